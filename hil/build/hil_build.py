@@ -7,20 +7,35 @@ Single-entry build script for the first HIL diagnostic run.
 This script:
 - constructs a bounded run context,
 - loads an explicit self-corpus,
-- executes the epistemic core pipeline,
-- writes diagnostic artifacts to disk,
+- executes the epistemic core pipeline (field, structure and diagnostics
+  stages, each served from the content-addressed stage cache when its
+  inputs, config and native kernels are unchanged),
+- writes diagnostic artifacts to disk (JSON summaries plus a binary
+  memory-mappable field/graph artifact),
 - and optionally serves a local-only static HTML view.
 
+With --batch, several corpus directories are built in one process through
+a bounded-queue stage pipeline (hil.build.pipeline): corpus N+1 loads while
+corpus N embeds and corpus N-1 is in structure or diagnostics. Every run
+directory holds the same artifacts a single build of that corpus writes;
+stage occupancy and queue depths go to the batch's BATCH_MANIFEST.json.
+
+With --ann-index, each run also writes an HNSW index over its field rows
+(hil.core.ann, FIELD_ANN.hilx) so later additions to the corpus can update
+the kNN structure without a full rebuild.
+
 Invariants:
 - Diagnostic only (no labels, no thresholds, no decisions)
 - Deterministic given fixed inputs
 - Local-only (no federation, no external hosting)
-- No persistence beyond artifact writing
+- No persistence beyond artifact writing (the stage cache holds only
+  outputs reproducible from their key; --no-cache bypasses it)
 - No mutation of source materials
 """
 
 from __future__ import annotations
 
+import argparse
 import json
 import hashlib
 import os
@@ -28,27 +43,50 @@ import sys
 import time
 import platform
 import subprocess
+from dataclasses import dataclass, field as dc_field
 from pathlib import Path
-from typing import List, Dict, Any
+from typing import List, Dict, Any, Optional
 
 # --- Core imports (epistemic kernel) -----------------------------------------
 from hil.core.api import (
+    CoreField,
     build_embedding,
     build_field,
     build_structure,
     compute_diagnostics,
 )
+from hil.core.structure.graph import Graph
+from hil.build.pipeline import Stage, run_pipeline
+from hil.build.stage_cache import CACHE_RECORD_NAME, StageCache, native_fingerprint, stage_key
+from hil.io.artifact import ARTIFACT_NAME, write_artifact
+from hil.io.ann_index import ANN_INDEX_NAME, write_ann_index
+from hil.core.ann import ANNIndex
+from hil.observe.state_writer import STATS_NAME, reset_native_stats, write_native_stats
 
 # --- Configuration (explicit, human-readable) --------------------------------
 
 EMBEDDING_CONFIG = {
     "method": "lsa",
     "dimensions": 300,
+    # Term counting: "sklearn" CountVectorizer or "hil" native lexicon
+    "vectorizer": "sklearn",
+    # Randomized truncated SVD; "range_finder" for very large vocabularies
+    "algorithm": "sklearn",
+    "oversamples": 10,
+    "power_iterations": 5,
+    "seed": 0,
+    # Field storage: "float32" halves memory traffic (float64 accumulation)
+    "dtype": "float64",
 }
 
 STRUCTURE_CONFIG = {
-    "method": "temporary_scaffold",
-    "notes": "fully connected or trivial structure for sanity run",
+    # "complete": all pairs i < j (n(n-1)/2 edges)
+    # "knn":       top-k neighbours per element (n*k edges)
+    # "threshold": neighbours with weight >= min_weight
+    "method": "complete",
+    "k": None,
+    "min_weight": None,
+    "notes": "fully connected structure for sanity run",
 }
 
 METRICS_CONFIG = {
@@ -57,6 +95,13 @@ METRICS_CONFIG = {
     "stability": None,
 }
 
+# Written only with --ann-index; not a stage input (no stage key depends on it)
+ANN_CONFIG = {
+    "m": 16,
+    "ef_construction": 200,
+    "seed": 0,
+}
+
 # --- Helpers -----------------------------------------------------------------
 
 def utc_timestamp() -> str:
@@ -84,30 +129,53 @@ def git_commit_hash() -> str | None:
 
 # --- Corpus loading ----------------------------------------------------------
 
-def load_self_corpus(repo_root: Path) -> List[str]:
+SELF_CORPUS_FILES = ["README.md", "CHARTER.md", "ROADMAP.md", "NON_CLAIMS.md"]
+
+# Files a corpus directory contributes in --batch mode.
+CORPUS_SUFFIXES = (".md", ".txt")
+
+
+@dataclass(frozen=True)
+class Corpus:
     """
-    Load a bounded, explicit self-corpus.
+    An explicit, bounded corpus: declared files relative to a root.
 
-    This is not crawling. It is a mirror of selected, declared files.
+    This is not crawling. Missing files are skipped, as for the self-corpus.
     """
-    targets = [
-        repo_root / "README.md",
-        repo_root / "CHARTER.md",
-        repo_root / "ROADMAP.md",
-        repo_root / "NON_CLAIMS.md",
-    ]
+    name: str
+    root: Path
+    files: List[str]
+    corpus_type: str = "self"
+
 
+def self_corpus(repo_root: Path) -> Corpus:
+    return Corpus(name="self", root=repo_root, files=list(SELF_CORPUS_FILES))
+
+
+def directory_corpus(path: Path) -> Corpus:
+    """Every CORPUS_SUFFIXES file under path, in sorted relative-path order."""
+    root = path.resolve()
+    files = sorted(
+        p.relative_to(root).as_posix()
+        for p in root.rglob("*")
+        if p.is_file() and p.suffix.lower() in CORPUS_SUFFIXES
+    )
+    return Corpus(name=root.name, root=root, files=files, corpus_type="directory")
+
+
+def load_corpus(corpus: Corpus) -> List[str]:
     documents: List[str] = []
-    for p in targets:
+    for rel in corpus.files:
+        p = corpus.root / rel
         if p.exists():
             documents.append(p.read_text(encoding="utf-8"))
     return documents
 
 
-def build_input_manifest(repo_root: Path) -> Dict[str, Any]:
+def corpus_manifest(corpus: Corpus) -> Dict[str, Any]:
     files = []
-    for rel in ["README.md", "CHARTER.md", "ROADMAP.md", "NON_CLAIMS.md"]:
-        p = repo_root / rel
+    for rel in corpus.files:
+        p = corpus.root / rel
         if p.exists():
             files.append(
                 {
@@ -117,11 +185,24 @@ def build_input_manifest(repo_root: Path) -> Dict[str, Any]:
             )
 
     return {
-        "corpus_type": "self",
+        "corpus_type": corpus.corpus_type,
         "files": files,
     }
 
 
+def load_self_corpus(repo_root: Path) -> List[str]:
+    """
+    Load a bounded, explicit self-corpus.
+
+    This is not crawling. It is a mirror of selected, declared files.
+    """
+    return load_corpus(self_corpus(repo_root))
+
+
+def build_input_manifest(repo_root: Path) -> Dict[str, Any]:
+    return corpus_manifest(self_corpus(repo_root))
+
+
 # --- Artifact writers --------------------------------------------------------
 
 def write_json(path: Path, obj: Dict[str, Any]) -> None:
@@ -129,39 +210,139 @@ def write_json(path: Path, obj: Dict[str, Any]) -> None:
         json.dump(obj, f, indent=2, sort_keys=True)
 
 
-# --- Main build --------------------------------------------------------------
+# --- Core stages -------------------------------------------------------------
+#
+# Each stage loads its output from the stage cache when one is given and the
+# key matches, and otherwise computes and stores it. Keys chain: the field key
+# covers the input manifest and EMBEDDING_CONFIG, the structure key the field
+# key and STRUCTURE_CONFIG, the diagnostics key the structure key and
+# METRICS_CONFIG; every key also covers the native kernel fingerprint.
 
-def main() -> None:
-    repo_root = Path(__file__).resolve().parents[2]
+def cached_field(cache: Optional[StageCache], key: str) -> Optional[CoreField]:
+    if cache is None:
+        return None
+    vectors = cache.load_field("field", key, dtype=EMBEDDING_CONFIG["dtype"])
+    return None if vectors is None else CoreField(vectors=vectors)
 
-    run_id = time.strftime("run_%Y%m%d_%H%M%S", time.gmtime())
-    run_root = repo_root / "artifacts" / "runs" / run_id
 
-    html_dir = run_root / "html"
-    static_dir = run_root / "static"
+def embed_documents(
+    documents: List[str],
+    cache: Optional[StageCache],
+    key: str,
+) -> CoreField:
+    dtype = EMBEDDING_CONFIG["dtype"]
+    embedding = build_embedding(
+        documents,
+        n_components=EMBEDDING_CONFIG["dimensions"],
+        vectorizer=EMBEDDING_CONFIG["vectorizer"],
+        algorithm=EMBEDDING_CONFIG["algorithm"],
+        oversamples=EMBEDDING_CONFIG["oversamples"],
+        power_iterations=EMBEDDING_CONFIG["power_iterations"],
+        seed=EMBEDDING_CONFIG["seed"],
+    )
+    field = build_field(embedding, dtype=dtype)
+    if cache is not None:
+        cache.store_field("field", key, field.vectors)
+    return field
+
+
+def stage_field(corpus: Corpus, cache: Optional[StageCache], key: str) -> CoreField:
+    field = cached_field(cache, key)
+    if field is not None:
+        return field
+    return embed_documents(load_corpus(corpus), cache, key)
+
+
+def stage_structure(field: CoreField, cache: Optional[StageCache], key: str) -> Graph:
+    if cache is not None:
+        graph = cache.load_graph("structure", key, dtype=field.vectors.dtype)
+        if graph is not None:
+            return graph
+
+    graph = build_structure(
+        field,
+        method=STRUCTURE_CONFIG["method"],
+        k=STRUCTURE_CONFIG["k"],
+        min_weight=STRUCTURE_CONFIG["min_weight"],
+    )
+    if cache is not None:
+        cache.store_graph("structure", key, graph)
+    return graph
+
+
+def stage_diagnostics(
+    field: CoreField,
+    graph: Graph,
+    cache: Optional[StageCache],
+    key: str,
+) -> Dict[str, Any]:
+    if cache is not None:
+        diagnostics = cache.load_json("diagnostics", key)
+        if diagnostics is not None:
+            return diagnostics
 
+    diagnostics = compute_diagnostics(field, graph)
+    if cache is not None:
+        cache.store_json("diagnostics", key, diagnostics)
+    return diagnostics
+
+
+# --- Runs ------------------------------------------------------------------
+#
+# One build of one corpus, split into the stages the batch pipeline overlaps:
+# open (directories, manifests, stage keys, corpus read) -> embed ->
+# structure -> diagnostics -> write. A single build runs them in order.
+
+@dataclass
+class BuildRun:
+    """Mutable state of one corpus build as it moves through the stages."""
+    corpus: Corpus
+    run_root: Path
+    cache: Optional[StageCache]
+    native: Optional[str]
+    native_stats_path: str = STATS_NAME
+    ann_index: bool = False
+    input_manifest: Dict[str, Any] = dc_field(default_factory=dict)
+    keys: Dict[str, str] = dc_field(default_factory=dict)
+    documents: Optional[List[str]] = None
+    field: Optional[CoreField] = None
+    graph: Optional[Graph] = None
+    diagnostics: Optional[Dict[str, Any]] = None
+    core_seconds: float = 0.0
+
+    @property
+    def run_id(self) -> str:
+        return self.run_root.name
+
+
+def open_run(run: BuildRun) -> BuildRun:
+    """
+    Create the run directory, write RUN_METADATA / INPUT_MANIFEST /
+    CONFIG_SNAPSHOT, derive stage keys, and read the corpus unless the
+    field stage is cached.
+    """
     # Create directories
-    html_dir.mkdir(parents=True, exist_ok=False)
-    static_dir.mkdir(parents=True, exist_ok=False)
+    (run.run_root / "html").mkdir(parents=True, exist_ok=False)
+    (run.run_root / "static").mkdir(parents=True, exist_ok=False)
 
     # ------------------------------------------------------------------
     # RUN_METADATA.json
     # ------------------------------------------------------------------
     run_metadata = {
-        "run_id": run_id,
+        "run_id": run.run_id,
         "timestamp_utc": utc_timestamp(),
         "hil_version": "sanity-kernel",
         "git_commit": git_commit_hash(),
         "python_version": sys.version.split()[0],
         "platform": platform.platform(),
     }
-    write_json(run_root / "RUN_METADATA.json", run_metadata)
+    write_json(run.run_root / "RUN_METADATA.json", run_metadata)
 
     # ------------------------------------------------------------------
     # INPUT_MANIFEST.json
     # ------------------------------------------------------------------
-    input_manifest = build_input_manifest(repo_root)
-    write_json(run_root / "INPUT_MANIFEST.json", input_manifest)
+    run.input_manifest = corpus_manifest(run.corpus)
+    write_json(run.run_root / "INPUT_MANIFEST.json", run.input_manifest)
 
     # ------------------------------------------------------------------
     # CONFIG_SNAPSHOT.json
@@ -170,26 +351,81 @@ def main() -> None:
         "embedding": EMBEDDING_CONFIG,
         "structure": STRUCTURE_CONFIG,
         "metrics": METRICS_CONFIG,
+        "ann_index": ANN_CONFIG if run.ann_index else None,
     }
-    write_json(run_root / "CONFIG_SNAPSHOT.json", config_snapshot)
+    write_json(run.run_root / "CONFIG_SNAPSHOT.json", config_snapshot)
+
+    field_key = stage_key(
+        "field", config=EMBEDDING_CONFIG, inputs=run.input_manifest, native=run.native
+    )
+    structure_key = stage_key(
+        "structure", config=STRUCTURE_CONFIG, upstream=field_key, native=run.native
+    )
+    diagnostics_key = stage_key(
+        "diagnostics", config=METRICS_CONFIG, upstream=structure_key, native=run.native
+    )
+    run.keys = {"field": field_key, "structure": structure_key, "diagnostics": diagnostics_key}
+
+    t0 = time.perf_counter()
+    run.field = cached_field(run.cache, field_key)
+    if run.field is None:
+        run.documents = load_corpus(run.corpus)
+    run.core_seconds += time.perf_counter() - t0
+    return run
+
+
+def embed_run(run: BuildRun) -> BuildRun:
+    t0 = time.perf_counter()
+    if run.field is None:
+        run.field = embed_documents(run.documents or [], run.cache, run.keys["field"])
+    run.documents = None
+    run.core_seconds += time.perf_counter() - t0
+    return run
+
+
+def structure_run(run: BuildRun) -> BuildRun:
+    t0 = time.perf_counter()
+    run.graph = stage_structure(run.field, run.cache, run.keys["structure"])
+    run.core_seconds += time.perf_counter() - t0
+    return run
+
+
+def diagnostics_run(run: BuildRun) -> BuildRun:
+    t0 = time.perf_counter()
+    run.diagnostics = stage_diagnostics(run.field, run.graph, run.cache, run.keys["diagnostics"])
+    run.core_seconds += time.perf_counter() - t0
+    return run
+
+
+def write_run(run: BuildRun, *, native_stats: bool = True) -> BuildRun:
+    """
+    Write every remaining artifact. native_stats=False leaves NATIVE_STATS.json
+    to the caller (a batch records the process-wide counters once).
+    """
+    run_root, cache, field, graph = run.run_root, run.cache, run.field, run.graph
+    html_dir = run_root / "html"
+    static_dir = run_root / "static"
 
     # ------------------------------------------------------------------
-    # Load corpus and run epistemic core
+    # STAGE_CACHE.json (stage keys and hits; procedural only)
     # ------------------------------------------------------------------
-    documents = load_self_corpus(repo_root)
-
-    embedding = build_embedding(
-        documents,
-        n_components=EMBEDDING_CONFIG["dimensions"],
-    )
-    field = build_field(embedding)
-    graph = build_structure(field)
-    diagnostics = compute_diagnostics(field, graph)
+    write_json(run_root / CACHE_RECORD_NAME, {
+        "enabled": cache is not None,
+        "root": str(cache.root) if cache is not None else None,
+        "native_fingerprint": run.native,
+        "stages": cache.record if cache is not None else {},
+    })
 
     # ------------------------------------------------------------------
     # METRICS.json
     # ------------------------------------------------------------------
-    write_json(run_root / "METRICS.json", diagnostics)
+    write_json(run_root / "METRICS.json", run.diagnostics)
+
+    # ------------------------------------------------------------------
+    # NATIVE_STATS.json (native kernel counters; empty without HIL_STATS)
+    # ------------------------------------------------------------------
+    if native_stats:
+        write_native_stats(run_root, wall_seconds=run.core_seconds)
 
     # ------------------------------------------------------------------
     # FIELD_SUMMARY.json
@@ -215,15 +451,30 @@ def main() -> None:
     }
     write_json(run_root / "GRAPH_SUMMARY.json", graph_summary)
 
+    # ------------------------------------------------------------------
+    # FIELD_GRAPH.hila (binary, memory-mappable field + graph)
+    # ------------------------------------------------------------------
+    write_artifact(run_root / ARTIFACT_NAME, vectors=field.vectors, graph=graph)
+
+    # ------------------------------------------------------------------
+    # FIELD_ANN.hilx (optional HNSW index over the field rows)
+    # ------------------------------------------------------------------
+    if run.ann_index:
+        write_ann_index(run_root / ANN_INDEX_NAME, ANNIndex.build(field.vectors, **ANN_CONFIG))
+
     # ------------------------------------------------------------------
     # ARTIFACT_INDEX.json
     # ------------------------------------------------------------------
     artifact_index = {
-        "run_id": run_id,
+        "run_id": run.run_id,
         "artifacts": {
             "metrics": "METRICS.json",
+            "native_stats": run.native_stats_path,
+            "stage_cache": CACHE_RECORD_NAME,
             "field": "FIELD_SUMMARY.json",
             "graph": "GRAPH_SUMMARY.json",
+            "binary": ARTIFACT_NAME,
+            "ann_index": ANN_INDEX_NAME if run.ann_index else None,
             "html": "html/index.html",
         },
     }
@@ -251,6 +502,191 @@ def main() -> None:
         encoding="utf-8",
     )
 
+    # Release the stage outputs; only the artifacts on disk remain.
+    run.field = run.graph = run.diagnostics = None
+    return run
+
+
+# --- Batch build -------------------------------------------------------------
+
+BATCH_MANIFEST_NAME = "BATCH_MANIFEST.json"
+
+
+def _safe_name(name: str) -> str:
+    return "".join(c if c.isalnum() or c in "-_" else "-" for c in name) or "corpus"
+
+
+def run_batch(
+    corpora: List[Corpus],
+    batch_root: Path,
+    *,
+    cache_root: Optional[Path],
+    queue_depth: int = 2,
+    sequential: bool = False,
+    ann_index: bool = False,
+) -> Dict[str, Any]:
+    """
+    Build every corpus through the stage pipeline, one run directory each
+    (batch_root/run_<index>_<name>), and write BATCH_MANIFEST.json.
+
+    A corpus whose build fails is recorded with the failing stage; the
+    others still complete. Returns the manifest.
+    """
+    batch_root.mkdir(parents=True, exist_ok=False)
+    native = native_fingerprint()
+
+    runs = [
+        BuildRun(
+            corpus=corpus,
+            run_root=batch_root / f"run_{i:03d}_{_safe_name(corpus.name)}",
+            # One cache object per run keeps each STAGE_CACHE.json record local.
+            cache=None if cache_root is None else StageCache(cache_root),
+            native=native,
+            native_stats_path=f"../{STATS_NAME}",
+            ann_index=ann_index,
+        )
+        for i, corpus in enumerate(corpora)
+    ]
+    stages = [
+        Stage("open", open_run),
+        Stage("embed", embed_run),
+        Stage("structure", structure_run),
+        Stage("diagnostics", diagnostics_run),
+        Stage("write", lambda run: write_run(run, native_stats=False)),
+    ]
+
+    reset_native_stats()
+    result = run_pipeline(runs, stages, queue_depth=queue_depth, sequential=sequential)
+    write_native_stats(batch_root, wall_seconds=result.stats.wall_seconds)
+
+    manifest = {
+        "batch_id": batch_root.name,
+        "timestamp_utc": utc_timestamp(),
+        "native_stats": STATS_NAME,
+        "runs": [
+            {
+                "corpus": run.corpus.name,
+                "corpus_root": str(run.corpus.root),
+                "run_directory": run.run_root.name,
+                "success": i not in result.errors,
+                "failed_stage": result.errors[i][0] if i in result.errors else None,
+                "error": result.errors[i][1] if i in result.errors else None,
+            }
+            for i, run in enumerate(runs)
+        ],
+        "pipeline": result.stats.to_dict(),
+    }
+    write_json(batch_root / BATCH_MANIFEST_NAME, manifest)
+    return manifest
+
+
+# --- Main build --------------------------------------------------------------
+
+def parse_args(argv: Optional[List[str]] = None) -> argparse.Namespace:
+    parser = argparse.ArgumentParser(prog="hil_build", description="Single HIL diagnostic run.")
+    parser.add_argument(
+        "--run-dir",
+        type=Path,
+        default=None,
+        help="write artifacts here (must not exist); default artifacts/runs/run_<UTC time>",
+    )
+    parser.add_argument(
+        "--cache-dir",
+        type=Path,
+        default=None,
+        help="stage cache root; default artifacts/cache",
+    )
+    parser.add_argument(
+        "--no-cache",
+        action="store_true",
+        help="recompute every stage and leave the stage cache untouched",
+    )
+    parser.add_argument(
+        "--batch",
+        type=Path,
+        nargs="+",
+        default=None,
+        metavar="CORPUS_DIR",
+        help="build each directory's .md/.txt files as one corpus, pipelined across stages",
+    )
+    parser.add_argument(
+        "--batch-dir",
+        type=Path,
+        default=None,
+        help="batch output directory (must not exist); default artifacts/runs/batch_<UTC time>",
+    )
+    parser.add_argument(
+        "--queue-depth",
+        type=int,
+        default=2,
+        help="corpora allowed to wait between two batch stages; default 2",
+    )
+    parser.add_argument(
+        "--sequential",
+        action="store_true",
+        help="run batch corpora one at a time through every stage (reference schedule)",
+    )
+    parser.add_argument(
+        "--ann-index",
+        action="store_true",
+        help=f"also write an HNSW index over the field rows ({ANN_INDEX_NAME}) per run",
+    )
+    args = parser.parse_args(argv)
+    if args.batch is not None and args.run_dir is not None:
+        parser.error("--run-dir applies to single builds; use --batch-dir with --batch")
+    if args.queue_depth < 1:
+        parser.error("--queue-depth must be >= 1")
+    return args
+
+
+def main(argv: Optional[List[str]] = None) -> None:
+    args = parse_args(argv)
+    repo_root = Path(__file__).resolve().parents[2]
+
+    cache_root = None if args.no_cache else (args.cache_dir or repo_root / "artifacts" / "cache")
+
+    if args.batch is not None:
+        if args.batch_dir is not None:
+            batch_root = args.batch_dir.resolve()
+        else:
+            batch_id = time.strftime("batch_%Y%m%d_%H%M%S", time.gmtime())
+            batch_root = repo_root / "artifacts" / "runs" / batch_id
+        manifest = run_batch(
+            [directory_corpus(p) for p in args.batch],
+            batch_root,
+            cache_root=cache_root,
+            queue_depth=args.queue_depth,
+            sequential=args.sequential,
+            ann_index=args.ann_index,
+        )
+        failed = [r["corpus"] for r in manifest["runs"] if not r["success"]]
+        print(f"[HIL BUILD COMPLETE] Batch written to: {batch_root}")
+        if failed:
+            raise SystemExit(f"[HIL BUILD] {len(failed)} corpus build(s) failed: {failed}")
+        return
+
+    if args.run_dir is not None:
+        # Explicit output directory (e.g. one per orchestrator plan step).
+        run_root = args.run_dir.resolve()
+    else:
+        run_id = time.strftime("run_%Y%m%d_%H%M%S", time.gmtime())
+        run_root = repo_root / "artifacts" / "runs" / run_id
+
+    # ------------------------------------------------------------------
+    # Load corpus and run epistemic core (through the stage cache)
+    # ------------------------------------------------------------------
+    run = BuildRun(
+        corpus=self_corpus(repo_root),
+        run_root=run_root,
+        cache=None if cache_root is None else StageCache(cache_root),
+        native=native_fingerprint(),
+        ann_index=args.ann_index,
+    )
+
+    reset_native_stats()
+    for step in (open_run, embed_run, structure_run, diagnostics_run, write_run):
+        step(run)
+
     print(f"[HIL BUILD COMPLETE] Artifacts written to: {run_root}")
 
 
@@ -0,0 +1,307 @@
+# hil/build/pipeline.py
+"""
+hil.build.pipeline
+
+Bounded-queue stage pipeline for batch builds.
+
+This module defines:
+- Stage: one named step of a per-item pipeline (a function of the previous
+  stage's output) and its worker count
+- run_pipeline: push items through the stages, each stage on its own
+  worker threads, connected by bounded FIFO queues, so item N+1 can be in
+  one stage while item N is in the next
+- PipelineStats: per-stage occupancy and queue depth
+
+This module does NOT:
+- know what the stages compute (hil_build defines them)
+- retry, reorder or drop items
+- interpret results
+
+Determinism: every item passes through the same stage functions in the
+same order as a sequential run, and outputs are returned in input order,
+so per-item results are those of the sequential run whenever the stage
+functions are deterministic and independent across items. Only timing
+(and hence PipelineStats) varies between runs.
+
+Overlap comes from stages that release the GIL (file I/O, NumPy, native
+kernels); pure-Python stages still run one at a time. queue_depth bounds
+the items waiting between two stages, so at most
+sum(workers) + queue_depth * (len(stages) - 1) items are in flight.
+
+A failing stage records its error for that item, which then skips the
+remaining stages; other items continue.
+"""
+
+from __future__ import annotations
+
+import queue
+import threading
+import time
+from dataclasses import dataclass, field
+from typing import Any, Callable, Dict, List, Optional, Sequence, Tuple
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _pipeline_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.build.pipeline invariant] {message}")
+
+
+# ---------------------------------------------------------------------------
+# Types
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class Stage:
+    """
+    One pipeline stage: fn maps the previous stage's output (or the input
+    item, for the first stage) to this stage's output.
+    """
+    name: str
+    fn: Callable[[Any], Any]
+    workers: int = 1
+
+
+@dataclass
+class StageStats:
+    """
+    Timing of one stage over a pipeline run.
+
+    - busy_seconds: time inside fn, summed over workers
+    - wait_seconds: time workers spent waiting for input
+    - blocked_seconds: time workers spent waiting for room downstream
+    - queue depth: items waiting in this stage's input queue, sampled each
+      time one is added
+    """
+    name: str
+    workers: int
+    items: int = 0
+    busy_seconds: float = 0.0
+    wait_seconds: float = 0.0
+    blocked_seconds: float = 0.0
+    queue_depth_max: int = 0
+    queue_depth_total: int = 0
+    queue_samples: int = 0
+
+    def occupancy(self, wall_seconds: float) -> float:
+        """Fraction of the run this stage's workers spent inside fn."""
+        if wall_seconds <= 0.0:
+            return 0.0
+        return min(1.0, self.busy_seconds / (wall_seconds * self.workers))
+
+    def to_dict(self, wall_seconds: float) -> Dict[str, Any]:
+        return {
+            "name": self.name,
+            "workers": self.workers,
+            "items": self.items,
+            "busy_seconds": self.busy_seconds,
+            "wait_seconds": self.wait_seconds,
+            "blocked_seconds": self.blocked_seconds,
+            "occupancy": self.occupancy(wall_seconds),
+            "queue_depth_max": self.queue_depth_max,
+            "queue_depth_mean": (
+                self.queue_depth_total / self.queue_samples if self.queue_samples else 0.0
+            ),
+        }
+
+
+@dataclass
+class PipelineStats:
+    """Procedural record of one pipeline run (JSON-safe via to_dict)."""
+    mode: str
+    queue_depth: int
+    items: int
+    wall_seconds: float = 0.0
+    stages: List[StageStats] = field(default_factory=list)
+
+    def to_dict(self) -> Dict[str, Any]:
+        return {
+            "mode": self.mode,
+            "queue_depth": self.queue_depth,
+            "items": self.items,
+            "wall_seconds": self.wall_seconds,
+            "stage_seconds_total": sum(s.busy_seconds for s in self.stages),
+            "stages": [s.to_dict(self.wall_seconds) for s in self.stages],
+        }
+
+
+@dataclass(frozen=True)
+class PipelineResult:
+    """
+    outputs[i] is the last stage's output for items[i], or None if a stage
+    failed for it; errors maps such indices to (stage name, message).
+    """
+    outputs: List[Any]
+    errors: Dict[int, Tuple[str, str]]
+    stats: PipelineStats
+
+
+# ---------------------------------------------------------------------------
+# Execution
+# ---------------------------------------------------------------------------
+
+_END = object()
+
+
+def _apply(stage: Stage, payload: Any) -> Tuple[Any, Optional[str]]:
+    try:
+        return stage.fn(payload), None
+    except Exception as e:  # recorded per item, never raised
+        return None, f"{type(e).__name__}: {e}"
+
+
+def _run_sequential(
+    items: Sequence[Any],
+    stages: Sequence[Stage],
+    stats: PipelineStats,
+) -> Tuple[List[Any], Dict[int, Tuple[str, str]]]:
+    outputs: List[Any] = [None] * len(items)
+    errors: Dict[int, Tuple[str, str]] = {}
+    for i, item in enumerate(items):
+        payload = item
+        for stage, st in zip(stages, stats.stages):
+            t0 = time.perf_counter()
+            payload, error = _apply(stage, payload)
+            st.busy_seconds += time.perf_counter() - t0
+            st.items += 1
+            if error is not None:
+                errors[i] = (stage.name, error)
+                break
+        else:
+            outputs[i] = payload
+    return outputs, errors
+
+
+def _run_pipelined(
+    items: Sequence[Any],
+    stages: Sequence[Stage],
+    stats: PipelineStats,
+    queue_depth: int,
+) -> Tuple[List[Any], Dict[int, Tuple[str, str]]]:
+    outputs: List[Any] = [None] * len(items)
+    errors: Dict[int, Tuple[str, str]] = {}
+    lock = threading.Lock()
+
+    queues = [queue.Queue(maxsize=queue_depth) for _ in stages]
+    remaining = [stage.workers for stage in stages]
+
+    def _put(s: int, msg: Any) -> float:
+        """Put msg on stage s's input queue; return seconds blocked."""
+        t0 = time.perf_counter()
+        queues[s].put(msg)
+        blocked = time.perf_counter() - t0
+        if msg is not _END:
+            depth = queues[s].qsize()
+            with lock:
+                st = stats.stages[s]
+                st.queue_depth_max = max(st.queue_depth_max, depth)
+                st.queue_depth_total += depth
+                st.queue_samples += 1
+        return blocked
+
+    def _worker(s: int) -> None:
+        stage, st = stages[s], stats.stages[s]
+        last = s == len(stages) - 1
+        busy = wait = blocked = 0.0
+        count = 0
+        while True:
+            t0 = time.perf_counter()
+            msg = queues[s].get()
+            wait += time.perf_counter() - t0
+            if msg is _END:
+                break
+
+            i, payload, failed = msg
+            if not failed:
+                t0 = time.perf_counter()
+                payload, error = _apply(stage, payload)
+                busy += time.perf_counter() - t0
+                count += 1
+                if error is not None:
+                    with lock:
+                        errors[i] = (stage.name, error)
+                    failed = True
+
+            if last:
+                if not failed:
+                    outputs[i] = payload
+            else:
+                blocked += _put(s + 1, (i, payload, failed))
+
+        with lock:
+            st.busy_seconds += busy
+            st.wait_seconds += wait
+            st.blocked_seconds += blocked
+            st.items += count
+            remaining[s] -= 1
+            done = remaining[s] == 0
+        # The last worker out closes the next stage.
+        if done and not last:
+            for _ in range(stages[s + 1].workers):
+                _put(s + 1, _END)
+
+    threads = [
+        threading.Thread(target=_worker, args=(s,), name=f"hil-pipe-{stage.name}-{w}", daemon=True)
+        for s, stage in enumerate(stages)
+        for w in range(stage.workers)
+    ]
+    for t in threads:
+        t.start()
+
+    for i, item in enumerate(items):
+        _put(0, (i, item, False))
+    for _ in range(stages[0].workers):
+        _put(0, _END)
+
+    for t in threads:
+        t.join()
+    return outputs, errors
+
+
+def run_pipeline(
+    items: Sequence[Any],
+    stages: Sequence[Stage],
+    *,
+    queue_depth: int = 2,
+    sequential: bool = False,
+) -> PipelineResult:
+    """
+    Run every item through stages in order.
+
+    sequential runs each item through all stages in the calling thread
+    before starting the next (the reference schedule, with the same stats);
+    otherwise stages run concurrently on their own threads.
+    """
+    _pipeline_invariant(len(stages) >= 1, "at least one stage is required")
+    _pipeline_invariant(queue_depth >= 1, "queue_depth must be >= 1")
+    names = [s.name for s in stages]
+    _pipeline_invariant(len(set(names)) == len(names), "stage names must be unique")
+    _pipeline_invariant(all(s.workers >= 1 for s in stages), "stage workers must be >= 1")
+
+    stats = PipelineStats(
+        mode="sequential" if sequential else "pipelined",
+        queue_depth=queue_depth,
+        items=len(items),
+        stages=[StageStats(name=s.name, workers=1 if sequential else s.workers) for s in stages],
+    )
+
+    t0 = time.perf_counter()
+    if sequential:
+        outputs, errors = _run_sequential(items, stages, stats)
+    else:
+        outputs, errors = _run_pipelined(items, stages, stats, queue_depth)
+    stats.wall_seconds = time.perf_counter() - t0
+
+    return PipelineResult(outputs=outputs, errors=dict(sorted(errors.items())), stats=stats)
+
+
+__all__ = [
+    "Stage",
+    "StageStats",
+    "PipelineStats",
+    "PipelineResult",
+    "run_pipeline",
+]
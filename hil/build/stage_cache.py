@@ -0,0 +1,238 @@
+# hil/build/stage_cache.py
+"""
+hil.build.stage_cache
+
+Content-addressed cache of hil_build stage outputs.
+
+This module defines:
+- how a stage key is derived (sha256 over inputs, config, upstream key,
+  the hil package sources and native kernel fingerprint)
+- how field / graph stage outputs are stored (binary artifact format,
+  mapped back read-only on a hit) and how JSON stage outputs are stored
+
+This module does NOT:
+- decide which stages run (hil_build does)
+- compute or interpret diagnostics
+- evict entries (deleting the cache directory is always safe)
+
+Layout:
+
+    <root>/<stage>/<key>.hila   field or graph (hil.io.artifact)
+    <root>/<stage>/<key>.json   JSON-safe stage output
+
+Entries are written to a temporary file and renamed into place, so
+concurrent builds (parallel orchestrator steps, or pipelined batch runs in
+one process) never observe a partial entry. A key changes whenever any
+input, config value, upstream stage, hil source file or the native
+extension changes; entries are never updated in place. CACHE_SCHEMA is
+for layout changes the sources alone cannot signal (e.g. a dependency
+upgrade that changes results).
+"""
+
+from __future__ import annotations
+
+import hashlib
+import json
+import os
+import threading
+from functools import lru_cache
+from pathlib import Path
+from typing import Any, Dict, Optional, Union
+
+import numpy as np
+
+from hil.core.structure.graph import CSRGraph, Graph
+from hil.io.artifact import open_artifact, write_artifact
+
+# Bump when the meaning or layout of cached outputs changes without any
+# hil source change (source edits already change every key).
+CACHE_SCHEMA = 1
+
+# Package root whose Python sources are folded into every key.
+_PACKAGE_ROOT = Path(__file__).resolve().parents[1]
+
+CACHE_RECORD_NAME = "STAGE_CACHE.json"
+
+
+# ---------------------------------------------------------------------------
+# Keys
+# ---------------------------------------------------------------------------
+
+def native_fingerprint() -> Optional[str]:
+    """
+    Native extension fingerprint, or None when the extension (or NumPy) is
+    unavailable; results then key on the pure-Python backends.
+    """
+    try:
+        from hil.core.native._shim import native_fingerprint as _fingerprint
+    except ImportError:
+        return None
+    return _fingerprint()
+
+
+@lru_cache(maxsize=1)
+def code_fingerprint() -> str:
+    """
+    sha256 over the path and contents of every .py file in the hil package
+    (tests excluded), computed once per process. Any code change therefore
+    invalidates cached outputs without a CACHE_SCHEMA bump.
+    """
+    h = hashlib.sha256()
+    for path in sorted(_PACKAGE_ROOT.rglob("*.py")):
+        rel = path.relative_to(_PACKAGE_ROOT)
+        if rel.parts[0] == "tests":
+            continue
+        h.update(rel.as_posix().encode("utf-8") + b"\0")
+        h.update(path.read_bytes())
+        h.update(b"\0")
+    return h.hexdigest()
+
+
+def stage_key(
+    stage: str,
+    *,
+    config: Dict[str, Any],
+    inputs: Any = None,
+    upstream: Optional[str] = None,
+    native: Optional[str] = None,
+) -> str:
+    """
+    sha256 hex key of one stage: canonical JSON of the stage name, its
+    inputs, config, upstream stage key, code and native fingerprints.
+    """
+    payload = {
+        "schema": CACHE_SCHEMA,
+        "code": code_fingerprint(),
+        "stage": stage,
+        "inputs": inputs,
+        "config": config,
+        "upstream": upstream,
+        "native": native,
+    }
+    blob = json.dumps(payload, sort_keys=True, separators=(",", ":"), default=str)
+    return hashlib.sha256(blob.encode("utf-8")).hexdigest()
+
+
+# ---------------------------------------------------------------------------
+# Store
+# ---------------------------------------------------------------------------
+
+class StageCache:
+    """
+    On-disk stage cache rooted at `root`.
+
+    load_* return None on a miss (or an unreadable entry, which is treated
+    as a miss); store_* write the entry and return its path. Every lookup
+    is recorded in `record` (stage -> {"key", "hit"}).
+    """
+
+    def __init__(self, root: Union[str, Path]) -> None:
+        self.root = Path(root)
+        self.record: Dict[str, Dict[str, Any]] = {}
+
+    def _path(self, stage: str, key: str, suffix: str) -> Path:
+        return self.root / stage / f"{key}{suffix}"
+
+    def _note(self, stage: str, key: str, hit: bool) -> None:
+        self.record[stage] = {"key": key, "hit": hit}
+
+    def _publish(self, path: Path, write) -> Path:
+        path.parent.mkdir(parents=True, exist_ok=True)
+        # Unique per process and thread: pipelined builds share one process.
+        tmp = path.with_name(f".{path.name}.{os.getpid()}.{threading.get_ident()}.tmp")
+        try:
+            write(tmp)
+            os.replace(tmp, path)
+        finally:
+            if tmp.exists():
+                tmp.unlink()
+        return path
+
+    # ---- Field -------------------------------------------------------------
+
+    def load_field(self, stage: str, key: str, dtype: Any = np.float64) -> Optional[np.ndarray]:
+        """
+        Cached field vectors, mapped read-only (copied only when `dtype`
+        differs from the stored float64).
+        """
+        path = self._path(stage, key, ".hila")
+        vectors = None
+        if path.exists():
+            try:
+                vectors = open_artifact(path).coordinates
+            except (OSError, ValueError):
+                vectors = None
+        self._note(stage, key, vectors is not None)
+        if vectors is None:
+            return None
+        return vectors.astype(np.dtype(dtype), copy=False)
+
+    def store_field(self, stage: str, key: str, vectors: np.ndarray) -> Path:
+        return self._publish(
+            self._path(stage, key, ".hila"),
+            lambda tmp: write_artifact(tmp, vectors=vectors),
+        )
+
+    # ---- Graph -------------------------------------------------------------
+
+    def load_graph(self, stage: str, key: str, dtype: Any = np.float64) -> Optional[Graph]:
+        """
+        Cached edge-list graph. Stored in directed CSR form, which for the
+        row-grouped edge lists of build_structure expands back in the same
+        edge order.
+        """
+        path = self._path(stage, key, ".hila")
+        csr: Optional[CSRGraph] = None
+        if path.exists():
+            try:
+                csr = open_artifact(path).graph()
+            except (OSError, ValueError):
+                csr = None
+        self._note(stage, key, csr is not None)
+        if csr is None:
+            return None
+        graph = csr.to_graph()
+        if graph.weight.dtype != np.dtype(dtype):
+            graph = Graph(
+                src=graph.src,
+                dst=graph.dst,
+                weight=graph.weight.astype(np.dtype(dtype)),
+                num_nodes=graph.num_nodes,
+            )
+        return graph
+
+    def store_graph(self, stage: str, key: str, graph: Union[Graph, CSRGraph]) -> Path:
+        return self._publish(
+            self._path(stage, key, ".hila"),
+            lambda tmp: write_artifact(tmp, graph=graph),
+        )
+
+    # ---- JSON --------------------------------------------------------------
+
+    def load_json(self, stage: str, key: str) -> Optional[Dict[str, Any]]:
+        path = self._path(stage, key, ".json")
+        obj = None
+        if path.exists():
+            try:
+                with path.open("r", encoding="utf-8") as f:
+                    obj = json.load(f)
+            except (OSError, ValueError):
+                obj = None
+        self._note(stage, key, obj is not None)
+        return obj
+
+    def store_json(self, stage: str, key: str, obj: Dict[str, Any]) -> Path:
+        def _write(tmp: Path) -> None:
+            with tmp.open("w", encoding="utf-8") as f:
+                json.dump(obj, f, indent=2, sort_keys=True)
+
+        return self._publish(self._path(stage, key, ".json"), _write)
+
+
+__all__ = [
+    "CACHE_SCHEMA",
+    "CACHE_RECORD_NAME",
+    "StageCache",
+    "native_fingerprint",
+    "stage_key",
+]
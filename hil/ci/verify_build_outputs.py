@@ -18,6 +18,7 @@ REQUIRED_FILES = [
     "METRICS.json",
     "FIELD_SUMMARY.json",
     "GRAPH_SUMMARY.json",
+    "FIELD_GRAPH.hila",
     "ARTIFACT_INDEX.json",
 ]
 
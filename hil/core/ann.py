@@ -0,0 +1,367 @@
+# hil/core/ann.py
+"""
+hil.core.ann
+
+Approximate nearest-neighbour index and incrementally maintained kNN
+structure for growing fields.
+
+This module defines:
+- ANNIndex: a native HNSW index (hilbert_ann.h) over the normalized rows of
+  a field, answering approximate top-k cosine neighbour queries
+- IncrementalKNN: the directed kNN structure of build_structure_csr(field,
+  k=k, min_weight=min_weight), kept current as rows are appended, together
+  with per-node out-strength, in-degree and structural entropy
+
+Rows are normalized and weighted exactly as in build_structure_csr
+(w = (cos + 1) / 2, ties to the smaller index), so a neighbour the index
+finds carries the same weight, bit for bit. Only the neighbour *sets* are
+approximate: recall rises with ef (query) and ef_construction / m (build).
+
+Appending b rows costs O(b log n) index work plus one batched query,
+instead of the O(n^2 d) rebuild of build_structure_csr.
+
+Invariants:
+- Structural only (geometry; no labels)
+- Deterministic: the index depends only on the rows, their order and the
+  parameters; IncrementalKNN only on those and the sequence of add calls
+- No IO, no persistence (hil.io.ann_index writes and maps indexes)
+"""
+
+from __future__ import annotations
+
+from typing import Any, Dict, Optional, Tuple
+
+import numpy as np
+
+from hil.core.metrics.entropy import _entropy_from_out_strengths
+from hil.core.structure.graph import CSRGraph
+
+
+# Empty result slot in native query outputs.
+_NONE = np.uint32(0xFFFFFFFF)
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _ann_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.core.ann invariant] {message}")
+
+
+def _shim() -> Any:
+    # The index is native-only; importing lazily keeps this module importable
+    # (ImportError surfaces on first use) when the extension is not built.
+    from hil.core.native import _shim as shim  # noqa: WPS433
+    return shim
+
+
+def _rows(vectors: Any, dim: int) -> np.ndarray:
+    X = np.asarray(vectors)
+    if X.ndim == 1:
+        X = X.reshape(1, -1)
+    _ann_invariant(X.ndim == 2 and X.shape[1] == dim, f"rows must be (n, {dim})")
+    X = np.ascontiguousarray(X, dtype=np.float64)
+    _ann_invariant(bool(np.all(np.isfinite(X))), "rows must be finite")
+    return X
+
+
+def _signed(ids: np.ndarray) -> np.ndarray:
+    """Native uint32 ids as int64 with -1 for empty slots."""
+    out = ids.astype(np.int64)
+    out[ids == _NONE] = -1
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Index
+# ---------------------------------------------------------------------------
+
+class ANNIndex:
+    """
+    Native HNSW index over normalized rows; node ids are insertion order.
+
+    m links per node on upper layers (2m on layer 0); ef_construction
+    candidates while linking a row; seed fixes the level draws.
+    """
+
+    def __init__(
+        self,
+        dim: int,
+        *,
+        m: int = 16,
+        ef_construction: int = 200,
+        seed: int = 0,
+    ) -> None:
+        _ann_invariant(dim >= 1, "dim must be >= 1")
+        _ann_invariant(m >= 2, "m must be >= 2")
+        _ann_invariant(ef_construction >= 1, "ef_construction must be >= 1")
+        self._handle = _shim().ann_new(
+            int(dim), m=int(m), ef_construction=int(ef_construction), seed=int(seed)
+        )
+        self._dim = int(dim)
+
+    @classmethod
+    def build(cls, vectors: Any, **params: Any) -> "ANNIndex":
+        """Index every row of a (n, d) array."""
+        X = np.asarray(vectors)
+        _ann_invariant(X.ndim == 2, "vectors must be 2D (n, d)")
+        index = cls(int(X.shape[1]), **params)
+        index.add(X)
+        return index
+
+    @classmethod
+    def from_state(cls, state: Dict[str, Any]) -> "ANNIndex":
+        """Rebuild an index from to_state() output (arrays are copied)."""
+        index = cls.__new__(cls)
+        index._handle = _shim().ann_import(state, copy=True)
+        index._dim = int(state["dim"])
+        return index
+
+    def to_state(self) -> Dict[str, Any]:
+        """Parameters and flat arrays (see hil.core.native._shim.ann_export)."""
+        return _shim().ann_export(self._handle)
+
+    # ---- Properties --------------------------------------------------------
+
+    @property
+    def dim(self) -> int:
+        return self._dim
+
+    @property
+    def size(self) -> int:
+        return _shim().ann_info(self._handle)["size"]
+
+    def info(self) -> Dict[str, int]:
+        return _shim().ann_info(self._handle)
+
+    # ---- Mutation and queries ----------------------------------------------
+
+    def add(self, vectors: Any) -> np.ndarray:
+        """Append rows; returns their node ids."""
+        X = _rows(vectors, self._dim)
+        start = self.size
+        _shim().ann_add(self._handle, X)
+        return np.arange(start, start + X.shape[0], dtype=np.int64)
+
+    def query(self, queries: Any, k: int, *, ef: int = 64) -> Tuple[np.ndarray, np.ndarray]:
+        """
+        Approximate top-k neighbours of each query row, best first.
+
+        Returns (ids, weight), each (n_queries, k); ids is int64 with -1 in
+        slots past the neighbours found (weight 0 there).
+        """
+        _ann_invariant(k >= 1, "k must be >= 1")
+        ids, w = _shim().ann_query(self._handle, _rows(queries, self._dim), int(k), ef=int(ef))
+        return _signed(ids), w
+
+    def query_nodes(self, nodes: Any, k: int, *, ef: int = 64) -> Tuple[np.ndarray, np.ndarray]:
+        """As query, for stored nodes; a node is never its own neighbour."""
+        _ann_invariant(k >= 1, "k must be >= 1")
+        ids_in = np.asarray(nodes, dtype=np.int64).reshape(-1)
+        _ann_invariant(
+            ids_in.size == 0 or (ids_in.min() >= 0 and ids_in.max() < self.size),
+            "nodes out of range",
+        )
+        ids, w = _shim().ann_query_nodes(
+            self._handle, ids_in.astype(np.uint32), int(k), ef=int(ef)
+        )
+        return _signed(ids), w
+
+
+# ---------------------------------------------------------------------------
+# Incremental kNN structure
+# ---------------------------------------------------------------------------
+
+class IncrementalKNN:
+    """
+    Directed kNN rows over the nodes of an ANNIndex, updated as rows are
+    appended.
+
+    Row i holds up to k neighbours j != i with w >= min_weight, ranked by
+    weight (ties to the smaller j). When a row is added, its own row comes
+    from an index query, and each of its `candidates` nearest nodes whose
+    row the newcomer outranks takes it in place of that row's last entry.
+    A node whose true kNN row gains the newcomer is missed only if it lies
+    outside the newcomer's candidates, so with exact queries and
+    candidates >= n - 1 the rows equal build_structure_csr exactly.
+
+    Out-strength (row weight sums) and in-degree are updated per changed
+    entry; resync() recomputes both from the rows.
+    """
+
+    def __init__(
+        self,
+        index: ANNIndex,
+        k: int,
+        *,
+        min_weight: Optional[float] = None,
+        ef: int = 64,
+        candidates: Optional[int] = None,
+    ) -> None:
+        _ann_invariant(isinstance(index, ANNIndex), "index must be an ANNIndex")
+        _ann_invariant(k >= 1, "k must be >= 1")
+        _ann_invariant(
+            min_weight is None or 0.0 <= float(min_weight) <= 1.0,
+            "min_weight must lie in [0, 1]",
+        )
+        self._index = index
+        self._k = int(k)
+        self._min_weight = 0.0 if min_weight is None else float(min_weight)
+        self._candidates = max(self._k, 2 * self._k if candidates is None else int(candidates))
+        self._ef = max(int(ef), self._candidates)
+
+        self._n = 0
+        self._allocate(max(64, index.size))
+        if index.size:
+            self._extend(np.arange(index.size, dtype=np.int64))
+
+    # ---- Storage -----------------------------------------------------------
+
+    def _allocate(self, capacity: int) -> None:
+        self._ids = np.full((capacity, self._k), -1, dtype=np.int64)
+        self._w = np.zeros((capacity, self._k), dtype=np.float64)
+        self._count = np.zeros(capacity, dtype=np.int64)
+        self._strength = np.zeros(capacity, dtype=np.float64)
+        self._in_degree = np.zeros(capacity, dtype=np.int64)
+
+    def _grow(self, need: int) -> None:
+        cap = self._ids.shape[0]
+        if need <= cap:
+            return
+        while cap < need:
+            cap *= 2
+        old = (self._ids, self._w, self._count, self._strength, self._in_degree)
+        self._allocate(cap)
+        n = self._n
+        self._ids[:n], self._w[:n], self._count[:n] = old[0][:n], old[1][:n], old[2][:n]
+        self._strength[:n], self._in_degree[:n] = old[3][:n], old[4][:n]
+
+    # ---- Updates -----------------------------------------------------------
+
+    def _offer(self, i: int, j: int, w: float) -> bool:
+        """Insert j into row i if it ranks among the k best; True if changed."""
+        c = int(self._count[i])
+        ids, ws = self._ids[i], self._w[i]
+        if j in ids[:c]:
+            return False
+        if c == self._k:
+            # Rows are kept best first; the last entry is the weakest.
+            wl, jl = float(ws[c - 1]), int(ids[c - 1])
+            if w < wl or (w == wl and j > jl):
+                return False
+            self._strength[i] -= wl
+            self._in_degree[jl] -= 1
+            c -= 1
+
+        pos = c
+        while pos > 0 and (ws[pos - 1] < w or (ws[pos - 1] == w and ids[pos - 1] > j)):
+            pos -= 1
+        ids[pos + 1:c + 1] = ids[pos:c]
+        ws[pos + 1:c + 1] = ws[pos:c]
+        ids[pos], ws[pos] = j, w
+        self._count[i] = c + 1
+        self._strength[i] += w
+        self._in_degree[j] += 1
+        return True
+
+    def _extend(self, nodes: np.ndarray) -> np.ndarray:
+        """Rows for new index nodes, then reverse updates; returns changed rows."""
+        self._grow(int(nodes[-1]) + 1)
+        self._n = int(nodes[-1]) + 1
+        ids, w = self._index.query_nodes(nodes, self._candidates, ef=self._ef)
+        keep = (ids >= 0) & (w >= self._min_weight)
+
+        changed = set()
+        # Every new row is set before any reverse update, so a node added
+        # later in the batch can still displace an entry of an earlier one.
+        for r, q in enumerate(nodes):
+            q = int(q)
+            sel = np.flatnonzero(keep[r])[:self._k]
+            for j, wj in zip(ids[r, sel], w[r, sel]):
+                self._offer(q, int(j), float(wj))
+            changed.add(q)
+        for r, q in enumerate(nodes):
+            q = int(q)
+            for j, wj in zip(ids[r, keep[r]], w[r, keep[r]]):
+                if self._offer(int(j), q, float(wj)):
+                    changed.add(int(j))
+        return np.array(sorted(changed), dtype=np.int64)
+
+    def add(self, vectors: Any) -> np.ndarray:
+        """
+        Append rows to the index and update the structure.
+
+        Returns the sorted node ids whose rows changed (the new nodes and
+        every existing node that gained one of them).
+        """
+        nodes = self._index.add(vectors)
+        if nodes.size == 0:
+            return nodes
+        return self._extend(nodes)
+
+    def resync(self) -> None:
+        """Recompute out-strength and in-degree exactly from the rows. O(n k)."""
+        n = self._n
+        mask = np.arange(self._k)[None, :] < self._count[:n, None]
+        self._strength[:n] = np.where(mask, self._w[:n], 0.0).sum(axis=1)
+        self._in_degree[:n] = np.bincount(self._ids[:n][mask], minlength=n)
+
+    # ---- Read-out ----------------------------------------------------------
+
+    @property
+    def num_nodes(self) -> int:
+        return self._n
+
+    @property
+    def index(self) -> ANNIndex:
+        return self._index
+
+    def row(self, i: int) -> Tuple[np.ndarray, np.ndarray]:
+        """(neighbour ids, weights) of row i, best first."""
+        _ann_invariant(0 <= i < self._n, "row out of range")
+        c = int(self._count[i])
+        return self._ids[i, :c].copy(), self._w[i, :c].copy()
+
+    def out_degree(self) -> np.ndarray:
+        return self._count[:self._n].copy()
+
+    def in_degree(self) -> np.ndarray:
+        return self._in_degree[:self._n].copy()
+
+    def out_strength(self) -> np.ndarray:
+        # Clamp subtraction residue; strengths are sums of weights in [0, 1].
+        return np.maximum(self._strength[:self._n], 0.0)
+
+    def entropy(self) -> Optional[float]:
+        """Structural entropy over the current out-strengths. O(n)."""
+        if self._n == 0:
+            return None
+        h = _entropy_from_out_strengths(self.out_strength())
+        _ann_invariant(np.isfinite(h), "entropy must be finite")
+        return h
+
+    def to_csr(self) -> CSRGraph:
+        """Current rows as a CSRGraph, each row in ascending index order."""
+        n = self._n
+        counts = self._count[:n]
+        offsets = np.zeros(n + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum(counts)
+
+        mask = np.arange(self._k)[None, :] < counts[:, None]
+        rows = np.broadcast_to(np.arange(n)[:, None], mask.shape)[mask]
+        ids, w = self._ids[:n][mask], self._w[:n][mask]
+        order = np.lexsort((ids, rows))
+        return CSRGraph(
+            offsets=offsets,
+            indices=ids[order].astype(np.uint32),
+            weight=w[order],
+            num_nodes=n,
+        )
+
+
+__all__ = [
+    "ANNIndex",
+    "IncrementalKNN",
+]
@@ -25,7 +25,7 @@ from typing import Any, Dict, Iterable, Optional
 
 import numpy as np
 
-from hil.core.structure.graph import Graph
+from hil.core.structure.graph import CSRGraph, Graph
 from hil.core.embeddings.lsa import build_lsa_embedding
 
 
@@ -62,6 +62,11 @@ def build_embedding(
     documents: Iterable[str],
     *,
     n_components: int = 300,
+    vectorizer: str = "sklearn",
+    algorithm: str = "sklearn",
+    oversamples: int = 10,
+    power_iterations: int = 5,
+    seed: int = 0,
 ) -> CoreEmbedding:
     """
     Build an embedding space for a given set of documents.
@@ -70,6 +75,10 @@ def build_embedding(
     - Deterministic Latent Semantic Analysis (LSA)
     - Purely structural (term co-occurrence geometry)
     - No semantic interpretation
+    - Seeded randomized truncated SVD over the sparse term-document matrix;
+      algorithm="range_finder" keeps memory independent of vocabulary size
+    - vectorizer="hil" counts terms with the core tokenizer (native streaming
+      lexicon when built) instead of sklearn's CountVectorizer
 
     Invariants:
     - No IO (documents provided as strings)
@@ -83,6 +92,11 @@ def build_embedding(
     vectors, vocabulary = build_lsa_embedding(
         docs,
         n_components=n_components,
+        vectorizer=vectorizer,
+        algorithm=algorithm,
+        oversamples=oversamples,
+        power_iterations=power_iterations,
+        random_state=seed,
     )
 
     _core_invariant(
@@ -100,18 +114,39 @@ def build_embedding(
     )
 
 
+_FIELD_DTYPES = ("float64", "float32")
+
+
+def _field_storage(field: CoreField) -> np.ndarray:
+    """
+    Field vectors in their storage dtype: float32 is kept (native *_f32
+    kernels), anything else is widened to float64.
+    """
+    X = field.vectors
+    if X.dtype == np.float32:
+        return X
+    return X.astype(np.float64, copy=False)
+
+
 def build_field(
     embedding: CoreEmbedding,
     *,
     metadata: Optional[Dict[str, Any]] = None,
+    dtype: str = "float64",
 ) -> CoreField:
     """
     Construct a Hilbert Epistemic Field from embedding vectors.
 
+    dtype="float32" stores the field (and the graphs built from it) in
+    single precision, halving memory traffic for structure and coherence;
+    reductions still accumulate in float64, so diagnostics agree with the
+    float64 field to float32 rounding of the inputs.
+
     Invariants:
     - Field is a mathematical object (vectors + optional metadata)
     - No persistence, no IDs, no run state
     """
+    _core_invariant(dtype in _FIELD_DTYPES, f"unknown field dtype: {dtype}")
     _core_invariant(
         isinstance(embedding.vectors, np.ndarray),
         "embedding.vectors must be np.ndarray",
@@ -122,52 +157,101 @@ def build_field(
     )
 
     return CoreField(
-        vectors=embedding.vectors,
+        vectors=embedding.vectors.astype(np.dtype(dtype), copy=False),
         metadata=metadata,
     )
 
 
-def build_structure(field: CoreField) -> Graph:
+_STRUCTURE_METHODS = ("complete", "knn", "threshold")
+
+
+def build_structure(
+    field: CoreField,
+    *,
+    method: str = "complete",
+    k: Optional[int] = None,
+    min_weight: Optional[float] = None,
+) -> Graph:
     """
     Construct structural graph from a field.
 
-    Minimal calibration implementation:
+    Minimal calibration implementation (method="complete"):
     - Fully-connected undirected cosine graph (i < j)
     - Non-negative weights by shifting cosine similarity into [0, 1]
       w = (cos + 1) / 2
 
+    Sparse methods (same weights, directed i -> j, see build_structure_csr):
+    - method="knn":       keep the k highest-weight neighbours of each node
+                          (optionally also requiring w >= min_weight)
+    - method="threshold": keep every neighbour with w >= min_weight
+
     Properties:
     - Structural (geometry only)
     - Deterministic
     - Label-free
+
+    Weights are stored in the field's dtype (float32 or float64); cosines are
+    always computed in float64. src/dst are uint32 (formerly int32) on every
+    path: the hil_graph_t index type, so native kernels wrap them in place.
+
+    Backend stages:
+    - Stage C: native hil_graph_build_cosine (tiled Gram sweep) when available,
+      hil_graph_build_cosine_f32 for float32 fields.
+    - Stage A/B: NumPy row-block fallback with identical edge ordering.
     """
     _core_invariant(field.vectors.ndim == 2, "field.vectors must be 2D")
+    _core_invariant(method in _STRUCTURE_METHODS, f"unknown structure method: {method}")
+
+    if method == "knn":
+        _core_invariant(k is not None, "method 'knn' requires k")
+        return build_structure_csr(field, k=k, min_weight=min_weight).to_graph()
+    if method == "threshold":
+        _core_invariant(min_weight is not None, "method 'threshold' requires min_weight")
+        return build_structure_csr(field, min_weight=min_weight).to_graph()
 
-    X = field.vectors.astype(np.float64, copy=False)
+    X = _field_storage(field)
     n = int(X.shape[0])
     _core_invariant(n >= 1, "field must have at least one vector")
 
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import graph_build_cosine as _native_build  # noqa: WPS433
+    except ImportError:
+        _native_build = None
+
+    if _native_build is not None:
+        try:
+            src, dst, w = _native_build(X)
+            return Graph(src=src, dst=dst, weight=w, num_nodes=n)
+        except NativeError:
+            # Fall back to NumPy when the native path is unavailable or fails.
+            pass
+
+    # --- Stage A/B: NumPy implementation ------------------------------------
+    wtype = X.dtype
+    X = X.astype(np.float64, copy=False)
+
     # Normalize rows deterministically
     norms = np.linalg.norm(X, axis=1, keepdims=True)
     norms[norms == 0.0] = 1.0
     V = X / norms
 
-    src_list: list[int] = []
-    dst_list: list[int] = []
-    w_list: list[float] = []
-
-    for i in range(n):
-        vi = V[i]
-        for j in range(i + 1, n):
-            cos = float(np.dot(vi, V[j]))
-            w = (cos + 1.0) * 0.5  # shift to [0, 1]
-            src_list.append(i)
-            dst_list.append(j)
-            w_list.append(w)
-
-    src = np.asarray(src_list, dtype=np.int32)
-    dst = np.asarray(dst_list, dtype=np.int32)
-    w = np.asarray(w_list, dtype=np.float64)
+    # Preallocated edge arrays in row-major upper-triangle order (i < j),
+    # filled one row-block at a time (no per-pair Python objects).
+    m = (n * (n - 1)) // 2
+    src = np.empty(m, dtype=np.uint32)
+    dst = np.empty(m, dtype=np.uint32)
+    w = np.empty(m, dtype=wtype)
+
+    e = 0
+    for i in range(n - 1):
+        k = n - i - 1
+        cos = V[i + 1:] @ V[i]
+        src[e:e + k] = i
+        dst[e:e + k] = np.arange(i + 1, n, dtype=np.uint32)
+        w[e:e + k] = (cos + 1.0) * 0.5  # shift to [0, 1]
+        e += k
 
     return Graph(
         src=src,
@@ -177,6 +261,114 @@ def build_structure(field: CoreField) -> Graph:
     )
 
 
+def build_structure_csr(
+    field: CoreField,
+    *,
+    k: Optional[int] = None,
+    min_weight: Optional[float] = None,
+) -> CSRGraph:
+    """
+    Construct a sparse cosine graph from a field in CSR form.
+
+    For each element i, neighbours j != i with w = (cos + 1) / 2 are kept if:
+    - w >= min_weight (when given), and
+    - w ranks among the k highest for i (when k is given); ties prefer the
+      smaller neighbour index.
+
+    Row i lists its kept neighbours in ascending index order. Memory is O(n*k)
+    rather than O(n^2), so large fields never materialize a dense graph.
+    Weights are stored in the field's dtype, as in build_structure. Fields
+    split across processes build the same rows with hil.core.sharded.
+
+    Properties:
+    - Structural (geometry only)
+    - Deterministic
+    - Label-free
+    """
+    _core_invariant(field.vectors.ndim == 2, "field.vectors must be 2D")
+    _core_invariant(k is None or k >= 1, "k must be >= 1")
+    _core_invariant(
+        min_weight is None or 0.0 <= min_weight <= 1.0,
+        "min_weight must lie in [0, 1]",
+    )
+
+    X = _field_storage(field)
+    n = int(X.shape[0])
+    _core_invariant(n >= 1, "field must have at least one vector")
+
+    kk = 0 if k is None else min(int(k), n - 1)
+    mw = 0.0 if min_weight is None else float(min_weight)
+
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import graph_build_knn_csr as _native_knn  # noqa: WPS433
+    except ImportError:
+        _native_knn = None
+
+    if _native_knn is not None:
+        try:
+            offsets, indices, w = _native_knn(X, kk, mw)
+            return CSRGraph(offsets=offsets, indices=indices, weight=w, num_nodes=n)
+        except NativeError:
+            pass
+
+    # --- Stage A/B: NumPy implementation ------------------------------------
+    wtype = X.dtype
+    X = X.astype(np.float64, copy=False)
+
+    norms = np.linalg.norm(X, axis=1, keepdims=True)
+    norms[norms == 0.0] = 1.0
+    V = X / norms
+
+    # Row blocks bound the dense scratch to roughly 4M weights.
+    block = max(1, (1 << 22) // max(n, 1))
+
+    counts = np.zeros(n, dtype=np.int64)
+    idx_parts: list[np.ndarray] = []
+    w_parts: list[np.ndarray] = []
+
+    for r0 in range(0, n, block):
+        r1 = min(r0 + block, n)
+        Wb = ((V[r0:r1] @ V.T) + 1.0) * 0.5
+        rows = np.arange(r0, r1)
+
+        if kk > 0:
+            # Stable sort on -w keeps the smaller index first among ties.
+            Wb[rows - r0, rows] = -np.inf
+            order = np.argsort(-Wb, axis=1, kind="stable")[:, :kk]
+            for b, sel in enumerate(order):
+                wsel = Wb[b, sel]
+                keep = (wsel >= mw)
+                sel, wsel = sel[keep], wsel[keep]
+                perm = np.argsort(sel, kind="stable")
+                idx_parts.append(sel[perm].astype(np.uint32))
+                w_parts.append(wsel[perm])
+                counts[r0 + b] = sel.size
+        else:
+            for b, row in enumerate(Wb):
+                keep = (row >= mw)
+                keep[r0 + b] = False
+                sel = np.flatnonzero(keep)
+                idx_parts.append(sel.astype(np.uint32))
+                w_parts.append(row[sel])
+                counts[r0 + b] = sel.size
+
+    offsets = np.zeros(n + 1, dtype=np.uint64)
+    offsets[1:] = np.cumsum(counts)
+
+    return CSRGraph(
+        offsets=offsets,
+        indices=np.concatenate(idx_parts) if idx_parts else np.empty(0, dtype=np.uint32),
+        weight=(
+            np.concatenate(w_parts).astype(wtype, copy=False)
+            if w_parts
+            else np.empty(0, dtype=wtype)
+        ),
+        num_nodes=n,
+    )
+
+
 def compute_diagnostics(
     field: CoreField,
     graph: Graph,
@@ -216,5 +408,6 @@ __all__ = [
     "build_embedding",
     "build_field",
     "build_structure",
+    "build_structure_csr",
     "compute_diagnostics",
 ]
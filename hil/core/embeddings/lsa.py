@@ -13,6 +13,19 @@ Invariants:
 - No labels, no topic naming
 - No persistence, no global state
 - No adaptive or online behavior
+
+Two decompositions are available (both seeded, both sparse-aware):
+- "sklearn":      sklearn TruncatedSVD(algorithm="randomized")
+- "range_finder": blockwise randomized range finder over the sparse
+                  term-document matrix (see _range_finder_svd); memory is
+                  O(nnz + n_docs * (k + oversamples)), independent of
+                  vocabulary size
+
+Two term-document builders are available:
+- "sklearn": CountVectorizer (its token pattern: two or more word chars)
+- "hil":     hil.core.embeddings.vocabulary.build_term_document (the core
+             tokenizer, native streaming counter when built); stop words
+             and document-frequency bounds are then applied as column masks
 """
 
 from __future__ import annotations
@@ -20,9 +33,11 @@ from __future__ import annotations
 from typing import Iterable, Dict, Tuple, Optional, List
 
 import numpy as np
-from sklearn.feature_extraction.text import CountVectorizer
+from sklearn.feature_extraction.text import CountVectorizer, ENGLISH_STOP_WORDS
 from sklearn.decomposition import TruncatedSVD
 
+from hil.core.embeddings.vocabulary import build_term_document
+
 
 # ---------------------------------------------------------------------------
 # Invariants
@@ -33,6 +48,116 @@ def _lsa_invariant(condition: bool, message: str) -> None:
         raise ValueError(f"[hil.core.embeddings.lsa invariant] {message}")
 
 
+# ---------------------------------------------------------------------------
+# Randomized range finder
+# ---------------------------------------------------------------------------
+
+_LSA_ALGORITHMS = ("sklearn", "range_finder")
+_LSA_VECTORIZERS = ("sklearn", "hil")
+
+# Term columns per block. Fixed so the Gaussian test matrix, drawn block by
+# block, is identical for a given seed regardless of vocabulary size.
+_TERM_BLOCK = 4096
+
+
+def _orthonormal(Y: np.ndarray) -> np.ndarray:
+    Q, _ = np.linalg.qr(Y, mode="reduced")
+    return Q
+
+
+def _range_finder_svd(
+    term_doc,
+    k: int,
+    *,
+    oversamples: int,
+    power_iterations: int,
+    random_state: int,
+) -> np.ndarray:
+    """
+    Top-k document vectors U_k * S_k of a sparse (n_docs x n_terms) matrix.
+
+    Halko-Martinsson-Tropp range finder with subspace iteration:
+      Y = A @ Omega, Q = orth(Y), then Q = orth(A @ (A.T @ Q)) per power
+      iteration; finally the (l x l) Gram Q.T A A.T Q is diagonalized.
+
+    A is only touched through column blocks, so neither the n_terms x l test
+    matrix nor Q.T @ A is ever materialized. Singular values come from the
+    Gram eigenvalues, which is ample for the leading LSA spectrum.
+
+    Signs follow sklearn's svd_flip convention (largest |U| entry of each
+    column positive), so output is deterministic for a fixed seed.
+    """
+    A = term_doc.tocsc().astype(np.float64)
+    n_docs, n_terms = A.shape
+    l = min(k + oversamples, n_docs, n_terms)
+    blocks = [(s, min(s + _TERM_BLOCK, n_terms)) for s in range(0, n_terms, _TERM_BLOCK)]
+    cols = [A[:, s:e] for s, e in blocks]
+
+    rng = np.random.default_rng(random_state)
+    Y = np.zeros((n_docs, l), dtype=np.float64)
+    for (s, e), Ab in zip(blocks, cols):
+        Y += Ab @ rng.standard_normal((e - s, l))
+    Q = _orthonormal(Y)
+
+    for _ in range(power_iterations):
+        Z = np.zeros_like(Q)
+        for Ab in cols:
+            Z += Ab @ (Ab.T @ Q)
+        Q = _orthonormal(Z)
+
+    G = np.zeros((l, l), dtype=np.float64)
+    for Ab in cols:
+        T = Ab.T @ Q
+        G += T.T @ T
+
+    evals, W = np.linalg.eigh(G)
+    order = np.argsort(evals)[::-1][:k]
+    sigma = np.sqrt(np.maximum(evals[order], 0.0))
+    U = Q @ W[:, order]
+
+    pivots = np.argmax(np.abs(U), axis=0)
+    signs = np.sign(U[pivots, np.arange(U.shape[1])])
+    signs[signs == 0.0] = 1.0
+    return (U * signs) * sigma
+
+
+# ---------------------------------------------------------------------------
+# Term-document matrix (HIL tokenizer)
+# ---------------------------------------------------------------------------
+
+def _hil_term_doc(
+    docs: List[str],
+    *,
+    min_df,
+    max_df,
+    stop_words: Optional[str],
+):
+    """
+    CountVectorizer-equivalent filtering over build_term_document output.
+
+    min_df / max_df follow sklearn: ints are document counts, floats are
+    fractions of the corpus. Surviving columns keep their relative order.
+    """
+    _lsa_invariant(stop_words in (None, "english"), "stop_words must be None or 'english'")
+
+    td = build_term_document(docs)
+    n_docs, n_terms = td.shape
+    df = np.bincount(td.indices.astype(np.int64), minlength=n_terms)
+
+    lo = min_df if isinstance(min_df, (int, np.integer)) else float(min_df) * n_docs
+    hi = max_df if isinstance(max_df, (int, np.integer)) else float(max_df) * n_docs
+    keep = (df >= lo) & (df <= hi)
+
+    terms = sorted(td.vocabulary, key=td.vocabulary.__getitem__)
+    if stop_words == "english":
+        keep &= np.array([t not in ENGLISH_STOP_WORDS for t in terms], dtype=bool)
+
+    cols = np.flatnonzero(keep)
+    term_doc = td.to_scipy()[:, cols]
+    vocabulary = {terms[c]: i for i, c in enumerate(cols)}
+    return term_doc, vocabulary
+
+
 # ---------------------------------------------------------------------------
 # LSA
 # ---------------------------------------------------------------------------
@@ -44,6 +169,11 @@ def build_lsa_embedding(
     min_df: int = 1,
     max_df: float = 1.0,
     stop_words: Optional[str] = "english",
+    vectorizer: str = "sklearn",
+    algorithm: str = "sklearn",
+    oversamples: int = 10,
+    power_iterations: int = 5,
+    random_state: int = 0,
 ) -> Tuple[np.ndarray, Dict[str, int]]:
     """
     Build an LSA embedding from raw documents.
@@ -60,6 +190,17 @@ def build_lsa_embedding(
         Maximum document frequency (fraction).
     stop_words : str or None
         Stop-word handling (passed through to sklearn).
+    vectorizer : str
+        "sklearn" (CountVectorizer) or "hil" (core tokenizer, native counter).
+    algorithm : str
+        "sklearn" (TruncatedSVD) or "range_finder" (blockwise sparse).
+    oversamples : int
+        Extra random directions beyond k in the range sketch.
+    power_iterations : int
+        Subspace iterations; sharpen the leading spectrum on slowly
+        decaying singular values.
+    random_state : int
+        Seed for the Gaussian test matrix.
 
     Returns
     -------
@@ -74,17 +215,26 @@ def build_lsa_embedding(
     docs: List[str] = [d for d in documents if isinstance(d, str)]
     _lsa_invariant(len(docs) > 0, "documents must be non-empty")
     _lsa_invariant(n_components > 0, "n_components must be > 0")
+    _lsa_invariant(vectorizer in _LSA_VECTORIZERS, f"unknown LSA vectorizer: {vectorizer}")
+    _lsa_invariant(algorithm in _LSA_ALGORITHMS, f"unknown LSA algorithm: {algorithm}")
+    _lsa_invariant(oversamples >= 0, "oversamples must be >= 0")
+    _lsa_invariant(power_iterations >= 0, "power_iterations must be >= 0")
 
     # ------------------------------------------------------------------
     # Term-document matrix (counts only)
     # ------------------------------------------------------------------
-    vectorizer = CountVectorizer(
-        min_df=min_df,
-        max_df=max_df,
-        stop_words=stop_words,
-    )
-
-    term_doc = vectorizer.fit_transform(docs)
+    if vectorizer == "hil":
+        term_doc, vocabulary = _hil_term_doc(
+            docs, min_df=min_df, max_df=max_df, stop_words=stop_words,
+        )
+    else:
+        counter = CountVectorizer(
+            min_df=min_df,
+            max_df=max_df,
+            stop_words=stop_words,
+        )
+        term_doc = counter.fit_transform(docs)
+        vocabulary = dict(counter.vocabulary_)
     _lsa_invariant(
         term_doc.shape[0] == len(docs),
         "term-document row count mismatch",
@@ -111,13 +261,23 @@ def build_lsa_embedding(
     # - randomized SVD is acceptable here because:
     #   - random_state is fixed
     #   - we only require determinism, not exact algebraic equivalence
-    svd = TruncatedSVD(
-        n_components=k,
-        algorithm="randomized",
-        random_state=0,
-    )
-
-    vectors = svd.fit_transform(term_doc)
+    if algorithm == "range_finder":
+        vectors = _range_finder_svd(
+            term_doc,
+            k,
+            oversamples=oversamples,
+            power_iterations=power_iterations,
+            random_state=random_state,
+        )
+    else:
+        svd = TruncatedSVD(
+            n_components=k,
+            algorithm="randomized",
+            n_iter=power_iterations,
+            n_oversamples=oversamples,
+            random_state=random_state,
+        )
+        vectors = svd.fit_transform(term_doc)
 
     # ------------------------------------------------------------------
     # Output normalization
@@ -131,8 +291,6 @@ def build_lsa_embedding(
         "embedding contains non-finite values",
     )
 
-    vocabulary: Dict[str, int] = dict(vectorizer.vocabulary_)
-
     return vectors.astype(np.float64, copy=False), vocabulary
 
 
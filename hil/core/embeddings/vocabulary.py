@@ -7,6 +7,7 @@ This module is responsible only for:
 - normalising text
 - extracting tokens
 - constructing a stable token → index mapping
+- counting tokens per document (term-document matrix, CSR)
 
 It does NOT:
 - read files
@@ -19,10 +20,13 @@ The vocabulary defines the coordinate basis of the embedding space.
 
 from __future__ import annotations
 
-from typing import Dict, Iterable, List
+from dataclasses import dataclass
+from typing import Dict, Iterable, List, Sequence
 import re
 from collections import Counter
 
+import numpy as np
+
 
 _TOKEN_PATTERN = re.compile(r"[A-Za-z0-9_]+")
 
@@ -61,11 +65,21 @@ def build_vocabulary(
         Mapping from token to integer index.
     """
 
+    # Single streaming pass: only the corpus-wide Counter is kept.
     counter: Counter[str] = Counter()
 
     for doc in documents:
         counter.update(tokenize(doc))
 
+    return _select_vocabulary(counter, min_count, max_vocab_size)
+
+
+def _select_vocabulary(
+    counter: Counter[str],
+    min_count: int,
+    max_vocab_size: int | None,
+) -> Dict[str, int]:
+    """Token selection and ordering shared by build_vocabulary and build_term_document."""
     # Filter by minimum count
     tokens = [
         token for token, count in counter.items()
@@ -81,3 +95,98 @@ def build_vocabulary(
         tokens = tokens[:max_vocab_size]
 
     return {token: idx for idx, token in enumerate(tokens)}
+
+
+# ---------------------------------------------------------------------------
+# Term-document matrix
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class TermDocument:
+    """
+    Per-document token counts in CSR form over a build_vocabulary basis.
+
+    Row i lists the vocabulary indices present in document i, ascending.
+    """
+    offsets: np.ndarray      # uint64, (n_docs + 1,)
+    indices: np.ndarray      # uint32, (nnz,)
+    counts: np.ndarray       # float64, (nnz,)
+    vocabulary: Dict[str, int]
+
+    @property
+    def shape(self) -> tuple:
+        return (int(self.offsets.size - 1), len(self.vocabulary))
+
+    def to_scipy(self):
+        from scipy.sparse import csr_matrix  # noqa: WPS433
+        return csr_matrix(
+            (self.counts, self.indices.astype(np.int64), self.offsets.astype(np.int64)),
+            shape=self.shape,
+        )
+
+
+def build_term_document(
+    documents: Iterable[str],
+    *,
+    min_count: int = 1,
+    max_vocab_size: int | None = None,
+) -> TermDocument:
+    """
+    Build the vocabulary and the term-document count matrix in one pass.
+
+    The vocabulary is exactly build_vocabulary's (same tokens, same order).
+    Use build_vocabulary when only the vocabulary is needed: it streams the
+    documents and keeps no per-document counts.
+
+    Backend stages:
+    - Stage C: native streaming lexicon (hilbert_lexicon.h) — byte tokenizer,
+      open-addressing term tables, chunked across threads and merged
+      deterministically.
+    - Stage A/B: the Python reference below.
+    """
+    docs: Sequence[str] = documents if isinstance(documents, (list, tuple)) else list(documents)
+
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import term_document as _native_term_document  # noqa: WPS433
+    except ImportError:
+        _native_term_document = None
+
+    if _native_term_document is not None:
+        try:
+            offsets, indices, counts, _, terms = _native_term_document(
+                docs, min_count=min_count, max_terms=max_vocab_size,
+            )
+            return TermDocument(
+                offsets=offsets,
+                indices=indices,
+                counts=counts,
+                vocabulary={token: idx for idx, token in enumerate(terms)},
+            )
+        except NativeError:
+            pass
+
+    # --- Stage A/B: Python reference ----------------------------------------
+    per_doc: List[Counter[str]] = [Counter(tokenize(doc)) for doc in docs]
+    counter: Counter[str] = Counter()
+    for c in per_doc:
+        counter.update(c)
+
+    vocabulary = _select_vocabulary(counter, min_count, max_vocab_size)
+
+    offsets = np.zeros(len(per_doc) + 1, dtype=np.uint64)
+    idx_parts: List[int] = []
+    cnt_parts: List[float] = []
+    for i, c in enumerate(per_doc):
+        row = sorted((vocabulary[t], n) for t, n in c.items() if t in vocabulary)
+        idx_parts.extend(j for j, _ in row)
+        cnt_parts.extend(float(n) for _, n in row)
+        offsets[i + 1] = len(idx_parts)
+
+    return TermDocument(
+        offsets=offsets,
+        indices=np.asarray(idx_parts, dtype=np.uint32),
+        counts=np.asarray(cnt_parts, dtype=np.float64),
+        vocabulary=vocabulary,
+    )
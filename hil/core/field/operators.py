@@ -17,7 +17,7 @@ Invariants:
 
 from __future__ import annotations
 
-from typing import Tuple
+from typing import Optional, Tuple
 
 import numpy as np
 
@@ -128,6 +128,9 @@ def spectral_energy(eigenvalues: np.ndarray) -> float:
     """
     Compute total spectral energy (sum of absolute eigenvalues).
 
+    Given only the leading eigenvalues (field_spectrum), this is the energy
+    of the leading part of the spectrum.
+
     Diagnostic quantity only.
     """
     _op_invariant(isinstance(eigenvalues, np.ndarray), "eigenvalues must be np.ndarray")
@@ -136,6 +139,93 @@ def spectral_energy(eigenvalues: np.ndarray) -> float:
     return float(np.sum(np.abs(eigenvalues)))
 
 
+_FIELD_OPERATORS = ("gram", "covariance")
+
+
+def _fix_signs(vecs: np.ndarray) -> np.ndarray:
+    """Sign each column so its largest-magnitude entry is positive (first on ties)."""
+    arg = np.argmax(np.abs(vecs), axis=0)
+    signs = np.where(vecs[arg, np.arange(vecs.shape[1])] < 0.0, -1.0, 1.0)
+    return vecs * signs
+
+
+def field_spectrum(
+    mat: np.ndarray,
+    k: int,
+    *,
+    operator: str = "gram",
+    tol: float = 1e-10,
+    start: Optional[np.ndarray] = None,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    Leading k eigenpairs of the Gram (X X^T) or covariance operator of the
+    rows of mat, without forming the n x n or d x d matrix.
+
+    Returns (eigenvalues (k,), eigenvectors (N, k)) sorted by descending
+    eigenvalue, as spectrum() would for the leading k, with each
+    eigenvector signed so its largest-magnitude entry is positive.
+
+    The native path is matrix-free Lanczos (memory linear in N = n or d),
+    converged to tol relative to the leading eigenvalue and
+    deterministic for a given start vector; without it the dense matrix is
+    decomposed.
+    """
+    _op_invariant(isinstance(mat, np.ndarray), "mat must be np.ndarray")
+    _op_invariant(mat.ndim == 2 and mat.size > 0, "mat must be 2D and non-empty")
+    _op_invariant(operator in _FIELD_OPERATORS, f"operator must be one of {_FIELD_OPERATORS}")
+    covariance = operator == "covariance"
+    side = mat.shape[1] if covariance else mat.shape[0]
+    _op_invariant(1 <= k <= side, f"k must lie in [1, {side}]")
+
+    # --- Stage C: native matrix-free solver ---------------------------------
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+    except ImportError:
+        _shim = None
+
+    if _shim is not None:
+        try:
+            vals, vecs, _ = _shim.field_spectrum(
+                mat, int(k), covariance=covariance, tol=tol, start=start, copy=True
+            )
+            return vals, vecs.T
+        except _shim.NativeError:
+            pass
+
+    # --- Stage A/B: dense NumPy --------------------------------------------
+    op = covariance_matrix(mat) if covariance else gram_matrix(mat)
+    vals, vecs = spectrum(op)
+    return vals[:k], _fix_signs(vecs[:, :k])
+
+
+def field_spectral_energy(
+    mat: np.ndarray,
+    *,
+    operator: str = "gram",
+    k: Optional[int] = None,
+) -> float:
+    """
+    Spectral energy of the Gram or covariance operator of the rows of mat.
+
+    Both operators are positive semi-definite, so the total (k=None) is
+    their trace and needs no decomposition; with k, the energy of the
+    leading k eigenvalues (field_spectrum).
+    """
+    _op_invariant(isinstance(mat, np.ndarray), "mat must be np.ndarray")
+    _op_invariant(mat.ndim == 2 and mat.size > 0, "mat must be 2D and non-empty")
+    _op_invariant(operator in _FIELD_OPERATORS, f"operator must be one of {_FIELD_OPERATORS}")
+
+    if k is not None:
+        vals, _ = field_spectrum(mat, k, operator=operator)
+        return spectral_energy(vals)
+
+    X = mat.astype(np.float64, copy=False)
+    if operator == "covariance":
+        X = X - X.mean(axis=0, keepdims=True)
+        return float(np.einsum("ij,ij->", X, X) / float(X.shape[0]))
+    return float(np.einsum("ij,ij->", X, X))
+
+
 __all__ = [
     "l2_norm",
     "normalize",
@@ -144,4 +234,6 @@ __all__ = [
     "covariance_matrix",
     "spectrum",
     "spectral_energy",
+    "field_spectrum",
+    "field_spectral_energy",
 ]
@@ -21,8 +21,8 @@ from typing import Dict, Any
 
 import numpy as np
 
-from hil.core.structure.field import Field
-from hil.core.operators import l2_norm
+from hil.core.field.field import Field
+from hil.core.field.operators import field_spectrum, spectral_energy
 
 
 # ---------------------------------------------------------------------------
@@ -98,6 +98,33 @@ def element_potential(field: Field) -> np.ndarray:
     return p.astype(np.float64, copy=False)
 
 
+def spectral_potential(field: Field, k: int) -> float:
+    """
+    Potential carried by the k leading principal axes of the field.
+
+    V is the trace of the covariance C = (1/N) sum_i (x_i - c)(x_i - c)^T,
+    so the k largest eigenvalues of C split off the part of V along the
+    dominant axes:
+
+        V_k = sum_{j <= k} lambda_j(C),   0 <= V_k <= V
+
+    The eigenvalues come from the matrix-free solver (field_spectrum), so
+    C is never formed.
+    """
+    _potential_invariant(isinstance(field, Field), "field must be a Field")
+    _potential_invariant(field.size >= 1, "field must contain at least one element")
+
+    mat = field.matrix
+    _potential_invariant(1 <= k <= mat.shape[1], "k must lie in [1, dimensions]")
+
+    vals, _ = field_spectrum(mat, k, operator="covariance")
+    # Covariance eigenvalues are >= 0; clamp rounding below zero.
+    Vk = spectral_energy(np.maximum(vals, 0.0))
+
+    _potential_invariant(np.isfinite(Vk), "spectral potential must be finite")
+    return Vk
+
+
 def potential_summary(field: Field) -> Dict[str, Any]:
     """
     Minimal, JSON-safe summary of field potential diagnostics.
@@ -113,5 +140,6 @@ def potential_summary(field: Field) -> Dict[str, Any]:
 __all__ = [
     "field_potential",
     "element_potential",
+    "spectral_potential",
     "potential_summary",
 ]
@@ -0,0 +1,428 @@
+# hil/core/incremental.py
+"""
+hil.core.incremental
+
+Incremental sliding-window diagnostics over StreamProtocol sources.
+
+Consecutive windows of a live stream usually share almost all of their
+elements, yet pushing every slice through build_field -> build_structure ->
+compute_diagnostics costs O(n^2 d) per tick. This engine keeps running state
+instead and updates it per element added or removed:
+
+- centroid sum and sum of norm-clamped unit rows (coherence)
+- per-element row norms
+- per-element structural strength (entropy)
+- union-find over the sparse structure (components), method="threshold"
+
+A tick then costs O(changed * n * d) for the weight updates plus O(n) for the
+entropy read-out, rather than a full rebuild.
+
+Reference semantics per tick (equal up to floating-point drift):
+- coherence == field_coherence(window vectors)
+- entropy, method="complete":
+      NumPy structural_entropy of build_structure(field), with the window
+      ordered by insertion (every edge runs earlier -> later element)
+- entropy, method="threshold":
+      structural_entropy(build_structure_csr(field, min_weight=min_weight))
+
+Running sums drift slowly under long add/remove sequences; resync()
+recomputes them exactly from the retained rows.
+
+Invariants:
+- Diagnostic only (returns numbers; never classifies or labels)
+- Deterministic for a fixed sequence of additions and removals
+- No IO, no persistence
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import Any, Callable, Dict, Hashable, Iterable, Iterator, List, Optional, Tuple
+
+import numpy as np
+
+from hil.core.metrics.coherence import _HIL_EPS
+from hil.core.metrics.entropy import _entropy_from_out_strengths
+from hil.core.stream import StreamProtocol
+
+
+MicroSlice = Any
+TimeIndex = Any
+
+_WINDOW_METHODS = ("complete", "threshold")
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _window_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.core.incremental invariant] {message}")
+
+
+# ---------------------------------------------------------------------------
+# Data structures
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class WindowTick:
+    t: TimeIndex
+    entropy: Optional[float]          # None while the window is empty
+    coherence: Optional[float]        # None while the window is empty
+    num_elements: int
+    added: int
+    removed: int
+
+
+# ---------------------------------------------------------------------------
+# Incremental engine
+# ---------------------------------------------------------------------------
+
+class IncrementalDiagnostics:
+    """
+    Running entropy/coherence state over a keyed, mutable window of vectors.
+
+    Elements are identified by hashable keys; a key present across ticks is
+    taken to carry the same vector. Rows live in slot arrays that grow by
+    doubling and are reused after removal, so steady-state ticks allocate
+    only the O(n) weight vectors of the changed elements.
+    """
+
+    def __init__(
+        self,
+        dim: Optional[int] = None,
+        *,
+        method: str = "complete",
+        min_weight: Optional[float] = None,
+        capacity: int = 64,
+    ) -> None:
+        _window_invariant(method in _WINDOW_METHODS, f"unknown window method: {method}")
+        _window_invariant(dim is None or dim >= 1, "dim must be >= 1")
+        _window_invariant(capacity >= 1, "capacity must be >= 1")
+        if method == "threshold":
+            _window_invariant(min_weight is not None, "method 'threshold' requires min_weight")
+            _window_invariant(0.0 <= float(min_weight) <= 1.0, "min_weight must lie in [0, 1]")
+
+        self._method = method
+        self._min_weight = None if min_weight is None else float(min_weight)
+        self._dim: Optional[int] = None
+        self._slot: Dict[Hashable, int] = {}
+        self._free: List[int] = []
+        self._next_seq = 0
+        self._capacity = 0
+        self._uf_stale = False
+        if dim is not None:
+            self._allocate(int(dim), int(capacity))
+        else:
+            self._initial_capacity = int(capacity)
+
+    # ---- Slot storage ------------------------------------------------------
+
+    def _allocate(self, dim: int, capacity: int) -> None:
+        self._dim = dim
+        self._capacity = capacity
+        self._X = np.zeros((capacity, dim), dtype=np.float64)      # raw rows
+        self._V = np.zeros((capacity, dim), dtype=np.float64)      # structure-normalized rows
+        self._norm = np.zeros(capacity, dtype=np.float64)
+        self._strength = np.zeros(capacity, dtype=np.float64)
+        self._seq = np.zeros(capacity, dtype=np.int64)
+        self._alive = np.zeros(capacity, dtype=bool)
+        self._parent = np.arange(capacity, dtype=np.int64)
+        self._adj: List[Dict[int, float]] = [{} for _ in range(capacity)]
+        self._sum = np.zeros(dim, dtype=np.float64)
+        self._unit_sum = np.zeros(dim, dtype=np.float64)
+        self._free = list(range(capacity - 1, -1, -1))
+
+    def _grow(self) -> None:
+        old = self._capacity
+        cap = 2 * old
+        for name in ("_X", "_V"):
+            arr = np.zeros((cap, self._dim), dtype=np.float64)
+            arr[:old] = getattr(self, name)
+            setattr(self, name, arr)
+        for name, dtype in (("_norm", np.float64), ("_strength", np.float64),
+                            ("_seq", np.int64), ("_alive", bool)):
+            arr = np.zeros(cap, dtype=dtype)
+            arr[:old] = getattr(self, name)
+            setattr(self, name, arr)
+        parent = np.arange(cap, dtype=np.int64)
+        parent[:old] = self._parent
+        self._parent = parent
+        self._adj.extend({} for _ in range(cap - old))
+        self._free.extend(range(cap - 1, old - 1, -1))
+        self._capacity = cap
+
+    def _alive_slots(self) -> np.ndarray:
+        return np.flatnonzero(self._alive[:self._capacity])
+
+    # ---- Union-find (threshold structure) ----------------------------------
+
+    def _find(self, x: int) -> int:
+        parent = self._parent
+        while parent[x] != x:
+            parent[x] = parent[parent[x]]
+            x = int(parent[x])
+        return x
+
+    def _union(self, a: int, b: int) -> None:
+        ra, rb = self._find(a), self._find(b)
+        if ra == rb:
+            return
+        if ra < rb:
+            self._parent[rb] = ra
+        else:
+            self._parent[ra] = rb
+
+    def _rebuild_components(self) -> None:
+        # Union-find cannot delete; removals mark it stale and the forest is
+        # rebuilt from the retained adjacency on the next query.
+        slots = self._alive_slots()
+        self._parent[slots] = slots
+        for i in slots:
+            for j in self._adj[int(i)]:
+                self._union(int(i), j)
+        self._uf_stale = False
+
+    # ---- Mutation ----------------------------------------------------------
+
+    def add(self, key: Hashable, vector: Any) -> None:
+        """
+        Insert one element. Cost O(n * d) against the current window.
+        """
+        v = np.asarray(vector, dtype=np.float64).reshape(-1)
+        _window_invariant(key not in self._slot, f"duplicate element key: {key!r}")
+        _window_invariant(v.size >= 1, "element vectors must be non-empty")
+        _window_invariant(bool(np.all(np.isfinite(v))), "element vectors must be finite")
+        if self._dim is None:
+            self._allocate(int(v.size), self._initial_capacity)
+        _window_invariant(v.size == self._dim, "element vector dimension mismatch")
+
+        others = self._alive_slots()
+        if not self._free:
+            self._grow()
+        slot = self._free.pop()
+
+        norm = float(np.linalg.norm(v))
+        # build_structure normalization: zero rows stay zero (cos = 0).
+        u = v / norm if norm != 0.0 else v
+
+        strength = 0.0
+        adj: Dict[int, float] = {}
+        if others.size:
+            w = (self._V[others] @ u + 1.0) * 0.5
+            if self._method == "complete":
+                # Every earlier element gains an out-edge to the newcomer.
+                self._strength[others] += w
+            else:
+                keep = w >= self._min_weight
+                nbrs, wk = others[keep], w[keep]
+                self._strength[nbrs] += wk
+                strength = float(wk.sum())
+                adj = {int(j): float(x) for j, x in zip(nbrs, wk)}
+                for j, x in adj.items():
+                    self._adj[j][slot] = x
+
+        self._X[slot] = v
+        self._V[slot] = u
+        self._norm[slot] = norm
+        self._strength[slot] = strength
+        self._seq[slot] = self._next_seq
+        self._alive[slot] = True
+        self._adj[slot] = adj
+        self._parent[slot] = slot
+        self._slot[key] = slot
+        self._next_seq += 1
+
+        self._sum += v
+        self._unit_sum += v / max(norm, _HIL_EPS)
+
+        if not self._uf_stale:
+            for j in adj:
+                self._union(slot, j)
+
+    def remove(self, key: Hashable) -> None:
+        """
+        Remove one element. Cost O(n * d) for method="complete", O(deg) for
+        method="threshold".
+        """
+        _window_invariant(key in self._slot, f"unknown element key: {key!r}")
+        slot = self._slot.pop(key)
+        self._alive[slot] = False
+
+        if self._method == "complete":
+            others = self._alive_slots()
+            earlier = others[self._seq[others] < self._seq[slot]]
+            if earlier.size:
+                w = (self._V[earlier] @ self._V[slot] + 1.0) * 0.5
+                self._strength[earlier] -= w
+        else:
+            for j, x in self._adj[slot].items():
+                del self._adj[j][slot]
+                self._strength[j] -= x
+            self._adj[slot] = {}
+            self._uf_stale = True
+
+        v = self._X[slot]
+        self._sum -= v
+        self._unit_sum -= v / max(float(self._norm[slot]), _HIL_EPS)
+        self._strength[slot] = 0.0
+        self._free.append(slot)
+
+    def step(
+        self,
+        t: TimeIndex,
+        elements: Iterable[Tuple[Hashable, Any]],
+    ) -> WindowTick:
+        """
+        Move the window to the given (key, vector) membership and emit a tick.
+
+        Departed keys are removed first, then new keys are added in the
+        order given.
+        """
+        current: Dict[Hashable, Any] = {}
+        for key, vec in elements:
+            _window_invariant(key not in current, f"duplicate element key: {key!r}")
+            current[key] = vec
+
+        departed = [k for k in self._slot if k not in current]
+        arrived = [k for k in current if k not in self._slot]
+        for k in departed:
+            self.remove(k)
+        for k in arrived:
+            self.add(k, current[k])
+
+        return WindowTick(
+            t=t,
+            entropy=self.entropy(),
+            coherence=self.coherence(),
+            num_elements=self.num_elements,
+            added=len(arrived),
+            removed=len(departed),
+        )
+
+    def resync(self) -> None:
+        """
+        Recompute running sums and strengths exactly from the retained rows.
+
+        O(n^2 d) for method="complete"; O(edges) for method="threshold".
+        """
+        slots = self._alive_slots()
+        if self._dim is None:
+            return
+        self._sum = self._X[slots].sum(axis=0) if slots.size else np.zeros(self._dim)
+        clamp = np.maximum(self._norm[slots], _HIL_EPS)
+        self._unit_sum = (
+            (self._X[slots] / clamp[:, None]).sum(axis=0) if slots.size else np.zeros(self._dim)
+        )
+
+        if self._method == "complete":
+            order = slots[np.argsort(self._seq[slots], kind="stable")]
+            V = self._V[order]
+            for pos, i in enumerate(order):
+                later = V[pos + 1:]
+                self._strength[i] = float(((later @ V[pos] + 1.0) * 0.5).sum()) if later.size else 0.0
+        else:
+            for i in slots:
+                self._strength[i] = float(sum(self._adj[int(i)].values()))
+            self._rebuild_components()
+
+    # ---- Read-out ----------------------------------------------------------
+
+    @property
+    def num_elements(self) -> int:
+        return len(self._slot)
+
+    def entropy(self) -> Optional[float]:
+        """
+        Structural entropy over the current per-element strengths. O(n).
+        """
+        if not self._slot:
+            return None
+        # Clamp subtraction residue; strengths are sums of weights in [0, 1].
+        s = np.maximum(self._strength[self._alive_slots()], 0.0)
+        h = _entropy_from_out_strengths(s)
+        _window_invariant(np.isfinite(h), "entropy must be finite")
+        return h
+
+    def coherence(self) -> Optional[float]:
+        """
+        Mean cosine to centroid from the running sums. O(d).
+
+        sum_r cos_r = <sum_r x_r / |x_r|, c> / |c|, norms clamped as in C.
+        """
+        n = self.num_elements
+        if n == 0:
+            return None
+        c = self._sum / float(n)
+        c_norm = max(float(np.linalg.norm(c)), _HIL_EPS)
+        return float(np.dot(self._unit_sum, c) / c_norm / float(n))
+
+    def components(self) -> int:
+        """
+        Connected component count of the window structure.
+
+        The complete graph is connected whenever it is non-empty; the
+        threshold graph reads the union-find, rebuilding it after removals.
+        """
+        if not self._slot:
+            return 0
+        if self._method == "complete":
+            return 1
+        if self._uf_stale:
+            self._rebuild_components()
+        slots = self._alive_slots()
+        return int(np.count_nonzero(self._parent[slots] == slots))
+
+
+# ---------------------------------------------------------------------------
+# Stream driver
+# ---------------------------------------------------------------------------
+
+def sliding_diagnostics(
+    *,
+    stream: StreamProtocol,
+    dt: float,
+    elements: Callable[[MicroSlice], Iterable[Tuple[Hashable, Any]]],
+    method: str = "complete",
+    min_weight: Optional[float] = None,
+    anchors: Optional[List[TimeIndex]] = None,
+    resync_every: Optional[int] = None,
+) -> Iterator[WindowTick]:
+    """
+    Emit one WindowTick per valid anchor, updating state incrementally.
+
+    `elements` maps a slice to its keyed (key, vector) members; keys shared
+    by consecutive slices are carried over without recomputation. With
+    resync_every=k, running sums are recomputed exactly every k ticks.
+    """
+    _window_invariant(resync_every is None or resync_every >= 1, "resync_every must be >= 1")
+
+    if anchors is None:
+        anchors = list(stream.times(dt))
+
+    engine = IncrementalDiagnostics(method=method, min_weight=min_weight)
+    ticks = 0
+    for t in anchors:
+        if not stream.is_valid_time(t):
+            continue
+        tick = engine.step(t, elements(stream.slice(t, dt)))
+        ticks += 1
+        if resync_every is not None and ticks % resync_every == 0:
+            engine.resync()
+            tick = WindowTick(
+                t=tick.t,
+                entropy=engine.entropy(),
+                coherence=engine.coherence(),
+                num_elements=tick.num_elements,
+                added=tick.added,
+                removed=tick.removed,
+            )
+        yield tick
+
+
+__all__ = [
+    "IncrementalDiagnostics",
+    "WindowTick",
+    "sliding_diagnostics",
+]
@@ -17,6 +17,9 @@ Definition (matches C):
     cos_r = dot(x_r, c) / (||x_r|| * ||c||), with each norm clamped to eps
 - Coherence = (1/n) * sum_r cos_r
 
+float32 fields are read in place and widened one row at a time; every
+reduction accumulates in float64 (as hil_field_coherence_f32).
+
 Invariants:
 - Geometric, not semantic
 - Diagnostic only (returns numbers; never classifies or labels)
@@ -56,7 +59,9 @@ def field_coherence(vectors: np.ndarray) -> float:
     float
         Mean cosine similarity to centroid (coherence proxy), matching C semantics.
     """
-    X = np.asarray(vectors, dtype=np.float64)
+    X = np.asarray(vectors)
+    if X.dtype != np.float32:
+        X = X.astype(np.float64, copy=False)
 
     _metric_invariant(X.ndim == 2, "vectors must be 2D (n, d)")
     n, d = X.shape
@@ -64,7 +69,7 @@ def field_coherence(vectors: np.ndarray) -> float:
     _metric_invariant(d >= 1, "vectors must have at least one column")
 
     # Centroid (matches C: sum then scale by 1/n)
-    centroid = X.sum(axis=0) / float(n)
+    centroid = X.sum(axis=0, dtype=np.float64) / float(n)
 
     # Norm clamps (matches C hil_clamp_min)
     c_norm = _clamp_min(float(np.linalg.norm(centroid)), _HIL_EPS)
@@ -72,7 +77,7 @@ def field_coherence(vectors: np.ndarray) -> float:
     # Mean cosine similarity to centroid
     sum_cos = 0.0
     for r in range(n):
-        row = X[r]
+        row = X[r].astype(np.float64, copy=False)
         r_norm = _clamp_min(float(np.linalg.norm(row)), _HIL_EPS)
         dot = float(np.dot(row, centroid))
         sum_cos += dot / (r_norm * c_norm)
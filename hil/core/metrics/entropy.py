@@ -13,10 +13,12 @@ Invariants:
 
 from __future__ import annotations
 
-from typing import Protocol
+from typing import Protocol, Union
 
 import numpy as np
 
+from hil.core.structure.graph import CSRGraph, PackedCSRGraph
+
 
 # ---------------------------------------------------------------------------
 # Invariants
@@ -70,7 +72,99 @@ def _entropy_from_out_strengths(out_strength: np.ndarray) -> float:
 # Public API
 # ---------------------------------------------------------------------------
 
-def structural_entropy(graph: _GraphLike) -> float:
+def _structural_entropy_csr(graph: CSRGraph) -> float:
+    """
+    Entropy over CSR row weight sums.
+
+    Row sums are out-strengths, so for a directed CSR graph this is the
+    NumPy out-strength entropy of graph.to_graph(); for a symmetric view it
+    is the entropy of the full weighted degree, matching native
+    hil_graph_entropy on the originating edge list.
+    """
+    _metric_invariant(graph.num_nodes >= 1, "graph.num_nodes must be >= 1")
+
+    if graph.num_edges == 0:
+        return 0.0
+
+    _metric_invariant(np.all(graph.weight >= 0.0), "weights must be non-negative")
+
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # type: ignore
+        from hil.core.native._shim import graph_entropy_csr as _native_entropy_csr  # type: ignore
+    except ImportError:
+        _native_entropy_csr = None  # type: ignore
+
+    if _native_entropy_csr is not None:
+        try:
+            h = float(
+                _native_entropy_csr(
+                    graph.offsets,
+                    graph.indices,
+                    graph.weight,
+                    graph.num_nodes,
+                )
+            )
+            _metric_invariant(np.isfinite(h), "native entropy must be finite")
+            _metric_invariant(h >= 0.0, "entropy must be >= 0")
+            return h
+        except NativeError:
+            pass
+
+    # --- Stage A/B: NumPy implementation ------------------------------------
+    h = _entropy_from_out_strengths(graph.out_strength())
+
+    _metric_invariant(np.isfinite(h), "entropy must be finite")
+    _metric_invariant(h >= 0.0, "entropy must be >= 0")
+
+    return h
+
+
+def _structural_entropy_packed(graph: PackedCSRGraph) -> float:
+    """
+    Entropy over the dequantized row sums of a packed graph.
+
+    Within graph.entropy_error_bound() of the entropy of the CSRGraph it
+    was packed from.
+    """
+    _metric_invariant(graph.num_nodes >= 1, "graph.num_nodes must be >= 1")
+
+    if graph.num_edges == 0:
+        return 0.0
+
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # type: ignore
+        from hil.core.native._shim import graph_entropy_packed as _native_entropy_packed  # type: ignore
+    except ImportError:
+        _native_entropy_packed = None  # type: ignore
+
+    if _native_entropy_packed is not None:
+        try:
+            h = float(
+                _native_entropy_packed(
+                    graph.offsets,
+                    graph.stream,
+                    graph.num_nodes,
+                    graph.num_edges,
+                )
+            )
+            _metric_invariant(np.isfinite(h), "native entropy must be finite")
+            _metric_invariant(h >= 0.0, "entropy must be >= 0")
+            return h
+        except NativeError:
+            pass
+
+    # --- Stage A/B: NumPy implementation ------------------------------------
+    h = _entropy_from_out_strengths(graph.out_strength())
+
+    _metric_invariant(np.isfinite(h), "entropy must be finite")
+    _metric_invariant(h >= 0.0, "entropy must be >= 0")
+
+    return h
+
+
+def structural_entropy(graph: Union[_GraphLike, CSRGraph, PackedCSRGraph]) -> float:
     """
     Compute a structural entropy quantity for a graph.
 
@@ -84,11 +178,20 @@ def structural_entropy(graph: _GraphLike) -> float:
     - Diagnostic (numeric only)
     - Deterministic (pure function)
 
+    A CSRGraph is accepted directly (see _structural_entropy_csr), so an
+    adjacency view built once can be reused across diagnostics; so is a
+    PackedCSRGraph (see _structural_entropy_packed).
+
     Backend stages:
     - Stage A/B: NumPy implementation (default).
-    - Stage C: Optional native backend if hil.core.native._shim.graph_entropy exists.
+    - Stage C: Optional native backend if hil.core.native._shim.graph_out_entropy
+      exists (hil_graph_out_entropy, the same out-strength definition).
       Native is strictly an acceleration, not a semantic change.
     """
+    if isinstance(graph, CSRGraph):
+        return _structural_entropy_csr(graph)
+    if isinstance(graph, PackedCSRGraph):
+        return _structural_entropy_packed(graph)
 
     # --- Structural sanity ---------------------------------------------------
     _metric_invariant(isinstance(graph.num_nodes, int), "graph.num_nodes must be an int")
@@ -135,8 +238,9 @@ def structural_entropy(graph: _GraphLike) -> float:
     # --- Stage C: optional native backend -----------------------------------
     try:
         # Import locally to preserve core boundary.
-        from hil.core.native._shim import graph_entropy as _native_graph_entropy  # type: ignore
-    except Exception:
+        from hil.core.native._shim import NativeError  # type: ignore
+        from hil.core.native._shim import graph_out_entropy as _native_graph_entropy  # type: ignore
+    except ImportError:
         _native_graph_entropy = None  # type: ignore
 
     if _native_graph_entropy is not None:
@@ -154,8 +258,8 @@ def structural_entropy(graph: _GraphLike) -> float:
             _metric_invariant(np.isfinite(h), "native entropy must be finite")
             _metric_invariant(h >= 0.0, "entropy must be >= 0")
             return h
-        except Exception:
-            # Fall back to NumPy path on any native failure.
+        except NativeError:
+            # Fall back to NumPy when the native path is unavailable or fails.
             pass
 
     # --- Stage A/B: NumPy implementation ------------------------------------
@@ -10,6 +10,7 @@ geometry of a field changes under controlled perturbation.
 Current implementation:
 - Orthogonal Procrustes distance between 2D PCA projections
   (baseline vs leave-one-out)
+- Batched leave-one-out deltas for every element (native when available)
 
 Invariants:
 - Structural, not semantic
@@ -90,8 +91,9 @@ def _procrustes_distance(A: np.ndarray, B: np.ndarray) -> float:
     _geom_invariant(A.shape == B.shape, "A and B must have same shape")
     _geom_invariant(A.shape[1] == 2, "A and B must be 2D")
 
-    # Optimal orthogonal alignment via SVD
-    M = A.T @ B
+    # Optimal orthogonal alignment via SVD: argmin_R |A - B R| = U V^T
+    # for B^T A = U S V^T
+    M = B.T @ A
     U, _, Vt = np.linalg.svd(M)
     R = U @ Vt
 
@@ -161,6 +163,68 @@ def geometry_delta_procrustes_2d(
     return _procrustes_distance(Yf, Yl)
 
 
+# ---------------------------------------------------------------------------
+# Geometry delta (all leave-one-out perturbations)
+# ---------------------------------------------------------------------------
+
+def geometry_delta_loo_2d(
+    X: np.ndarray,
+    *,
+    max_iter: int = 200,
+    tol: float = 1e-10,
+) -> np.ndarray:
+    """
+    geometry_delta_procrustes_2d for every removed element of X.
+
+    Parameters
+    ----------
+    X : np.ndarray, shape (n, d)
+        Field vectors (n >= 3, d >= 2).
+    max_iter, tol : native subspace iteration budget and relative tolerance.
+
+    Returns
+    -------
+    deltas : np.ndarray, shape (n,)
+        deltas[i] is the geometry delta for removing element i.
+
+    Backend stages:
+    - Stage C: native hil_geometry_delta_loo solves the baseline axes once
+      and each leave-one-out field as a rank-1 scatter downdate, warm-started
+      from the baseline axes; agrees with Stage A/B to ~1e-10 absolute
+      unless the 2nd and 3rd variances are (near) tied, where the 2D
+      projection itself is ill-defined.
+    - Stage A/B: one geometry_delta_procrustes_2d call per element.
+    """
+    _geom_invariant(isinstance(X, np.ndarray), "X must be np.ndarray")
+    _geom_invariant(X.ndim == 2, "X must be 2D")
+    _geom_invariant(X.shape[0] >= 3, "X must have at least 3 rows")
+    _geom_invariant(X.shape[1] >= 2, "X must have at least 2 columns")
+
+    deltas = None
+    try:
+        from hil.core.native._shim import NativeError, geometry_delta_loo  # noqa: WPS433
+    except ImportError:
+        geometry_delta_loo = None
+
+    if geometry_delta_loo is not None:
+        try:
+            deltas = geometry_delta_loo(X, max_iter=max_iter, tol=tol, copy=True)
+        except NativeError:
+            pass
+    if deltas is None:
+        deltas = np.array(
+            [
+                geometry_delta_procrustes_2d(X, np.delete(X, i, axis=0), removed_index=i)
+                for i in range(X.shape[0])
+            ],
+            dtype=np.float64,
+        )
+
+    _geom_invariant(np.isfinite(deltas).all(), "deltas must be finite")
+    return deltas
+
+
 __all__ = [
     "geometry_delta_procrustes_2d",
+    "geometry_delta_loo_2d",
 ]
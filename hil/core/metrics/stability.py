@@ -22,11 +22,11 @@ No thresholds, no regimes, no desirability claims are made.
 
 from __future__ import annotations
 
-from typing import Dict
+from typing import Dict, Optional, Tuple
 
 import numpy as np
 
-from hil.core.metrics.geometry_delta import geometry_delta_procrustes_2d
+from hil.core.metrics.geometry_delta import geometry_delta_loo_2d
 from hil.core.metrics.entropy import structural_entropy
 from hil.core.metrics.coherence import field_coherence
 from hil.core.structure.graph import Graph
@@ -41,6 +41,42 @@ def _metric_invariant(condition: bool, message: str) -> None:
         raise ValueError(f"[hil.core.metrics.stability invariant] {message}")
 
 
+# ---------------------------------------------------------------------------
+# Native leave-one-out engine (optional)
+# ---------------------------------------------------------------------------
+
+def _native_loo_diagnostics(
+    field_vectors: np.ndarray,
+    graph: Graph,
+) -> Optional[Tuple[np.ndarray, np.ndarray]]:
+    """
+    Per-element leave-one-out (entropy, coherence) from the native engine,
+    or None when the native backend is unavailable.
+
+    The engine removes element i and its incident edges from the baseline
+    graph instead of rebuilding, which equals the complete-graph rebuild
+    used below (weights depend only on the pair). Agreement with the
+    rebuild path is within ~1e-10 absolute.
+
+    The engine has no float32 variant, so float32 fields and weights are
+    widened here (one copy each).
+    """
+    try:
+        from hil.core.native._shim import NativeError, leave_one_out_diagnostics  # noqa: WPS433
+    except ImportError:
+        return None
+
+    try:
+        return leave_one_out_diagnostics(
+            field_vectors.astype(np.float64, copy=False),
+            graph.src,
+            graph.dst,
+            graph.weight.astype(np.float64, copy=False),
+        )
+    except NativeError:
+        return None
+
+
 # ---------------------------------------------------------------------------
 # Stability (leave-one-out)
 # ---------------------------------------------------------------------------
@@ -76,6 +112,13 @@ def structural_stability_leave_one_out(
     -------
     stability : dict[int, float]
         Mapping from element index to stability value.
+
+    Backend stages:
+    - Stage C: native hil_leave_one_out_diagnostics derives every
+      leave-one-out entropy and coherence from baseline state in O(m + n*d)
+      (parallel across elements). Geometry deltas come from one batched
+      geometry_delta_loo_2d call (native hil_geometry_delta_loo when present).
+    - Stage A/B: explicit rebuild of graph and metrics per element.
     """
     _metric_invariant(field_vectors.ndim == 2, "field_vectors must be 2D")
 
@@ -91,28 +134,30 @@ def structural_stability_leave_one_out(
 
     stability: Dict[int, float] = {}
 
-    # --- Leave-one-out loop --------------------------------------------
-    for i in range(n):
-        # Remove element i
-        X_loo = np.delete(field_vectors, i, axis=0)
-
-        # Geometry delta (primary signal)
-        delta_geom = geometry_delta_procrustes_2d(
-            field_vectors,
-            X_loo,
-            removed_index=i,
-        )
-
-        # Rebuild graph deterministically for LOO field
-        # (reuse the same construction rule as in core.api)
-        from hil.core.api import build_structure, CoreField  # local import by design
+    native_loo = _native_loo_diagnostics(field_vectors, graph)
 
-        loo_field = CoreField(vectors=X_loo)
-        loo_graph = build_structure(loo_field)
+    # Geometry deltas (primary signal), all elements in one call
+    geometry_loo = geometry_delta_loo_2d(field_vectors)
 
-        # Secondary deltas
-        entropy_loo = structural_entropy(loo_graph)
-        coherence_loo = field_coherence(X_loo)
+    # --- Leave-one-out loop --------------------------------------------
+    for i in range(n):
+        delta_geom = float(geometry_loo[i])
+
+        if native_loo is not None:
+            entropy_loo = float(native_loo[0][i])
+            coherence_loo = float(native_loo[1][i])
+        else:
+            # Remove element i and rebuild graph deterministically for the
+            # LOO field (reuse the same construction rule as in core.api)
+            from hil.core.api import build_structure, CoreField  # local import by design
+
+            X_loo = np.delete(field_vectors, i, axis=0)
+            loo_field = CoreField(vectors=X_loo)
+            loo_graph = build_structure(loo_field)
+
+            # Secondary deltas
+            entropy_loo = structural_entropy(loo_graph)
+            coherence_loo = field_coherence(X_loo)
 
         delta_entropy = abs(base_entropy - entropy_loo)
         delta_coherence = abs(base_coherence - coherence_loo)
@@ -13,6 +13,10 @@ Invariants:
 - No persistence / run state
 - Deterministic calls only
 - Accept NumPy arrays; validate dtype/shape; forward to native
+- No implicit copies: arrays the native layer cannot wrap in place raise
+  ValueError unless the caller passes copy=True
+- float32 vectors / weights select the `*_f32` exports (float32 storage,
+  double accumulation) and results keep float32 weights
 
 Development stages:
 A) Stub functions (this file) so Python core can shape its needs.
@@ -22,13 +26,33 @@ C) Native calls once `_native` exists and exports stable function names.
 
 from __future__ import annotations
 
-from typing import Any, Dict, Optional
+from typing import Any, Dict, Iterable, Optional, Tuple
 import os
 import numpy as np
 
 
-class NativeUnavailable(RuntimeError):
-    pass
+class NativeError(Exception):
+    """
+    Base of the errors a Stage C caller falls back to NumPy on. Anything
+    else raised through the shim (bad shapes, invalid input) is a bug and
+    should propagate.
+    """
+
+
+class NativeUnavailable(NativeError, RuntimeError):
+    """The extension is not built, or is missing an export."""
+
+
+class NativeCopyRequired(NativeError, ValueError):
+    """An input cannot be wrapped in place without a copy (pass copy=True)."""
+
+
+class NativeUnsupported(NativeError, ValueError):
+    """The input is outside what the native kernel handles (e.g. empty, too large, k > 3)."""
+
+
+class NativeKernelError(NativeError, RuntimeError):
+    """A native kernel reported failure (rejected input or allocation failure)."""
 
 
 def _native_available() -> bool:
@@ -61,40 +85,940 @@ def _require_native() -> Any:
         ) from e
 
 
+# ---- Zero-copy coercion ----------------------------------------------------
+
+def _as_vector(x: Any, dtype: Any, name: str, copy: bool) -> np.ndarray:
+    """
+    Return `x` as a contiguous 1D array of `dtype` the native layer wraps in place.
+
+    Without `copy`, only copy-free adaptations are made: non-negative signed
+    indices of the same width (e.g. int32 -> uint32) are reinterpreted as a
+    view. Anything that would need a copy raises NativeCopyRequired (a
+    ValueError).
+    """
+    dtype = np.dtype(dtype)
+    if copy or not isinstance(x, np.ndarray):
+        return np.ascontiguousarray(x, dtype=dtype)
+
+    if x.dtype != dtype:
+        if (
+            x.dtype.kind == "i"
+            and dtype.kind == "u"
+            and x.dtype.itemsize == dtype.itemsize
+            and x.dtype.isnative
+        ):
+            if x.size and int(x.min()) < 0:
+                raise ValueError(f"{name} must be non-negative")
+            x = x.view(dtype)
+        else:
+            raise NativeCopyRequired(
+                f"{name} must be {dtype.name} (got {x.dtype}); "
+                "converting would copy, pass copy=True"
+            )
+    if x.ndim == 1 and x.size > 1 and x.strides[0] != x.itemsize:
+        raise NativeCopyRequired(
+            f"{name} is not contiguous; wrapping would copy, pass copy=True"
+        )
+    return x
+
+
+def _as_matrix(x: Any, name: str, copy: bool, dtype: Any = np.float64) -> np.ndarray:
+    """
+    Return `x` as a `dtype` matrix the native layer wraps in place.
+
+    Rows may be strided (column slices, row steps); elements within a row
+    must be contiguous. Anything else raises NativeCopyRequired without `copy`.
+    """
+    dtype = np.dtype(dtype)
+    if copy or not isinstance(x, np.ndarray):
+        return np.ascontiguousarray(x, dtype=dtype)
+
+    if x.dtype != dtype:
+        raise NativeCopyRequired(
+            f"{name} must be {dtype.name} (got {x.dtype}); converting would copy, pass copy=True"
+        )
+    if x.ndim == 2 and x.size:
+        if (x.shape[1] > 1 and x.strides[1] != x.itemsize) or (
+            x.shape[0] > 1 and x.strides[0] < 0
+        ):
+            raise NativeCopyRequired(
+                f"{name} rows are not contiguous; wrapping would copy, pass copy=True"
+            )
+    return x
+
+
+def _storage(x: Any) -> Tuple[Any, str]:
+    """
+    (dtype, export suffix) for an input array: float32 arrays select the
+    float32-storage exports, anything else the float64 ones.
+    """
+    if isinstance(x, np.ndarray) and x.dtype == np.float32:
+        return np.float32, "_f32"
+    return np.float64, ""
+
+
+def _export(native: Any, name: str) -> Any:
+    if not hasattr(native, name):
+        raise NativeUnavailable(f"Native module missing {name} export")
+    return getattr(native, name)
+
+
 def graph_entropy(
     src: np.ndarray,
     dst: np.ndarray,
     weight: np.ndarray,
     num_nodes: int,
+    *,
+    copy: bool = False,
+    workspace: Any = None,
 ) -> float:
     """
     Native structural entropy.
 
     Stub shape:
       - src, dst: uint32 arrays (1D)
-      - weight: float64 array (1D)
+      - weight: float64 or float32 array (1D)
       - num_nodes: int
 
     Returns: float entropy
 
-    NOTE: This function will call `_native.graph_entropy` once bindings exist.
+    NOTE: This function will call `_native.graph_entropy` once bindings exist
+    (`graph_entropy_f32` for float32 weights).
+
+    workspace: a workspace_new() arena reused across calls (the _ws kernel);
+    None uses a temporary one.
     """
-    src = np.asarray(src, dtype=np.uint32)
-    dst = np.asarray(dst, dtype=np.uint32)
-    weight = np.asarray(weight, dtype=np.float64)
+    wtype, suffix = _storage(weight)
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, wtype, "weight", copy)
 
     if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
         raise ValueError("src, dst, weight must be 1D arrays")
     if src.shape != dst.shape or src.shape != weight.shape:
         raise ValueError("src, dst, weight must have identical shapes")
     if num_nodes < 1:
-        raise ValueError("num_nodes must be >= 1")
+        raise NativeUnsupported("num_nodes must be >= 1")
 
     # Stage C: native
     native = _require_native()
-    if not hasattr(native, "graph_entropy"):
-        raise AttributeError("Native module missing graph_entropy export")
-    return float(native.graph_entropy(src, dst, weight, int(num_nodes)))
+    entropy = _export(native, "graph_entropy" + suffix)
+    return float(entropy(src, dst, weight, int(num_nodes), workspace))
+
+
+def graph_out_entropy(
+    src: np.ndarray,
+    dst: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+) -> float:
+    """
+    Native out-strength entropy: p_i over the summed weights of edges
+    leaving i, the definition of structural_entropy for edge lists.
+
+    Arguments as graph_entropy, which counts both endpoints of every edge.
+    Calls `_native.graph_out_entropy` (hil_graph_out_entropy), or
+    `graph_out_entropy_f32` for float32 weights.
+    """
+    wtype, suffix = _storage(weight)
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, wtype, "weight", copy)
+
+    if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
+        raise ValueError("src, dst, weight must be 1D arrays")
+    if src.shape != dst.shape or src.shape != weight.shape:
+        raise ValueError("src, dst, weight must have identical shapes")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+
+    native = _require_native()
+    entropy = _export(native, "graph_out_entropy" + suffix)
+    return float(entropy(src, dst, weight, int(num_nodes)))
+
+
+def graph_components(
+    src: np.ndarray,
+    dst: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+    workspace: Any = None,
+) -> Tuple[int, np.ndarray, np.ndarray]:
+    """
+    Native weakly connected components with per-node labels.
+
+    Stub shape:
+      - src, dst: uint32 arrays (1D)
+      - weight: float64 array (1D)
+      - num_nodes: int
+
+    Returns: (count, labels, sizes)
+      - labels: uint32 array of length num_nodes, dense in [0, count),
+        numbered in order of each component's smallest node
+      - sizes: uint64 array of length count
+
+    Calls `_native.graph_components` (hil_graph_components). Labels do not
+    depend on native thread count.
+
+    workspace: a workspace_new() arena reused across calls (the _ws kernel);
+    None uses a temporary one.
+    """
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, np.float64, "weight", copy)
+
+    if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
+        raise ValueError("src, dst, weight must be 1D arrays")
+    if src.shape != dst.shape or src.shape != weight.shape:
+        raise ValueError("src, dst, weight must have identical shapes")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+
+    labels = np.empty(int(num_nodes), dtype=np.uint32)
+    sizes = np.empty(int(num_nodes), dtype=np.uint64)
+
+    native = _require_native()
+    if not hasattr(native, "graph_components"):
+        raise NativeUnavailable("Native module missing graph_components export")
+    count = int(native.graph_components(
+        src, dst, weight, int(num_nodes), labels, sizes, workspace
+    ))
+    if count < 1:
+        raise NativeKernelError("native graph_components failed")
+    return count, labels, sizes[:count]
+
+
+def graph_build_cosine(
+    vectors: np.ndarray,
+    *,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Native fully-connected cosine graph construction.
+
+    Stub shape:
+      - vectors: float64 or float32 array (2D, n x d), rows contiguous, any
+        row stride
+
+    Returns: (src, dst, weight) with src/dst uint32 and weight of the vectors'
+    dtype, each of length n*(n-1)/2, in row-major upper-triangle order (i < j).
+
+    Output arrays are allocated here and filled in place by
+    `_native.graph_build_cosine` (hil_graph_build_cosine) or
+    `_native.graph_build_cosine_f32`.
+    """
+    wtype, suffix = _storage(vectors)
+    X = _as_matrix(vectors, "vectors", copy, wtype)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    n = int(X.shape[0])
+    if n < 1:
+        raise NativeUnsupported("vectors must have at least one row")
+    if n > np.iinfo(np.uint32).max:
+        raise NativeUnsupported("vectors has too many rows for uint32 node indices")
+
+    m = (n * (n - 1)) // 2
+    src = np.empty(m, dtype=np.uint32)
+    dst = np.empty(m, dtype=np.uint32)
+    weight = np.empty(m, dtype=wtype)
+
+    native = _require_native()
+    build = _export(native, "graph_build_cosine" + suffix)
+    if not build(X, src, dst, weight):
+        raise NativeKernelError("native graph_build_cosine failed")
+    return src, dst, weight
+
+
+def graph_build_knn_csr(
+    vectors: np.ndarray,
+    k: int = 0,
+    min_weight: float = 0.0,
+    *,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Native sparse cosine graph construction in CSR form.
+
+    Stub shape:
+      - vectors: float64 or float32 array (2D, n x d), rows contiguous, any
+        row stride
+      - k: neighbours kept per node (0 = no cap)
+      - min_weight: minimum kept weight (0.0 = no cutoff)
+
+    Returns: (offsets, indices, weight) with offsets uint64 (n + 1),
+    indices uint32 and weight of the vectors' dtype (num_edges).
+
+    Calls `_native.graph_build_knn_csr` (hil_graph_build_knn_csr) or
+    `_native.graph_build_knn_csr_f32`.
+    """
+    wtype, suffix = _storage(vectors)
+    X = _as_matrix(vectors, "vectors", copy, wtype)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] < 1:
+        raise NativeUnsupported("vectors must have at least one row")
+    if X.shape[0] > np.iinfo(np.uint32).max:
+        raise NativeUnsupported("vectors has too many rows for uint32 node indices")
+    if k < 0:
+        raise ValueError("k must be >= 0")
+
+    native = _require_native()
+    build = _export(native, "graph_build_knn_csr" + suffix)
+    try:
+        offsets, indices, weight = build(X, int(k), float(min_weight))
+    except RuntimeError as e:
+        raise NativeKernelError(str(e)) from e
+    return (
+        np.asarray(offsets, dtype=np.uint64),
+        np.asarray(indices, dtype=np.uint32),
+        np.asarray(weight, dtype=wtype),
+    )
+
+
+def graph_build_csr(
+    src: np.ndarray,
+    dst: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Native symmetric CSR adjacency view of an edge list.
+
+    Stub shape:
+      - src, dst: uint32 arrays (1D)
+      - weight: float64 or float32 array (1D)
+      - num_nodes: int
+
+    Returns: (offsets, indices, weight) with offsets uint64 (n + 1),
+    indices uint32 and weight of the input weight dtype (2 * num_edges).
+
+    Calls `_native.graph_build_csr` (hil_graph_build_csr) or
+    `_native.graph_build_csr_f32`.
+    """
+    wtype, suffix = _storage(weight)
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, wtype, "weight", copy)
+
+    if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
+        raise ValueError("src, dst, weight must be 1D arrays")
+    if src.shape != dst.shape or src.shape != weight.shape:
+        raise ValueError("src, dst, weight must have identical shapes")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+
+    native = _require_native()
+    build = _export(native, "graph_build_csr" + suffix)
+    try:
+        offsets, indices, out_weight = build(src, dst, weight, int(num_nodes))
+    except RuntimeError as e:
+        raise NativeKernelError(str(e)) from e
+    return (
+        np.asarray(offsets, dtype=np.uint64),
+        np.asarray(indices, dtype=np.uint32),
+        np.asarray(out_weight, dtype=wtype),
+    )
+
+
+def _csr_arrays(
+    offsets: np.ndarray,
+    indices: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    copy: bool,
+    wtype: Any = np.float64,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """Validate and coerce CSR arrays to the hil_graph_csr_t layout."""
+    offsets = _as_vector(offsets, np.uint64, "offsets", copy)
+    indices = _as_vector(indices, np.uint32, "indices", copy)
+    weight = _as_vector(weight, wtype, "weight", copy)
+
+    if offsets.ndim != 1 or indices.ndim != 1 or weight.ndim != 1:
+        raise ValueError("offsets, indices, weight must be 1D arrays")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+    if offsets.shape != (num_nodes + 1,):
+        raise ValueError("offsets must have length num_nodes + 1")
+    if indices.shape != weight.shape:
+        raise ValueError("indices, weight must have identical shapes")
+    return offsets, indices, weight
+
+
+def graph_entropy_csr(
+    offsets: np.ndarray,
+    indices: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+) -> float:
+    """
+    Native structural entropy over a CSR graph (row weight sums).
+
+    Calls `_native.graph_entropy_csr` (hil_graph_entropy_csr), or
+    `_native.graph_entropy_csr_f32` for float32 weights.
+    """
+    wtype, suffix = _storage(weight)
+    offsets, indices, weight = _csr_arrays(offsets, indices, weight, num_nodes, copy, wtype)
+
+    native = _require_native()
+    entropy = _export(native, "graph_entropy_csr" + suffix)
+    return float(entropy(offsets, indices, weight, int(num_nodes)))
+
+
+def graph_connected_components_csr(
+    offsets: np.ndarray,
+    indices: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+) -> int:
+    """
+    Native (weakly) connected component count over a CSR graph.
+
+    Calls `_native.graph_connected_components_csr`
+    (hil_graph_connected_components_csr).
+    """
+    offsets, indices, weight = _csr_arrays(offsets, indices, weight, num_nodes, copy)
+
+    native = _require_native()
+    if not hasattr(native, "graph_connected_components_csr"):
+        raise NativeUnavailable("Native module missing graph_connected_components_csr export")
+    return int(native.graph_connected_components_csr(offsets, indices, weight, int(num_nodes)))
+
+
+def graph_pack_csr(
+    offsets: np.ndarray,
+    indices: np.ndarray,
+    weight: np.ndarray,
+    num_nodes: int,
+    *,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    Native packed CSR: 16-bit weights, delta-varint neighbour lists.
+
+    Stub shape:
+      - offsets, indices, weight: CSR arrays (weight float64, values in [0, 1])
+      - num_nodes: int
+
+    Returns: (offsets, stream) with offsets uint64 row byte offsets (n + 1)
+    and stream uint8 (hil_graph_packed_t layout). Rows are sorted by index.
+
+    Calls `_native.graph_pack_csr` (hil_graph_pack_csr).
+    """
+    offsets, indices, weight = _csr_arrays(offsets, indices, weight, num_nodes, copy)
+
+    native = _require_native()
+    pack = _export(native, "graph_pack_csr")
+    out_offsets, stream = pack(offsets, indices, weight, int(num_nodes))
+    return np.asarray(out_offsets, dtype=np.uint64), np.asarray(stream, dtype=np.uint8)
+
+
+def _packed_arrays(
+    offsets: np.ndarray,
+    stream: np.ndarray,
+    num_nodes: int,
+    copy: bool,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """Validate and coerce packed arrays to the hil_graph_packed_t layout."""
+    offsets = _as_vector(offsets, np.uint64, "offsets", copy)
+    stream = _as_vector(stream, np.uint8, "stream", copy)
+
+    if offsets.ndim != 1 or stream.ndim != 1:
+        raise ValueError("offsets, stream must be 1D arrays")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+    if offsets.shape != (num_nodes + 1,):
+        raise ValueError("offsets must have length num_nodes + 1")
+    return offsets, stream
+
+
+def graph_degree_packed(
+    offsets: np.ndarray,
+    stream: np.ndarray,
+    num_nodes: int,
+    num_edges: int,
+    *,
+    copy: bool = False,
+) -> np.ndarray:
+    """
+    Native dequantized row weight sums of a packed graph.
+
+    Calls `_native.graph_degree_packed` (hil_graph_degree_packed).
+    """
+    offsets, stream = _packed_arrays(offsets, stream, num_nodes, copy)
+
+    native = _require_native()
+    degree = _export(native, "graph_degree_packed")
+    return np.asarray(degree(offsets, stream, int(num_nodes), int(num_edges)), dtype=np.float64)
+
+
+def graph_entropy_packed(
+    offsets: np.ndarray,
+    stream: np.ndarray,
+    num_nodes: int,
+    num_edges: int,
+    *,
+    copy: bool = False,
+) -> float:
+    """
+    Native structural entropy over a packed graph.
+
+    Calls `_native.graph_entropy_packed` (hil_graph_entropy_packed).
+    """
+    offsets, stream = _packed_arrays(offsets, stream, num_nodes, copy)
+
+    native = _require_native()
+    entropy = _export(native, "graph_entropy_packed")
+    return float(entropy(offsets, stream, int(num_nodes), int(num_edges)))
+
+
+def graph_entropy_packed_bound(
+    offsets: np.ndarray,
+    stream: np.ndarray,
+    num_nodes: int,
+    num_edges: int,
+    *,
+    copy: bool = False,
+) -> float:
+    """
+    Native bound on the entropy change caused by weight quantization.
+
+    Calls `_native.graph_entropy_packed_bound` (hil_graph_entropy_packed_bound).
+    """
+    offsets, stream = _packed_arrays(offsets, stream, num_nodes, copy)
+
+    native = _require_native()
+    bound = _export(native, "graph_entropy_packed_bound")
+    return float(bound(offsets, stream, int(num_nodes), int(num_edges)))
+
+
+def graph_connected_components_packed(
+    offsets: np.ndarray,
+    stream: np.ndarray,
+    num_nodes: int,
+    num_edges: int,
+    *,
+    copy: bool = False,
+) -> int:
+    """
+    Native (weakly) connected component count over a packed graph.
+
+    Calls `_native.graph_connected_components_packed`
+    (hil_graph_connected_components_packed).
+    """
+    offsets, stream = _packed_arrays(offsets, stream, num_nodes, copy)
+
+    native = _require_native()
+    components = _export(native, "graph_connected_components_packed")
+    return int(components(offsets, stream, int(num_nodes), int(num_edges)))
+
+
+def leave_one_out_diagnostics(
+    vectors: np.ndarray,
+    src: np.ndarray,
+    dst: np.ndarray,
+    weight: np.ndarray,
+    *,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    Native leave-one-out entropy and coherence for every element.
+
+    Stub shape:
+      - vectors: float64 array (2D, n x d), rows contiguous, any row stride
+      - src, dst: uint32 arrays (1D); weight: float64 array (1D), the edge
+        list over the same n nodes (as produced by graph_build_cosine)
+
+    Returns: (entropy_loo, coherence_loo), float64 arrays of length n.
+    entropy_loo[i] is the out-strength entropy (graph_out_entropy) of the
+    graph without node i and its edges.
+
+    Calls `_native.leave_one_out_diagnostics`
+    (hil_leave_one_out_diagnostics).
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    n = int(X.shape[0])
+    if n < 2:
+        raise NativeUnsupported("vectors must have at least two rows")
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, np.float64, "weight", copy)
+
+    if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
+        raise ValueError("src, dst, weight must be 1D arrays")
+    if src.shape != dst.shape or src.shape != weight.shape:
+        raise ValueError("src, dst, weight must have identical shapes")
+
+    entropy_loo = np.empty(n, dtype=np.float64)
+    coherence_loo = np.empty(n, dtype=np.float64)
+
+    native = _require_native()
+    if not hasattr(native, "leave_one_out_diagnostics"):
+        raise NativeUnavailable("Native module missing leave_one_out_diagnostics export")
+    if not native.leave_one_out_diagnostics(
+        X, src, dst, weight, entropy_loo, coherence_loo
+    ):
+        raise NativeKernelError("native leave_one_out_diagnostics failed")
+    return entropy_loo, coherence_loo
+
+
+def epistemic_stability_curve(
+    vectors: np.ndarray,
+    epsilons: Any,
+    *,
+    copy: bool = False,
+) -> np.ndarray:
+    """
+    Native coherence sensitivity curve, one value per epsilon.
+
+    Stub shape:
+      - vectors: float64 array (2D, n x d), rows contiguous, any row stride
+      - epsilons: positive perturbation magnitudes (1D)
+
+    Returns: float64 array, |C(perturbed(eps_k)) - C| / eps_k.
+
+    Calls `_native.epistemic_stability_curve`
+    (hil_epistemic_stability_curve); one pass over the field for all eps.
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+    eps = np.ascontiguousarray(epsilons, dtype=np.float64).reshape(-1)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] < 1 or X.shape[1] < 1:
+        raise NativeUnsupported("vectors must be non-empty")
+    if eps.size < 1 or not np.all(eps > 0.0):
+        raise ValueError("epsilons must be non-empty and > 0")
+
+    out = np.empty(eps.size, dtype=np.float64)
+
+    native = _require_native()
+    if not hasattr(native, "epistemic_stability_curve"):
+        raise NativeUnavailable("Native module missing epistemic_stability_curve export")
+    if not native.epistemic_stability_curve(X, eps, out):
+        raise NativeKernelError("native epistemic_stability_curve failed")
+    return out
+
+
+def field_summary(
+    vectors: np.ndarray,
+    *,
+    return_row_norms: bool = False,
+    copy: bool = False,
+    workspace: Any = None,
+) -> Dict[str, Any]:
+    """
+    Fused single-pass field summary.
+
+    Stub shape:
+      - vectors: float64 or float32 array (2D, n x d), rows contiguous, any
+        row stride
+
+    Calls `_native.field_summary` (hil_field_summary), or
+    `_native.field_summary_f32` for float32 vectors, and returns
+
+      - "mean_norm", "centroid_norm", "coherence" (floats)
+      - "row_norms" (float64 array of length n), only if return_row_norms
+
+    workspace: a workspace_new() arena reused across calls (the _ws kernel);
+    None uses a temporary one.
+    """
+    wtype, suffix = _storage(vectors)
+    X = _as_matrix(vectors, "vectors", copy, wtype)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] < 1 or X.shape[1] < 1:
+        raise NativeUnsupported("vectors must be non-empty")
+
+    row_norms = np.empty(X.shape[0], dtype=np.float64) if return_row_norms else None
+
+    native = _require_native()
+    summary = _export(native, "field_summary" + suffix)
+    try:
+        out = summary(X, row_norms, workspace)
+    except RuntimeError as e:
+        raise NativeKernelError(str(e)) from e
+
+    result: Dict[str, Any] = {str(k): float(v) for k, v in dict(out).items()}
+    if row_norms is not None:
+        result["row_norms"] = row_norms
+    return result
+
+
+# ---- Geometric delta (PCA / Procrustes) ------------------------------------
+
+def pca_axes(
+    vectors: np.ndarray,
+    k: int = 2,
+    *,
+    warm_axes: Optional[np.ndarray] = None,
+    max_iter: int = 200,
+    tol: float = 1e-10,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    Native leading principal axes.
+
+    Stub shape:
+      - vectors: float64 array (2D, n x d), rows contiguous, any row stride
+      - k: 1 <= k <= min(d, 3)
+      - warm_axes: optional (k, d) starting axes, e.g. a baseline field's
+
+    Returns: (axes (k, d), mean (d,), variance (k,)); axes are unit rows by
+    descending variance, signed so each row's largest-magnitude entry is
+    positive.
+
+    Calls `_native.pca_axes` (hil_pca_axes): subspace iteration, converged
+    to tol relative to the leading variance or stopped after max_iter.
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    n, d = int(X.shape[0]), int(X.shape[1])
+    if n < 1 or not 1 <= int(k) <= min(d, 3):
+        raise NativeUnsupported("vectors must be non-empty and k in [1, min(d, 3)]")
+    warm = None
+    if warm_axes is not None:
+        warm = np.ascontiguousarray(warm_axes, dtype=np.float64).reshape(-1)
+
+    axes = np.empty(int(k) * d, dtype=np.float64)
+    mean = np.empty(d, dtype=np.float64)
+    variance = np.empty(int(k), dtype=np.float64)
+
+    native = _require_native()
+    if not hasattr(native, "pca_axes"):
+        raise NativeUnavailable("Native module missing pca_axes export")
+    if not native.pca_axes(X, int(k), warm, int(max_iter), float(tol), axes, mean, variance):
+        raise NativeKernelError("native pca_axes failed")
+    return axes.reshape(int(k), d), mean, variance
+
+
+def pca_axes_batch(
+    fields: Iterable[np.ndarray],
+    k: int = 2,
+    *,
+    warm_axes: Optional[np.ndarray] = None,
+    max_iter: int = 200,
+    tol: float = 1e-10,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+    """
+    pca_axes for many fields of one dimensionality in a single call.
+
+    Fields are stacked once (a copy) and solved in parallel natively.
+
+    Returns: (axes (count, k, d), means (count, d), variances (count, k)).
+
+    Calls `_native.pca_axes_batch` (hil_pca_axes_batch); warm_axes is
+    shared by all fields.
+    """
+    blocks = [np.asarray(f, dtype=np.float64) for f in fields]
+    if not blocks or any(b.ndim != 2 or b.shape[0] < 1 for b in blocks):
+        raise ValueError("fields must be a non-empty sequence of non-empty 2D arrays")
+    d = int(blocks[0].shape[1])
+    if any(int(b.shape[1]) != d for b in blocks):
+        raise ValueError("fields must share one dimensionality")
+    if not 1 <= int(k) <= min(d, 3):
+        raise NativeUnsupported("k must be in [1, min(d, 3)]")
+
+    X = np.ascontiguousarray(np.vstack(blocks))
+    row_offsets = np.zeros(len(blocks) + 1, dtype=np.uint64)
+    row_offsets[1:] = np.cumsum([b.shape[0] for b in blocks], dtype=np.uint64)
+    warm = None
+    if warm_axes is not None:
+        warm = np.ascontiguousarray(warm_axes, dtype=np.float64).reshape(-1)
+
+    count = len(blocks)
+    axes = np.empty(count * int(k) * d, dtype=np.float64)
+    means = np.empty(count * d, dtype=np.float64)
+    variances = np.empty(count * int(k), dtype=np.float64)
+
+    native = _require_native()
+    if not hasattr(native, "pca_axes_batch"):
+        raise NativeUnavailable("Native module missing pca_axes_batch export")
+    if not native.pca_axes_batch(
+        X, row_offsets, int(k), warm, int(max_iter), float(tol), axes, means, variances
+    ):
+        raise NativeKernelError("native pca_axes_batch failed")
+    return axes.reshape(count, int(k), d), means.reshape(count, d), variances.reshape(count, int(k))
+
+
+def geometry_delta_loo(
+    vectors: np.ndarray,
+    *,
+    max_iter: int = 200,
+    tol: float = 1e-10,
+    copy: bool = False,
+) -> np.ndarray:
+    """
+    Native leave-one-out geometry delta for every element.
+
+    Stub shape:
+      - vectors: float64 array (2D, n x d), n >= 3, d >= 2, rows contiguous
+
+    Returns: float64 array of length n, the 2D PCA + Procrustes delta of
+    hil.core.metrics.geometry_delta.geometry_delta_procrustes_2d for each
+    removed element.
+
+    Calls `_native.geometry_delta_loo` (hil_geometry_delta_loo): baseline
+    axes once, then a rank-1 scatter downdate and warm-started iteration
+    per element.
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] < 3 or X.shape[1] < 2:
+        raise NativeUnsupported("vectors must have at least 3 rows and 2 columns")
+
+    out = np.empty(int(X.shape[0]), dtype=np.float64)
+
+    native = _require_native()
+    if not hasattr(native, "geometry_delta_loo"):
+        raise NativeUnavailable("Native module missing geometry_delta_loo export")
+    if not native.geometry_delta_loo(X, int(max_iter), float(tol), out):
+        raise NativeKernelError("native geometry_delta_loo failed")
+    return out
+
+
+# ---- Snapshot batches ------------------------------------------------------
+
+def field_summary_batch(
+    vectors: np.ndarray,
+    row_offsets: Any,
+    *,
+    return_centroids: bool = False,
+    copy: bool = False,
+) -> Tuple[np.ndarray, Optional[np.ndarray]]:
+    """
+    field_summary for T snapshots held in one field buffer, in one call.
+
+    Stub shape:
+      - vectors: float64 array (2D, N x d), rows contiguous, any row stride
+      - row_offsets: (T + 1,) strictly increasing from 0 to N; snapshot t is
+        rows [row_offsets[t], row_offsets[t + 1])
+
+    Returns: (summaries (T, 3) with columns mean_norm, centroid_norm,
+    coherence; centroids (T, d) or None unless return_centroids).
+
+    Calls `_native.field_summary_batch` (hil_field_summary_batch); snapshots
+    are wrapped in place and summarized in parallel.
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+    off = np.ascontiguousarray(row_offsets, dtype=np.uint64).reshape(-1)
+
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] < 1 or X.shape[1] < 1:
+        raise NativeUnsupported("vectors must be non-empty")
+    if off.size < 2:
+        raise ValueError("row_offsets must delimit at least one snapshot")
+
+    count = int(off.size) - 1
+    summaries = np.empty(3 * count, dtype=np.float64)
+    centroids = np.empty(count * int(X.shape[1]), dtype=np.float64) if return_centroids else None
+
+    native = _require_native()
+    batch = _export(native, "field_summary_batch")
+    if not batch(X, off, summaries, centroids):
+        raise NativeKernelError("native field_summary_batch failed")
+    return (
+        summaries.reshape(count, 3),
+        None if centroids is None else centroids.reshape(count, int(X.shape[1])),
+    )
+
+
+def macrostate_dispersion_batch(
+    stack: np.ndarray,
+    norm: str = "l2",
+    *,
+    copy: bool = False,
+) -> np.ndarray:
+    """
+    Native macrostate dispersion of T snapshots.
+
+    Stub shape:
+      - stack: float64 array (3D, T x G x k), C-contiguous: snapshot t built
+        under G moduli settings
+      - norm: "l2" or "linf"
+
+    Returns: float64 array (T,), hil.core.timebase.macrostate_dispersion of
+    each snapshot's G macrostates.
+
+    Calls `_native.macrostate_dispersion_batch`
+    (hil_macrostate_dispersion_batch).
+    """
+    if norm not in ("l2", "linf"):
+        raise ValueError(f"Unknown norm: {norm}")
+    if copy or not isinstance(stack, np.ndarray):
+        S = np.ascontiguousarray(stack, dtype=np.float64)
+    else:
+        S = stack
+        if S.dtype != np.float64 or not S.flags.c_contiguous:
+            raise NativeCopyRequired(
+                "stack must be C-contiguous float64; converting would copy, pass copy=True"
+            )
+
+    if S.ndim != 3 or S.shape[1] < 1 or S.shape[2] < 1:
+        raise ValueError("stack must be a 3D array (T, G, k) with G, k >= 1")
+
+    count, group, k = (int(n) for n in S.shape)
+    out = np.empty(count, dtype=np.float64)
+
+    native = _require_native()
+    batch = _export(native, "macrostate_dispersion_batch")
+    if not batch(S.reshape(-1), count, group, k, norm == "linf", out):
+        raise NativeKernelError("native macrostate_dispersion_batch failed")
+    return out
+
+
+def fiber_entropy_batch(
+    sigmas: np.ndarray,
+    *,
+    copy: bool = False,
+) -> np.ndarray:
+    """
+    Native fiber entropy of every macrostate.
+
+    Stub shape:
+      - sigmas: float64 array (2D, m x k), rows contiguous, any row stride
+
+    Returns: float64 array (m,), Shannon entropy of |sigma| / sum |sigma|
+    per row (0 for a zero row).
+
+    Calls `_native.fiber_entropy_batch` (hil_fiber_entropy_batch).
+    """
+    X = _as_matrix(sigmas, "sigmas", copy)
+
+    if X.ndim != 2:
+        raise ValueError("sigmas must be a 2D array")
+    if X.shape[0] and X.shape[1] < 1:
+        raise NativeUnsupported("sigmas must have at least one column")
+
+    out = np.empty(int(X.shape[0]), dtype=np.float64)
+    if out.size == 0:
+        return out
+
+    native = _require_native()
+    batch = _export(native, "fiber_entropy_batch")
+    if not batch(X, out):
+        raise NativeKernelError("native fiber_entropy_batch failed")
+    return out
 
 
 def graph_metrics(
@@ -102,25 +1026,433 @@ def graph_metrics(
     dst: np.ndarray,
     weight: np.ndarray,
     num_nodes: int,
+    *,
+    copy: bool = False,
+    workspace: Any = None,
 ) -> Dict[str, float]:
     """
     Optional convenience wrapper returning a dict of native graph metrics.
 
     Not required for core correctness, but useful as a single call boundary.
 
-    Will call `_native.graph_metrics` if present; otherwise only entropy is returned.
+    Will call `_native.graph_metrics` (hil_graph_metrics) if present: one fused
+    pass over the edge arrays returning
+
+      - "mean_degree", "total_weight", "density" (floats)
+      - "degree_entropy": as graph_entropy (both endpoints of every edge)
+      - "out_entropy": as graph_out_entropy, i.e. structural_entropy
+      - "components" (int)
+
+    Otherwise only the two entropies are returned. float32 weights use
+    `_native.graph_metrics_f32`.
+
+    workspace: a workspace_new() arena reused across calls (the _ws kernel);
+    None uses a temporary one.
     """
+    wtype, suffix = _storage(weight)
+    src = _as_vector(src, np.uint32, "src", copy)
+    dst = _as_vector(dst, np.uint32, "dst", copy)
+    weight = _as_vector(weight, wtype, "weight", copy)
+
+    if src.ndim != 1 or dst.ndim != 1 or weight.ndim != 1:
+        raise ValueError("src, dst, weight must be 1D arrays")
+    if src.shape != dst.shape or src.shape != weight.shape:
+        raise ValueError("src, dst, weight must have identical shapes")
+    if num_nodes < 1:
+        raise NativeUnsupported("num_nodes must be >= 1")
+
+    native = _require_native()
+
+    if hasattr(native, "graph_metrics" + suffix):
+        try:
+            out = getattr(native, "graph_metrics" + suffix)(
+                src, dst, weight, int(num_nodes), workspace
+            )
+        except RuntimeError as e:
+            raise NativeKernelError(str(e)) from e
+        # Expect dict-like output from native; coerce to Python scalars.
+        return {
+            str(k): (int(v) if k == "components" else float(v))
+            for k, v in dict(out).items()
+        }
+
+    # Fallback: only the entropies via the single-function exports
+    return {
+        "degree_entropy": graph_entropy(src, dst, weight, num_nodes, workspace=workspace),
+        "out_entropy": graph_out_entropy(src, dst, weight, num_nodes),
+    }
+
+
+# ---- Linear operators ------------------------------------------------------
+
+def field_spectrum(
+    vectors: np.ndarray,
+    k: int,
+    *,
+    covariance: bool = False,
+    ncv: int = 0,
+    max_restarts: int = 100,
+    tol: float = 1e-10,
+    start: Optional[np.ndarray] = None,
+    eigenvectors: bool = True,
+    copy: bool = False,
+) -> Tuple[np.ndarray, Optional[np.ndarray], Dict[str, int]]:
+    """
+    Native top-k eigenpairs of the Gram X X^T (N = n) or, with
+    covariance=True, of (X - mu)^T (X - mu) / n (N = d), matrix-free
+    (hil_field_spectrum, thick-restart Lanczos).
+
+    Stub shape:
+      - vectors: float64 array (2D, n x d), rows contiguous, any row stride
+      - k: 1 <= k <= N; ncv: Krylov basis size (0 = default, else > k)
+      - start: optional (N,) start vector; default fixed-seed
+
+    Returns: (values (k,) descending, eigenvectors (k, N) unit rows signed
+    so each row's largest-magnitude entry is positive, or None when
+    eigenvectors=False, info {"matvecs", "restarts", "converged"}).
+    info["converged"] < k when max_restarts ran out first.
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+    if X.ndim != 2 or X.shape[0] == 0 or X.shape[1] == 0:
+        raise ValueError("vectors must be a non-empty 2D array")
+
+    side = int(X.shape[1] if covariance else X.shape[0])
+    if not 1 <= int(k) <= side:
+        raise NativeUnsupported(f"k must be in [1, {side}]")
+    v0 = None
+    if start is not None:
+        v0 = np.ascontiguousarray(start, dtype=np.float64).reshape(-1)
+
+    values = np.empty(int(k), dtype=np.float64)
+    vecs = np.empty(int(k) * side, dtype=np.float64) if eigenvectors else None
+
+    native = _require_native()
+    info = _export(native, "field_spectrum")(
+        X, bool(covariance), int(k), int(ncv), int(max_restarts), float(tol), v0, values, vecs
+    )
+    if info is None:
+        raise NativeKernelError("native field_spectrum failed")
+    return (
+        values,
+        None if vecs is None else vecs.reshape(int(k), side),
+        {str(key): int(v) for key, v in dict(info).items()},
+    )
+
+
+# ---- Lexicon ---------------------------------------------------------------
+
+# Code points whose lower-case form contains ASCII token characters. Folding
+# them before encoding makes the byte tokenizer match str.lower() exactly.
+_LEXICON_FOLD = str.maketrans({"\u0130": "i\u0307", "\u212a": "k"})
+
+
+def term_document(
+    documents: Iterable[str],
+    *,
+    min_count: int = 1,
+    max_terms: Optional[int] = None,
+    batch_bytes: int = 1 << 26,
+) -> Tuple[np.ndarray, np.ndarray, np.ndarray, np.ndarray, list]:
+    """
+    Native streaming tokenizer and term-document counter.
+
+    Documents are UTF-8 encoded and handed to the native lexicon in batches
+    of roughly batch_bytes, so the corpus is never joined into one buffer.
+
+    Returns: (offsets, indices, counts, term_counts, terms)
+      - offsets: uint64 (n_docs + 1), indices: uint32, counts: float64 — CSR
+      - term_counts: uint64 corpus count per term id
+      - terms: list of str, ordered as hil.core.embeddings.vocabulary
+
+    Calls `_native.lexicon_new` / `lexicon_add` / `lexicon_finish`
+    (hilbert_lexicon.h).
+    """
+    if min_count < 1:
+        raise NativeUnsupported("min_count must be >= 1")
+    if max_terms is not None and max_terms < 1:
+        raise NativeUnsupported("max_terms must be >= 1")
+    if batch_bytes < 1:
+        raise ValueError("batch_bytes must be >= 1")
+
     native = _require_native()
+    if not hasattr(native, "lexicon_new"):
+        raise NativeUnavailable("Native module missing lexicon exports")
+    lex = native.lexicon_new()
+
+    def _flush(parts: list) -> None:
+        offsets = np.zeros(len(parts) + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum([len(p) for p in parts], dtype=np.uint64)
+        if not native.lexicon_add(lex, b"".join(parts), offsets):
+            raise NativeKernelError("native lexicon_add failed")
 
-    if hasattr(native, "graph_metrics"):
-        out = native.graph_metrics(
-            np.asarray(src, dtype=np.uint32),
-            np.asarray(dst, dtype=np.uint32),
-            np.asarray(weight, dtype=np.float64),
-            int(num_nodes),
+    parts: list = []
+    pending = 0
+    for doc in documents:
+        enc = doc.translate(_LEXICON_FOLD).encode("utf-8")
+        parts.append(enc)
+        pending += len(enc)
+        if pending >= batch_bytes:
+            _flush(parts)
+            parts, pending = [], 0
+    if parts:
+        _flush(parts)
+
+    try:
+        off, idx, cnt, tc, toff, raw = native.lexicon_finish(
+            lex, int(min_count), 0 if max_terms is None else int(max_terms)
         )
-        # Expect dict-like output from native; coerce to Python floats.
-        return {str(k): float(v) for k, v in dict(out).items()}
+    except RuntimeError as e:
+        raise NativeKernelError(str(e)) from e
+    toff = np.asarray(toff)
+    terms = [raw[toff[i]:toff[i + 1]].decode("ascii") for i in range(toff.size - 1)]
+    return np.asarray(off), np.asarray(idx), np.asarray(cnt), np.asarray(tc), terms
+
+
+# ---- ANN index -------------------------------------------------------------
+
+def _ann_native() -> Any:
+    native = _require_native()
+    if not hasattr(native, "ann_new"):
+        raise NativeUnavailable("Native module missing ann exports")
+    return native
+
+
+def ann_new(
+    dim: int,
+    *,
+    m: int = 16,
+    ef_construction: int = 200,
+    seed: int = 0,
+) -> Any:
+    """
+    Empty native HNSW index over dim-wide rows (hil_ann_create).
+
+    Returns an opaque handle for the other ann_* calls; the index is freed
+    with the handle. Rows are normalised and ranked exactly as in
+    graph_build_knn_csr.
+    """
+    if dim < 1 or m < 2 or ef_construction < 1:
+        raise ValueError("requires dim >= 1, m >= 2 and ef_construction >= 1")
+    if not 0 <= seed < 1 << 64:
+        raise ValueError("seed must fit in 64 bits")
+    return _ann_native().ann_new(int(dim), int(m), int(ef_construction), int(seed))
+
+
+def ann_add(index: Any, vectors: np.ndarray, *, copy: bool = False) -> None:
+    """
+    Append rows to the index (hil_ann_add); row r becomes node size + r.
+
+    Stub shape:
+      - vectors: float64 array (2D, n x dim), rows contiguous, any row stride
+    """
+    X = _as_matrix(vectors, "vectors", copy)
+    if X.ndim != 2:
+        raise ValueError("vectors must be a 2D array")
+    if X.shape[0] == 0:
+        return
+    if not _ann_native().ann_add(index, X):
+        raise NativeKernelError("native ann_add failed")
+
+
+def _ann_outputs(count: int, k: int) -> Tuple[np.ndarray, np.ndarray]:
+    return np.empty(count * k, dtype=np.uint32), np.empty(count * k, dtype=np.float64)
+
+
+def ann_query(
+    index: Any,
+    queries: np.ndarray,
+    k: int,
+    *,
+    ef: int = 64,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    Approximate top-k neighbours of each query row (hil_ann_query).
+
+    Returns (ids, weight), each (n_queries, k), best first; slots past the
+    neighbours found hold id 2**32 - 1 and weight 0.
+    """
+    if k < 1 or ef < 0:
+        raise ValueError("requires k >= 1 and ef >= 0")
+    Q = _as_matrix(queries, "queries", copy)
+    if Q.ndim != 2:
+        raise ValueError("queries must be a 2D array")
+    ids, w = _ann_outputs(int(Q.shape[0]), int(k))
+    if Q.shape[0] and not _ann_native().ann_query(index, Q, int(k), int(ef), ids, w):
+        raise NativeKernelError("native ann_query failed")
+    return ids.reshape(-1, k), w.reshape(-1, k)
+
+
+def ann_query_nodes(
+    index: Any,
+    nodes: np.ndarray,
+    k: int,
+    *,
+    ef: int = 64,
+    copy: bool = False,
+) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    As ann_query for stored nodes, never reporting a node as its own
+    neighbour (hil_ann_query_nodes).
+    """
+    if k < 1 or ef < 0:
+        raise ValueError("requires k >= 1 and ef >= 0")
+    ids_in = _as_vector(nodes, np.uint32, "nodes", copy)
+    ids, w = _ann_outputs(int(ids_in.size), int(k))
+    if ids_in.size and not _ann_native().ann_query_nodes(index, ids_in, int(k), int(ef), ids, w):
+        raise NativeKernelError("native ann_query_nodes failed")
+    return ids.reshape(-1, k), w.reshape(-1, k)
+
+
+def ann_info(index: Any) -> Dict[str, int]:
+    """
+    {"dim", "size", "m", "ef_construction", "seed", "max_level", "entry"};
+    entry is -1 while the index is empty.
+    """
+    return {str(k): int(v) for k, v in dict(_ann_native().ann_info(index)).items()}
+
+
+def ann_export(index: Any) -> Dict[str, Any]:
+    """
+    Flat form of the index (hil_ann_export): ann_info plus the arrays
+    "vectors" (size x dim float64), "levels" (uint32), "offsets" (uint64,
+    size + 1) and "links" (uint32). ann_import(ann_export(i)) answers every
+    query exactly as i.
+    """
+    native = _ann_native()
+    info = ann_info(index)
+    vectors, levels, offsets, links = native.ann_export(index)
+    out: Dict[str, Any] = dict(info)
+    out["vectors"] = np.asarray(vectors).reshape(info["size"], info["dim"])
+    out["levels"] = np.asarray(levels)
+    out["offsets"] = np.asarray(offsets)
+    out["links"] = np.asarray(links)
+    return out
+
+
+def ann_import(state: Dict[str, Any], *, copy: bool = False) -> Any:
+    """
+    Rebuild an index handle from ann_export output (hil_ann_import). The
+    arrays are copied and validated natively; ValueError if they do not
+    describe a valid index.
+    """
+    vectors = _as_matrix(state["vectors"], "vectors", copy)
+    return _ann_native().ann_import(
+        int(state["dim"]),
+        int(state["m"]),
+        int(state["ef_construction"]),
+        int(state["seed"]),
+        int(state["entry"]),
+        int(state["max_level"]),
+        np.ascontiguousarray(vectors).reshape(-1),
+        _as_vector(state["levels"], np.uint32, "levels", copy),
+        _as_vector(state["offsets"], np.uint64, "offsets", copy),
+        _as_vector(state["links"], np.uint32, "links", copy),
+    )
+
+
+# ---- Workspaces ------------------------------------------------------------
+
+def workspace_new(initial_bytes: int = 0) -> Any:
+    """
+    Native scratch arena (hil_workspace_t) for the `workspace=` argument of
+    graph_entropy, graph_metrics, graph_components and field_summary.
+
+    The arena grows to the largest call it has served, so a repeated call
+    pattern allocates nothing after the first call. Use one per thread.
+    """
+    if initial_bytes < 0:
+        raise ValueError("initial_bytes must be >= 0")
+    return _export(_require_native(), "workspace_new")(int(initial_bytes))
+
+
+def workspace_info(workspace: Any) -> Dict[str, int]:
+    """
+    {"capacity", "peak", "overflow"}: arena bytes, the largest per-call
+    request seen, and one-off blocks the last call needed past capacity.
+    """
+    info = _export(_require_native(), "workspace_info")(workspace)
+    return {str(k): int(v) for k, v in dict(info).items()}
+
+
+# ---- Vector kernels --------------------------------------------------------
+
+def vec_dot(a: np.ndarray, b: np.ndarray, *, copy: bool = False) -> Tuple[float, float]:
+    """
+    Native dot product of two 1D arrays of one length, float64 or float32.
+
+    Returns (hil_vec_dot, hil_vec_dot_for(n)): the runtime-length and the
+    length-resolved kernel, both from the backend selected at load time
+    (vec_backend). Every backend reduces in the canonical lane order, so
+    both equal the scalar reference bit for bit.
+    """
+    wtype, suffix = _storage(a)
+    a = _as_vector(a, wtype, "a", copy)
+    b = _as_vector(b, wtype, "b", copy)
+
+    if a.ndim != 1 or b.ndim != 1:
+        raise ValueError("a, b must be 1D arrays")
+    if a.shape != b.shape:
+        raise ValueError("a, b must have identical shapes")
+
+    native = _require_native()
+    dot, dot_for = _export(native, "vec_dot")(a, b, suffix == "_f32")
+    return float(dot), float(dot_for)
+
+
+def vec_backend() -> str:
+    """
+    Vector kernel selected at load time (hil_vec_backend): "sequential",
+    "scalar", "avx2", "avx512" or "neon".
+    """
+    return str(_export(_require_native(), "vec_backend")())
+
+
+# ---- Instrumentation -------------------------------------------------------
+
+def native_fingerprint() -> Optional[str]:
+    """
+    sha256 of the loaded native extension binary, or None when it is
+    unavailable. Changes whenever the kernel is rebuilt, so callers can key
+    cached native results on it.
+    """
+    try:
+        native = _require_native()
+    except NativeUnavailable:
+        return None
+    path = getattr(native, "__file__", None)
+    if not path or not os.path.isfile(path):
+        return None
+
+    import hashlib  # noqa: WPS433
+    h = hashlib.sha256()
+    with open(path, "rb") as f:
+        for chunk in iter(lambda: f.read(1 << 20), b""):
+            h.update(chunk)
+    return h.hexdigest()
+
+
+def native_stats(*, reset: bool = False) -> Dict[str, Any]:
+    """
+    Per-kernel native counters (hil_stats_snapshot).
+
+    Returns {"enabled": bool, "kernels": {name: {"calls", "nanoseconds",
+    "bytes", "items"}}}. Counters exist only when the extension was built with
+    -DHIL_STATS; otherwise "enabled" is False and "kernels" is empty.
+
+    reset=True zeroes the counters after reading them.
+    """
+    native = _require_native()
+    if not hasattr(native, "native_stats"):
+        return {"enabled": False, "kernels": {}}
 
-    # Fallback: only entropy via the single-function export
-    return {"entropy": graph_entropy(src, dst, weight, num_nodes)}
+    out = dict(native.native_stats())
+    if reset:
+        native.native_stats_reset()
+    return {
+        "enabled": bool(out.get("enabled", False)),
+        "kernels": {
+            str(name): {str(k): int(v) for k, v in dict(entry).items()}
+            for name, entry in dict(out.get("kernels", {})).items()
+        },
+    }
@@ -0,0 +1,753 @@
+/*
+ * hilbert_ann.c
+ *
+ * HNSW index over normalised field rows, declared in hilbert_ann.h.
+ *
+ * Design intent:
+ *  - Same normalisation, weights and tie order as the exact kNN builder
+ *  - Index shape a function of rows, order and parameters only
+ *  - No persistence: flat export / import for the caller to store
+ */
+
+#include "hilbert_ann.h"
+#include "hilbert_math.h"
+
+#include <stdlib.h>   /* malloc, realloc, calloc, free, qsort */
+#include <string.h>   /* memcpy, memset */
+#include <math.h>     /* sqrt, log, floor */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/* ============================================================================
+ * Layout
+ * ============================================================================
+ *
+ * Layer 0 links live in one array of (2m + 1) slots per node; layers >= 1
+ * in a per-node block of level * (m + 1) slots. Slot 0 of each list is its
+ * count.
+ */
+
+struct hil_ann {
+    size_t dim;
+    size_t n;
+    size_t cap;
+    hil_ann_params_t params;
+    size_t m0;           /* layer-0 list capacity, 2m */
+    double level_mult;   /* 1 / ln(m) */
+
+    double    *vectors;  /* cap * dim normalised rows */
+    uint32_t  *levels;   /* cap */
+    uint32_t  *link0;    /* cap * (m0 + 1) */
+    uint32_t **upper;    /* cap; NULL for level-0 nodes */
+
+    uint32_t entry;
+    uint32_t max_level;
+    hil_vec_dot_fn dot;
+};
+
+static size_t hil_ann_layer_cap(const hil_ann_t *ann, uint32_t layer) {
+    return layer == 0 ? ann->m0 : ann->params.m;
+}
+
+static uint32_t *hil_ann_links(const hil_ann_t *ann, uint32_t node, uint32_t layer) {
+    if (layer == 0) return ann->link0 + (size_t)node * (ann->m0 + 1);
+    return ann->upper[node] + (size_t)(layer - 1) * (ann->params.m + 1);
+}
+
+static const double *hil_ann_row(const hil_ann_t *ann, uint32_t node) {
+    return ann->vectors + (size_t)node * ann->dim;
+}
+
+/* Level of node id: geometric with ratio 1/m, from a splitmix64 draw on
+   (seed, id) so it never depends on how rows were batched. */
+static uint32_t hil_ann_draw_level(const hil_ann_t *ann, uint32_t id) {
+    uint64_t z = ann->params.seed + 0x9E3779B97F4A7C15ull * ((uint64_t)id + 1);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    const double u = (double)((z >> 11) + 1) * (1.0 / 9007199254740992.0);  /* (0, 1] */
+    const double level = floor(-log(u) * ann->level_mult);
+    return level >= (double)HIL_ANN_MAX_LEVEL ? HIL_ANN_MAX_LEVEL : (uint32_t)level;
+}
+
+
+/* ============================================================================
+ * Candidates
+ * ============================================================================
+ */
+
+typedef struct {
+    double   w;
+    uint32_t j;
+} hil_ann_cand_t;
+
+/* a ranks below b: lower weight, or equal weight and larger id. */
+static int hil_ann_worse(const hil_ann_cand_t *a, const hil_ann_cand_t *b) {
+    return (a->w < b->w) || (a->w == b->w && a->j > b->j);
+}
+
+/* Best first. */
+static int hil_ann_cmp_best(const void *a, const void *b) {
+    const hil_ann_cand_t *x = (const hil_ann_cand_t*)a;
+    const hil_ann_cand_t *y = (const hil_ann_cand_t*)b;
+    return hil_ann_worse(x, y) - hil_ann_worse(y, x);
+}
+
+/* Binary heap; worst_root selects a min-heap (results) or max-heap
+   (candidates to expand). */
+typedef struct {
+    hil_ann_cand_t *h;
+    size_t len, cap;
+    int worst_root;
+} hil_ann_heap_t;
+
+static int hil_ann_heap_above(const hil_ann_heap_t *q, size_t a, size_t b) {
+    return q->worst_root ? hil_ann_worse(&q->h[a], &q->h[b])
+                         : hil_ann_worse(&q->h[b], &q->h[a]);
+}
+
+static int hil_ann_heap_push(hil_ann_heap_t *q, hil_ann_cand_t c) {
+    if (q->len == q->cap) {
+        const size_t nc = q->cap ? 2 * q->cap : 64;
+        hil_ann_cand_t *nh = (hil_ann_cand_t*)realloc(q->h, sizeof(hil_ann_cand_t) * nc);
+        if (!nh) return 0;
+        q->h = nh;
+        q->cap = nc;
+    }
+    size_t i = q->len++;
+    q->h[i] = c;
+    while (i > 0) {
+        const size_t p = (i - 1) / 2;
+        if (!hil_ann_heap_above(q, i, p)) break;
+        hil_ann_cand_t t = q->h[i]; q->h[i] = q->h[p]; q->h[p] = t;
+        i = p;
+    }
+    return 1;
+}
+
+static hil_ann_cand_t hil_ann_heap_pop(hil_ann_heap_t *q) {
+    const hil_ann_cand_t top = q->h[0];
+    q->h[0] = q->h[--q->len];
+    size_t i = 0;
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, m = i;
+        if (l < q->len && hil_ann_heap_above(q, l, m)) m = l;
+        if (r < q->len && hil_ann_heap_above(q, r, m)) m = r;
+        if (m == i) break;
+        hil_ann_cand_t t = q->h[i]; q->h[i] = q->h[m]; q->h[m] = t;
+        i = m;
+    }
+    return top;
+}
+
+
+/* ============================================================================
+ * Search Scratch
+ * ============================================================================
+ *
+ * Visited marks are epoch tags, so clearing between searches is O(1). One
+ * scratch per searching thread.
+ */
+
+typedef struct {
+    uint32_t *tag;
+    size_t tag_cap;
+    uint32_t epoch;
+    hil_ann_heap_t cand;     /* max-heap: next node to expand */
+    hil_ann_heap_t res;      /* min-heap: best ef so far */
+    hil_ann_cand_t *sel;     /* neighbour selection buffer */
+    size_t sel_cap;
+} hil_ann_scratch_t;
+
+static void hil_ann_scratch_free(hil_ann_scratch_t *s) {
+    free(s->tag);
+    free(s->cand.h);
+    free(s->res.h);
+    free(s->sel);
+    memset(s, 0, sizeof(*s));
+}
+
+static int hil_ann_scratch_reserve(hil_ann_scratch_t *s, size_t n) {
+    s->cand.worst_root = 0;
+    s->res.worst_root = 1;
+    if (n <= s->tag_cap) return 1;
+    size_t nc = s->tag_cap ? s->tag_cap : 1024;
+    while (nc < n) nc *= 2;
+    uint32_t *t = (uint32_t*)realloc(s->tag, sizeof(uint32_t) * nc);
+    if (!t) return 0;
+    memset(t + s->tag_cap, 0, sizeof(uint32_t) * (nc - s->tag_cap));
+    s->tag = t;
+    s->tag_cap = nc;
+    return 1;
+}
+
+static int hil_ann_sel_reserve(hil_ann_scratch_t *s, size_t n) {
+    if (n <= s->sel_cap) return 1;
+    size_t nc = s->sel_cap ? s->sel_cap : 64;
+    while (nc < n) nc *= 2;
+    hil_ann_cand_t *p = (hil_ann_cand_t*)realloc(s->sel, sizeof(hil_ann_cand_t) * nc);
+    if (!p) return 0;
+    s->sel = p;
+    s->sel_cap = nc;
+    return 1;
+}
+
+static void hil_ann_next_epoch(hil_ann_scratch_t *s) {
+    if (++s->epoch == 0) {
+        memset(s->tag, 0, sizeof(uint32_t) * s->tag_cap);
+        s->epoch = 1;
+    }
+}
+
+
+/* ============================================================================
+ * Layer Search
+ * ============================================================================
+ */
+
+static double hil_ann_weight(const hil_ann_t *ann, const double *v, uint32_t node) {
+    return (ann->dot(v, hil_ann_row(ann, node), ann->dim) + 1.0) * 0.5;
+}
+
+/* Greedy descent to the best node of one layer (ef = 1). */
+static uint32_t hil_ann_greedy(const hil_ann_t *ann, const double *v, uint32_t ep, uint32_t layer) {
+    hil_ann_cand_t best = { hil_ann_weight(ann, v, ep), ep };
+    for (int moved = 1; moved;) {
+        moved = 0;
+        const uint32_t *links = hil_ann_links(ann, best.j, layer);
+        for (uint32_t t = 1; t <= links[0]; t++) {
+            const hil_ann_cand_t c = { hil_ann_weight(ann, v, links[t]), links[t] };
+            if (hil_ann_worse(&best, &c)) {
+                best = c;
+                moved = 1;
+            }
+        }
+    }
+    return best.j;
+}
+
+/*
+ * Best-first search of one layer from ep, keeping the best ef nodes in
+ * s->res. skip is traversed but never kept (HIL_ANN_NONE to keep all).
+ */
+static int hil_ann_search_layer(
+    const hil_ann_t *ann,
+    hil_ann_scratch_t *s,
+    const double *v,
+    uint32_t ep,
+    size_t ef,
+    uint32_t layer,
+    uint32_t skip
+) {
+    hil_ann_next_epoch(s);
+    s->cand.len = 0;
+    s->res.len = 0;
+
+    const hil_ann_cand_t start = { hil_ann_weight(ann, v, ep), ep };
+    s->tag[ep] = s->epoch;
+    if (!hil_ann_heap_push(&s->cand, start)) return 0;
+    if (ep != skip && !hil_ann_heap_push(&s->res, start)) return 0;
+
+    while (s->cand.len > 0) {
+        const hil_ann_cand_t c = hil_ann_heap_pop(&s->cand);
+        if (s->res.len >= ef && hil_ann_worse(&c, &s->res.h[0])) break;
+
+        const uint32_t *links = hil_ann_links(ann, c.j, layer);
+        for (uint32_t t = 1; t <= links[0]; t++) {
+            const uint32_t e = links[t];
+            if (s->tag[e] == s->epoch) continue;
+            s->tag[e] = s->epoch;
+
+            const hil_ann_cand_t x = { hil_ann_weight(ann, v, e), e };
+            if (s->res.len < ef || hil_ann_worse(&s->res.h[0], &x)) {
+                if (!hil_ann_heap_push(&s->cand, x)) return 0;
+                if (e == skip) continue;
+                if (!hil_ann_heap_push(&s->res, x)) return 0;
+                if (s->res.len > ef) hil_ann_heap_pop(&s->res);
+            }
+        }
+    }
+    return 1;
+}
+
+/*
+ * Keep up to m of the count candidates in c (sorted best first in place):
+ * a candidate is kept only if it is closer to the base row than to every
+ * candidate already kept, which spreads links across directions. Returns
+ * the number kept, compacted to the front of c.
+ */
+static size_t hil_ann_select(const hil_ann_t *ann, hil_ann_cand_t *c, size_t count, size_t m) {
+    qsort(c, count, sizeof(hil_ann_cand_t), hil_ann_cmp_best);
+    size_t kept = 0;
+    for (size_t i = 0; i < count && kept < m; i++) {
+        const double *ci = hil_ann_row(ann, c[i].j);
+        int good = 1;
+        for (size_t r = 0; r < kept && good; r++) {
+            if (hil_ann_weight(ann, ci, c[r].j) > c[i].w) good = 0;
+        }
+        if (good) c[kept++] = c[i];
+    }
+    return kept;
+}
+
+
+/* ============================================================================
+ * Insertion
+ * ============================================================================
+ */
+
+static int hil_ann_reserve(hil_ann_t *ann, size_t need) {
+    if (need <= ann->cap) return 1;
+    size_t nc = ann->cap ? ann->cap : 256;
+    while (nc < need) nc *= 2;
+
+    double *v = (double*)realloc(ann->vectors, sizeof(double) * nc * ann->dim);
+    if (!v) return 0;
+    ann->vectors = v;
+    uint32_t *lv = (uint32_t*)realloc(ann->levels, sizeof(uint32_t) * nc);
+    if (!lv) return 0;
+    ann->levels = lv;
+    uint32_t *l0 = (uint32_t*)realloc(ann->link0, sizeof(uint32_t) * nc * (ann->m0 + 1));
+    if (!l0) return 0;
+    ann->link0 = l0;
+    uint32_t **up = (uint32_t**)realloc(ann->upper, sizeof(uint32_t*) * nc);
+    if (!up) return 0;
+    ann->upper = up;
+
+    ann->cap = nc;
+    return 1;
+}
+
+/* Add q to e's list on layer; an overflowing list is re-selected. */
+static int hil_ann_link_back(hil_ann_t *ann, hil_ann_scratch_t *s, uint32_t e, uint32_t q, uint32_t layer) {
+    uint32_t *links = hil_ann_links(ann, e, layer);
+    const size_t lcap = hil_ann_layer_cap(ann, layer);
+    if (links[0] < lcap) {
+        links[++links[0]] = q;
+        return 1;
+    }
+
+    if (!hil_ann_sel_reserve(s, lcap + 1)) return 0;
+    const double *ve = hil_ann_row(ann, e);
+    for (uint32_t t = 1; t <= links[0]; t++) {
+        s->sel[t - 1] = (hil_ann_cand_t){ hil_ann_weight(ann, ve, links[t]), links[t] };
+    }
+    s->sel[lcap] = (hil_ann_cand_t){ hil_ann_weight(ann, ve, q), q };
+
+    const size_t kept = hil_ann_select(ann, s->sel, lcap + 1, lcap);
+    links[0] = (uint32_t)kept;
+    for (size_t t = 0; t < kept; t++) links[t + 1] = s->sel[t].j;
+    return 1;
+}
+
+static int hil_ann_insert(hil_ann_t *ann, hil_ann_scratch_t *s, uint32_t q) {
+    const uint32_t level = ann->levels[q];
+    const double *v = hil_ann_row(ann, q);
+
+    if (ann->entry == HIL_ANN_NONE) {
+        ann->entry = q;
+        ann->max_level = level;
+        return 1;
+    }
+
+    uint32_t ep = ann->entry;
+    for (uint32_t l = ann->max_level; l > level; l--) ep = hil_ann_greedy(ann, v, ep, l);
+
+    for (uint32_t l = (level < ann->max_level ? level : ann->max_level) + 1; l-- > 0;) {
+        if (!hil_ann_search_layer(ann, s, v, ep, ann->params.ef_construction, l, HIL_ANN_NONE)) {
+            return 0;
+        }
+        if (!hil_ann_sel_reserve(s, s->res.len)) return 0;
+        const size_t found = s->res.len;
+        memcpy(s->sel, s->res.h, sizeof(hil_ann_cand_t) * found);
+
+        /* Next layer starts from the best node found here. */
+        const size_t kept = hil_ann_select(ann, s->sel, found, hil_ann_layer_cap(ann, l));
+        if (found > 0) ep = s->sel[0].j;
+
+        uint32_t *links = hil_ann_links(ann, q, l);
+        links[0] = (uint32_t)kept;
+        for (size_t t = 0; t < kept; t++) links[t + 1] = s->sel[t].j;
+
+        /* link_back reuses s->sel, so walk q's own list instead. */
+        for (size_t t = 0; t < kept; t++) {
+            if (!hil_ann_link_back(ann, s, links[t + 1], q, l)) return 0;
+        }
+    }
+
+    if (level > ann->max_level) {
+        ann->entry = q;
+        ann->max_level = level;
+    }
+    return 1;
+}
+
+
+/* ============================================================================
+ * Index Lifecycle
+ * ============================================================================
+ */
+
+static int hil_ann_params_valid(size_t dim, const hil_ann_params_t *p) {
+    return p && dim >= 1 && p->m >= 2 && p->ef_construction >= 1 && p->m < UINT32_MAX / 2;
+}
+
+hil_ann_t *hil_ann_create(size_t dim, const hil_ann_params_t *params) {
+    if (!hil_ann_params_valid(dim, params)) return NULL;
+    hil_ann_t *ann = (hil_ann_t*)calloc(1, sizeof(hil_ann_t));
+    if (!ann) return NULL;
+    ann->dim = dim;
+    ann->params = *params;
+    ann->m0 = 2 * params->m;
+    ann->level_mult = 1.0 / log((double)params->m);
+    ann->entry = HIL_ANN_NONE;
+    ann->dot = hil_vec_dot_for(dim);
+    return ann;
+}
+
+void hil_ann_free(hil_ann_t *ann) {
+    if (!ann) return;
+    for (size_t i = 0; i < ann->n; i++) free(ann->upper[i]);
+    free(ann->vectors);
+    free(ann->levels);
+    free(ann->link0);
+    free(ann->upper);
+    free(ann);
+}
+
+size_t hil_ann_size(const hil_ann_t *ann) { return ann ? ann->n : 0; }
+size_t hil_ann_dim(const hil_ann_t *ann) { return ann ? ann->dim : 0; }
+uint32_t hil_ann_max_level(const hil_ann_t *ann) { return ann ? ann->max_level : 0; }
+uint32_t hil_ann_entry(const hil_ann_t *ann) { return ann ? ann->entry : HIL_ANN_NONE; }
+
+hil_ann_params_t hil_ann_params(const hil_ann_t *ann) {
+    hil_ann_params_t p = { 0, 0, 0 };
+    return ann ? ann->params : p;
+}
+
+/* Store row r of M as node id (normalised, levels drawn, lists empty). */
+static int hil_ann_place(hil_ann_t *ann, const hil_matrix_t *M, size_t r, uint32_t id) {
+    const size_t d = ann->dim;
+    const double *row = hil_matrix_row(M, r);
+    double *vr = ann->vectors + (size_t)id * d;
+    double nrm = sqrt(ann->dot(row, row, d));
+    if (nrm == 0.0) nrm = 1.0;
+    for (size_t c = 0; c < d; c++) vr[c] = row[c] / nrm;
+
+    const uint32_t level = hil_ann_draw_level(ann, id);
+    ann->levels[id] = level;
+    ann->link0[(size_t)id * (ann->m0 + 1)] = 0;
+    ann->upper[id] = NULL;
+    if (level > 0) {
+        ann->upper[id] = (uint32_t*)malloc(sizeof(uint32_t) * level * (ann->params.m + 1));
+        if (!ann->upper[id]) return 0;
+        for (uint32_t l = 1; l <= level; l++) hil_ann_links(ann, id, l)[0] = 0;
+    }
+    return 1;
+}
+
+static int hil_ann_add_kernel(hil_ann_t *ann, const hil_field_t *rows) {
+    if (!ann || !rows) return 0;
+    const hil_matrix_t M = rows->coordinates;
+    if (M.rows == 0) return 1;
+    if (!M.data || M.cols != ann->dim) return 0;
+    if (M.rows > (size_t)HIL_ANN_NONE - ann->n) return 0;
+    if (!hil_ann_reserve(ann, ann->n + M.rows)) return 0;
+
+    hil_ann_scratch_t s;
+    memset(&s, 0, sizeof(s));
+    int ok = hil_ann_scratch_reserve(&s, ann->n + M.rows);
+
+    for (size_t r = 0; ok && r < M.rows; r++) {
+        const uint32_t id = (uint32_t)ann->n;
+        ok = hil_ann_place(ann, &M, r, id);
+        ann->n++;  /* owns upper[id] from here, even on failure */
+        if (ok) ok = hil_ann_insert(ann, &s, id);
+    }
+
+    hil_ann_scratch_free(&s);
+    return ok;
+}
+
+int hil_ann_add(hil_ann_t *ann, const hil_field_t *rows) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+#ifdef HIL_STATS
+    const size_t before = ann ? ann->n : 0;
+#endif
+    const int ok = hil_ann_add_kernel(ann, rows);
+#ifdef HIL_STATS
+    const size_t added = ann ? ann->n - before : 0;
+    HIL_STATS_END(HIL_STAT_ANN_ADD, t0, added * (ann ? ann->dim : 0) * sizeof(double), added);
+#else
+    HIL_STATS_END(HIL_STAT_ANN_ADD, t0, 0, 0);
+#endif
+    return ok;
+}
+
+
+/* ============================================================================
+ * Queries
+ * ============================================================================
+ */
+
+/* Search for v (skipping node skip) and write k best-first slots. */
+static int hil_ann_query_one(
+    const hil_ann_t *ann,
+    hil_ann_scratch_t *s,
+    const double *v,
+    uint32_t skip,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+) {
+    size_t found = 0;
+    if (ann->entry != HIL_ANN_NONE) {
+        uint32_t ep = ann->entry;
+        for (uint32_t l = ann->max_level; l > 0; l--) ep = hil_ann_greedy(ann, v, ep, l);
+        if (!hil_ann_search_layer(ann, s, v, ep, ef, 0, skip)) return 0;
+
+        found = s->res.len;
+        qsort(s->res.h, found, sizeof(hil_ann_cand_t), hil_ann_cmp_best);
+        if (found > k) found = k;
+    }
+
+    for (size_t t = 0; t < k; t++) {
+        out_ids[t] = t < found ? s->res.h[t].j : HIL_ANN_NONE;
+        out_weight[t] = t < found ? s->res.h[t].w : 0.0;
+    }
+    return 1;
+}
+
+/*
+ * Shared driver: query q reads row (queries) or stored node (nodes). Each
+ * thread owns one scratch; results do not depend on the schedule.
+ */
+static int hil_ann_query_kernel(
+    const hil_ann_t *ann,
+    const hil_matrix_t *Q,
+    const uint32_t *nodes,
+    size_t count,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+) {
+    if (ef < k) ef = k;
+    int good = 1;
+
+    #ifdef _OPENMP
+    #pragma omp parallel reduction(&&:good)
+    #endif
+    {
+        hil_ann_scratch_t s;
+        memset(&s, 0, sizeof(s));
+        int ok = hil_ann_scratch_reserve(&s, ann->n ? ann->n : 1);
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 16)
+        #endif
+        for (size_t q = 0; q < count; q++) {
+            if (!ok) continue;
+            const double *v = Q ? hil_matrix_row(Q, q) : hil_ann_row(ann, nodes[q]);
+            const uint32_t skip = Q ? HIL_ANN_NONE : nodes[q];
+
+            /* Query rows are normalised like stored rows. */
+            double *tmp = NULL;
+            if (Q) {
+                tmp = (double*)malloc(sizeof(double) * ann->dim);
+                if (!tmp) { ok = 0; continue; }
+                double nrm = sqrt(ann->dot(v, v, ann->dim));
+                if (nrm == 0.0) nrm = 1.0;
+                for (size_t c = 0; c < ann->dim; c++) tmp[c] = v[c] / nrm;
+                v = tmp;
+            }
+            ok = hil_ann_query_one(ann, &s, v, skip, k, ef, out_ids + q * k, out_weight + q * k);
+            free(tmp);
+        }
+
+        hil_ann_scratch_free(&s);
+        good = good && ok;
+    }
+    return good;
+}
+
+int hil_ann_query(
+    const hil_ann_t *ann,
+    const hil_field_t *queries,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    int ok = 0;
+    if (ann && queries && out_ids && out_weight && k >= 1) {
+        const hil_matrix_t Q = queries->coordinates;
+        if (Q.rows == 0) ok = 1;
+        else if (Q.data && Q.cols == ann->dim) {
+            ok = hil_ann_query_kernel(ann, &Q, NULL, Q.rows, k, ef, out_ids, out_weight);
+        }
+    }
+    HIL_STATS_END(HIL_STAT_ANN_QUERY, t0,
+                  (ok ? queries->coordinates.rows * k * (sizeof(uint32_t) + sizeof(double)) : 0),
+                  (ok ? queries->coordinates.rows : 0));
+    return ok;
+}
+
+int hil_ann_query_nodes(
+    const hil_ann_t *ann,
+    const uint32_t *nodes,
+    size_t count,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    int ok = (ann && (nodes || count == 0) && out_ids && out_weight && k >= 1);
+    for (size_t q = 0; ok && q < count; q++) {
+        if (nodes[q] >= ann->n) ok = 0;
+    }
+    if (ok && count > 0) {
+        ok = hil_ann_query_kernel(ann, NULL, nodes, count, k, ef, out_ids, out_weight);
+    }
+    HIL_STATS_END(HIL_STAT_ANN_QUERY, t0,
+                  (ok ? count * k * (sizeof(uint32_t) + sizeof(double)) : 0), (ok ? count : 0));
+    return ok;
+}
+
+
+/* ============================================================================
+ * Flat Form
+ * ============================================================================
+ */
+
+void hil_ann_graph_free(hil_ann_graph_t *graph) {
+    if (!graph) return;
+    free(graph->vectors);
+    free(graph->levels);
+    free(graph->offsets);
+    free(graph->links);
+    graph->vectors = NULL;
+    graph->levels = NULL;
+    graph->offsets = NULL;
+    graph->links = NULL;
+}
+
+int hil_ann_export(const hil_ann_t *ann, hil_ann_graph_t *out) {
+    if (!ann || !out) return 0;
+    memset(out, 0, sizeof(*out));
+    const size_t n = ann->n;
+
+    out->dim = ann->dim;
+    out->num_nodes = n;
+    out->params = ann->params;
+    out->entry = ann->entry;
+    out->max_level = ann->max_level;
+
+    out->offsets = (uint64_t*)malloc(sizeof(uint64_t) * (n + 1));
+    if (!out->offsets) return 0;
+    out->offsets[0] = 0;
+    for (size_t i = 0; i < n; i++) {
+        uint64_t len = 0;
+        for (uint32_t l = 0; l <= ann->levels[i]; l++) {
+            len += 1 + hil_ann_links(ann, (uint32_t)i, l)[0];
+        }
+        out->offsets[i + 1] = out->offsets[i] + len;
+    }
+
+    /* Never hand back NULL for an empty array. */
+    out->vectors = (double*)malloc(sizeof(double) * (n ? n * ann->dim : 1));
+    out->levels = (uint32_t*)malloc(sizeof(uint32_t) * (n ? n : 1));
+    out->links = (uint32_t*)malloc(sizeof(uint32_t) * (out->offsets[n] ? out->offsets[n] : 1));
+    if (!out->vectors || !out->levels || !out->links) {
+        hil_ann_graph_free(out);
+        return 0;
+    }
+
+    if (n) {
+        memcpy(out->vectors, ann->vectors, sizeof(double) * n * ann->dim);
+        memcpy(out->levels, ann->levels, sizeof(uint32_t) * n);
+    }
+    for (size_t i = 0; i < n; i++) {
+        uint32_t *dst = out->links + out->offsets[i];
+        for (uint32_t l = 0; l <= ann->levels[i]; l++) {
+            const uint32_t *src = hil_ann_links(ann, (uint32_t)i, l);
+            memcpy(dst, src, sizeof(uint32_t) * (1 + (size_t)src[0]));
+            dst += 1 + src[0];
+        }
+    }
+    return 1;
+}
+
+/* Every segment must parse exactly, within the layer caps, and only link
+   to nodes present on that layer. */
+static int hil_ann_graph_valid(const hil_ann_graph_t *g) {
+    if (!hil_ann_params_valid(g->dim, &g->params)) return 0;
+    const size_t n = g->num_nodes;
+    if (n == 0) return g->entry == HIL_ANN_NONE;
+    if (n > (size_t)HIL_ANN_NONE || !g->vectors || !g->levels || !g->offsets || !g->links) return 0;
+    if (g->entry >= n || g->levels[g->entry] != g->max_level || g->offsets[0] != 0) return 0;
+
+    for (size_t i = 0; i < n; i++) {
+        if (g->levels[i] > HIL_ANN_MAX_LEVEL || g->levels[i] > g->max_level) return 0;
+        if (g->offsets[i + 1] < g->offsets[i]) return 0;
+
+        uint64_t p = g->offsets[i];
+        const uint64_t end = g->offsets[i + 1];
+        for (uint32_t l = 0; l <= g->levels[i]; l++) {
+            if (p >= end) return 0;
+            const uint32_t c = g->links[p++];
+            if (c > (l == 0 ? 2 * g->params.m : g->params.m) || c > end - p) return 0;
+            for (uint32_t t = 0; t < c; t++) {
+                const uint32_t e = g->links[p++];
+                if (e >= n || g->levels[e] < l) return 0;
+            }
+        }
+        if (p != end) return 0;
+    }
+    return 1;
+}
+
+hil_ann_t *hil_ann_import(const hil_ann_graph_t *graph) {
+    if (!graph || !hil_ann_graph_valid(graph)) return NULL;
+    hil_ann_t *ann = hil_ann_create(graph->dim, &graph->params);
+    if (!ann) return NULL;
+
+    const size_t n = graph->num_nodes;
+    if (n == 0) return ann;
+    if (!hil_ann_reserve(ann, n)) {
+        hil_ann_free(ann);
+        return NULL;
+    }
+
+    memcpy(ann->vectors, graph->vectors, sizeof(double) * n * graph->dim);
+    memcpy(ann->levels, graph->levels, sizeof(uint32_t) * n);
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t level = graph->levels[i];
+        ann->upper[i] = NULL;
+        if (level > 0) {
+            ann->upper[i] = (uint32_t*)malloc(sizeof(uint32_t) * level * (ann->params.m + 1));
+            if (!ann->upper[i]) {
+                ann->n = i;
+                hil_ann_free(ann);
+                return NULL;
+            }
+        }
+        const uint32_t *src = graph->links + graph->offsets[i];
+        for (uint32_t l = 0; l <= level; l++) {
+            uint32_t *dst = hil_ann_links(ann, (uint32_t)i, l);
+            memcpy(dst, src, sizeof(uint32_t) * (1 + (size_t)src[0]));
+            src += 1 + src[0];
+        }
+    }
+
+    ann->n = n;
+    ann->entry = graph->entry;
+    ann->max_level = graph->max_level;
+    return ann;
+}
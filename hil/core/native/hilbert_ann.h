@@ -0,0 +1,172 @@
+#ifndef HILBERT_ANN_H
+#define HILBERT_ANN_H
+
+/*
+ * hilbert_ann.h
+ *
+ * Hierarchical navigable small-world (HNSW) index over normalised field
+ * rows, for approximate top-k cosine neighbours of rows added over time.
+ *
+ * Rows are L2-normalised on insertion exactly as hil_graph_build_knn_csr
+ * normalises them (exact-zero rows keep a unit divisor), and neighbours are
+ * ranked by w = (cos + 1) / 2 with ties broken by the smaller index, so a
+ * neighbour the index finds carries the same weight, bit for bit, as in the
+ * exact kNN builder. Only the set of neighbours found is approximate.
+ *
+ * Determinism:
+ *  - node levels are drawn from (seed, node id), not from call order
+ *  - rows are linked one at a time in id order, so the index depends only
+ *    on the rows, their order and the parameters, never on batching
+ *  - queries only read the index; each query is independent of thread
+ *    count and of the other queries in the call
+ *
+ * Epistemic constraints:
+ *  - No semantics or interpretation
+ *  - No persistence: the index is exported to and imported from flat
+ *    arrays; files are the caller's concern
+ *  - Seeded, deterministic level draws only
+ */
+
+#include <stddef.h>   /* size_t */
+#include <stdint.h>   /* uint32_t, uint64_t */
+
+#include "hilbert_native.h"  /* hil_field_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Parameters
+ * ============================================================================
+ */
+
+#define HIL_ANN_NONE      UINT32_MAX  /* empty result slot / no entry point */
+#define HIL_ANN_MAX_LEVEL 16          /* level draws are capped here */
+
+/*
+ * m:               links kept per node on layers >= 1; layer 0 keeps 2m
+ * ef_construction: candidate list size while linking a new row
+ * seed:            level draws (level of node i depends on seed and i only)
+ */
+typedef struct {
+    size_t   m;
+    size_t   ef_construction;
+    uint64_t seed;
+} hil_ann_params_t;
+
+#define HIL_ANN_DEFAULT_M               16
+#define HIL_ANN_DEFAULT_EF_CONSTRUCTION 200
+
+
+/* ============================================================================
+ * Index
+ * ============================================================================
+ *
+ * An index is not thread-safe for hil_ann_add; queries may run from any
+ * number of threads while no add is in progress.
+ */
+
+typedef struct hil_ann hil_ann_t;
+
+/*
+ * Empty index over dim-wide rows. Requires dim >= 1, m >= 2 and
+ * ef_construction >= 1. Returns NULL on invalid input or allocation failure.
+ */
+hil_ann_t *hil_ann_create(size_t dim, const hil_ann_params_t *params);
+void hil_ann_free(hil_ann_t *ann);
+
+size_t hil_ann_size(const hil_ann_t *ann);
+size_t hil_ann_dim(const hil_ann_t *ann);
+hil_ann_params_t hil_ann_params(const hil_ann_t *ann);
+
+/* Top layer and entry node; HIL_ANN_NONE entry while the index is empty. */
+uint32_t hil_ann_max_level(const hil_ann_t *ann);
+uint32_t hil_ann_entry(const hil_ann_t *ann);
+
+/*
+ * Append every row of rows (cols must equal the index dim). Row r becomes
+ * node hil_ann_size() + r, counted before the call.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure; nodes
+ * linked before a failure stay in the index.
+ */
+int hil_ann_add(hil_ann_t *ann, const hil_field_t *rows);
+
+/*
+ * Approximate top-k neighbours of each query row.
+ *
+ * Query q writes out_ids[q * k ..] and out_weight[q * k ..], best first
+ * (descending weight, ties by smaller id). Slots past the number of nodes
+ * found hold HIL_ANN_NONE and weight 0. ef (raised to k when smaller) is
+ * the layer-0 candidate list size: larger ef trades latency for recall.
+ *
+ * Queries run in parallel when built with OpenMP.
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_ann_query(
+    const hil_ann_t *ann,
+    const hil_field_t *queries,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+);
+
+/*
+ * As hil_ann_query, for stored nodes: node nodes[q] is searched with its
+ * stored row and never reported as its own neighbour (the kNN rows of
+ * hil_graph_build_knn_csr exclude i -> i likewise).
+ */
+int hil_ann_query_nodes(
+    const hil_ann_t *ann,
+    const uint32_t *nodes,
+    size_t count,
+    size_t k,
+    size_t ef,
+    uint32_t *out_ids,
+    double *out_weight
+);
+
+
+/* ============================================================================
+ * Flat Form (Export / Import)
+ * ============================================================================
+ *
+ * Node i's links are links[offsets[i] .. offsets[i + 1]): for each layer
+ * l = 0 .. levels[i], one count c followed by c neighbour ids. vectors holds
+ * the normalised rows, so an imported index answers every query exactly as
+ * the exported one.
+ */
+typedef struct {
+    size_t           dim;
+    size_t           num_nodes;
+    hil_ann_params_t params;
+    uint32_t         entry;      /* HIL_ANN_NONE when num_nodes == 0 */
+    uint32_t         max_level;
+
+    double   *vectors;  /* num_nodes * dim */
+    uint32_t *levels;   /* num_nodes */
+    uint64_t *offsets;  /* num_nodes + 1 */
+    uint32_t *links;    /* offsets[num_nodes] */
+} hil_ann_graph_t;
+
+/*
+ * Copy the index into flat arrays allocated here; release with
+ * hil_ann_graph_free. Returns 1 on success, 0 on allocation failure.
+ */
+int hil_ann_export(const hil_ann_t *ann, hil_ann_graph_t *out);
+void hil_ann_graph_free(hil_ann_graph_t *graph);
+
+/*
+ * Rebuild an index from flat arrays (copied; the caller keeps them).
+ * Every count, level and id is checked against the layout above. Returns
+ * NULL on invalid input or allocation failure.
+ */
+hil_ann_t *hil_ann_import(const hil_ann_graph_t *graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HILBERT_ANN_H */
@@ -0,0 +1,577 @@
+/*
+ * hilbert_lexicon.c
+ *
+ * Streaming tokenizer, open-addressing term table and CSR term-document
+ * builder declared in hilbert_lexicon.h.
+ *
+ * Design intent:
+ *  - Bytes in, counts out: no semantics, no persistence
+ *  - Output independent of batch boundaries and thread count
+ */
+
+#include "hilbert_lexicon.h"
+#include "hilbert_native.h"  /* instrumentation hooks */
+
+#include <stdlib.h>   /* malloc, realloc, free, qsort */
+#include <string.h>   /* memcpy, memcmp, memset */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+/* ============================================================================
+ * Byte Classes
+ * ============================================================================
+ */
+
+static int hil_lex_is_token(uint8_t c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+           (c >= '0' && c <= '9') || c == '_';
+}
+
+static uint8_t hil_lex_fold(uint8_t c) {
+    return (c >= 'A' && c <= 'Z') ? (uint8_t)(c + ('a' - 'A')) : c;
+}
+
+/* FNV-1a over the folded bytes. */
+static uint64_t hil_lex_hash(const uint8_t *p, size_t len) {
+    uint64_t h = 1469598103934665603ULL;
+    for (size_t i = 0; i < len; i++) {
+        h ^= hil_lex_fold(p[i]);
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static int hil_lex_grow(void **p, size_t *cap, size_t need, size_t elem) {
+    if (need <= *cap) return 1;
+    size_t c = *cap ? *cap : 64;
+    while (c < need) c *= 2;
+    void *q = realloc(*p, c * elem);
+    if (!q) return 0;
+    *p = q;
+    *cap = c;
+    return 1;
+}
+
+/* ============================================================================
+ * Open-Addressing Term Table
+ * ============================================================================
+ *
+ * Linear probing over a power-of-two slot array kept at most half full.
+ * Slots hold term id + 1 (0 = empty); terms are stored folded in one arena.
+ */
+
+typedef struct {
+    uint32_t *slots;
+    size_t    slot_cap;
+    uint64_t *hashes;     /* per term */
+    uint64_t *starts;     /* per term, into bytes */
+    uint32_t *lens;       /* per term */
+    uint64_t *freq;       /* per term */
+    size_t    num, term_cap;
+    char     *bytes;
+    size_t    bytes_len, bytes_cap;
+} hil_lex_table_t;
+
+static void hil_lex_table_free(hil_lex_table_t *t) {
+    free(t->slots);
+    free(t->hashes);
+    free(t->starts);
+    free(t->lens);
+    free(t->freq);
+    free(t->bytes);
+    memset(t, 0, sizeof(*t));
+}
+
+static int hil_lex_table_rehash(hil_lex_table_t *t, size_t slot_cap) {
+    uint32_t *slots = (uint32_t*)calloc(slot_cap, sizeof(uint32_t));
+    if (!slots) return 0;
+    const size_t mask = slot_cap - 1;
+    for (size_t id = 0; id < t->num; id++) {
+        size_t s = (size_t)t->hashes[id] & mask;
+        while (slots[s]) s = (s + 1) & mask;
+        slots[s] = (uint32_t)(id + 1);
+    }
+    free(t->slots);
+    t->slots = slots;
+    t->slot_cap = slot_cap;
+    return 1;
+}
+
+/*
+ * Id of the folded token p[0..len), inserting it if new; count added to its
+ * frequency. Returns 1 on success, 0 on allocation failure.
+ */
+static int hil_lex_table_add(
+    hil_lex_table_t *t,
+    const uint8_t *p,
+    size_t len,
+    uint64_t count,
+    uint32_t *out_id
+) {
+    if (2 * (t->num + 1) > t->slot_cap) {
+        if (!hil_lex_table_rehash(t, t->slot_cap ? 2 * t->slot_cap : 1024)) return 0;
+    }
+
+    const uint64_t h = hil_lex_hash(p, len);
+    const size_t mask = t->slot_cap - 1;
+    size_t s = (size_t)h & mask;
+
+    while (t->slots[s]) {
+        const uint32_t id = t->slots[s] - 1;
+        if (t->hashes[id] == h && t->lens[id] == len) {
+            const char *q = t->bytes + t->starts[id];
+            size_t i = 0;
+            while (i < len && (char)hil_lex_fold(p[i]) == q[i]) i++;
+            if (i == len) {
+                t->freq[id] += count;
+                *out_id = id;
+                return 1;
+            }
+        }
+        s = (s + 1) & mask;
+    }
+
+    if (t->num >= (size_t)UINT32_MAX - 1 || len > (size_t)UINT32_MAX) return 0;
+    size_t cap = t->term_cap;
+    if (t->num + 1 > cap) {
+        if (!hil_lex_grow((void**)&t->hashes, &cap, t->num + 1, sizeof(uint64_t))) return 0;
+        cap = t->term_cap;
+        if (!hil_lex_grow((void**)&t->starts, &cap, t->num + 1, sizeof(uint64_t))) return 0;
+        cap = t->term_cap;
+        if (!hil_lex_grow((void**)&t->lens, &cap, t->num + 1, sizeof(uint32_t))) return 0;
+        cap = t->term_cap;
+        if (!hil_lex_grow((void**)&t->freq, &cap, t->num + 1, sizeof(uint64_t))) return 0;
+        t->term_cap = cap;
+    }
+    if (!hil_lex_grow((void**)&t->bytes, &t->bytes_cap, t->bytes_len + len, 1)) return 0;
+
+    const uint32_t id = (uint32_t)t->num++;
+    for (size_t i = 0; i < len; i++) t->bytes[t->bytes_len + i] = (char)hil_lex_fold(p[i]);
+    t->hashes[id] = h;
+    t->starts[id] = t->bytes_len;
+    t->lens[id] = (uint32_t)len;
+    t->freq[id] = count;
+    t->bytes_len += len;
+    t->slots[s] = id + 1;
+    *out_id = id;
+    return 1;
+}
+
+/* ============================================================================
+ * Document Rows
+ * ============================================================================
+ *
+ * Per-document (term id, count) entries, one row per document, ids local to
+ * whichever table produced them.
+ */
+
+typedef struct {
+    uint64_t *rows;       /* num_docs + 1 */
+    size_t    num_docs, rows_cap;
+    uint32_t *ids;
+    uint32_t *cnt;
+    size_t    nnz, ids_cap, cnt_cap;
+} hil_lex_rows_t;
+
+static void hil_lex_rows_free(hil_lex_rows_t *r) {
+    free(r->rows);
+    free(r->ids);
+    free(r->cnt);
+    memset(r, 0, sizeof(*r));
+}
+
+static int hil_lex_rows_reserve(hil_lex_rows_t *r, size_t docs, size_t nnz) {
+    return hil_lex_grow((void**)&r->rows, &r->rows_cap, docs + 1, sizeof(uint64_t)) &&
+           hil_lex_grow((void**)&r->ids, &r->ids_cap, nnz, sizeof(uint32_t)) &&
+           hil_lex_grow((void**)&r->cnt, &r->cnt_cap, nnz, sizeof(uint32_t));
+}
+
+/* ============================================================================
+ * Chunk Tokenization
+ * ============================================================================
+ */
+
+typedef struct {
+    hil_lex_table_t table;
+    hil_lex_rows_t  rows;
+    uint32_t *stamp;      /* per local id: last document seen + 1 */
+    uint32_t *pos;        /* per local id: entry index within that document */
+    size_t    stamp_cap, pos_cap;
+} hil_lex_chunk_t;
+
+static void hil_lex_chunk_free(hil_lex_chunk_t *c) {
+    hil_lex_table_free(&c->table);
+    hil_lex_rows_free(&c->rows);
+    free(c->stamp);
+    free(c->pos);
+    memset(c, 0, sizeof(*c));
+}
+
+static int hil_lex_chunk_run(
+    hil_lex_chunk_t *c,
+    const uint8_t *text,
+    const uint64_t *doc_offsets,
+    size_t d0,
+    size_t d1
+) {
+    hil_lex_rows_t *r = &c->rows;
+    if (!hil_lex_rows_reserve(r, d1 - d0, 0)) return 0;
+    r->rows[0] = 0;
+
+    for (size_t d = d0; d < d1; d++) {
+        const uint32_t mark = (uint32_t)(d - d0 + 1);
+        const uint64_t row_start = r->nnz;
+        size_t i = (size_t)doc_offsets[d];
+        const size_t end = (size_t)doc_offsets[d + 1];
+
+        while (i < end) {
+            if (!hil_lex_is_token(text[i])) { i++; continue; }
+            size_t j = i + 1;
+            while (j < end && hil_lex_is_token(text[j])) j++;
+
+            uint32_t id;
+            if (!hil_lex_table_add(&c->table, text + i, j - i, 1, &id)) return 0;
+            if (c->table.num > c->stamp_cap) {
+                const size_t old = c->stamp_cap;
+                if (!hil_lex_grow((void**)&c->stamp, &c->stamp_cap, c->table.num, sizeof(uint32_t))) return 0;
+                memset(c->stamp + old, 0, (c->stamp_cap - old) * sizeof(uint32_t));
+                if (!hil_lex_grow((void**)&c->pos, &c->pos_cap, c->stamp_cap, sizeof(uint32_t))) return 0;
+            }
+
+            if (c->stamp[id] == mark) {
+                uint32_t *n = &r->cnt[row_start + c->pos[id]];
+                if (*n == UINT32_MAX) return 0;
+                (*n)++;
+            } else {
+                if (!hil_lex_rows_reserve(r, d1 - d0, r->nnz + 1)) return 0;
+                c->stamp[id] = mark;
+                c->pos[id] = (uint32_t)(r->nnz - row_start);
+                r->ids[r->nnz] = id;
+                r->cnt[r->nnz] = 1;
+                r->nnz++;
+            }
+            i = j;
+        }
+        r->rows[d - d0 + 1] = r->nnz;
+    }
+    r->num_docs = d1 - d0;
+    return 1;
+}
+
+/* ============================================================================
+ * Streaming Lexicon
+ * ============================================================================
+ */
+
+struct hil_lexicon {
+    hil_lex_table_t table;   /* corpus terms, provisional (merge-order) ids */
+    hil_lex_rows_t  rows;    /* corpus rows over provisional ids */
+    int failed;
+};
+
+hil_lexicon_t *hil_lexicon_create(void) {
+    hil_lexicon_t *lex = (hil_lexicon_t*)calloc(1, sizeof(hil_lexicon_t));
+    if (!lex) return NULL;
+    if (!hil_lex_rows_reserve(&lex->rows, 0, 0)) {
+        free(lex);
+        return NULL;
+    }
+    lex->rows.rows[0] = 0;
+    return lex;
+}
+
+void hil_lexicon_free(hil_lexicon_t *lex) {
+    if (!lex) return;
+    hil_lex_table_free(&lex->table);
+    hil_lex_rows_free(&lex->rows);
+    free(lex);
+}
+
+/* Fold one chunk into the corpus table and rows, in document order. */
+static int hil_lex_merge_chunk(hil_lexicon_t *lex, const hil_lex_chunk_t *c) {
+    const hil_lex_table_t *t = &c->table;
+    uint32_t *map = (uint32_t*)malloc(sizeof(uint32_t) * (t->num ? t->num : 1));
+    if (!map) return 0;
+
+    for (size_t id = 0; id < t->num; id++) {
+        if (!hil_lex_table_add(&lex->table, (const uint8_t*)(t->bytes + t->starts[id]),
+                               t->lens[id], t->freq[id], &map[id])) {
+            free(map);
+            return 0;
+        }
+    }
+
+    hil_lex_rows_t *dst = &lex->rows;
+    const hil_lex_rows_t *src = &c->rows;
+    if (!hil_lex_rows_reserve(dst, dst->num_docs + src->num_docs, dst->nnz + src->nnz)) {
+        free(map);
+        return 0;
+    }
+    for (size_t k = 0; k < src->nnz; k++) {
+        dst->ids[dst->nnz + k] = map[src->ids[k]];
+        dst->cnt[dst->nnz + k] = src->cnt[k];
+    }
+    for (size_t d = 0; d < src->num_docs; d++) {
+        dst->rows[dst->num_docs + d + 1] = dst->nnz + src->rows[d + 1];
+    }
+    dst->nnz += src->nnz;
+    dst->num_docs += src->num_docs;
+
+    free(map);
+    return 1;
+}
+
+static int hil_lexicon_add_kernel(
+    hil_lexicon_t *lex,
+    const uint8_t *text,
+    const uint64_t *doc_offsets,
+    size_t num_docs
+) {
+    if (!lex || lex->failed) return 0;
+    if (num_docs == 0) return 1;
+    if (num_docs >= (size_t)UINT32_MAX) return 0;
+    if (!doc_offsets || (!text && doc_offsets[num_docs] > doc_offsets[0])) return 0;
+    for (size_t d = 0; d < num_docs; d++) {
+        if (doc_offsets[d + 1] < doc_offsets[d]) return 0;
+    }
+
+    size_t chunks = 1;
+    #ifdef _OPENMP
+    chunks = (size_t)omp_get_max_threads();
+    #endif
+    if (chunks > num_docs) chunks = num_docs;
+    if (chunks < 1) chunks = 1;
+
+    hil_lex_chunk_t *c = (hil_lex_chunk_t*)calloc(chunks, sizeof(hil_lex_chunk_t));
+    int *ok = (int*)calloc(chunks, sizeof(int));
+    if (!c || !ok) {
+        free(c);
+        free(ok);
+        lex->failed = 1;
+        return 0;
+    }
+
+    /* Contiguous document ranges keep the merged rows in document order. */
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static, 1) num_threads((int)chunks)
+    #endif
+    for (long long ii = 0; ii < (long long)chunks; ii++) {
+        const size_t k = (size_t)ii;
+        const size_t d0 = num_docs * k / chunks;
+        const size_t d1 = num_docs * (k + 1) / chunks;
+        ok[k] = hil_lex_chunk_run(&c[k], text, doc_offsets, d0, d1);
+    }
+
+    int good = 1;
+    for (size_t k = 0; k < chunks; k++) {
+        if (good) good = ok[k] && hil_lex_merge_chunk(lex, &c[k]);
+        hil_lex_chunk_free(&c[k]);
+    }
+    free(c);
+    free(ok);
+
+    if (!good) lex->failed = 1;
+    return good;
+}
+
+#ifdef HIL_STATS
+/* Heap bytes held by the corpus table and rows (capacities, not lengths). */
+static uint64_t hil_lex_footprint(const hil_lexicon_t *lex) {
+    const hil_lex_table_t *t = &lex->table;
+    const hil_lex_rows_t *r = &lex->rows;
+    return (uint64_t)t->slot_cap * sizeof(uint32_t)
+         + (uint64_t)t->term_cap * (3 * sizeof(uint64_t) + sizeof(uint32_t))
+         + (uint64_t)t->bytes_cap
+         + (uint64_t)r->rows_cap * sizeof(uint64_t)
+         + (uint64_t)(r->ids_cap + r->cnt_cap) * sizeof(uint32_t);
+}
+#endif
+
+int hil_lexicon_add(
+    hil_lexicon_t *lex,
+    const uint8_t *text,
+    const uint64_t *doc_offsets,
+    size_t num_docs
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+#ifdef HIL_STATS
+    const uint64_t before = lex ? hil_lex_footprint(lex) : 0;
+#endif
+    const int ok = hil_lexicon_add_kernel(lex, text, doc_offsets, num_docs);
+#ifdef HIL_STATS
+    const uint64_t after = lex ? hil_lex_footprint(lex) : 0;
+    HIL_STATS_END(HIL_STAT_LEXICON_ADD, t0, (after > before ? after - before : 0), num_docs);
+#else
+    HIL_STATS_END(HIL_STAT_LEXICON_ADD, t0, 0, 0);
+#endif
+    return ok;
+}
+
+/* ============================================================================
+ * Finish: Vocabulary Order and CSR
+ * ============================================================================
+ */
+
+typedef struct {
+    uint64_t    freq;
+    const char *bytes;
+    uint32_t    len;
+    uint32_t    id;
+} hil_lex_key_t;
+
+/* Descending count, then byte order with the shorter prefix first. */
+static int hil_lex_key_cmp(const void *a, const void *b) {
+    const hil_lex_key_t *x = (const hil_lex_key_t*)a;
+    const hil_lex_key_t *y = (const hil_lex_key_t*)b;
+    if (x->freq != y->freq) return (x->freq > y->freq) ? -1 : 1;
+    const uint32_t n = x->len < y->len ? x->len : y->len;
+    const int c = memcmp(x->bytes, y->bytes, n);
+    if (c != 0) return c;
+    return (x->len > y->len) - (x->len < y->len);
+}
+
+static int hil_lex_u64_cmp(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+void hil_term_doc_free(hil_term_doc_t *td) {
+    if (!td) return;
+    free(td->offsets);
+    free(td->indices);
+    free(td->counts);
+    free(td->term_counts);
+    free(td->term_offsets);
+    free(td->term_bytes);
+    memset(td, 0, sizeof(*td));
+}
+
+static int hil_lexicon_finish_kernel(
+    const hil_lexicon_t *lex,
+    uint64_t min_count,
+    size_t max_terms,
+    hil_term_doc_t *out
+) {
+    if (!lex || lex->failed || !out) return 0;
+    memset(out, 0, sizeof(*out));
+
+    const hil_lex_table_t *t = &lex->table;
+    const hil_lex_rows_t *r = &lex->rows;
+    const size_t n = t->num;
+    const size_t docs = r->num_docs;
+
+    hil_lex_key_t *keys = (hil_lex_key_t*)malloc(sizeof(hil_lex_key_t) * (n ? n : 1));
+    uint32_t *final_id = (uint32_t*)malloc(sizeof(uint32_t) * (n ? n : 1));
+    if (!keys || !final_id) goto fail;
+
+    for (size_t id = 0; id < n; id++) {
+        keys[id].freq = t->freq[id];
+        keys[id].bytes = t->bytes + t->starts[id];
+        keys[id].len = t->lens[id];
+        keys[id].id = (uint32_t)id;
+    }
+    qsort(keys, n, sizeof(hil_lex_key_t), hil_lex_key_cmp);
+
+    /* Sorted by descending count, so surviving terms form a prefix. */
+    size_t kept = 0;
+    while (kept < n && keys[kept].freq >= min_count) kept++;
+    if (max_terms > 0 && kept > max_terms) kept = max_terms;
+
+    for (size_t id = 0; id < n; id++) final_id[id] = UINT32_MAX;
+    size_t total_bytes = 0;
+    for (size_t k = 0; k < kept; k++) {
+        final_id[keys[k].id] = (uint32_t)k;
+        total_bytes += keys[k].len;
+    }
+
+    out->num_docs = docs;
+    out->num_terms = kept;
+    out->offsets = (uint64_t*)malloc(sizeof(uint64_t) * (docs + 1));
+    out->term_counts = (uint64_t*)malloc(sizeof(uint64_t) * (kept ? kept : 1));
+    out->term_offsets = (uint64_t*)malloc(sizeof(uint64_t) * (kept + 1));
+    out->term_bytes = (char*)malloc(total_bytes ? total_bytes : 1);
+    if (!out->offsets || !out->term_counts || !out->term_offsets || !out->term_bytes) goto fail;
+
+    out->term_offsets[0] = 0;
+    for (size_t k = 0; k < kept; k++) {
+        memcpy(out->term_bytes + out->term_offsets[k], keys[k].bytes, keys[k].len);
+        out->term_offsets[k + 1] = out->term_offsets[k] + keys[k].len;
+        out->term_counts[k] = keys[k].freq;
+    }
+
+    /* Pass 1: surviving entries per row. */
+    out->offsets[0] = 0;
+    size_t widest = 0;
+    for (size_t d = 0; d < docs; d++) {
+        size_t len = 0;
+        for (uint64_t k = r->rows[d]; k < r->rows[d + 1]; k++) {
+            if (final_id[r->ids[k]] != UINT32_MAX) len++;
+        }
+        out->offsets[d + 1] = out->offsets[d] + len;
+        if (len > widest) widest = len;
+    }
+
+    const size_t nnz = (size_t)out->offsets[docs];
+    out->indices = (uint32_t*)malloc(sizeof(uint32_t) * (nnz ? nnz : 1));
+    out->counts = (double*)malloc(sizeof(double) * (nnz ? nnz : 1));
+    if (!out->indices || !out->counts) goto fail;
+
+    /* Pass 2: remap, sort each row by final id (packed id:count keys). */
+    int good = 1;
+    #ifdef _OPENMP
+    #pragma omp parallel reduction(&&:good)
+    #endif
+    {
+        uint64_t *packed = (uint64_t*)malloc(sizeof(uint64_t) * (widest ? widest : 1));
+        if (!packed) good = 0;
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 256)
+        #endif
+        for (long long dd = 0; dd < (long long)docs; dd++) {
+            if (!packed) continue;
+            const size_t d = (size_t)dd;
+            size_t len = 0;
+            for (uint64_t k = r->rows[d]; k < r->rows[d + 1]; k++) {
+                const uint32_t f = final_id[r->ids[k]];
+                if (f != UINT32_MAX) packed[len++] = ((uint64_t)f << 32) | r->cnt[k];
+            }
+            qsort(packed, len, sizeof(uint64_t), hil_lex_u64_cmp);
+            const uint64_t base = out->offsets[d];
+            for (size_t k = 0; k < len; k++) {
+                out->indices[base + k] = (uint32_t)(packed[k] >> 32);
+                out->counts[base + k] = (double)(uint32_t)packed[k];
+            }
+        }
+        free(packed);
+    }
+    if (!good) goto fail;
+
+    free(keys);
+    free(final_id);
+    return 1;
+
+fail:
+    free(keys);
+    free(final_id);
+    hil_term_doc_free(out);
+    return 0;
+}
+
+int hil_lexicon_finish(
+    const hil_lexicon_t *lex,
+    uint64_t min_count,
+    size_t max_terms,
+    hil_term_doc_t *out
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_lexicon_finish_kernel(lex, min_count, max_terms, out);
+    HIL_STATS_END(HIL_STAT_LEXICON_FINISH, t0,
+                  (ok ? (out->num_docs + 1 + 2 * out->num_terms + 1) * sizeof(uint64_t)
+                      + out->offsets[out->num_docs] * (sizeof(uint32_t) + sizeof(double))
+                      + out->term_offsets[out->num_terms] : 0),
+                  (ok ? out->num_docs : 0));
+    return ok;
+}
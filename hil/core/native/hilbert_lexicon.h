@@ -0,0 +1,106 @@
+#ifndef HILBERT_LEXICON_H
+#define HILBERT_LEXICON_H
+
+/*
+ * hilbert_lexicon.h
+ *
+ * Byte-level tokenization and term counting for the HIL embedding step.
+ *
+ * Tokens are maximal runs of [A-Za-z0-9_] with A-Z folded to a-z; every
+ * other byte separates. Text is opaque bytes: no language model, no stop
+ * words, no stemming. This matches hil.core.embeddings.vocabulary.tokenize
+ * on UTF-8 input once the two code points whose lower-case form is ASCII
+ * (U+0130, U+212A) are folded by the caller.
+ *
+ * Epistemic constraints:
+ *  - No semantics or interpretation
+ *  - No persistence, identity, or provenance
+ *  - Deterministic output, independent of batching and thread count
+ */
+
+#include <stddef.h>   /* size_t */
+#include <stdint.h>   /* uint32_t, uint64_t */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * Term-Document Matrix
+ * ============================================================================
+ */
+
+/*
+ * Document-by-term counts in CSR form plus the vocabulary it indexes.
+ *
+ * Term ids are ordered by descending corpus count, ties broken by byte
+ * order of the term (hil.core.embeddings.vocabulary.build_vocabulary).
+ * Row i lists the distinct terms of document i in ascending id order.
+ *
+ * Term t is term_bytes[term_offsets[t] .. term_offsets[t + 1]).
+ * All arrays are owned; release with hil_term_doc_free.
+ */
+typedef struct {
+    size_t    num_docs;
+    size_t    num_terms;
+    uint64_t *offsets;        /* num_docs + 1 */
+    uint32_t *indices;        /* offsets[num_docs] term ids */
+    double   *counts;         /* offsets[num_docs] occurrence counts */
+    uint64_t *term_counts;    /* num_terms corpus counts */
+    uint64_t *term_offsets;   /* num_terms + 1 */
+    char     *term_bytes;     /* term_offsets[num_terms] bytes, no separators */
+} hil_term_doc_t;
+
+void hil_term_doc_free(hil_term_doc_t *td);
+
+/* ============================================================================
+ * Streaming Lexicon
+ * ============================================================================
+ *
+ * Documents arrive in batches; each batch is tokenized in contiguous
+ * document chunks across threads (OpenMP when enabled), each chunk into its
+ * own open-addressing table, and the chunk tables are then merged into the
+ * corpus table in chunk order. Final ids are assigned only at finish, by
+ * sorting, so batching and threading never change the output.
+ */
+
+typedef struct hil_lexicon hil_lexicon_t;
+
+/* Returns NULL on allocation failure. */
+hil_lexicon_t *hil_lexicon_create(void);
+void hil_lexicon_free(hil_lexicon_t *lex);
+
+/*
+ * Append num_docs documents. Document i is
+ * text[doc_offsets[i] .. doc_offsets[i + 1]); doc_offsets has num_docs + 1
+ * non-decreasing entries and need not start at zero.
+ *
+ * Returns 1 on success, 0 on failure (the lexicon is then unusable).
+ */
+int hil_lexicon_add(
+    hil_lexicon_t *lex,
+    const uint8_t *text,
+    const uint64_t *doc_offsets,
+    size_t num_docs
+);
+
+/*
+ * Emit the term-document matrix for every document added so far.
+ *
+ * Terms with corpus count < min_count are dropped; max_terms > 0 then keeps
+ * only the first max_terms ids. Rows keep every document, possibly empty.
+ *
+ * Returns 1 on success, 0 on failure.
+ */
+int hil_lexicon_finish(
+    const hil_lexicon_t *lex,
+    uint64_t min_count,
+    size_t max_terms,
+    hil_term_doc_t *out
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HILBERT_LEXICON_H */
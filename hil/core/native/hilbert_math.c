@@ -66,16 +66,425 @@ double hil_decay_power(double t, double alpha) {
  * ============================================================================
  */
 
-double hil_vec_dot(const double *a, const double *b, size_t n) {
+/* The canonical order forbids contracting a * b + s into an FMA. */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(__GNUC__)
+#pragma GCC optimize ("fp-contract=off")
+#endif
+
+#if defined(HIL_SEQUENTIAL_REDUCTION)
+
+/* Reference order: single accumulator, left to right. */
+static double hil_dot_sequential(const double *a, const double *b, size_t n) {
     double s = 0.0;
     for (size_t i = 0; i < n; i++) s += a[i] * b[i];
     return s;
 }
 
-double hil_vec_norm(const double *a, size_t n) {
+static double hil_dot_f32_sequential(const float *a, const float *b, size_t n) {
     double s = 0.0;
-    for (size_t i = 0; i < n; i++) s += a[i] * a[i];
-    return sqrt(s);
+    for (size_t i = 0; i < n; i++) s += (double)a[i] * (double)b[i];
+    return s;
+}
+
+#else
+
+/*
+ * Canonical lane combine: k + k+8, k + k+4, k + k+2, 0 + 1.
+ */
+static inline double hil_combine_lanes(double *s) {
+    for (size_t w = HIL_VEC_LANES / 2; w > 0; w /= 2) {
+        for (size_t k = 0; k < w; k++) s[k] += s[k + w];
+    }
+    return s[0];
+}
+
+/*
+ * Every lane kernel is written once per ISA as an accumulator type, a
+ * BLOCK step folding elements [0, 16) of a and b into the accumulators,
+ * and a STORE writing them out as the 16 canonical lanes. Elements past
+ * the last full block then go to lane (i mod 16), and the lanes combine.
+ *
+ * HIL_DOT_DEFINE emits the runtime-length kernel NAME and NAME##_fixed,
+ * a table of the same kernel at each HIL_VEC_FIXED_DIMS length. With n a
+ * compile-time constant both loops below unroll completely, leaving
+ * straight-line code for the block run and the (n mod 16) tail. The
+ * arithmetic is the same expression in the same order, so NAME and
+ * NAME##_fixed agree bit for bit.
+ */
+#if defined(__clang__)
+#define HIL_UNROLL_FIXED _Pragma("unroll")
+#elif defined(__GNUC__)
+#define HIL_UNROLL_FIXED _Pragma("GCC unroll 64")
+#else
+#define HIL_UNROLL_FIXED
+#endif
+
+#if defined(__GNUC__)
+#define HIL_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define HIL_ALWAYS_INLINE
+#endif
+
+#define HIL_DOT_FIXED_COUNT 6
+
+#define HIL_DOT_DEFINE(NAME, ATTR, T, ACC_T, ACC_N, ACC_ZERO, BLOCK, STORE)               \
+    ATTR HIL_ALWAYS_INLINE static inline double NAME##_n(                                 \
+        const T *a, const T *b, const size_t n, const int fixed) {                        \
+        ACC_T acc[ACC_N];                                                                 \
+        for (size_t k = 0; k < (ACC_N); k++) acc[k] = ACC_ZERO;                           \
+        const size_t nb = n - (n % HIL_VEC_LANES);                                        \
+        double s[HIL_VEC_LANES];                                                          \
+        if (fixed) {                                                                      \
+            HIL_UNROLL_FIXED                                                              \
+            for (size_t i = 0; i < nb; i += HIL_VEC_LANES) BLOCK(acc, a + i, b + i);      \
+            STORE(s, acc);                                                                \
+            HIL_UNROLL_FIXED                                                              \
+            for (size_t i = nb; i < n; i++) s[i % HIL_VEC_LANES] += (double)a[i] * (double)b[i]; \
+        } else {                                                                          \
+            for (size_t i = 0; i < nb; i += HIL_VEC_LANES) BLOCK(acc, a + i, b + i);      \
+            STORE(s, acc);                                                                \
+            for (size_t i = nb; i < n; i++) s[i % HIL_VEC_LANES] += (double)a[i] * (double)b[i]; \
+        }                                                                                 \
+        return hil_combine_lanes(s);                                                      \
+    }                                                                                     \
+    ATTR static double NAME(const T *a, const T *b, size_t n) {                           \
+        return NAME##_n(a, b, n, 0);                                                      \
+    }                                                                                     \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 64)                                                   \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 128)                                                  \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 256)                                                  \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 300)                                                  \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 384)                                                  \
+    HIL_DOT_FIXED_AT(NAME, ATTR, T, 768)                                                  \
+    static double (*const NAME##_fixed[HIL_DOT_FIXED_COUNT])(const T *, const T *, size_t) = { \
+        NAME##_64, NAME##_128, NAME##_256, NAME##_300, NAME##_384, NAME##_768             \
+    };
+
+/* The n argument is ignored: hil_vec_dot_for hands these out for n == D only. */
+#define HIL_DOT_FIXED_AT(NAME, ATTR, T, D)                                                \
+    ATTR static double NAME##_##D(const T *a, const T *b, size_t n) {                     \
+        (void)n;                                                                          \
+        return NAME##_n(a, b, (D), 1);                                                    \
+    }
+
+/* Must list the lengths of HIL_DOT_DEFINE's tables, in order. */
+static const size_t hil_dot_fixed_dims[HIL_DOT_FIXED_COUNT] = { 64, 128, 256, 300, 384, 768 };
+
+/* Sixteen scalar accumulators, one per lane (double and float inputs). */
+#define HIL_SCALAR_BLOCK(acc, a, b)                                                       \
+    HIL_UNROLL_FIXED                                                                      \
+    for (size_t k = 0; k < HIL_VEC_LANES; k++) (acc)[k] += (double)(a)[k] * (double)(b)[k]
+#define HIL_SCALAR_STORE(s, acc)                                                          \
+    for (size_t k = 0; k < HIL_VEC_LANES; k++) (s)[k] = (acc)[k]
+
+HIL_DOT_DEFINE(hil_dot_scalar, , double, double, HIL_VEC_LANES, 0.0,
+               HIL_SCALAR_BLOCK, HIL_SCALAR_STORE)
+
+/* Widened before the multiply. */
+HIL_DOT_DEFINE(hil_dot_f32_scalar, , float, double, HIL_VEC_LANES, 0.0,
+               HIL_SCALAR_BLOCK, HIL_SCALAR_STORE)
+
+#endif /* HIL_SEQUENTIAL_REDUCTION */
+
+#if !defined(HIL_SEQUENTIAL_REDUCTION) && defined(__GNUC__) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HIL_VEC_X86 1
+#include <immintrin.h>
+
+/* Four 4-lane accumulators cover lanes 0..15. mul + add, never FMA. */
+__attribute__((target("avx2"))) HIL_ALWAYS_INLINE
+static inline void hil_block_avx2(__m256d *acc, const double *a, const double *b) {
+    acc[0] = _mm256_add_pd(acc[0], _mm256_mul_pd(_mm256_loadu_pd(a),      _mm256_loadu_pd(b)));
+    acc[1] = _mm256_add_pd(acc[1], _mm256_mul_pd(_mm256_loadu_pd(a + 4),  _mm256_loadu_pd(b + 4)));
+    acc[2] = _mm256_add_pd(acc[2], _mm256_mul_pd(_mm256_loadu_pd(a + 8),  _mm256_loadu_pd(b + 8)));
+    acc[3] = _mm256_add_pd(acc[3], _mm256_mul_pd(_mm256_loadu_pd(a + 12), _mm256_loadu_pd(b + 12)));
+}
+
+/* As hil_block_avx2, widening four floats per accumulator. */
+__attribute__((target("avx2"))) HIL_ALWAYS_INLINE
+static inline void hil_block_f32_avx2(__m256d *acc, const float *a, const float *b) {
+#define HIL_F32X4_AVX2(k)                                                    \
+    acc[k] = _mm256_add_pd(acc[k], _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(a + 4 * (k))), \
+                                                 _mm256_cvtps_pd(_mm_loadu_ps(b + 4 * (k)))))
+    HIL_F32X4_AVX2(0);
+    HIL_F32X4_AVX2(1);
+    HIL_F32X4_AVX2(2);
+    HIL_F32X4_AVX2(3);
+#undef HIL_F32X4_AVX2
+}
+
+__attribute__((target("avx2"))) HIL_ALWAYS_INLINE
+static inline void hil_store_avx2(double *s, const __m256d *acc) {
+    _mm256_storeu_pd(s, acc[0]);
+    _mm256_storeu_pd(s + 4, acc[1]);
+    _mm256_storeu_pd(s + 8, acc[2]);
+    _mm256_storeu_pd(s + 12, acc[3]);
+    /* The compiler does not clear the upper halves before the scalar tail;
+       left dirty, every later SSE instruction (e.g. libm log) pays a
+       transition penalty. */
+    _mm256_zeroupper();
+}
+
+HIL_DOT_DEFINE(hil_dot_avx2, __attribute__((target("avx2"))), double, __m256d, 4,
+               _mm256_setzero_pd(), hil_block_avx2, hil_store_avx2)
+HIL_DOT_DEFINE(hil_dot_f32_avx2, __attribute__((target("avx2"))), float, __m256d, 4,
+               _mm256_setzero_pd(), hil_block_f32_avx2, hil_store_avx2)
+
+__attribute__((target("avx2")))
+static void hil_add_f32_avx2(double *dst, const float *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(dst + i),
+                                                _mm256_cvtps_pd(_mm_loadu_ps(src + i))));
+    }
+    for (; i < n; i++) dst[i] += (double)src[i];
+}
+
+__attribute__((target("avx2")))
+static void hil_add_avx2(double *dst, const double *src, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_loadu_pd(dst + i), _mm256_loadu_pd(src + i)));
+    }
+    for (; i < n; i++) dst[i] += src[i];
+}
+
+__attribute__((target("avx2")))
+static void hil_scale_avx2(double *dst, size_t n, double k) {
+    const __m256d kv = _mm256_set1_pd(k);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(dst + i, _mm256_mul_pd(_mm256_loadu_pd(dst + i), kv));
+    }
+    for (; i < n; i++) dst[i] *= k;
+}
+
+/* Two 8-lane accumulators cover lanes 0..15. */
+__attribute__((target("avx512f"))) HIL_ALWAYS_INLINE
+static inline void hil_block_avx512(__m512d *acc, const double *a, const double *b) {
+    acc[0] = _mm512_add_pd(acc[0], _mm512_mul_pd(_mm512_loadu_pd(a),     _mm512_loadu_pd(b)));
+    acc[1] = _mm512_add_pd(acc[1], _mm512_mul_pd(_mm512_loadu_pd(a + 8), _mm512_loadu_pd(b + 8)));
+}
+
+__attribute__((target("avx512f"))) HIL_ALWAYS_INLINE
+static inline void hil_block_f32_avx512(__m512d *acc, const float *a, const float *b) {
+    acc[0] = _mm512_add_pd(acc[0], _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(a)),
+                                                 _mm512_cvtps_pd(_mm256_loadu_ps(b))));
+    acc[1] = _mm512_add_pd(acc[1], _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(a + 8)),
+                                                 _mm512_cvtps_pd(_mm256_loadu_ps(b + 8))));
+}
+
+__attribute__((target("avx512f"))) HIL_ALWAYS_INLINE
+static inline void hil_store_avx512(double *s, const __m512d *acc) {
+    _mm512_storeu_pd(s, acc[0]);
+    _mm512_storeu_pd(s + 8, acc[1]);
+    _mm256_zeroupper();  /* as in hil_store_avx2 */
+}
+
+HIL_DOT_DEFINE(hil_dot_avx512, __attribute__((target("avx512f"))), double, __m512d, 2,
+               _mm512_setzero_pd(), hil_block_avx512, hil_store_avx512)
+HIL_DOT_DEFINE(hil_dot_f32_avx512, __attribute__((target("avx512f"))), float, __m512d, 2,
+               _mm512_setzero_pd(), hil_block_f32_avx512, hil_store_avx512)
+
+__attribute__((target("avx512f")))
+static void hil_add_f32_avx512(double *dst, const float *src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(dst + i),
+                                                _mm512_cvtps_pd(_mm256_loadu_ps(src + i))));
+    }
+    for (; i < n; i++) dst[i] += (double)src[i];
+}
+
+__attribute__((target("avx512f")))
+static void hil_add_avx512(double *dst, const double *src, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(dst + i, _mm512_add_pd(_mm512_loadu_pd(dst + i), _mm512_loadu_pd(src + i)));
+    }
+    for (; i < n; i++) dst[i] += src[i];
+}
+
+__attribute__((target("avx512f")))
+static void hil_scale_avx512(double *dst, size_t n, double k) {
+    const __m512d kv = _mm512_set1_pd(k);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm512_storeu_pd(dst + i, _mm512_mul_pd(_mm512_loadu_pd(dst + i), kv));
+    }
+    for (; i < n; i++) dst[i] *= k;
+}
+#endif /* HIL_VEC_X86 */
+
+#if !defined(HIL_SEQUENTIAL_REDUCTION) && defined(__aarch64__) && defined(__ARM_NEON)
+#define HIL_VEC_NEON 1
+#include <arm_neon.h>
+
+/* Eight 2-lane accumulators cover lanes 0..15. vmulq + vaddq, never vfmaq. */
+HIL_ALWAYS_INLINE
+static inline void hil_block_neon(float64x2_t *acc, const double *a, const double *b) {
+    HIL_UNROLL_FIXED
+    for (size_t k = 0; k < HIL_VEC_LANES / 2; k++) {
+        acc[k] = vaddq_f64(acc[k], vmulq_f64(vld1q_f64(a + 2 * k), vld1q_f64(b + 2 * k)));
+    }
+}
+
+HIL_ALWAYS_INLINE
+static inline void hil_block_f32_neon(float64x2_t *acc, const float *a, const float *b) {
+    HIL_UNROLL_FIXED
+    for (size_t k = 0; k < HIL_VEC_LANES / 4; k++) {
+        const float32x4_t x = vld1q_f32(a + 4 * k);
+        const float32x4_t y = vld1q_f32(b + 4 * k);
+        acc[2 * k] = vaddq_f64(acc[2 * k], vmulq_f64(vcvt_f64_f32(vget_low_f32(x)),
+                                                     vcvt_f64_f32(vget_low_f32(y))));
+        acc[2 * k + 1] = vaddq_f64(acc[2 * k + 1], vmulq_f64(vcvt_high_f64_f32(x),
+                                                             vcvt_high_f64_f32(y)));
+    }
+}
+
+HIL_ALWAYS_INLINE
+static inline void hil_store_neon(double *s, const float64x2_t *acc) {
+    HIL_UNROLL_FIXED
+    for (size_t k = 0; k < HIL_VEC_LANES / 2; k++) vst1q_f64(s + 2 * k, acc[k]);
+}
+
+HIL_DOT_DEFINE(hil_dot_neon, , double, float64x2_t, HIL_VEC_LANES / 2,
+               vdupq_n_f64(0.0), hil_block_neon, hil_store_neon)
+HIL_DOT_DEFINE(hil_dot_f32_neon, , float, float64x2_t, HIL_VEC_LANES / 2,
+               vdupq_n_f64(0.0), hil_block_f32_neon, hil_store_neon)
+
+static void hil_add_f32_neon(double *dst, const float *src, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        vst1q_f64(dst + i, vaddq_f64(vld1q_f64(dst + i), vcvt_f64_f32(vld1_f32(src + i))));
+    }
+    for (; i < n; i++) dst[i] += (double)src[i];
+}
+
+static void hil_add_neon(double *dst, const double *src, size_t n) {
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) vst1q_f64(dst + i, vaddq_f64(vld1q_f64(dst + i), vld1q_f64(src + i)));
+    for (; i < n; i++) dst[i] += src[i];
+}
+
+static void hil_scale_neon(double *dst, size_t n, double k) {
+    const float64x2_t kv = vdupq_n_f64(k);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) vst1q_f64(dst + i, vmulq_f64(vld1q_f64(dst + i), kv));
+    for (; i < n; i++) dst[i] *= k;
+}
+#endif /* HIL_VEC_NEON */
+
+static void hil_add_scalar(double *dst, const double *src, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] += src[i];
+}
+
+static void hil_scale_scalar(double *dst, size_t n, double k) {
+    for (size_t i = 0; i < n; i++) dst[i] *= k;
+}
+
+static void hil_add_f32_scalar(double *dst, const float *src, size_t n) {
+    for (size_t i = 0; i < n; i++) dst[i] += (double)src[i];
+}
+
+/*
+ * Kernel table, selected once from CPU features. x86 targets resolve in a
+ * load-time constructor; the first-call check covers toolchains without
+ * constructor support. Selection never changes results (see header).
+ */
+typedef struct {
+    double (*dot)(const double *, const double *, size_t);
+    void   (*add)(double *, const double *, size_t);
+    void   (*scale)(double *, size_t, double);
+    double (*dot_f32)(const float *, const float *, size_t);
+    void   (*add_f32)(double *, const float *, size_t);
+    const char *name;
+    /* Fixed-length dots at hil_dot_fixed_dims; NULL without them. */
+    double (*const *dot_fixed)(const double *, const double *, size_t);
+    double (*const *dot_f32_fixed)(const float *, const float *, size_t);
+} hil_vec_kernels_t;
+
+static hil_vec_kernels_t hil_vec_k = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+
+static void hil_vec_select(void) {
+#if defined(HIL_SEQUENTIAL_REDUCTION)
+    hil_vec_k = (hil_vec_kernels_t){ hil_dot_sequential, hil_add_scalar, hil_scale_scalar,
+                                     hil_dot_f32_sequential, hil_add_f32_scalar, "sequential",
+                                     NULL, NULL };
+#elif defined(HIL_VEC_X86)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        hil_vec_k = (hil_vec_kernels_t){ hil_dot_avx512, hil_add_avx512, hil_scale_avx512,
+                                         hil_dot_f32_avx512, hil_add_f32_avx512, "avx512",
+                                         hil_dot_avx512_fixed, hil_dot_f32_avx512_fixed };
+    } else if (__builtin_cpu_supports("avx2")) {
+        hil_vec_k = (hil_vec_kernels_t){ hil_dot_avx2, hil_add_avx2, hil_scale_avx2,
+                                         hil_dot_f32_avx2, hil_add_f32_avx2, "avx2",
+                                         hil_dot_avx2_fixed, hil_dot_f32_avx2_fixed };
+    } else {
+        hil_vec_k = (hil_vec_kernels_t){ hil_dot_scalar, hil_add_scalar, hil_scale_scalar,
+                                         hil_dot_f32_scalar, hil_add_f32_scalar, "scalar",
+                                         hil_dot_scalar_fixed, hil_dot_f32_scalar_fixed };
+    }
+#elif defined(HIL_VEC_NEON)
+    hil_vec_k = (hil_vec_kernels_t){ hil_dot_neon, hil_add_neon, hil_scale_neon,
+                                     hil_dot_f32_neon, hil_add_f32_neon, "neon",
+                                     hil_dot_neon_fixed, hil_dot_f32_neon_fixed };
+#else
+    hil_vec_k = (hil_vec_kernels_t){ hil_dot_scalar, hil_add_scalar, hil_scale_scalar,
+                                     hil_dot_f32_scalar, hil_add_f32_scalar, "scalar",
+                                     hil_dot_scalar_fixed, hil_dot_f32_scalar_fixed };
+#endif
+}
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+static void hil_vec_init(void) {
+    hil_vec_select();
+}
+#endif
+
+static const hil_vec_kernels_t *hil_vec_kernels(void) {
+    if (!hil_vec_k.dot) hil_vec_select();
+    return &hil_vec_k;
+}
+
+const char *hil_vec_backend(void) {
+    return hil_vec_kernels()->name;
+}
+
+/* Slot of n in hil_dot_fixed_dims, or -1. */
+static int hil_dot_fixed_slot(size_t n) {
+#if !defined(HIL_SEQUENTIAL_REDUCTION)
+    for (int k = 0; k < HIL_DOT_FIXED_COUNT; k++) {
+        if (hil_dot_fixed_dims[k] == n) return k;
+    }
+#else
+    (void)n;
+#endif
+    return -1;
+}
+
+hil_vec_dot_fn hil_vec_dot_for(size_t n) {
+    const hil_vec_kernels_t *k = hil_vec_kernels();
+    const int slot = hil_dot_fixed_slot(n);
+    return (k->dot_fixed && slot >= 0) ? k->dot_fixed[slot] : k->dot;
+}
+
+hil_vec_dot_f32_fn hil_vec_dot_f32_for(size_t n) {
+    const hil_vec_kernels_t *k = hil_vec_kernels();
+    const int slot = hil_dot_fixed_slot(n);
+    return (k->dot_f32_fixed && slot >= 0) ? k->dot_f32_fixed[slot] : k->dot_f32;
+}
+
+double hil_vec_dot(const double *a, const double *b, size_t n) {
+    return hil_vec_kernels()->dot(a, b, n);
+}
+
+double hil_vec_norm(const double *a, size_t n) {
+    return sqrt(hil_vec_dot(a, a, n));
 }
 
 void hil_vec_zero(double *dst, size_t n) {
@@ -83,17 +492,29 @@ void hil_vec_zero(double *dst, size_t n) {
 }
 
 void hil_vec_add_inplace(double *dst, const double *src, size_t n) {
-    for (size_t i = 0; i < n; i++) dst[i] += src[i];
+    hil_vec_kernels()->add(dst, src, n);
 }
 
 void hil_vec_scale_inplace(double *dst, size_t n, double k) {
-    for (size_t i = 0; i < n; i++) dst[i] *= k;
+    hil_vec_kernels()->scale(dst, n, k);
 }
 
 void hil_vec_copy(double *dst, const double *src, size_t n) {
     for (size_t i = 0; i < n; i++) dst[i] = src[i];
 }
 
+double hil_vec_dot_f32(const float *a, const float *b, size_t n) {
+    return hil_vec_kernels()->dot_f32(a, b, n);
+}
+
+double hil_vec_norm_f32(const float *a, size_t n) {
+    return sqrt(hil_vec_dot_f32(a, a, n));
+}
+
+void hil_vec_add_f32_inplace(double *dst, const float *src, size_t n) {
+    hil_vec_kernels()->add_f32(dst, src, n);
+}
+
 /* Deterministic sign pattern for perturbation (no RNG, no state) */
 double hil_det_sign(size_t idx) {
     return (idx & 1u) ? -1.0 : 1.0;
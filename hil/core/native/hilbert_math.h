@@ -38,8 +38,19 @@ double hil_decay_power(double t, double alpha);
 /* ============================================================================
  * Vector Helpers
  * ============================================================================
+ *
+ * hil_vec_dot / hil_vec_norm reduce in a canonical order: element i is
+ * accumulated into lane (i mod HIL_VEC_LANES), and the lanes are combined by
+ * a fixed pairwise tree. Every implementation (scalar, AVX2, AVX-512, NEON)
+ * follows this order without FMA contraction, so results are bitwise
+ * identical whichever kernel is selected at load time.
+ *
+ * Define HIL_SEQUENTIAL_REDUCTION at build time to use the single
+ * accumulator reference order instead (no dispatch).
  */
 
+#define HIL_VEC_LANES 16
+
 double hil_vec_dot(const double *a, const double *b, size_t n);
 double hil_vec_norm(const double *a, size_t n);
 void   hil_vec_zero(double *dst, size_t n);
@@ -47,9 +58,39 @@ void   hil_vec_add_inplace(double *dst, const double *src, size_t n);
 void   hil_vec_scale_inplace(double *dst, size_t n, double k);
 void   hil_vec_copy(double *dst, const double *src, size_t n);
 
+/*
+ * float32 inputs, double accumulation. Elements are widened before the
+ * multiply, and a product of two floats is exact in double, so
+ * hil_vec_dot_f32(a, b) equals hil_vec_dot on the widened arrays bit for
+ * bit (same canonical lane order, every backend).
+ */
+double hil_vec_dot_f32(const float *a, const float *b, size_t n);
+double hil_vec_norm_f32(const float *a, size_t n);
+void   hil_vec_add_f32_inplace(double *dst, const float *src, size_t n);
+
+/*
+ * Row kernels: the dot kernel for vectors of exactly n elements, resolved
+ * once so loops over many rows of one length skip the per-call dispatch.
+ * For n in 64, 128, 256, 300, 384 and 768 this is a fixed-length copy of
+ * the selected kernel with every loop unrolled (no runtime trip count or
+ * tail loop); other n get the runtime-length kernel. Either way the result
+ * equals hil_vec_dot(a, b, n) bit for bit.
+ *
+ * The returned function must only be called with that same n.
+ */
+typedef double (*hil_vec_dot_fn)(const double *a, const double *b, size_t n);
+typedef double (*hil_vec_dot_f32_fn)(const float *a, const float *b, size_t n);
+
+hil_vec_dot_fn     hil_vec_dot_for(size_t n);
+hil_vec_dot_f32_fn hil_vec_dot_f32_for(size_t n);
+
 /* Deterministic sign pattern (no RNG, no state) */
 double hil_det_sign(size_t idx);
 
+/* Name of the vector kernel selected at load time:
+   "sequential", "scalar", "avx2", "avx512" or "neon". */
+const char *hil_vec_backend(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,288 +22,3938 @@
 #include "hilbert_native.h"
 #include "hilbert_math.h"
 
+#include <stdlib.h>   /* malloc, free */
+#include <string.h>   /* memcpy */
+#include <math.h>     /* sqrt, log */
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/* ============================================================================
+ * Workspace (Scratch Arena)
+ * ============================================================================
+ */
+
+#define HIL_WS_ALIGN 64
+
+static size_t hil_ws_round(size_t bytes) {
+    return (bytes + (HIL_WS_ALIGN - 1)) & ~(size_t)(HIL_WS_ALIGN - 1);
+}
+
+/* Arena bytes one hil_workspace_alloc(ws, bytes) call consumes. Plain
+   wrappers sum these over their kernel's allocations to size the temporary
+   arena up front, so the kernel runs in one block, not one-off blocks. */
+static size_t hil_ws_need(size_t bytes) {
+    return hil_ws_round(bytes ? bytes : 1);
+}
+
+/* Thread count kernels carve per-thread scratch for. */
+static size_t hil_ws_threads(void) {
+    #ifdef _OPENMP
+    return (size_t)omp_get_max_threads();
+    #else
+    return 1;
+    #endif
+}
+
+static unsigned char *hil_ws_aligned(void *raw) {
+    const uintptr_t p = (uintptr_t)raw;
+    return (unsigned char*)((p + (HIL_WS_ALIGN - 1)) & ~(uintptr_t)(HIL_WS_ALIGN - 1));
+}
+
+static void hil_ws_drop_overflow(hil_workspace_t *ws) {
+    for (size_t i = 0; i < ws->overflow_count; i++) free(ws->overflow[i]);
+    ws->overflow_count = 0;
+}
+
+int hil_workspace_init(hil_workspace_t *ws, size_t initial_bytes) {
+    if (!ws) return 0;
+    memset(ws, 0, sizeof(*ws));
+    if (initial_bytes == 0) return 1;
+
+    const size_t cap = hil_ws_round(initial_bytes);
+    ws->block = malloc(cap + HIL_WS_ALIGN);
+    if (!ws->block) return 0;
+    ws->capacity = cap;
+    return 1;
+}
+
+void hil_workspace_reset(hil_workspace_t *ws) {
+    if (!ws) return;
+    hil_ws_drop_overflow(ws);
+
+    /* Grow the primary block to the largest call seen so far, so a
+       repeated call pattern settles into zero allocations. */
+    if (ws->peak > ws->capacity) {
+        void *grown = malloc(ws->peak + HIL_WS_ALIGN);
+        if (grown) {
+            free(ws->block);
+            ws->block = grown;
+            ws->capacity = ws->peak;
+        }
+    }
+
+    ws->used = 0;
+    ws->requested = 0;
+}
+
+void *hil_workspace_alloc(hil_workspace_t *ws, size_t bytes) {
+    if (!ws) return NULL;
+    const size_t need = hil_ws_need(bytes);
+    if (need < bytes) return NULL;
+
+    ws->requested += need;
+    if (ws->requested > ws->peak) ws->peak = ws->requested;
+
+    if (ws->block && ws->used + need <= ws->capacity) {
+        unsigned char *p = hil_ws_aligned(ws->block) + ws->used;
+        ws->used += need;
+        return p;
+    }
+
+    /* Past capacity: serve from a one-off block until the next reset. */
+    if (ws->overflow_count == ws->overflow_cap) {
+        const size_t cap = ws->overflow_cap ? 2 * ws->overflow_cap : 4;
+        void **list = (void**)realloc(ws->overflow, sizeof(void*) * cap);
+        if (!list) return NULL;
+        ws->overflow = list;
+        ws->overflow_cap = cap;
+    }
+    void *raw = malloc(need + HIL_WS_ALIGN);
+    if (!raw) return NULL;
+    ws->overflow[ws->overflow_count++] = raw;
+    return hil_ws_aligned(raw);
+}
+
+void hil_workspace_free(hil_workspace_t *ws) {
+    if (!ws) return;
+    hil_ws_drop_overflow(ws);
+    free(ws->overflow);
+    free(ws->block);
+    memset(ws, 0, sizeof(*ws));
+}
+
+
+/* ============================================================================
+ * Instrumentation (Compile-Time Optional)
+ * ============================================================================
+ */
+
+#ifdef HIL_STATS
+
+#include <time.h>     /* timespec_get */
+
+typedef struct {
+    uint64_t calls;
+    uint64_t nanoseconds;
+    uint64_t bytes;
+    uint64_t items;
+} hil_stat_counter_t;
+
+static hil_stat_counter_t hil_stat_table[HIL_STAT_COUNT];
+
+static const char *const hil_stat_names[HIL_STAT_COUNT] = {
+    "graph_build_cosine",
+    "graph_build_knn_csr",
+    "graph_entropy",
+    "graph_components",
+    "graph_metrics",
+    "graph_build_csr",
+    "graph_entropy_csr",
+    "graph_components_csr",
+    "field_coherence",
+    "field_summary",
+    "epistemic_stability",
+    "epistemic_stability_curve",
+    "leave_one_out_diagnostics",
+    "pca_axes",
+    "pca_axes_batch",
+    "geometry_delta_loo",
+    "field_perturb",
+    "lexicon_add",
+    "lexicon_finish",
+    "graph_build_cosine_f32",
+    "graph_build_knn_csr_f32",
+    "graph_build_csr_f32",
+    "graph_entropy_f32",
+    "graph_metrics_f32",
+    "graph_entropy_csr_f32",
+    "field_summary_f32",
+    "field_coherence_f32",
+    "field_summary_batch",
+    "macrostate_dispersion_batch",
+    "fiber_entropy_batch",
+    "graph_pack",
+    "graph_entropy_packed",
+    "graph_components_packed",
+    "ann_add",
+    "ann_query",
+    "field_spectrum",
+    "graph_out_entropy",
+    "graph_out_entropy_f32",
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define HIL_STAT_ADD(p, v) __atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define HIL_STAT_LOAD(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define HIL_STAT_STORE(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#else
+#define HIL_STAT_ADD(p, v) (*(p) += (v))
+#define HIL_STAT_LOAD(p) (*(p))
+#define HIL_STAT_STORE(p, v) (*(p) = (v))
+#endif
+
+/* Bytes owned by a CSR the kernel allocated for the caller. */
+static uint64_t hil_stat_csr_bytes(const hil_graph_csr_t *csr) {
+    if (!csr || !csr->offsets) return 0;
+    return (uint64_t)(csr->num_nodes + 1) * sizeof(uint64_t)
+         + (uint64_t)csr->num_edges * (sizeof(uint32_t) + sizeof(double));
+}
+
+static uint64_t hil_stat_csr_f32_bytes(const hil_graph_csr_f32_t *csr) {
+    if (!csr || !csr->offsets) return 0;
+    return (uint64_t)(csr->num_nodes + 1) * sizeof(uint64_t)
+         + (uint64_t)csr->num_edges * (sizeof(uint32_t) + sizeof(float));
+}
+
+static uint64_t hil_stat_rows(const hil_field_t *field) {
+    return field ? (uint64_t)field->coordinates.rows : 0;
+}
+
+static uint64_t hil_stat_rows_f32(const hil_field_f32_t *field) {
+    return field ? (uint64_t)field->coordinates.rows : 0;
+}
+
+#endif /* HIL_STATS */
+
+#define HIL_STAT_WS_BYTES(ws) ((ws) ? (uint64_t)(ws)->requested : 0)
+
+int hil_stats_enabled(void) {
+#ifdef HIL_STATS
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+uint64_t hil_stats_clock(void) {
+#ifdef HIL_STATS
+    struct timespec ts;
+    if (timespec_get(&ts, TIME_UTC) != TIME_UTC) return 0;
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+#else
+    return 0;
+#endif
+}
+
+void hil_stats_record(hil_stat_slot_t slot, uint64_t start, uint64_t bytes, uint64_t items) {
+#ifdef HIL_STATS
+    if ((unsigned)slot >= (unsigned)HIL_STAT_COUNT) return;
+    const uint64_t now = hil_stats_clock();
+    hil_stat_counter_t *c = &hil_stat_table[slot];
+    HIL_STAT_ADD(&c->calls, 1);
+    HIL_STAT_ADD(&c->nanoseconds, now > start ? now - start : 0);
+    HIL_STAT_ADD(&c->bytes, bytes);
+    HIL_STAT_ADD(&c->items, items);
+#else
+    (void)slot; (void)start; (void)bytes; (void)items;
+#endif
+}
+
+size_t hil_stats_snapshot(hil_stat_entry_t *out, size_t cap) {
+#ifdef HIL_STATS
+    if (!out) return HIL_STAT_COUNT;
+    for (size_t i = 0; i < cap && i < HIL_STAT_COUNT; i++) {
+        const hil_stat_counter_t *c = &hil_stat_table[i];
+        out[i].name = hil_stat_names[i];
+        out[i].calls = HIL_STAT_LOAD(&c->calls);
+        out[i].nanoseconds = HIL_STAT_LOAD(&c->nanoseconds);
+        out[i].bytes = HIL_STAT_LOAD(&c->bytes);
+        out[i].items = HIL_STAT_LOAD(&c->items);
+    }
+    return HIL_STAT_COUNT;
+#else
+    (void)out; (void)cap;
+    return 0;
+#endif
+}
+
+void hil_stats_reset(void) {
+#ifdef HIL_STATS
+    for (size_t i = 0; i < HIL_STAT_COUNT; i++) {
+        hil_stat_counter_t *c = &hil_stat_table[i];
+        HIL_STAT_STORE(&c->calls, 0);
+        HIL_STAT_STORE(&c->nanoseconds, 0);
+        HIL_STAT_STORE(&c->bytes, 0);
+        HIL_STAT_STORE(&c->items, 0);
+    }
+#endif
+}
+
+
+/* ============================================================================
+ * Graph Integrity & Basic Structure
+ * ============================================================================
+ */
+
+int hil_graph_validate(const hil_graph_t *graph) {
+    if (!graph) return 0;
+    if (graph->num_nodes == 0) return 0;
+
+    /* Edge arrays can be NULL if num_edges == 0 */
+    if (graph->num_edges > 0) {
+        if (!graph->src || !graph->dst || !graph->weight) return 0;
+    }
+
+    /* Validate indices and finite weights */
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        uint32_t s = graph->src[e];
+        uint32_t d = graph->dst[e];
+        if ((size_t)s >= graph->num_nodes) return 0;
+        if ((size_t)d >= graph->num_nodes) return 0;
+
+        double w = graph->weight[e];
+        /* weights must be finite and non-negative for structural metrics */
+        if (!isfinite(w)) return 0;
+        if (w < 0.0) return 0;
+    }
+
+    return 1;
+}
+
+void hil_graph_degree(const hil_graph_t *graph, double *out_degree) {
+    if (!graph || !out_degree) return;
+    const size_t n = graph->num_nodes;
+
+    for (size_t i = 0; i < n; i++) out_degree[i] = 0.0;
+
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        const uint32_t s = graph->src[e];
+        const uint32_t d = graph->dst[e];
+        const double   w = graph->weight[e];
+
+        /* Weighted degree accumulation */
+        out_degree[s] += w;
+        out_degree[d] += w;
+    }
+}
+
+/* ============================================================================
+ * Structural Construction
+ * ============================================================================
+ */
+
+/* Rows per Gram tile. Two tiles of 64 x 300 doubles fit comfortably in L2. */
+#ifndef HIL_GRAM_TILE
+#define HIL_GRAM_TILE 64
+#endif
+
+/* Position of edge (i, j), i < j, in row-major upper-triangle order. */
+static size_t hil_triu_index(size_t i, size_t j, size_t n) {
+    return i * n - (i * (i + 1)) / 2 + (j - i - 1);
+}
+
+/*
+ * Row-normalised copy of M. Exact-zero rows keep a unit divisor, mirroring
+ * the Python builder (norms[norms == 0.0] = 1.0). Caller frees.
+ */
+static double *hil_normalized_rows(const hil_matrix_t *M) {
+    const size_t n = M->rows;
+    const size_t d = M->cols;
+
+    double *V = (double*)malloc(sizeof(double) * n * d);
+    if (!V) return NULL;
+
+    const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+    for (size_t r = 0; r < n; r++) {
+        const double *row = hil_matrix_row(M, r);
+        double *vr = V + (r * d);
+        double nrm = sqrt(dot(row, row, d));
+        if (nrm == 0.0) nrm = 1.0;
+        for (size_t c = 0; c < d; c++) vr[c] = row[c] / nrm;
+    }
+
+    return V;
+}
+
+/*
+ * Tiled upper-triangle Gram sweep over normalised rows V (n x d). Each
+ * edge has a fixed output slot, so tile order does not affect the emitted
+ * edge ordering. Weights go to w64, or rounded to w32 when w64 is NULL.
+ */
+static void hil_cosine_sweep(
+    const double *V,
+    size_t n,
+    size_t d,
+    uint32_t *src,
+    uint32_t *dst,
+    double *w64,
+    float *w32
+) {
+    const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+
+    for (size_t i0 = 0; i0 < n; i0 += HIL_GRAM_TILE) {
+        const size_t i1 = (i0 + HIL_GRAM_TILE < n) ? i0 + HIL_GRAM_TILE : n;
+
+        for (size_t j0 = i0; j0 < n; j0 += HIL_GRAM_TILE) {
+            const size_t j1 = (j0 + HIL_GRAM_TILE < n) ? j0 + HIL_GRAM_TILE : n;
+
+            for (size_t i = i0; i < i1; i++) {
+                const double *vi = V + (i * d);
+                const size_t js = (j0 > i + 1) ? j0 : i + 1;
+                if (js >= j1) continue;
+
+                size_t e = hil_triu_index(i, js, n);
+                for (size_t j = js; j < j1; j++, e++) {
+                    const double w = (dot(vi, V + (j * d), d) + 1.0) * 0.5;
+                    src[e] = (uint32_t)i;
+                    dst[e] = (uint32_t)j;
+                    if (w64) w64[e] = w; else w32[e] = (float)w;
+                }
+            }
+        }
+    }
+}
+
+static int hil_graph_build_cosine_kernel(const hil_field_t *field, hil_graph_t *out_graph) {
+    if (!field || !out_graph) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+
+    const size_t n = M.rows;
+    const size_t d = M.cols;
+    if (n > (size_t)UINT32_MAX) return 0;
+
+    const size_t m = (n * (n - 1)) / 2;
+    if (out_graph->num_edges != m) return 0;
+    if (m > 0 && (!out_graph->src || !out_graph->dst || !out_graph->weight)) return 0;
+
+    out_graph->num_nodes = n;
+    if (m == 0) return 1;
+
+    double *V = hil_normalized_rows(&M);
+    if (!V) return 0;
+
+    hil_cosine_sweep(V, n, d, out_graph->src, out_graph->dst, out_graph->weight, NULL);
+
+    free(V);
+    return 1;
+}
+
+int hil_graph_build_cosine(const hil_field_t *field, hil_graph_t *out_graph) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_cosine_kernel(field, out_graph);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_COSINE, t0,
+                  (ok ? hil_stat_rows(field) * field->coordinates.cols * sizeof(double)
+                      + out_graph->num_edges * (2 * sizeof(uint32_t) + sizeof(double)) : 0),
+                  (ok ? out_graph->num_edges : 0));
+    return ok;
+}
+
+/* Neighbour candidate: weight and node index. */
+typedef struct {
+    double   w;
+    uint32_t j;
+} hil_nbr_t;
+
+/* a ranks below b: lower weight, or equal weight and larger index. */
+static int hil_nbr_worse(const hil_nbr_t *a, const hil_nbr_t *b) {
+    return (a->w < b->w) || (a->w == b->w && a->j > b->j);
+}
+
+/* Restore the min-heap property (worst candidate at the root). */
+static void hil_nbr_sift_down(hil_nbr_t *h, size_t len, size_t i) {
+    for (;;) {
+        size_t l = 2 * i + 1, r = l + 1, m = i;
+        if (l < len && hil_nbr_worse(&h[l], &h[m])) m = l;
+        if (r < len && hil_nbr_worse(&h[r], &h[m])) m = r;
+        if (m == i) return;
+        hil_nbr_t t = h[i]; h[i] = h[m]; h[m] = t;
+        i = m;
+    }
+}
+
+static void hil_nbr_sift_up(hil_nbr_t *h, size_t i) {
+    while (i > 0) {
+        size_t p = (i - 1) / 2;
+        if (!hil_nbr_worse(&h[i], &h[p])) return;
+        hil_nbr_t t = h[i]; h[i] = h[p]; h[p] = t;
+        i = p;
+    }
+}
+
+static int hil_nbr_cmp_index(const void *a, const void *b) {
+    const uint32_t ja = ((const hil_nbr_t*)a)->j;
+    const uint32_t jb = ((const hil_nbr_t*)b)->j;
+    return (ja > jb) - (ja < jb);
+}
+
+/* Grow CSR index/weight storage to hold at least need entries. */
+static int hil_csr_reserve(hil_graph_csr_t *csr, size_t *cap, size_t need) {
+    if (need <= *cap) return 1;
+    size_t nc = (*cap > 0) ? *cap : 1024;
+    while (nc < need) nc *= 2;
+
+    uint32_t *ni = (uint32_t*)realloc(csr->indices, sizeof(uint32_t) * nc);
+    if (!ni) return 0;
+    csr->indices = ni;
+
+    double *nw = (double*)realloc(csr->weight, sizeof(double) * nc);
+    if (!nw) return 0;
+    csr->weight = nw;
+
+    *cap = nc;
+    return 1;
+}
+
+/* kNN / threshold CSR over normalised rows V (n x d, n >= 1). */
+static int hil_knn_csr_from_rows(
+    const double *V,
+    size_t n,
+    size_t d,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_t *out_csr
+) {
+    if (k >= n) k = n - 1;
+    const int capped = (k > 0);
+
+    out_csr->num_nodes = n;
+    out_csr->num_edges = 0;
+    out_csr->symmetric = 0;
+    out_csr->indices = NULL;
+    out_csr->weight = NULL;
+    out_csr->offsets = (uint64_t*)malloc(sizeof(uint64_t) * (n + 1));
+    if (!out_csr->offsets) return 0;
+    out_csr->offsets[0] = 0;
+
+    const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+
+    /* Per-row candidate buffers for one tile of rows. With a cap these are
+       fixed-size heaps over a full row tile; without one, each row is swept
+       on its own so the survivor buffer stays O(n). */
+    const size_t rt    = capped ? HIL_GRAM_TILE : 1;
+    const size_t slots = capped ? k : n;
+    hil_nbr_t *heap = (hil_nbr_t*)malloc(sizeof(hil_nbr_t) * slots * rt);
+    size_t *len = (size_t*)calloc(rt, sizeof(size_t));
+
+    size_t cap = 0;
+    int ok = (heap && len);
+    if (ok && capped) ok = hil_csr_reserve(out_csr, &cap, n * k);
+
+    for (size_t i0 = 0; ok && i0 < n; i0 += rt) {
+        const size_t i1 = (i0 + rt < n) ? i0 + rt : n;
+
+        for (size_t i = i0; i < i1; i++) len[i - i0] = 0;
+
+        for (size_t j0 = 0; j0 < n; j0 += HIL_GRAM_TILE) {
+            const size_t j1 = (j0 + HIL_GRAM_TILE < n) ? j0 + HIL_GRAM_TILE : n;
+
+            for (size_t i = i0; i < i1; i++) {
+                const double *vi = V + (i * d);
+                hil_nbr_t *h = heap + ((i - i0) * slots);
+                size_t *hl = &len[i - i0];
+
+                for (size_t j = j0; j < j1; j++) {
+                    if (j == i) continue;
+                    const double cos = dot(vi, V + (j * d), d);
+                    const hil_nbr_t c = { (cos + 1.0) * 0.5, (uint32_t)j };
+                    if (c.w < min_weight) continue;
+
+                    if (!capped) {
+                        h[(*hl)++] = c;
+                    } else if (*hl < k) {
+                        h[*hl] = c;
+                        hil_nbr_sift_up(h, (*hl)++);
+                    } else if (hil_nbr_worse(&h[0], &c)) {
+                        h[0] = c;
+                        hil_nbr_sift_down(h, k, 0);
+                    }
+                }
+            }
+        }
+
+        /* Emit rows in ascending neighbour order. */
+        for (size_t i = i0; i < i1; i++) {
+            hil_nbr_t *h = heap + ((i - i0) * slots);
+            const size_t hl = len[i - i0];
+            const size_t base = out_csr->num_edges;
+
+            if (!hil_csr_reserve(out_csr, &cap, base + hl)) { ok = 0; break; }
+            if (capped) qsort(h, hl, sizeof(hil_nbr_t), hil_nbr_cmp_index);
+
+            for (size_t t = 0; t < hl; t++) {
+                out_csr->indices[base + t] = h[t].j;
+                out_csr->weight[base + t] = h[t].w;
+            }
+            out_csr->num_edges = base + hl;
+            out_csr->offsets[i + 1] = (uint64_t)out_csr->num_edges;
+        }
+    }
+
+    free(len);
+    free(heap);
+
+    if (!ok) {
+        hil_graph_csr_free(out_csr);
+        return 0;
+    }
+    return 1;
+}
+
+static int hil_graph_build_knn_csr_kernel(
+    const hil_field_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_t *out_csr
+) {
+    if (!field || !out_csr) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+    if (M.rows > (size_t)UINT32_MAX) return 0;
+
+    double *V = hil_normalized_rows(&M);
+    if (!V) return 0;
+
+    const int ok = hil_knn_csr_from_rows(V, M.rows, M.cols, k, min_weight, out_csr);
+    free(V);
+    return ok;
+}
+
+int hil_graph_build_knn_csr(
+    const hil_field_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_t *out_csr
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_knn_csr_kernel(field, k, min_weight, out_csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_KNN_CSR, t0,
+                  (ok ? hil_stat_rows(field) * field->coordinates.cols * sizeof(double)
+                      + hil_stat_csr_bytes(out_csr) : 0),
+                  (ok ? out_csr->num_edges : 0));
+    return ok;
+}
+
+/* ============================================================================
+ * Structural Diagnostics (Graph-Theoretic)
+ * ============================================================================
+ */
+
+double hil_graph_density(const hil_graph_t *graph) {
+    if (!graph) return 0.0;
+    const double n = (double)graph->num_nodes;
+
+    if (n <= 1.0) return 0.0;
+
+    /* For a simple undirected graph, max edges = n*(n-1)/2.
+       We do not enforce simple-graph constraints; this is a structural proxy. */
+    const double max_e = (n * (n - 1.0)) / 2.0;
+    const double e = (double)graph->num_edges;
+
+    if (max_e <= 0.0) return 0.0;
+    double d = e / max_e;
+
+    if (d < 0.0) d = 0.0;
+    if (d > 1.0) d = 1.0;
+    return d;
+}
+
+/* H over p_i = deg_i / sum(deg); 0 when the total is below HIL_EPS.
+   out_sum (nullable) receives sum(deg). */
+static double hil_degree_entropy(const double *deg, size_t n, double *out_sum) {
+    double sum_deg = 0.0;
+    for (size_t i = 0; i < n; i++) sum_deg += deg[i];
+    if (out_sum) *out_sum = sum_deg;
+
+    if (sum_deg <= HIL_EPS) return 0.0;
+
+    double H = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        double p = deg[i] / sum_deg;
+        if (p > HIL_EPS) {
+            H -= p * hil_safe_log(p);
+        }
+    }
+
+    return H;
+}
+
+double hil_graph_entropy(const hil_graph_t *graph) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, graph ? hil_ws_need(sizeof(double) * graph->num_nodes) : 0);
+    const double H = hil_graph_entropy_ws(graph, &ws);
+    hil_workspace_free(&ws);
+    return H;
+}
+
+static double hil_graph_entropy_kernel(const hil_graph_t *graph, hil_workspace_t *ws) {
+    if (!graph || !ws) return 0.0;
+    if (graph->num_nodes == 0) return 0.0;
+    hil_workspace_reset(ws);
+
+    /* Structural entropy computed over weighted degree distribution:
+       p_i = deg_i / sum(deg), H = -sum p_i log p_i
+       This is purely structural (no semantics). */
+
+    double *deg = (double*)hil_workspace_alloc(ws, sizeof(double) * graph->num_nodes);
+    if (!deg) return 0.0;
+
+    hil_graph_degree(graph, deg);
+    return hil_degree_entropy(deg, graph->num_nodes, NULL);
+}
+
+double hil_graph_entropy_ws(const hil_graph_t *graph, hil_workspace_t *ws) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double H = hil_graph_entropy_kernel(graph, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_ENTROPY, t0, HIL_STAT_WS_BYTES(ws),
+                  (graph ? graph->num_edges : 0));
+    return H;
+}
+
+double hil_graph_out_entropy(const hil_graph_t *graph) {
+    if (!graph || graph->num_nodes == 0) return 0.0;
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const size_t n = graph->num_nodes;
+
+    double *strength = (double*)calloc(n, sizeof(double));
+    if (!strength) return 0.0;
+
+    /* Same accumulation order as np.bincount(src, weights=weight). */
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        strength[graph->src[e]] += graph->weight[e];
+    }
+
+    const double H = hil_degree_entropy(strength, n, NULL);
+    free(strength);
+    HIL_STATS_END(HIL_STAT_GRAPH_OUT_ENTROPY, t0, (uint64_t)n * sizeof(double),
+                  graph->num_edges);
+    return H;
+}
+
+/* Union-find root with path halving. */
+static uint32_t hil_uf_find(uint32_t *parent, uint32_t x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+/*
+ * Concurrent union-find over a shared parent array.
+ *
+ * Hooking always places the larger root under the smaller one, so
+ * parent[x] <= x at all times and the surviving root of every component is
+ * its smallest node, whichever order threads visit edges in. Halving only
+ * ever replaces a parent with one of its ancestors, so racing compressions
+ * are benign; the hook itself is a CAS that fails (and retries) if the root
+ * was linked in the meantime.
+ */
+#if defined(__GNUC__)
+#define HIL_UF_CONCURRENT 1
+#define HIL_UF_LOAD(p)      __atomic_load_n((p), __ATOMIC_RELAXED)
+#define HIL_UF_STORE(p, v)  __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+#define HIL_UF_CAS(p, e, v) \
+    __atomic_compare_exchange_n((p), &(e), (v), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+#else
+#define HIL_UF_LOAD(p)      (*(p))
+#define HIL_UF_STORE(p, v)  (*(p) = (v))
+#define HIL_UF_CAS(p, e, v) ((*(p) == (e)) ? (*(p) = (v), 1) : ((e) = *(p), 0))
+#endif
+
+static uint32_t hil_uf_find_shared(uint32_t *parent, uint32_t x) {
+    uint32_t p = HIL_UF_LOAD(&parent[x]);
+    while (p != x) {
+        const uint32_t gp = HIL_UF_LOAD(&parent[p]);
+        if (gp != p) HIL_UF_STORE(&parent[x], gp);
+        x = gp;
+        p = HIL_UF_LOAD(&parent[x]);
+    }
+    return x;
+}
+
+static void hil_uf_union_shared(uint32_t *parent, uint32_t a, uint32_t b) {
+    for (;;) {
+        a = hil_uf_find_shared(parent, a);
+        b = hil_uf_find_shared(parent, b);
+        if (a == b) return;
+        if (a > b) { const uint32_t t = a; a = b; b = t; }
+        uint32_t expected = b;
+        if (HIL_UF_CAS(&parent[b], expected, a)) return;
+    }
+}
+
+/*
+ * Count roots of a settled forest, optionally writing dense labels and sizes.
+ *
+ * Nodes are visited in ascending order; since parent[i] <= i, a node's parent
+ * is already labelled when the node is reached, so no flattening pass is
+ * needed. Labels are therefore ordered by each component's smallest node.
+ */
+static size_t hil_uf_settle(
+    const uint32_t *parent,
+    size_t n,
+    uint32_t *labels,
+    uint64_t *sizes
+) {
+    size_t comps = 0;
+
+    if (!labels) {
+        long long roots = 0;
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule(static) reduction(+:roots)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) {
+            if (parent[ii] == (uint32_t)ii) roots++;
+        }
+        return (size_t)roots;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const uint32_t p = parent[i];
+        if (p == (uint32_t)i) {
+            if (sizes) sizes[comps] = 0;
+            labels[i] = (uint32_t)comps++;
+        } else {
+            labels[i] = labels[p];
+        }
+        if (sizes) sizes[labels[i]]++;
+    }
+    return comps;
+}
+
+size_t hil_graph_connected_components(const hil_graph_t *graph) {
+    return hil_graph_components(graph, NULL, NULL);
+}
+
+size_t hil_graph_connected_components_ws(const hil_graph_t *graph, hil_workspace_t *ws) {
+    return hil_graph_components_ws(graph, NULL, NULL, ws);
+}
+
+size_t hil_graph_components(
+    const hil_graph_t *graph,
+    uint32_t *out_labels,
+    uint64_t *out_sizes
+) {
+    /* Parents, plus labels when only sizes are requested. */
+    const size_t n = graph ? graph->num_nodes : 0;
+    const size_t parts = (!out_labels && out_sizes) ? 2 : 1;
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, n ? parts * hil_ws_need(sizeof(uint32_t) * n) : 0);
+    const size_t comps = hil_graph_components_ws(graph, out_labels, out_sizes, &ws);
+    hil_workspace_free(&ws);
+    return comps;
+}
+
+static size_t hil_graph_components_kernel(
+    const hil_graph_t *graph,
+    uint32_t *out_labels,
+    uint64_t *out_sizes,
+    hil_workspace_t *ws
+) {
+    if (!graph || !ws) return 0;
+    const size_t n = graph->num_nodes;
+    if (n == 0 || n > (size_t)UINT32_MAX) return 0;
+    if (graph->num_edges > 0 && (!graph->src || !graph->dst)) return 0;
+    hil_workspace_reset(ws);
+
+    /* Union-find straight over the edge list: one node-sized buffer. */
+    uint32_t *parent = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n);
+    if (!parent) return 0;
+
+    uint32_t *labels = out_labels;
+    if (!labels && out_sizes) {
+        labels = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n);
+        if (!labels) return 0;
+    }
+
+    #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+    #pragma omp parallel
+    #endif
+    {
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(static)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) parent[ii] = (uint32_t)ii;
+
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(static)
+        #endif
+        for (long long e = 0; e < (long long)graph->num_edges; e++) {
+            const uint32_t s = graph->src[e];
+            const uint32_t d = graph->dst[e];
+            /* Out-of-range endpoints are skipped, as in the serial baseline. */
+            if ((size_t)s < n && (size_t)d < n) hil_uf_union_shared(parent, s, d);
+        }
+    }
+
+    return hil_uf_settle(parent, n, labels, out_sizes);
+}
+
+size_t hil_graph_components_ws(
+    const hil_graph_t *graph,
+    uint32_t *out_labels,
+    uint64_t *out_sizes,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const size_t comps = hil_graph_components_kernel(graph, out_labels, out_sizes, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_COMPONENTS, t0, HIL_STAT_WS_BYTES(ws),
+                  (graph ? graph->num_edges : 0));
+    return comps;
+}
+
+/* hil_graph_metrics_body scratch: degree (unless supplied), out-strength,
+   parents. */
+static size_t hil_graph_metrics_scratch(size_t n, const double *out_degree) {
+    if (n == 0) return 0;
+    return (out_degree ? 0 : hil_ws_need(sizeof(double) * n))
+         + hil_ws_need(sizeof(double) * n)
+         + hil_ws_need(sizeof(uint32_t) * n);
+}
+
+int hil_graph_metrics(
+    const hil_graph_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_graph_metrics_scratch(graph ? graph->num_nodes : 0, out_degree));
+    const int ok = hil_graph_metrics_ws(graph, out, out_degree, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+/*
+ * Metrics body over the topology of graph; weights come from w32 when
+ * given, else from graph->weight. Shared by the double and float32 kernels.
+ */
+static int hil_graph_metrics_body(
+    const hil_graph_t *graph,
+    const float *w32,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+) {
+    if (!graph || !out || !ws) return 0;
+    const size_t n = graph->num_nodes;
+    const size_t m = graph->num_edges;
+    if (n == 0 || n > (size_t)UINT32_MAX) return 0;
+    if (m > 0 && (!graph->src || !graph->dst || (!graph->weight && !w32))) return 0;
+    hil_workspace_reset(ws);
+
+    /* Node-sized scratch: degree (unless caller-supplied), out-strength
+       and parents. */
+    double *deg = out_degree
+        ? out_degree
+        : (double*)hil_workspace_alloc(ws, sizeof(double) * n);
+    double *out_s = (double*)hil_workspace_alloc(ws, sizeof(double) * n);
+    uint32_t *parent = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n);
+    if (!deg || !out_s || !parent) return 0;
+
+    for (size_t i = 0; i < n; i++) {
+        deg[i] = 0.0;
+        out_s[i] = 0.0;
+        parent[i] = (uint32_t)i;
+    }
+
+    /* Single streaming pass: degree, out-strength, total weight, unions. */
+    double total_w = 0.0;
+    size_t comps = n;
+
+    for (size_t e = 0; e < m; e++) {
+        const uint32_t s = graph->src[e];
+        const uint32_t d = graph->dst[e];
+        const double   w = w32 ? (double)w32[e] : graph->weight[e];
+
+        deg[s] += w;
+        deg[d] += w;
+        out_s[s] += w;
+        total_w += w;
+
+        uint32_t a = hil_uf_find(parent, s);
+        uint32_t b = hil_uf_find(parent, d);
+        if (a != b) {
+            if (a < b) parent[b] = a; else parent[a] = b;
+            comps--;
+        }
+    }
+
+    double sum_deg = 0.0;
+    const double H = hil_degree_entropy(deg, n, &sum_deg);
+
+    out->mean_degree = sum_deg / (double)n;
+    out->total_weight = total_w;
+    out->density = hil_graph_density(graph);
+    out->degree_entropy = H;
+    out->out_entropy = hil_degree_entropy(out_s, n, NULL);
+    out->components = comps;
+
+    return 1;
+}
+
+static int hil_graph_metrics_kernel(
+    const hil_graph_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+) {
+    return hil_graph_metrics_body(graph, NULL, out, out_degree, ws);
+}
+
+int hil_graph_metrics_ws(
+    const hil_graph_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_metrics_kernel(graph, out, out_degree, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_METRICS, t0, HIL_STAT_WS_BYTES(ws),
+                  (graph ? graph->num_edges : 0));
+    return ok;
+}
+
+/* ============================================================================
+ * Persistent Adjacency (CSR View)
+ * ============================================================================
+ */
+
+/*
+ * Symmetric CSR body. Weights are taken from w32 into *out_w32 when w32 is
+ * given, else from graph->weight into out_csr->weight.
+ */
+static int hil_graph_build_csr_body(
+    const hil_graph_t *graph,
+    const float *w32,
+    hil_graph_csr_t *out_csr,
+    float **out_w32
+) {
+    if (!graph || !out_csr) return 0;
+    const size_t n = graph->num_nodes;
+    const size_t m = graph->num_edges;
+    if (n == 0) return 0;
+    if (m > 0 && (!graph->src || !graph->dst || (!graph->weight && !w32))) return 0;
+
+    out_csr->num_nodes = n;
+    out_csr->num_edges = 0;
+    out_csr->symmetric = 1;
+    out_csr->offsets = (uint64_t*)calloc(n + 1, sizeof(uint64_t));
+    out_csr->indices = NULL;
+    out_csr->weight = NULL;
+    if (w32) *out_w32 = NULL;
+    if (!out_csr->offsets) return 0;
+
+    /* Count both endpoints of every in-range edge into offsets[v + 1]. */
+    uint64_t *off = out_csr->offsets;
+    for (size_t e = 0; e < m; e++) {
+        const uint32_t s = graph->src[e], d = graph->dst[e];
+        if ((size_t)s < n && (size_t)d < n) {
+            off[s + 1]++; off[d + 1]++;
+        }
+    }
+    for (size_t i = 0; i < n; i++) off[i + 1] += off[i];
+
+    const size_t total = (size_t)off[n];
+    if (total > 0) {
+        out_csr->indices = (uint32_t*)malloc(sizeof(uint32_t) * total);
+        if (w32) {
+            *out_w32 = (float*)malloc(sizeof(float) * total);
+        } else {
+            out_csr->weight = (double*)malloc(sizeof(double) * total);
+        }
+        if (!out_csr->indices || (w32 ? !*out_w32 : !out_csr->weight)) {
+            if (w32) { free(*out_w32); *out_w32 = NULL; }
+            hil_graph_csr_free(out_csr);
+            return 0;
+        }
+    }
+
+    /* Fill using off[v] as the write cursor of row v; afterwards off[v]
+       holds the end of row v, so shift back by one row. */
+    uint32_t *idx = out_csr->indices;
+    for (size_t e = 0; e < m; e++) {
+        const uint32_t s = graph->src[e], d = graph->dst[e];
+        if ((size_t)s >= n || (size_t)d >= n) continue;
+        if (w32) {
+            float *ow = *out_w32;
+            const float w = w32[e];
+            idx[off[s]] = d; ow[off[s]++] = w;
+            idx[off[d]] = s; ow[off[d]++] = w;
+        } else {
+            double *ow = out_csr->weight;
+            const double w = graph->weight[e];
+            idx[off[s]] = d; ow[off[s]++] = w;
+            idx[off[d]] = s; ow[off[d]++] = w;
+        }
+    }
+    for (size_t i = n; i > 0; i--) off[i] = off[i - 1];
+    off[0] = 0;
+
+    out_csr->num_edges = total;
+    return 1;
+}
+
+static int hil_graph_build_csr_kernel(const hil_graph_t *graph, hil_graph_csr_t *out_csr) {
+    return hil_graph_build_csr_body(graph, NULL, out_csr, NULL);
+}
+
+int hil_graph_build_csr(const hil_graph_t *graph, hil_graph_csr_t *out_csr) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_csr_kernel(graph, out_csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_CSR, t0, (ok ? hil_stat_csr_bytes(out_csr) : 0),
+                  (graph ? graph->num_edges : 0));
+    return ok;
+}
+
+/* Row weight sum; same accumulation order as hil_graph_degree on a
+   hil_graph_build_csr view. */
+static double hil_csr_row_sum(const hil_graph_csr_t *csr, size_t i) {
+    double s = 0.0;
+    for (uint64_t k = csr->offsets[i]; k < csr->offsets[i + 1]; k++) {
+        s += csr->weight[k];
+    }
+    return s;
+}
+
+void hil_graph_degree_csr(const hil_graph_csr_t *csr, double *out_degree) {
+    if (!csr || !out_degree) return;
+
+    for (size_t i = 0; i < csr->num_nodes; i++) {
+        out_degree[i] = hil_csr_row_sum(csr, i);
+    }
+}
+
+double hil_graph_density_csr(const hil_graph_csr_t *csr) {
+    if (!csr) return 0.0;
+    const double n = (double)csr->num_nodes;
+
+    if (n <= 1.0) return 0.0;
+
+    const double max_e = csr->symmetric ? (n * (n - 1.0)) / 2.0 : n * (n - 1.0);
+    const double e = csr->symmetric ? (double)(csr->num_edges / 2) : (double)csr->num_edges;
+
+    double d = e / max_e;
+
+    if (d < 0.0) d = 0.0;
+    if (d > 1.0) d = 1.0;
+    return d;
+}
+
+static double hil_graph_entropy_csr_kernel(const hil_graph_csr_t *csr) {
+    if (!csr) return 0.0;
+    if (csr->num_nodes == 0) return 0.0;
+
+    /* Two streaming passes over the row sums; no degree buffer. */
+    double sum_deg = 0.0;
+    for (size_t i = 0; i < csr->num_nodes; i++) sum_deg += hil_csr_row_sum(csr, i);
+
+    if (sum_deg <= HIL_EPS) return 0.0;
+
+    double H = 0.0;
+    for (size_t i = 0; i < csr->num_nodes; i++) {
+        double p = hil_csr_row_sum(csr, i) / sum_deg;
+        if (p > HIL_EPS) {
+            H -= p * hil_safe_log(p);
+        }
+    }
+
+    return H;
+}
+
+double hil_graph_entropy_csr(const hil_graph_csr_t *csr) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double H = hil_graph_entropy_csr_kernel(csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_ENTROPY_CSR, t0, 0, (csr ? csr->num_edges : 0));
+    return H;
+}
+
+size_t hil_graph_connected_components_csr(const hil_graph_csr_t *csr) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, csr ? hil_ws_need(sizeof(uint32_t) * csr->num_nodes) : 0);
+    const size_t comps = hil_graph_connected_components_csr_ws(csr, &ws);
+    hil_workspace_free(&ws);
+    return comps;
+}
+
+static size_t hil_graph_connected_components_csr_kernel(
+    const hil_graph_csr_t *csr,
+    hil_workspace_t *ws
+) {
+    if (!csr || !ws) return 0;
+    const size_t n = csr->num_nodes;
+    if (n == 0) return 0;
+    hil_workspace_reset(ws);
+
+    uint32_t *parent = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n);
+    if (!parent) return 0;
+
+    #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+    #pragma omp parallel
+    #endif
+    {
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(static)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) parent[ii] = (uint32_t)ii;
+
+        /* Rows vary in length; dynamic chunks keep threads level. */
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(dynamic, 256)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) {
+            const size_t i = (size_t)ii;
+            for (uint64_t k = csr->offsets[i]; k < csr->offsets[i + 1]; k++) {
+                hil_uf_union_shared(parent, (uint32_t)i, csr->indices[k]);
+            }
+        }
+    }
+
+    return hil_uf_settle(parent, n, NULL, NULL);
+}
+
+size_t hil_graph_connected_components_csr_ws(
+    const hil_graph_csr_t *csr,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const size_t comps = hil_graph_connected_components_csr_kernel(csr, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_COMPONENTS_CSR, t0, HIL_STAT_WS_BYTES(ws),
+                  (csr ? csr->num_edges : 0));
+    return comps;
+}
+
+/* ============================================================================
+ * Packed Adjacency (Compressed CSR)
+ * ============================================================================
+ */
+
+/* Quantize one weight; 0 for NaN or values outside [0, 1]. */
+static int hil_pack_weight(double w, uint16_t *q) {
+    if (!(w >= 0.0 && w <= 1.0)) return 0;
+    *q = (uint16_t)floor(w * (double)HIL_PACKED_WEIGHT_SCALE + 0.5);
+    return 1;
+}
+
+static size_t hil_varint_len(uint32_t v) {
+    size_t len = 1;
+    while (v >= 0x80u) { v >>= 7; len++; }
+    return len;
+}
+
+static int hil_key_cmp(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Decode one entry (index gap, weight) without reading past end; requires
+ * p < end. Over-long varints are cut at five bytes; a truncated weight
+ * reads as 0 and ends the row.
+ */
+static inline const uint8_t *hil_packed_next(
+    const uint8_t *p,
+    const uint8_t *end,
+    uint32_t *gap,
+    uint32_t *q
+) {
+    uint32_t v = 0;
+    if (*p < 0x80u) {
+        v = *p++;                       /* one-byte gap: the common case */
+    } else {
+        for (unsigned shift = 0; p < end && shift < 35; shift += 7) {
+            const uint8_t b = *p++;
+            v |= (uint32_t)(b & 0x7Fu) << shift;
+            if (!(b & 0x80u)) break;
+        }
+    }
+    *gap = v;
+    if (end - p < 2) {
+        *q = 0;
+        return end;
+    }
+    *q = (uint32_t)p[0] | ((uint32_t)p[1] << 8);
+    return p + 2;
+}
+
+/*
+ * Encode rows of (index << 16 | q) keys; row i spans keys[eoff[i]..eoff[i+1]).
+ * Keys are sorted in place per row. Allocates out->offsets and out->stream.
+ */
+static int hil_graph_pack_keys(
+    hil_graph_packed_t *out,
+    const uint64_t *eoff,
+    uint64_t *keys
+) {
+    const size_t n = out->num_nodes;
+
+    out->offsets = (uint64_t*)calloc(n + 1, sizeof(uint64_t));
+    if (!out->offsets) return 0;
+    uint64_t *off = out->offsets;
+
+    /* Sort each row and size its entries into off[i + 1]. */
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 256)
+    #endif
+    for (long long ii = 0; ii < (long long)n; ii++) {
+        const size_t i = (size_t)ii;
+        const size_t len = (size_t)(eoff[i + 1] - eoff[i]);
+        uint64_t *row = keys + eoff[i];
+        if (len > 1) qsort(row, len, sizeof(uint64_t), hil_key_cmp);
+
+        uint64_t nb = 0;
+        uint32_t prev = 0;
+        for (size_t k = 0; k < len; k++) {
+            const uint32_t j = (uint32_t)(row[k] >> 16);
+            nb += hil_varint_len(j - prev) + 2;
+            prev = j;
+        }
+        off[i + 1] = nb;
+    }
+    for (size_t i = 0; i < n; i++) off[i + 1] += off[i];
+
+    if (off[n] > 0) {
+        out->stream = (uint8_t*)malloc((size_t)off[n]);
+        if (!out->stream) return 0;
+    }
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 256)
+    #endif
+    for (long long ii = 0; ii < (long long)n; ii++) {
+        const size_t i = (size_t)ii;
+        uint8_t *p = out->stream + off[i];
+        uint32_t prev = 0;
+        for (uint64_t k = eoff[i]; k < eoff[i + 1]; k++) {
+            const uint32_t j = (uint32_t)(keys[k] >> 16);
+            uint32_t gap = j - prev;
+            while (gap >= 0x80u) {
+                *p++ = (uint8_t)(gap | 0x80u);
+                gap >>= 7;
+            }
+            *p++ = (uint8_t)gap;
+            *p++ = (uint8_t)(keys[k] & 0xFFu);
+            *p++ = (uint8_t)((keys[k] >> 8) & 0xFFu);
+            prev = j;
+        }
+    }
+    return 1;
+}
+
+static int hil_graph_pack_csr_kernel(const hil_graph_csr_t *csr, hil_graph_packed_t *out) {
+    if (!csr || !out || !csr->offsets) return 0;
+    const size_t n = csr->num_nodes;
+    const size_t m = csr->num_edges;
+    if (n == 0 || n > (size_t)UINT32_MAX) return 0;
+    if (m > 0 && (!csr->indices || !csr->weight)) return 0;
+    if (csr->offsets[0] != 0 || csr->offsets[n] != (uint64_t)m) return 0;
+    for (size_t i = 0; i < n; i++) {
+        if (csr->offsets[i + 1] < csr->offsets[i]) return 0;
+    }
+
+    out->num_nodes = n;
+    out->num_edges = m;
+    out->symmetric = csr->symmetric;
+    out->offsets = NULL;
+    out->stream = NULL;
+
+    uint64_t *keys = (m > 0) ? (uint64_t*)malloc(sizeof(uint64_t) * m) : NULL;
+    if (m > 0 && !keys) return 0;
+
+    int bad = 0;
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static) reduction(|:bad)
+    #endif
+    for (long long kk = 0; kk < (long long)m; kk++) {
+        uint16_t q = 0;
+        const uint32_t j = csr->indices[kk];
+        if ((size_t)j >= n || !hil_pack_weight(csr->weight[kk], &q)) {
+            bad |= 1;
+        } else {
+            keys[kk] = ((uint64_t)j << 16) | q;
+        }
+    }
+
+    const int ok = !bad && hil_graph_pack_keys(out, csr->offsets, keys);
+    free(keys);
+    if (!ok) hil_graph_packed_free(out);
+    return ok;
+}
+
+int hil_graph_pack_csr(const hil_graph_csr_t *csr, hil_graph_packed_t *out) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_pack_csr_kernel(csr, out);
+    HIL_STATS_END(HIL_STAT_GRAPH_PACK, t0, (ok ? (uint64_t)hil_graph_packed_bytes(out) : 0),
+                  (csr ? csr->num_edges : 0));
+    return ok;
+}
+
+static int hil_graph_pack_kernel(const hil_graph_t *graph, hil_graph_packed_t *out) {
+    if (!graph || !out) return 0;
+    const size_t n = graph->num_nodes;
+    const size_t m = graph->num_edges;
+    if (n == 0 || n > (size_t)UINT32_MAX) return 0;
+    if (m > 0 && (!graph->src || !graph->dst || !graph->weight)) return 0;
+
+    out->num_nodes = n;
+    out->num_edges = 0;
+    out->symmetric = 1;
+    out->offsets = NULL;
+    out->stream = NULL;
+
+    /* Row counts as in hil_graph_build_csr_body. */
+    uint64_t *eoff = (uint64_t*)calloc(n + 1, sizeof(uint64_t));
+    if (!eoff) return 0;
+    for (size_t e = 0; e < m; e++) {
+        const uint32_t s = graph->src[e], d = graph->dst[e];
+        if ((size_t)s < n && (size_t)d < n) {
+            eoff[s + 1]++; eoff[d + 1]++;
+        }
+    }
+    for (size_t i = 0; i < n; i++) eoff[i + 1] += eoff[i];
+
+    const size_t total = (size_t)eoff[n];
+    uint64_t *keys = (total > 0) ? (uint64_t*)malloc(sizeof(uint64_t) * total) : NULL;
+    if (total > 0 && !keys) {
+        free(eoff);
+        return 0;
+    }
+
+    int ok = 1;
+    for (size_t e = 0; e < m && ok; e++) {
+        const uint32_t s = graph->src[e], d = graph->dst[e];
+        if ((size_t)s >= n || (size_t)d >= n) continue;
+        uint16_t q = 0;
+        ok = hil_pack_weight(graph->weight[e], &q);
+        keys[eoff[s]++] = ((uint64_t)d << 16) | q;
+        keys[eoff[d]++] = ((uint64_t)s << 16) | q;
+    }
+    for (size_t i = n; i > 0; i--) eoff[i] = eoff[i - 1];
+    eoff[0] = 0;
+
+    out->num_edges = total;
+    ok = ok && hil_graph_pack_keys(out, eoff, keys);
+    free(keys);
+    free(eoff);
+    if (!ok) hil_graph_packed_free(out);
+    return ok;
+}
+
+int hil_graph_pack(const hil_graph_t *graph, hil_graph_packed_t *out) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_pack_kernel(graph, out);
+    HIL_STATS_END(HIL_STAT_GRAPH_PACK, t0, (ok ? (uint64_t)hil_graph_packed_bytes(out) : 0),
+                  (graph ? graph->num_edges : 0));
+    return ok;
+}
+
+size_t hil_graph_packed_bytes(const hil_graph_packed_t *packed) {
+    if (!packed || !packed->offsets) return 0;
+    return (packed->num_nodes + 1) * sizeof(uint64_t) + (size_t)packed->offsets[packed->num_nodes];
+}
+
+static int hil_packed_valid(const hil_graph_packed_t *packed) {
+    if (!packed || packed->num_nodes == 0 || !packed->offsets) return 0;
+    return packed->offsets[packed->num_nodes] == 0 || packed->stream;
+}
+
+/* Integer row sum of quantized weights; exact, so order-free. Gaps are
+   skipped by their continuation bits, never decoded. */
+static uint64_t hil_packed_row_sum(const hil_graph_packed_t *packed, size_t i) {
+    const uint8_t *p = packed->stream + packed->offsets[i];
+    const uint8_t *end = packed->stream + packed->offsets[i + 1];
+    uint64_t s = 0;
+    while (end - p >= 3) {
+        while (*p & 0x80u) {
+            if (++p == end) return s;
+        }
+        p++;
+        if (end - p < 2) break;
+        s += (uint64_t)p[0] | ((uint64_t)p[1] << 8);
+        p += 2;
+    }
+    return s;
+}
+
+void hil_graph_degree_packed(const hil_graph_packed_t *packed, double *out_degree) {
+    if (!hil_packed_valid(packed) || !out_degree) return;
+    const double scale = 1.0 / (double)HIL_PACKED_WEIGHT_SCALE;
+
+    for (size_t i = 0; i < packed->num_nodes; i++) {
+        out_degree[i] = (double)hil_packed_row_sum(packed, i) * scale;
+    }
+}
+
+static double hil_graph_entropy_packed_kernel(const hil_graph_packed_t *packed) {
+    if (!hil_packed_valid(packed)) return 0.0;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < packed->num_nodes; i++) total += hil_packed_row_sum(packed, i);
+
+    const double sum_q = (double)total;
+    if (sum_q / (double)HIL_PACKED_WEIGHT_SCALE <= HIL_EPS) return 0.0;
+
+    double H = 0.0;
+    for (size_t i = 0; i < packed->num_nodes; i++) {
+        double p = (double)hil_packed_row_sum(packed, i) / sum_q;
+        if (p > HIL_EPS) {
+            H -= p * hil_safe_log(p);
+        }
+    }
+
+    return H;
+}
+
+double hil_graph_entropy_packed(const hil_graph_packed_t *packed) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double H = hil_graph_entropy_packed_kernel(packed);
+    HIL_STATS_END(HIL_STAT_GRAPH_ENTROPY_PACKED, t0, 0, (packed ? packed->num_edges : 0));
+    return H;
+}
+
+double hil_graph_entropy_packed_bound(const hil_graph_packed_t *packed) {
+    if (!hil_packed_valid(packed)) return 0.0;
+    const size_t n = packed->num_nodes;
+    if (n < 2 || packed->num_edges == 0) return 0.0;
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < n; i++) total += hil_packed_row_sum(packed, i);
+
+    const double S = (double)total / (double)HIL_PACKED_WEIGHT_SCALE;
+    const double D = (double)packed->num_edges * 0.5 / (double)HIL_PACKED_WEIGHT_SCALE;
+    const double ln_n = log((double)n);
+    if (S <= D) return ln_n;
+
+    const double T = D / (S - D);
+    if (T >= 1.0 - 1.0 / (double)n) return ln_n;
+
+    const double h = -T * log(T) - (1.0 - T) * log1p(-T);
+    return T * log((double)(n - 1)) + h;
+}
+
+size_t hil_graph_connected_components_packed(const hil_graph_packed_t *packed) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, packed ? hil_ws_need(sizeof(uint32_t) * packed->num_nodes) : 0);
+    const size_t comps = hil_graph_connected_components_packed_ws(packed, &ws);
+    hil_workspace_free(&ws);
+    return comps;
+}
+
+static size_t hil_graph_connected_components_packed_kernel(
+    const hil_graph_packed_t *packed,
+    hil_workspace_t *ws
+) {
+    if (!hil_packed_valid(packed) || !ws) return 0;
+    const size_t n = packed->num_nodes;
+    if (n > (size_t)UINT32_MAX) return 0;
+    hil_workspace_reset(ws);
+
+    uint32_t *parent = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n);
+    if (!parent) return 0;
+
+    #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+    #pragma omp parallel
+    #endif
+    {
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(static)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) parent[ii] = (uint32_t)ii;
+
+        #if defined(_OPENMP) && defined(HIL_UF_CONCURRENT)
+        #pragma omp for schedule(dynamic, 256)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) {
+            const size_t i = (size_t)ii;
+            const uint8_t *p = packed->stream + packed->offsets[i];
+            const uint8_t *end = packed->stream + packed->offsets[i + 1];
+            uint64_t j = 0;
+            while (p < end) {
+                uint32_t gap, q;
+                p = hil_packed_next(p, end, &gap, &q);
+                j += gap;
+                if (j >= n) break;
+                hil_uf_union_shared(parent, (uint32_t)i, (uint32_t)j);
+            }
+        }
+    }
+
+    return hil_uf_settle(parent, n, NULL, NULL);
+}
+
+size_t hil_graph_connected_components_packed_ws(
+    const hil_graph_packed_t *packed,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const size_t comps = hil_graph_connected_components_packed_kernel(packed, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_COMPONENTS_PACKED, t0, HIL_STAT_WS_BYTES(ws),
+                  (packed ? packed->num_edges : 0));
+    return comps;
+}
+
+/* ============================================================================
+ * Field Diagnostics (Geometric)
+ * ============================================================================
+ */
+
+double hil_field_mean_norm(const hil_field_t *field) {
+    if (!field) return 0.0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0.0;
+
+    const hil_vec_dot_fn dot = hil_vec_dot_for(M.cols);
+    double sum = 0.0;
+    for (size_t r = 0; r < M.rows; r++) {
+        const double *row = hil_matrix_row(&M, r);
+        sum += sqrt(dot(row, row, M.cols));
+    }
+
+    return sum / (double)M.rows;
+}
+
+/* Fold one row into the summary accumulators (centroid sum and
+   u = sum_r x_r / |x_r|); returns the row norm. dot is
+   hil_vec_dot_for(cols). */
+static double hil_summary_accumulate(
+    hil_vec_dot_fn dot,
+    const double *row,
+    size_t cols,
+    double *centroid,
+    double *u
+) {
+    const double r_norm = sqrt(dot(row, row, cols));
+    const double inv = 1.0 / hil_clamp_min(r_norm, HIL_EPS);
+
+    hil_vec_add_inplace(centroid, row, cols);
+    for (size_t k = 0; k < cols; k++) u[k] += row[k] * inv;
+    return r_norm;
+}
+
+/* Coherence from the accumulators; scales centroid to the mean in place
+   and reports its norm. */
+static double hil_summary_coherence(
+    double *centroid,
+    const double *u,
+    size_t cols,
+    size_t rows,
+    double *out_centroid_norm
+) {
+    hil_vec_scale_inplace(centroid, cols, 1.0 / (double)rows);
+
+    const double c_norm = hil_vec_norm(centroid, cols);
+    const double dot = hil_vec_dot(u, centroid, cols);
+
+    if (out_centroid_norm) *out_centroid_norm = c_norm;
+    return dot / (hil_clamp_min(c_norm, HIL_EPS) * (double)rows);
+}
+
+/* Summary of the rows of M; scratch holds 2 * M.cols doubles and is left
+   holding the centroid in its first M.cols entries. */
+static void hil_field_summary_rows(
+    const hil_matrix_t *M,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    double *scratch
+) {
+    double *centroid = scratch;
+    double *u = scratch + M->cols;
+
+    hil_vec_zero(scratch, 2 * M->cols);
+
+    /* Single streaming pass: each row is read from memory once and
+       stays cache-resident for the norm, centroid and u updates. */
+    const hil_vec_dot_fn dot = hil_vec_dot_for(M->cols);
+    double sum_norm = 0.0;
+    for (size_t r = 0; r < M->rows; r++) {
+        const double r_norm = hil_summary_accumulate(
+            dot, hil_matrix_row(M, r), M->cols, centroid, u
+        );
+        if (out_row_norms) out_row_norms[r] = r_norm;
+        sum_norm += r_norm;
+    }
+
+    out->mean_norm = sum_norm / (double)M->rows;
+    out->coherence = hil_summary_coherence(
+        centroid, u, M->cols, M->rows, &out->centroid_norm
+    );
+}
+
+/* Summary body; allocates from ws without resetting it, so callers can
+   keep earlier workspace allocations alive across the call. */
+static int hil_field_summary_impl(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+) {
+    if (!field || !out || !ws) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+
+    /* centroid sum and u = sum_r x_r / |x_r| share one allocation */
+    double *scratch = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * M.cols);
+    if (!scratch) return 0;
+
+    hil_field_summary_rows(&M, out, out_row_norms, scratch);
+    return 1;
+}
+
+double hil_field_coherence(const hil_field_t *field) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, field ? hil_ws_need(sizeof(double) * 2 * field->coordinates.cols) : 0);
+    const double C = hil_field_coherence_ws(field, &ws);
+    hil_workspace_free(&ws);
+    return C;
+}
+
+static double hil_field_coherence_kernel(const hil_field_t *field, hil_workspace_t *ws) {
+    /* Coherence proxy: mean cosine similarity to centroid.
+       Purely geometric; no semantics. */
+    hil_field_summary_t summary;
+    hil_workspace_reset(ws);
+    if (!hil_field_summary_impl(field, &summary, NULL, ws)) return 0.0;
+    return summary.coherence;
+}
+
+double hil_field_coherence_ws(const hil_field_t *field, hil_workspace_t *ws) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double C = hil_field_coherence_kernel(field, ws);
+    HIL_STATS_END(HIL_STAT_FIELD_COHERENCE, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return C;
+}
+
+int hil_field_summary(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, field ? hil_ws_need(sizeof(double) * 2 * field->coordinates.cols) : 0);
+    const int ok = hil_field_summary_ws(field, out, out_row_norms, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_field_summary_kernel(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+) {
+    hil_workspace_reset(ws);
+    return hil_field_summary_impl(field, out, out_row_norms, ws);
+}
+
+int hil_field_summary_ws(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_field_summary_kernel(field, out, out_row_norms, ws);
+    HIL_STATS_END(HIL_STAT_FIELD_SUMMARY, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return ok;
+}
+
+/* ============================================================================
+ * Epistemic Stability
+ * ============================================================================
+ */
+
+/* Perturb row r of a field in place (the hil_field_perturb pattern; the
+   sign index is the row-major element index r * cols + c). */
+static void hil_perturb_row(hil_vec_dot_fn dot, double *row, size_t r, size_t cols,
+                            double epsilon) {
+    for (size_t c = 0; c < cols; c++) {
+        size_t idx = r * cols + c;
+        row[c] += epsilon * hil_det_sign(idx);
+    }
+
+    /* Optional renormalization to unit norm (numerical stability) */
+    double nrm = sqrt(dot(row, row, cols));
+    if (nrm > HIL_EPS) {
+        hil_vec_scale_inplace(row, cols, 1.0 / nrm);
+    }
+}
+
+/* Curve kernel scratch: (centroid, u) per epsilon plus baseline, and one
+   perturbed row. */
+static size_t hil_stability_curve_scratch(const hil_field_t *field, size_t count) {
+    if (!field) return 0;
+    const size_t d = field->coordinates.cols;
+    return hil_ws_need(sizeof(double) * 2 * d * (count + 1)) + hil_ws_need(sizeof(double) * d);
+}
+
+double hil_epistemic_stability(const hil_field_t *field, const hil_graph_t *graph) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_stability_curve_scratch(field, 1));
+    const double S = hil_epistemic_stability_ws(field, graph, &ws);
+    hil_workspace_free(&ws);
+    return S;
+}
+
+/* Called directly so a stability call does not also count as a curve call. */
+static int hil_epistemic_stability_curve_kernel(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity,
+    hil_workspace_t *ws
+);
+
+static double hil_epistemic_stability_kernel(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    hil_workspace_t *ws
+) {
+    /* First-pass stability as sensitivity of coherence under bounded perturbation:
+         S = |C(field) - C(perturbed(field, eps))| / eps
+       This yields a diagnostic “instability” magnitude.
+       Interpretation is left to Python/theory layer; we only compute.
+    */
+    const double eps = 1e-6;
+    double S = 0.0;
+    if (!hil_epistemic_stability_curve_kernel(field, graph, &eps, 1, &S, ws)) return 0.0;
+    return S;
+}
+
+double hil_epistemic_stability_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double S = hil_epistemic_stability_kernel(field, graph, ws);
+    HIL_STATS_END(HIL_STAT_EPISTEMIC_STABILITY, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return S;
+}
+
+int hil_epistemic_stability_curve(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_stability_curve_scratch(field, count));
+    const int ok = hil_epistemic_stability_curve_ws(
+        field, graph, epsilons, count, out_sensitivity, &ws
+    );
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_epistemic_stability_curve_kernel(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity,
+    hil_workspace_t *ws
+) {
+    (void)graph; /* reserved: stability may later incorporate graph terms */
+
+    if (!field || !ws || !epsilons || !out_sensitivity || count == 0) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+    for (size_t k = 0; k < count; k++) {
+        if (!(epsilons[k] > 0.0)) return 0;
+    }
+    hil_workspace_reset(ws);
+
+    const size_t d = M.cols;
+
+    /* Accumulators: (centroid, u) for the baseline and for each epsilon,
+       plus one perturbed-row buffer. */
+    double *acc = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d * (count + 1));
+    double *y = (double*)hil_workspace_alloc(ws, sizeof(double) * d);
+    if (!acc || !y) return 0;
+    hil_vec_zero(acc, 2 * d * (count + 1));
+
+    /* Single streaming pass: each row is read once and perturbed in a
+       row-sized buffer exactly as hil_field_perturb would, then folded into
+       the accumulators for every epsilon. */
+    const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+    for (size_t r = 0; r < M.rows; r++) {
+        const double *row = hil_matrix_row(&M, r);
+        hil_summary_accumulate(dot, row, d, acc, acc + d);
+
+        for (size_t k = 0; k < count; k++) {
+            double *acc_k = acc + 2 * d * (k + 1);
+            memcpy(y, row, sizeof(double) * d);
+            hil_perturb_row(dot, y, r, d, epsilons[k]);
+            hil_summary_accumulate(dot, y, d, acc_k, acc_k + d);
+        }
+    }
+
+    const double C0 = hil_summary_coherence(acc, acc + d, d, M.rows, NULL);
+    for (size_t k = 0; k < count; k++) {
+        double *acc_k = acc + 2 * d * (k + 1);
+        const double Ck = hil_summary_coherence(acc_k, acc_k + d, d, M.rows, NULL);
+        out_sensitivity[k] = fabs(Ck - C0) / epsilons[k];
+    }
+
+    return 1;
+}
+
+int hil_epistemic_stability_curve_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_epistemic_stability_curve_kernel(
+        field, graph, epsilons, count, out_sensitivity, ws
+    );
+    HIL_STATS_END(HIL_STAT_EPISTEMIC_STABILITY_CURVE, t0, HIL_STAT_WS_BYTES(ws),
+                  hil_stat_rows(field));
+    return ok;
+}
+
+/* x log x, with the 0 log 0 = 0 convention (and rounding below 0 -> 0). */
+static double hil_xlogx(double x) {
+    return (x > 0.0) ? x * log(x) : 0.0;
+}
+
+/* Out-strength entropy with node i removed: H' = log S' - T' / S', where
+   S = sum out and T = sum out log out are updated for node i and the
+   sources of its in-edges only (row i of the in-edge CSR in_off / in_src /
+   in_w). Node i's own out-strength, self-loop included, leaves whole. */
+static double hil_loo_entropy(
+    const uint64_t *in_off,
+    const uint32_t *in_src,
+    const double *in_w,
+    const double *out,
+    double S,
+    double T,
+    size_t i,
+    double *delta,
+    uint8_t *mark,
+    uint32_t *touched
+) {
+    size_t nt = 0;
+    double in_sum = 0.0;
+
+    for (uint64_t k = in_off[i]; k < in_off[i + 1]; k++) {
+        const uint32_t j = in_src[k];
+        if ((size_t)j == i) continue;
+        if (!mark[j]) { mark[j] = 1; touched[nt++] = j; }
+        delta[j] += in_w[k];
+        in_sum += in_w[k];
+    }
+
+    double S1 = S - out[i] - in_sum;
+    double T1 = T - hil_xlogx(out[i]);
+
+    for (size_t t = 0; t < nt; t++) {
+        const uint32_t j = touched[t];
+        T1 -= hil_xlogx(out[j]) - hil_xlogx(out[j] - delta[j]);
+        delta[j] = 0.0;
+        mark[j] = 0;
+    }
+
+    if (S1 <= HIL_EPS) return 0.0;
+    const double H = log(S1) - T1 / S1;
+    return (H > 0.0) ? H : 0.0;
+}
+
+/* Kernel scratch: c, u, row norms and a_r for coherence; out-strengths,
+   in-edges grouped by destination and per-thread neighbour buffers for
+   entropy. */
+static size_t hil_leave_one_out_scratch(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *out_entropy,
+    const double *out_coherence
+) {
+    if (!field) return 0;
+    const size_t n = field->coordinates.rows;
+    const size_t d = field->coordinates.cols;
+    size_t bytes = 0;
+    if (out_coherence) {
+        bytes += 2 * hil_ws_need(sizeof(double) * d) + 2 * hil_ws_need(sizeof(double) * n);
+    }
+    if (out_entropy && graph) {
+        const size_t m = graph->num_edges ? graph->num_edges : 1;
+        const size_t nt = n * hil_ws_threads();
+        bytes += hil_ws_need(sizeof(double) * n)
+               + hil_ws_need(sizeof(uint64_t) * (n + 1))
+               + hil_ws_need(sizeof(uint32_t) * m)
+               + hil_ws_need(sizeof(double) * m)
+               + hil_ws_need(sizeof(double) * nt)
+               + hil_ws_need(nt)
+               + hil_ws_need(sizeof(uint32_t) * nt);
+    }
+    return bytes;
+}
+
+int hil_leave_one_out_diagnostics(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    double *out_entropy,
+    double *out_coherence
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_leave_one_out_scratch(field, graph, out_entropy, out_coherence));
+    const int ok = hil_leave_one_out_diagnostics_ws(field, graph, out_entropy, out_coherence, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_leave_one_out_diagnostics_kernel(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    double *out_entropy,
+    double *out_coherence,
+    hil_workspace_t *ws
+) {
+    if (!field || !ws) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows < 2 || M.cols == 0) return 0;
+
+    const size_t n = M.rows;
+    const size_t d = M.cols;
+
+    if (out_entropy) {
+        if (!graph || graph->num_nodes != n) return 0;
+        if (graph->num_edges > 0 && (!graph->src || !graph->dst || !graph->weight)) return 0;
+    }
+
+    hil_workspace_reset(ws);
+    int ok = 1;
+
+    /* ------------------------------------------------------------------
+     * Coherence: with c the centroid, nr_r the clamped row norms,
+     *   a_r = <x_r, c> / nr_r,  A = sum a_r,  u = sum x_r / nr_r,
+     * the field without row i has centroid c' = (n c - x_i) / (n - 1) and
+     *   sum_{r != i} <x_r, c'> / nr_r
+     *     = (n (A - a_i) - (<u, x_i> - <x_i, x_i> / nr_i)) / (n - 1).
+     * ------------------------------------------------------------------ */
+    if (out_coherence) {
+        double *c = (double*)hil_workspace_alloc(ws, sizeof(double) * d);
+        double *u = (double*)hil_workspace_alloc(ws, sizeof(double) * d);
+        double *nr = (double*)hil_workspace_alloc(ws, sizeof(double) * n);
+        double *a = (double*)hil_workspace_alloc(ws, sizeof(double) * n);
+
+        if (!c || !u || !nr || !a) {
+            ok = 0;
+        } else {
+            hil_vec_zero(c, d);
+            hil_vec_zero(u, d);
+
+            for (size_t r = 0; r < n; r++) {
+                hil_vec_add_inplace(c, hil_matrix_row(&M, r), d);
+            }
+            hil_vec_scale_inplace(c, d, 1.0 / (double)n);
+
+            const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+            double A = 0.0;
+            for (size_t r = 0; r < n; r++) {
+                const double *row = hil_matrix_row(&M, r);
+                nr[r] = hil_clamp_min(sqrt(dot(row, row, d)), HIL_EPS);
+                a[r] = dot(row, c, d) / nr[r];
+                A += a[r];
+                for (size_t k = 0; k < d; k++) u[k] += row[k] / nr[r];
+            }
+
+            const double dn = (double)n;
+            const double dn1 = (double)(n - 1);
+
+            #ifdef _OPENMP
+            #pragma omp parallel for schedule(static)
+            #endif
+            for (long long ii = 0; ii < (long long)n; ii++) {
+                const size_t i = (size_t)ii;
+                const double *xi = hil_matrix_row(&M, i);
+
+                double cn2 = 0.0;
+                for (size_t k = 0; k < d; k++) {
+                    const double ck = (dn * c[k] - xi[k]) / dn1;
+                    cn2 += ck * ck;
+                }
+                const double cn = hil_clamp_min(sqrt(cn2), HIL_EPS);
+
+                const double self = dot(xi, xi, d) / nr[i];
+                const double num = (dn * (A - a[i]) - (dot(u, xi, d) - self)) / dn1;
+
+                out_coherence[i] = num / (cn * dn1);
+            }
+        }
+    }
+
+    /* ------------------------------------------------------------------
+     * Entropy: baseline out-strengths, S and T once, and the in-edges
+     * grouped by destination; then per element only its in-edges are
+     * visited (O(m) in total).
+     * ------------------------------------------------------------------ */
+    if (ok && out_entropy) {
+        const size_t m = graph->num_edges;
+        int threads = 1;
+        #ifdef _OPENMP
+        threads = omp_get_max_threads();
+        #endif
+
+        /* Per-thread neighbour scratch, carved up front so the parallel
+           region never allocates; mark and delta are reset after each
+           element, so zeroing once suffices. */
+        double *out = (double*)hil_workspace_alloc(ws, sizeof(double) * n);
+        uint64_t *in_off = (uint64_t*)hil_workspace_alloc(ws, sizeof(uint64_t) * (n + 1));
+        uint32_t *in_src = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * (m ? m : 1));
+        double *in_w = (double*)hil_workspace_alloc(ws, sizeof(double) * (m ? m : 1));
+        double *delta = (double*)hil_workspace_alloc(ws, sizeof(double) * n * (size_t)threads);
+        uint8_t *mark = (uint8_t*)hil_workspace_alloc(ws, n * (size_t)threads);
+        uint32_t *touched = (uint32_t*)hil_workspace_alloc(ws, sizeof(uint32_t) * n * (size_t)threads);
+
+        if (!out || !in_off || !in_src || !in_w || !delta || !mark || !touched) {
+            ok = 0;
+        } else if (!hil_graph_validate(graph)) {
+            ok = 0;
+        } else {
+            memset(out, 0, sizeof(double) * n);
+            memset(in_off, 0, sizeof(uint64_t) * (n + 1));
+            memset(delta, 0, sizeof(double) * n * (size_t)threads);
+            memset(mark, 0, n * (size_t)threads);
+
+            /* Out-strengths in hil_graph_out_entropy order; in-edges by a
+               counting sort on dst (edge order kept within each row). */
+            for (size_t e = 0; e < m; e++) {
+                out[graph->src[e]] += graph->weight[e];
+                in_off[graph->dst[e] + 1]++;
+            }
+            for (size_t j = 0; j < n; j++) in_off[j + 1] += in_off[j];
+            for (size_t e = 0; e < m; e++) {
+                const uint64_t k = in_off[graph->dst[e]]++;
+                in_src[k] = graph->src[e];
+                in_w[k] = graph->weight[e];
+            }
+            for (size_t j = n; j > 0; j--) in_off[j] = in_off[j - 1];
+            in_off[0] = 0;
+
+            double S = 0.0, T = 0.0;
+            for (size_t j = 0; j < n; j++) {
+                S += out[j];
+                T += hil_xlogx(out[j]);
+            }
+
+            #ifdef _OPENMP
+            #pragma omp parallel num_threads(threads)
+            #endif
+            {
+                size_t t = 0;
+                #ifdef _OPENMP
+                t = (size_t)omp_get_thread_num();
+                #endif
+                double *t_delta = delta + t * n;
+                uint8_t *t_mark = mark + t * n;
+                uint32_t *t_touched = touched + t * n;
+
+                #ifdef _OPENMP
+                #pragma omp for schedule(dynamic, 64)
+                #endif
+                for (long long ii = 0; ii < (long long)n; ii++) {
+                    out_entropy[ii] = hil_loo_entropy(
+                        in_off, in_src, in_w, out, S, T, (size_t)ii, t_delta, t_mark, t_touched
+                    );
+                }
+            }
+        }
+    }
+
+    return ok;
+}
+
+int hil_leave_one_out_diagnostics_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    double *out_entropy,
+    double *out_coherence,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_leave_one_out_diagnostics_kernel(
+        field, graph, out_entropy, out_coherence, ws
+    );
+    HIL_STATS_END(HIL_STAT_LEAVE_ONE_OUT, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return ok;
+}
+
+/* ============================================================================
+ * Geometric Delta (PCA / Procrustes)
+ * ============================================================================
+ */
+
+/*
+ * Centered scatter operator  v -> S v - down_scale * down (down . v),
+ * S = sum_r (x_r - mean)(x_r - mean)^T, applied densely when S is given
+ * (cols x cols) and matrix-free over the rows otherwise.
+ */
+typedef struct {
+    const hil_matrix_t *M;
+    const double *mean;
+    const double *S;          /* nullable: dense scatter */
+    const double *down;       /* nullable: rank-1 downdate vector */
+    double        down_scale;
+} hil_pca_op_t;
+
+static void hil_pca_apply(const hil_pca_op_t *op, const double *v, double *out) {
+    const size_t d = op->M->cols;
+
+    if (op->S) {
+        const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+        for (size_t a = 0; a < d; a++) out[a] = dot(op->S + a * d, v, d);
+    } else {
+        hil_vec_zero(out, d);
+        for (size_t r = 0; r < op->M->rows; r++) {
+            const double *row = hil_matrix_row(op->M, r);
+            double t = 0.0;
+            for (size_t c = 0; c < d; c++) t += (row[c] - op->mean[c]) * v[c];
+            for (size_t c = 0; c < d; c++) out[c] += t * (row[c] - op->mean[c]);
+        }
+    }
+
+    if (op->down) {
+        const double t = op->down_scale * hil_vec_dot(op->down, v, d);
+        for (size_t c = 0; c < d; c++) out[c] -= t * op->down[c];
+    }
+}
+
+/* Fixed-seed start block (splitmix64), independent of the data. */
+static void hil_pca_seed_axes(double *V, size_t k, size_t d) {
+    uint64_t s = 0x48494c5043413031ull;
+    for (size_t i = 0; i < k * d; i++) {
+        s += 0x9E3779B97F4A7C15ull;
+        uint64_t z = s;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        V[i] = (double)(z >> 11) * (1.0 / 9007199254740992.0) - 0.5;
+    }
+}
+
+/* Orthonormalise the k rows of V in place: modified Gram-Schmidt applied
+   twice. A row that collapses into the span of the previous ones is
+   replaced by the first coordinate axis that does not, so the block always
+   spans k dimensions (k <= d). */
+static void hil_pca_orthonormalize(double *V, size_t k, size_t d) {
+    for (size_t j = 0; j < k; j++) {
+        double *vj = V + j * d;
+        const double n0 = hil_vec_norm(vj, d);
+        double nj = 0.0;
+
+        for (size_t e = 0; ; e++) {
+            for (int pass = 0; pass < 2; pass++) {
+                for (size_t p = 0; p < j; p++) {
+                    const double *vp = V + p * d;
+                    const double t = hil_vec_dot(vp, vj, d);
+                    for (size_t c = 0; c < d; c++) vj[c] -= t * vp[c];
+                }
+            }
+            nj = hil_vec_norm(vj, d);
+            if (e == 0 ? (nj > 1e-10 * n0 && nj > 0.0) : nj > 0.5) break;
+            if (e >= d) break;
+            hil_vec_zero(vj, d);
+            vj[e] = 1.0;
+        }
+
+        if (nj > 0.0) hil_vec_scale_inplace(vj, d, 1.0 / nj);
+    }
+}
+
+/* Eigen-decomposition of a symmetric k x k matrix (PCA blocks, Lanczos
+   projections) by cyclic Jacobi rotations. H is destroyed; on return evals
+   is descending and column j of G (G[a * k + j]) is the unit eigenvector of
+   evals[j]. */
+static void hil_sym_eigen_small(double *H, size_t k, double *evals, double *G) {
+    for (size_t a = 0; a < k; a++) {
+        for (size_t b = 0; b < k; b++) G[a * k + b] = (a == b) ? 1.0 : 0.0;
+    }
+
+    for (int sweep = 0; sweep < 64; sweep++) {
+        double off = 0.0, diag = 0.0;
+        for (size_t p = 0; p < k; p++) {
+            diag += H[p * k + p] * H[p * k + p];
+            for (size_t q = p + 1; q < k; q++) off += H[p * k + q] * H[p * k + q];
+        }
+        if (off == 0.0 || off <= 1e-32 * diag) break;
+
+        for (size_t p = 0; p < k; p++) {
+            for (size_t q = p + 1; q < k; q++) {
+                const double hpq = H[p * k + q];
+                if (hpq == 0.0) continue;
+
+                const double theta = (H[q * k + q] - H[p * k + p]) / (2.0 * hpq);
+                const double t = ((theta >= 0.0) ? 1.0 : -1.0)
+                               / (fabs(theta) + sqrt(theta * theta + 1.0));
+                const double c = 1.0 / sqrt(t * t + 1.0);
+                const double s = t * c;
+
+                /* H <- J^T H J, G <- G J for the (p, q) rotation */
+                for (size_t r = 0; r < k; r++) {
+                    const double hrp = H[r * k + p], hrq = H[r * k + q];
+                    H[r * k + p] = c * hrp - s * hrq;
+                    H[r * k + q] = s * hrp + c * hrq;
+                }
+                for (size_t r = 0; r < k; r++) {
+                    const double hpr = H[p * k + r], hqr = H[q * k + r];
+                    H[p * k + r] = c * hpr - s * hqr;
+                    H[q * k + r] = s * hpr + c * hqr;
+                }
+                for (size_t r = 0; r < k; r++) {
+                    const double gp = G[r * k + p], gq = G[r * k + q];
+                    G[r * k + p] = c * gp - s * gq;
+                    G[r * k + q] = s * gp + c * gq;
+                }
+            }
+        }
+    }
+
+    for (size_t j = 0; j < k; j++) evals[j] = H[j * k + j];
+
+    /* Selection sort, descending; ties keep their order. */
+    for (size_t j = 0; j < k; j++) {
+        size_t best = j;
+        for (size_t q = j + 1; q < k; q++) {
+            if (evals[q] > evals[best]) best = q;
+        }
+        if (best == j) continue;
+        const double ev = evals[j];
+        evals[j] = evals[best];
+        evals[best] = ev;
+        for (size_t r = 0; r < k; r++) {
+            const double g = G[r * k + j];
+            G[r * k + j] = G[r * k + best];
+            G[r * k + best] = g;
+        }
+    }
+}
+
+/* X <- G^T X for a k-row block (row j becomes sum_a G[a][j] X_a). */
+static void hil_pca_rotate(double *X, double *T, const double *G, size_t k, size_t d) {
+    for (size_t j = 0; j < k; j++) {
+        double *tj = T + j * d;
+        hil_vec_zero(tj, d);
+        for (size_t a = 0; a < k; a++) {
+            const double g = G[a * k + j];
+            const double *xa = X + a * d;
+            for (size_t c = 0; c < d; c++) tj[c] += g * xa[c];
+        }
+    }
+    memcpy(X, T, sizeof(double) * k * d);
+}
+
+/*
+ * Block subspace iteration with Rayleigh-Ritz for the top k eigenpairs of
+ * op. V (k rows of length cols) holds the start block on entry and the
+ * Ritz vectors on return; W and T are k x cols scratch. lambda receives the
+ * Ritz values, descending. At least one iteration is always performed.
+ */
+static void hil_pca_iterate(
+    const hil_pca_op_t *op,
+    size_t k,
+    size_t max_iter,
+    double tol,
+    double *V,
+    double *W,
+    double *T,
+    double *lambda
+) {
+    const size_t d = op->M->cols;
+    double H[HIL_PCA_MAX_AXES * HIL_PCA_MAX_AXES];
+    double G[HIL_PCA_MAX_AXES * HIL_PCA_MAX_AXES];
+
+    hil_pca_orthonormalize(V, k, d);
+
+    for (size_t it = 0; ; it++) {
+        for (size_t j = 0; j < k; j++) hil_pca_apply(op, V + j * d, W + j * d);
+
+        for (size_t a = 0; a < k; a++) {
+            for (size_t b = a; b < k; b++) {
+                const double h = 0.5 * (hil_vec_dot(V + a * d, W + b * d, d)
+                                      + hil_vec_dot(V + b * d, W + a * d, d));
+                H[a * k + b] = h;
+                H[b * k + a] = h;
+            }
+        }
+        hil_sym_eigen_small(H, k, lambda, G);
+
+        /* Rotate onto the Ritz vectors; W stays op(V). */
+        hil_pca_rotate(V, T, G, k, d);
+        hil_pca_rotate(W, T, G, k, d);
+
+        double res = 0.0;
+        for (size_t j = 0; j < k; j++) {
+            for (size_t c = 0; c < d; c++) {
+                const double e = W[j * d + c] - lambda[j] * V[j * d + c];
+                res += e * e;
+            }
+        }
+        if (sqrt(res) <= tol * fabs(lambda[0]) || it + 1 >= max_iter) break;
+
+        memcpy(V, W, sizeof(double) * k * d);
+        hil_pca_orthonormalize(V, k, d);
+    }
+}
+
+/* Sign convention: the largest-magnitude entry of each axis is positive
+   (first such entry on ties). */
+static void hil_pca_fix_signs(double *V, size_t k, size_t d) {
+    for (size_t j = 0; j < k; j++) {
+        double *vj = V + j * d;
+        size_t arg = 0;
+        for (size_t c = 1; c < d; c++) {
+            if (fabs(vj[c]) > fabs(vj[arg])) arg = c;
+        }
+        if (vj[arg] < 0.0) hil_vec_scale_inplace(vj, d, -1.0);
+    }
+}
+
+static void hil_pca_mean(const hil_matrix_t *M, double *mean) {
+    hil_vec_zero(mean, M->cols);
+    for (size_t r = 0; r < M->rows; r++) {
+        hil_vec_add_inplace(mean, hil_matrix_row(M, r), M->cols);
+    }
+    hil_vec_scale_inplace(mean, M->cols, 1.0 / (double)M->rows);
+}
+
+static int hil_pca_valid(const hil_field_t *field, size_t k) {
+    if (!field) return 0;
+    const hil_matrix_t *M = &field->coordinates;
+    if (!M->data || M->rows == 0 || M->cols == 0) return 0;
+    return k >= 1 && k <= HIL_PCA_MAX_AXES && k <= M->cols;
+}
+
+/* One field: mean (cols), axes (k x cols), W and T scratch (k x cols). */
+static void hil_pca_solve(
+    const hil_matrix_t *M,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *mean,
+    double *axes,
+    double *W,
+    double *T,
+    double *out_variance
+) {
+    const size_t d = M->cols;
+    double lambda[HIL_PCA_MAX_AXES];
+
+    hil_pca_mean(M, mean);
+    if (warm_axes) {
+        memcpy(axes, warm_axes, sizeof(double) * k * d);
+    } else {
+        hil_pca_seed_axes(axes, k, d);
+    }
+
+    const hil_pca_op_t op = { M, mean, NULL, NULL, 0.0 };
+    hil_pca_iterate(&op, k, max_iter, tol, axes, W, T, lambda);
+    hil_pca_fix_signs(axes, k, d);
+
+    if (out_variance) {
+        const double dof = (M->rows > 1) ? (double)(M->rows - 1) : 1.0;
+        for (size_t j = 0; j < k; j++) out_variance[j] = hil_clamp_min(lambda[j], 0.0) / dof;
+    }
+}
+
+/* PCA kernel scratch per thread: the mean (unless supplied) and the two
+   k x d iteration buffers. */
+static size_t hil_pca_scratch(size_t d, size_t k, int has_mean, size_t threads) {
+    return (has_mean ? 0 : hil_ws_need(sizeof(double) * d * threads))
+         + 2 * hil_ws_need(sizeof(double) * k * d * threads);
+}
+
+int hil_pca_axes(
+    const hil_field_t *field,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_mean,
+    double *out_variance
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, field ? hil_pca_scratch(field->coordinates.cols, k, out_mean != NULL, 1) : 0);
+    const int ok = hil_pca_axes_ws(field, k, warm_axes, max_iter, tol,
+                                   out_axes, out_mean, out_variance, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_pca_axes_kernel(
+    const hil_field_t *field,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_mean,
+    double *out_variance,
+    hil_workspace_t *ws
+) {
+    if (!out_axes || !ws || !hil_pca_valid(field, k)) return 0;
+    const size_t d = field->coordinates.cols;
+
+    hil_workspace_reset(ws);
+    double *mean = out_mean ? out_mean : (double*)hil_workspace_alloc(ws, sizeof(double) * d);
+    double *W = (double*)hil_workspace_alloc(ws, sizeof(double) * k * d);
+    double *T = (double*)hil_workspace_alloc(ws, sizeof(double) * k * d);
+    if (!mean || !W || !T) return 0;
+
+    hil_pca_solve(&field->coordinates, k, warm_axes, max_iter, tol,
+                  mean, out_axes, W, T, out_variance);
+    return 1;
+}
+
+int hil_pca_axes_ws(
+    const hil_field_t *field,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_mean,
+    double *out_variance,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_pca_axes_kernel(field, k, warm_axes, max_iter, tol,
+                                       out_axes, out_mean, out_variance, ws);
+    HIL_STATS_END(HIL_STAT_PCA_AXES, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return ok;
+}
+
+int hil_pca_axes_batch(
+    const hil_field_t *fields,
+    size_t count,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_means,
+    double *out_variances
+) {
+    const size_t d = (fields && count) ? fields[0].coordinates.cols : 0;
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, d ? hil_pca_scratch(d, k, 0, hil_ws_threads()) : 0);
+    const int ok = hil_pca_axes_batch_ws(fields, count, k, warm_axes, max_iter, tol,
+                                         out_axes, out_means, out_variances, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_pca_axes_batch_kernel(
+    const hil_field_t *fields,
+    size_t count,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_means,
+    double *out_variances,
+    hil_workspace_t *ws
+) {
+    if (!fields || count == 0 || !out_axes || !ws) return 0;
+    const size_t d = fields[0].coordinates.cols;
+    for (size_t f = 0; f < count; f++) {
+        if (!hil_pca_valid(&fields[f], k) || fields[f].coordinates.cols != d) return 0;
+    }
+
+    hil_workspace_reset(ws);
+
+    int threads = 1;
+    #ifdef _OPENMP
+    threads = omp_get_max_threads();
+    #endif
+
+    /* Per-thread mean and iteration scratch, carved before the region. */
+    double *mean = (double*)hil_workspace_alloc(ws, sizeof(double) * d * (size_t)threads);
+    double *W = (double*)hil_workspace_alloc(ws, sizeof(double) * k * d * (size_t)threads);
+    double *T = (double*)hil_workspace_alloc(ws, sizeof(double) * k * d * (size_t)threads);
+    if (!mean || !W || !T) return 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(threads)
+    #endif
+    {
+        size_t t = 0;
+        #ifdef _OPENMP
+        t = (size_t)omp_get_thread_num();
+        #endif
+        double *t_mean = mean + t * d;
+        double *t_W = W + t * k * d;
+        double *t_T = T + t * k * d;
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 1)
+        #endif
+        for (long long ff = 0; ff < (long long)count; ff++) {
+            const size_t f = (size_t)ff;
+            hil_pca_solve(&fields[f].coordinates, k, warm_axes, max_iter, tol,
+                          t_mean, out_axes + f * k * d, t_W, t_T,
+                          out_variances ? out_variances + f * k : NULL);
+            if (out_means) memcpy(out_means + f * d, t_mean, sizeof(double) * d);
+        }
+    }
+
+    return 1;
+}
+
+int hil_pca_axes_batch_ws(
+    const hil_field_t *fields,
+    size_t count,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_means,
+    double *out_variances,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_pca_axes_batch_kernel(fields, count, k, warm_axes, max_iter, tol,
+                                             out_axes, out_means, out_variances, ws);
+#ifdef HIL_STATS
+    uint64_t rows = 0;
+    for (size_t i = 0; fields && i < count; i++) rows += hil_stat_rows(&fields[i]);
+    HIL_STATS_END(HIL_STAT_PCA_AXES_BATCH, t0, HIL_STAT_WS_BYTES(ws), rows);
+#else
+    HIL_STATS_END(HIL_STAT_PCA_AXES_BATCH, t0, 0, 0);
+#endif
+    return ok;
+}
+
+/*
+ * Procrustes distance for element i given the leave-one-out axes V (2 x d).
+ *
+ * b_r = (x_r - mean') . v with mean' the leave-one-out mean, i.e.
+ * (x_r - mean) . v + (y_i . v) / (n - 1); a_r is the baseline projection
+ * P0[r] re-centered over r != i. Both are Frobenius-normalised and the
+ * optimal orthogonal R minimising |A - B R| is found in closed form: a
+ * rotation maximises c (N00 + N11) + s (N10 - N01), a reflection
+ * c (N00 - N11) + s (N01 + N10), with N = B^T A.
+ */
+static double hil_procrustes_loo(
+    const hil_matrix_t *M,
+    const double *mean,
+    const double *P0,
+    const double *psum,
+    const double *V,
+    const double *yi,
+    size_t i,
+    double *B
+) {
+    const size_t n = M->rows;
+    const size_t d = M->cols;
+    const double dn1 = (double)(n - 1);
+
+    const double sh0 = hil_vec_dot(yi, V, d) / dn1;
+    const double sh1 = hil_vec_dot(yi, V + d, d) / dn1;
+    const double am0 = (psum[0] - P0[2 * i]) / dn1;
+    const double am1 = (psum[1] - P0[2 * i + 1]) / dn1;
+
+    double bm0 = 0.0, bm1 = 0.0;
+    for (size_t r = 0, q = 0; r < n; r++) {
+        if (r == i) continue;
+        const double *row = hil_matrix_row(M, r);
+        double p0 = 0.0, p1 = 0.0;
+        for (size_t c = 0; c < d; c++) {
+            const double y = row[c] - mean[c];
+            p0 += y * V[c];
+            p1 += y * V[d + c];
+        }
+        B[2 * q] = p0 + sh0;
+        B[2 * q + 1] = p1 + sh1;
+        bm0 += B[2 * q];
+        bm1 += B[2 * q + 1];
+        q++;
+    }
+    bm0 /= dn1;
+    bm1 /= dn1;
+
+    double na2 = 0.0, nb2 = 0.0;
+    double N00 = 0.0, N01 = 0.0, N10 = 0.0, N11 = 0.0;
+    for (size_t r = 0, q = 0; r < n; r++) {
+        if (r == i) continue;
+        const double a0 = P0[2 * r] - am0, a1 = P0[2 * r + 1] - am1;
+        const double b0 = (B[2 * q] -= bm0), b1 = (B[2 * q + 1] -= bm1);
+        na2 += a0 * a0 + a1 * a1;
+        nb2 += b0 * b0 + b1 * b1;
+        N00 += b0 * a0;  N01 += b0 * a1;
+        N10 += b1 * a0;  N11 += b1 * a1;
+        q++;
+    }
+
+    /* Degenerate but deterministic: no geometry to compare */
+    if (na2 == 0.0 || nb2 == 0.0) return 0.0;
+
+    const double rot_c = N00 + N11, rot_s = N10 - N01;
+    const double ref_c = N00 - N11, ref_s = N01 + N10;
+
+    double R00, R01, R10, R11;
+    if (hypot(rot_c, rot_s) >= hypot(ref_c, ref_s)) {
+        const double th = atan2(rot_s, rot_c);
+        R00 = cos(th);  R01 = -sin(th);
+        R10 = sin(th);  R11 = cos(th);
+    } else {
+        const double th = atan2(ref_s, ref_c);
+        R00 = cos(th);  R01 = sin(th);
+        R10 = sin(th);  R11 = -cos(th);
+    }
+
+    const double ia = 1.0 / sqrt(na2);
+    const double ib = 1.0 / sqrt(nb2);
+
+    double res = 0.0;
+    for (size_t r = 0, q = 0; r < n; r++) {
+        if (r == i) continue;
+        const double a0 = (P0[2 * r] - am0) * ia, a1 = (P0[2 * r + 1] - am1) * ia;
+        const double b0 = B[2 * q] * ib, b1 = B[2 * q + 1] * ib;
+        const double e0 = a0 - (b0 * R00 + b1 * R10);
+        const double e1 = a1 - (b0 * R01 + b1 * R11);
+        res += e0 * e0 + e1 * e1;
+        q++;
+    }
+    return sqrt(res);
+}
+
+/* Kernel scratch: mean, baseline axes and projections, the d x d scatter
+   when d <= n, and per-thread axes, iteration, y_i and projection rows. */
+static size_t hil_geometry_delta_loo_scratch(const hil_field_t *field) {
+    if (!field) return 0;
+    const size_t n = field->coordinates.rows;
+    const size_t d = field->coordinates.cols;
+    const size_t nt = hil_ws_threads();
+    return hil_ws_need(sizeof(double) * d)
+         + hil_ws_need(sizeof(double) * 2 * d)
+         + hil_ws_need(sizeof(double) * 2 * n)
+         + ((d <= n) ? hil_ws_need(sizeof(double) * d * d) : 0)
+         + 3 * hil_ws_need(sizeof(double) * 2 * d * nt)
+         + hil_ws_need(sizeof(double) * d * nt)
+         + hil_ws_need(sizeof(double) * 2 * n * nt);
+}
+
+int hil_geometry_delta_loo(
+    const hil_field_t *field,
+    size_t max_iter,
+    double tol,
+    double *out_delta
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_geometry_delta_loo_scratch(field));
+    const int ok = hil_geometry_delta_loo_ws(field, max_iter, tol, out_delta, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
+
+static int hil_geometry_delta_loo_kernel(
+    const hil_field_t *field,
+    size_t max_iter,
+    double tol,
+    double *out_delta,
+    hil_workspace_t *ws
+) {
+    if (!field || !out_delta || !ws) return 0;
+    const hil_matrix_t M = field->coordinates;
+    if (!M.data || M.rows < 3 || M.cols < 2) return 0;
+
+    const size_t n = M.rows;
+    const size_t d = M.cols;
+
+    hil_workspace_reset(ws);
+
+    int threads = 1;
+    #ifdef _OPENMP
+    threads = omp_get_max_threads();
+    #endif
+    const size_t nt = (size_t)threads;
+
+    double *mean = (double*)hil_workspace_alloc(ws, sizeof(double) * d);
+    double *V0 = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d);
+    double *P0 = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * n);
+    double *S = (d <= n) ? (double*)hil_workspace_alloc(ws, sizeof(double) * d * d) : NULL;
+
+    /* Per-thread axes, iteration scratch, y_i and projection rows. */
+    double *V = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d * nt);
+    double *W = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d * nt);
+    double *T = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d * nt);
+    double *Y = (double*)hil_workspace_alloc(ws, sizeof(double) * d * nt);
+    double *B = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * n * nt);
+
+    if (!mean || !V0 || !P0 || (d <= n && !S) || !V || !W || !T || !Y || !B) return 0;
+
+    hil_pca_mean(&M, mean);
+
+    /* Dense centered scatter, one output row per iteration (row-major
+       reads of the field; each row of S depends only on its index). */
+    if (S) {
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic, 16)
+        #endif
+        for (long long aa = 0; aa < (long long)d; aa++) {
+            const size_t a = (size_t)aa;
+            double *Sa = S + a * d;
+            hil_vec_zero(Sa, d);
+            for (size_t r = 0; r < n; r++) {
+                const double *row = hil_matrix_row(&M, r);
+                const double ya = row[a] - mean[a];
+                if (ya == 0.0) continue;
+                for (size_t b = 0; b < d; b++) Sa[b] += ya * (row[b] - mean[b]);
+            }
+        }
+    }
+
+    /* Baseline axes and projection */
+    double lambda[2];
+    const hil_pca_op_t base = { &M, mean, S, NULL, 0.0 };
+    hil_pca_seed_axes(V0, 2, d);
+    hil_pca_iterate(&base, 2, max_iter, tol, V0, W, T, lambda);
+
+    double psum[2] = { 0.0, 0.0 };
+    for (size_t r = 0; r < n; r++) {
+        const double *row = hil_matrix_row(&M, r);
+        double p0 = 0.0, p1 = 0.0;
+        for (size_t c = 0; c < d; c++) {
+            const double y = row[c] - mean[c];
+            p0 += y * V0[c];
+            p1 += y * V0[d + c];
+        }
+        P0[2 * r] = p0;
+        P0[2 * r + 1] = p1;
+        psum[0] += p0;
+        psum[1] += p1;
+    }
+
+    const double down_scale = (double)n / (double)(n - 1);
+
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(threads)
+    #endif
+    {
+        size_t t = 0;
+        #ifdef _OPENMP
+        t = (size_t)omp_get_thread_num();
+        #endif
+        double *t_V = V + t * 2 * d;
+        double *t_W = W + t * 2 * d;
+        double *t_T = T + t * 2 * d;
+        double *t_y = Y + t * d;
+        double *t_B = B + t * 2 * n;
+        double t_lambda[2];
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 16)
+        #endif
+        for (long long ii = 0; ii < (long long)n; ii++) {
+            const size_t i = (size_t)ii;
+            const double *xi = hil_matrix_row(&M, i);
+            for (size_t c = 0; c < d; c++) t_y[c] = xi[c] - mean[c];
+
+            /* Scatter without row i, about the leave-one-out mean. */
+            const hil_pca_op_t op = { &M, mean, S, t_y, down_scale };
+            memcpy(t_V, V0, sizeof(double) * 2 * d);
+            hil_pca_iterate(&op, 2, max_iter, tol, t_V, t_W, t_T, t_lambda);
+
+            out_delta[i] = hil_procrustes_loo(&M, mean, P0, psum, t_V, t_y, i, t_B);
+        }
+    }
+
+    return 1;
+}
+
+int hil_geometry_delta_loo_ws(
+    const hil_field_t *field,
+    size_t max_iter,
+    double tol,
+    double *out_delta,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_geometry_delta_loo_kernel(field, max_iter, tol, out_delta, ws);
+    HIL_STATS_END(HIL_STAT_GEOMETRY_DELTA_LOO, t0, HIL_STAT_WS_BYTES(ws), hil_stat_rows(field));
+    return ok;
+}
+
+/* ============================================================================
+ * Spectral Operators (Lanczos)
+ * ============================================================================
+ */
+
+#define HIL_SPECTRUM_ROW_BLOCK 4096   /* rows per partial sum of X^T s */
+#define HIL_SPECTRUM_CHUNK     512    /* coordinates per parallel block */
+#define HIL_SPECTRUM_BREAKDOWN 1e-12  /* residual / |A| treated as zero */
+
+/*
+ * Field operator v -> A v of hil_field_spectrum: Gram (mean == NULL) or
+ * covariance (column means, scaled by 1 / rows). t holds the intermediate
+ * X^T v or X v; part holds one cols-long partial sum per row block.
+ */
+typedef struct {
+    const hil_matrix_t *M;
+    const double       *mean;
+    double             *t;
+    double             *part;
+} hil_spectrum_op_state_t;
+
+/* out[r] = <x_r - mean, v> for every row (mean nullable). */
+static void hil_spectrum_rows_dot(
+    const hil_matrix_t *M,
+    const double *mean,
+    const double *v,
+    double *out
+) {
+    const size_t d = M->cols;
+    const hil_vec_dot_fn dot = hil_vec_dot_for(d);
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (long long rr = 0; rr < (long long)M->rows; rr++) {
+        const size_t r = (size_t)rr;
+        const double *row = hil_matrix_row(M, r);
+        if (!mean) {
+            out[r] = dot(row, v, d);
+        } else {
+            double t = 0.0;
+            for (size_t c = 0; c < d; c++) t += (row[c] - mean[c]) * v[c];
+            out[r] = t;
+        }
+    }
+}
+
+/* out[c] = sum_r (x_r[c] - mean[c]) s[r] (mean nullable). Rows are summed
+   in order within fixed row blocks and the block sums in block order, so
+   the result does not depend on the thread count. */
+static void hil_spectrum_cols_dot(
+    const hil_matrix_t *M,
+    const double *mean,
+    const double *s,
+    double *part,
+    double *out
+) {
+    const size_t n = M->rows;
+    const size_t d = M->cols;
+    const size_t blocks = (n + HIL_SPECTRUM_ROW_BLOCK - 1) / HIL_SPECTRUM_ROW_BLOCK;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (long long bb = 0; bb < (long long)blocks; bb++) {
+        const size_t r0 = (size_t)bb * HIL_SPECTRUM_ROW_BLOCK;
+        const size_t r1 = (r0 + HIL_SPECTRUM_ROW_BLOCK < n) ? r0 + HIL_SPECTRUM_ROW_BLOCK : n;
+        double *acc = part + (size_t)bb * d;
+
+        hil_vec_zero(acc, d);
+        for (size_t r = r0; r < r1; r++) {
+            const double *row = hil_matrix_row(M, r);
+            const double sr = s[r];
+            if (!mean) {
+                for (size_t c = 0; c < d; c++) acc[c] += row[c] * sr;
+            } else {
+                for (size_t c = 0; c < d; c++) acc[c] += (row[c] - mean[c]) * sr;
+            }
+        }
+    }
+
+    memcpy(out, part, sizeof(double) * d);
+    for (size_t b = 1; b < blocks; b++) hil_vec_add_inplace(out, part + b * d, d);
+}
+
+static void hil_spectrum_apply(const hil_spectrum_op_state_t *A, const double *v, double *out) {
+    if (!A->mean) {
+        /* G v = X (X^T v) */
+        hil_spectrum_cols_dot(A->M, NULL, v, A->part, A->t);
+        hil_spectrum_rows_dot(A->M, NULL, A->t, out);
+    } else {
+        /* C v = (X - mu)^T ((X - mu) v) / rows */
+        hil_spectrum_rows_dot(A->M, A->mean, v, A->t);
+        hil_spectrum_cols_dot(A->M, A->mean, A->t, A->part, out);
+        hil_vec_scale_inplace(out, A->M->cols, 1.0 / (double)A->M->rows);
+    }
+}
+
+/*
+ * w <- w - sum_{i < count} (v_i . w) v_i over the rows of V, applied twice
+ * (full reorthogonalisation); coef receives the summed coefficients, tmp is
+ * count-long scratch. Each coordinate is updated in ascending i.
+ */
+static void hil_spectrum_orthogonalize(
+    const double *V,
+    size_t count,
+    size_t N,
+    double *w,
+    double *coef,
+    double *tmp
+) {
+    const size_t blocks = (N + HIL_SPECTRUM_CHUNK - 1) / HIL_SPECTRUM_CHUNK;
+
+    hil_vec_zero(coef, count);
+    for (int pass = 0; pass < 2; pass++) {
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+        #endif
+        for (long long ii = 0; ii < (long long)count; ii++) {
+            tmp[ii] = hil_vec_dot(V + (size_t)ii * N, w, N);
+        }
+
+        #ifdef _OPENMP
+        #pragma omp parallel for schedule(static)
+        #endif
+        for (long long bb = 0; bb < (long long)blocks; bb++) {
+            const size_t c0 = (size_t)bb * HIL_SPECTRUM_CHUNK;
+            const size_t c1 = (c0 + HIL_SPECTRUM_CHUNK < N) ? c0 + HIL_SPECTRUM_CHUNK : N;
+            for (size_t i = 0; i < count; i++) {
+                const double t = tmp[i];
+                const double *vi = V + i * N;
+                for (size_t c = c0; c < c1; c++) w[c] -= t * vi[c];
+            }
+        }
+
+        for (size_t i = 0; i < count; i++) coef[i] += tmp[i];
+    }
+}
+
+/* Fixed-seed vector (splitmix64 stream draw), independent of the data. */
+static void hil_spectrum_seed_vector(double *v, size_t N, uint64_t draw) {
+    uint64_t s = 0x48494c5350454331ull ^ (draw * 0xD1B54A32D192ED03ull);
+    for (size_t c = 0; c < N; c++) {
+        s += 0x9E3779B97F4A7C15ull;
+        uint64_t z = s;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        z ^= z >> 31;
+        v[c] = (double)(z >> 11) * (1.0 / 9007199254740992.0) - 0.5;
+    }
+}
+
+/* Row count of V becomes a unit vector orthogonal to rows 0..count-1
+   (count < N), from successive fixed-seed draws. */
+static void hil_spectrum_fresh(
+    double *V,
+    size_t count,
+    size_t N,
+    uint64_t *draw,
+    double *coef,
+    double *tmp
+) {
+    double *v = V + count * N;
+    for (;;) {
+        hil_spectrum_seed_vector(v, N, (*draw)++);
+        const double n0 = hil_vec_norm(v, N);
+        hil_spectrum_orthogonalize(V, count, N, v, coef, tmp);
+        const double nv = hil_vec_norm(v, N);
+        if (nv > 1e-3 * n0) {
+            hil_vec_scale_inplace(v, N, 1.0 / nv);
+            return;
+        }
+    }
+}
+
+/*
+ * Ritz vectors out_i = sum_{a < m} Y[a][i] v_a for i < p. out may be V
+ * itself: each coordinate block is combined in the calling thread's
+ * p x HIL_SPECTRUM_CHUNK slice of buf before it is written back.
+ */
+static void hil_spectrum_ritz(
+    const double *V,
+    const double *Y,
+    size_t m,
+    size_t p,
+    size_t N,
+    double *buf,
+    double *out
+) {
+    const size_t blocks = (N + HIL_SPECTRUM_CHUNK - 1) / HIL_SPECTRUM_CHUNK;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (long long bb = 0; bb < (long long)blocks; bb++) {
+        size_t th = 0;
+        #ifdef _OPENMP
+        th = (size_t)omp_get_thread_num();
+        #endif
+        double *tb = buf + th * p * HIL_SPECTRUM_CHUNK;
+        const size_t c0 = (size_t)bb * HIL_SPECTRUM_CHUNK;
+        const size_t len = (c0 + HIL_SPECTRUM_CHUNK < N) ? HIL_SPECTRUM_CHUNK : N - c0;
+
+        for (size_t i = 0; i < p; i++) {
+            double *o = tb + i * HIL_SPECTRUM_CHUNK;
+            hil_vec_zero(o, len);
+            for (size_t a = 0; a < m; a++) {
+                const double y = Y[a * m + i];
+                const double *va = V + a * N + c0;
+                for (size_t c = 0; c < len; c++) o[c] += y * va[c];
+            }
+        }
+        for (size_t i = 0; i < p; i++) {
+            memcpy(out + i * N + c0, tb + i * HIL_SPECTRUM_CHUNK, sizeof(double) * len);
+        }
+    }
+}
 
-#include <stdlib.h>   /* malloc, free */
-#include <string.h>   /* memcpy */
-#include <math.h>     /* sqrt, log */
+/* Krylov basis size: ncv, else max(2k + 1, k + 16), capped at N. */
+static size_t hil_spectrum_basis(size_t k, size_t ncv, size_t N) {
+    size_t m = ncv ? ncv : ((2 * k + 1 > k + 16) ? 2 * k + 1 : k + 16);
+    if (m > N) m = N;
+    return m;
+}
+
+/* Kernel scratch for arguments the kernel accepts, else 0: the basis,
+   three m x m matrices, Ritz and chunk buffers, and the partial sums. */
+static size_t hil_field_spectrum_scratch(
+    const hil_field_t *field,
+    hil_spectrum_op_t op,
+    size_t k,
+    size_t ncv
+) {
+    if (!field || (op != HIL_SPECTRUM_GRAM && op != HIL_SPECTRUM_COVARIANCE)) return 0;
+    const hil_matrix_t *M = &field->coordinates;
+    const size_t N = (op == HIL_SPECTRUM_GRAM) ? M->rows : M->cols;
+    if (k < 1 || k > N) return 0;
+
+    const size_t m = hil_spectrum_basis(k, ncv, N);
+    const size_t keep = k + (m - k) / 2;
+    const size_t ritz = (keep > k) ? keep : k;
+    const size_t blocks = (M->rows + HIL_SPECTRUM_ROW_BLOCK - 1) / HIL_SPECTRUM_ROW_BLOCK;
+    return hil_ws_need(sizeof(double) * (m + 1) * N)
+         + 3 * hil_ws_need(sizeof(double) * m * m)
+         + hil_ws_need(sizeof(double) * m)
+         + 2 * hil_ws_need(sizeof(double) * (m + 1))
+         + hil_ws_need(sizeof(double) * ritz * HIL_SPECTRUM_CHUNK * hil_ws_threads())
+         + hil_ws_need(sizeof(double) * ((op == HIL_SPECTRUM_GRAM) ? M->cols : M->rows))
+         + hil_ws_need(sizeof(double) * blocks * M->cols)
+         + ((op == HIL_SPECTRUM_COVARIANCE) ? hil_ws_need(sizeof(double) * M->cols) : 0);
+}
+
+static int hil_field_spectrum_kernel(
+    const hil_field_t *field,
+    hil_spectrum_op_t op,
+    size_t k,
+    size_t ncv,
+    size_t max_restarts,
+    double tol,
+    const double *start,
+    double *out_values,
+    double *out_vectors,
+    hil_spectrum_info_t *out_info,
+    hil_workspace_t *ws
+) {
+    if (!field || !out_values || !ws) return 0;
+    if (op != HIL_SPECTRUM_GRAM && op != HIL_SPECTRUM_COVARIANCE) return 0;
+    const hil_matrix_t *M = &field->coordinates;
+    if (!M->data || M->rows == 0 || M->cols == 0) return 0;
+    if (!(tol >= 0.0)) return 0;
+
+    const size_t N = (op == HIL_SPECTRUM_GRAM) ? M->rows : M->cols;
+    if (k < 1 || k > N) return 0;
+    if (ncv != 0 && ncv <= k && k < N) return 0;
+
+    const size_t m = hil_spectrum_basis(k, ncv, N);
+    const size_t keep = k + (m - k) / 2;
+
+    int threads = 1;
+    #ifdef _OPENMP
+    threads = omp_get_max_threads();
+    #endif
+    const size_t blocks = (M->rows + HIL_SPECTRUM_ROW_BLOCK - 1) / HIL_SPECTRUM_ROW_BLOCK;
+    const size_t ritz = (keep > k) ? keep : k;
+
+    hil_workspace_reset(ws);
+    double *V = (double*)hil_workspace_alloc(ws, sizeof(double) * (m + 1) * N);
+    double *H = (double*)hil_workspace_alloc(ws, sizeof(double) * m * m);
+    double *S = (double*)hil_workspace_alloc(ws, sizeof(double) * m * m);
+    double *Y = (double*)hil_workspace_alloc(ws, sizeof(double) * m * m);
+    double *theta = (double*)hil_workspace_alloc(ws, sizeof(double) * m);
+    double *coef = (double*)hil_workspace_alloc(ws, sizeof(double) * (m + 1));
+    double *tmp = (double*)hil_workspace_alloc(ws, sizeof(double) * (m + 1));
+    double *buf = (double*)hil_workspace_alloc(
+        ws, sizeof(double) * ritz * HIL_SPECTRUM_CHUNK * (size_t)threads);
+    double *t = (double*)hil_workspace_alloc(
+        ws, sizeof(double) * ((op == HIL_SPECTRUM_GRAM) ? M->cols : M->rows));
+    double *part = (double*)hil_workspace_alloc(ws, sizeof(double) * blocks * M->cols);
+    double *mean = (op == HIL_SPECTRUM_COVARIANCE)
+                 ? (double*)hil_workspace_alloc(ws, sizeof(double) * M->cols) : NULL;
+    if (!V || !H || !S || !Y || !theta || !coef || !tmp || !buf || !t || !part) return 0;
+    if (op == HIL_SPECTRUM_COVARIANCE && !mean) return 0;
+
+    if (mean) hil_pca_mean(M, mean);
+    const hil_spectrum_op_state_t A = { M, mean, t, part };
+
+    /* Start vector */
+    uint64_t draw = 0;
+    if (start) {
+        memcpy(V, start, sizeof(double) * N);
+    } else {
+        hil_spectrum_seed_vector(V, N, draw++);
+    }
+    const double n0 = hil_vec_norm(V, N);
+    if (!(n0 > 0.0) || !isfinite(n0)) return 0;
+    hil_vec_scale_inplace(V, N, 1.0 / n0);
+
+    hil_vec_zero(H, m * m);
+    size_t j = 0, matvecs = 0, sweeps = 0, converged = 0;
+    double beta = 0.0, anorm = 0.0;
+
+    for (;;) {
+        /* Expand the basis to m vectors; column j of H is V^T A v_j. */
+        for (; j < m; j++) {
+            double *w = V + (j + 1) * N;
+            hil_spectrum_apply(&A, V + j * N, w);
+            matvecs++;
+
+            hil_spectrum_orthogonalize(V, j + 1, N, w, coef, tmp);
+            for (size_t i = 0; i <= j; i++) {
+                H[i * m + j] = coef[i];
+                H[j * m + i] = coef[i];
+            }
+
+            beta = hil_vec_norm(w, N);
+            anorm = fmax(anorm, fmax(fabs(coef[j]), beta));
+            if (beta > HIL_SPECTRUM_BREAKDOWN * anorm) {
+                hil_vec_scale_inplace(w, N, 1.0 / beta);
+                continue;
+            }
+
+            /* Invariant subspace: the residual is zero; continue from a
+               fresh direction orthogonal to the basis. */
+            beta = 0.0;
+            if (j + 1 < m) hil_spectrum_fresh(V, j + 1, N, &draw, coef, tmp);
+        }
+
+        /* Rayleigh-Ritz on the projected matrix; the residual of Ritz pair
+           i is |beta * Y[m - 1][i]|. */
+        memcpy(S, H, sizeof(double) * m * m);
+        hil_sym_eigen_small(S, m, theta, Y);
+
+        const double scale = fabs(theta[0]);
+        converged = 0;
+        while (converged < k && fabs(beta * Y[(m - 1) * m + converged]) <= tol * scale) {
+            converged++;
+        }
+        if (converged == k || keep >= m || sweeps + 1 >= max_restarts) break;
+
+        /* Thick restart: keep the leading Ritz vectors, then the residual. */
+        hil_spectrum_ritz(V, Y, m, keep, N, buf, V);
+        memmove(V + keep * N, V + m * N, sizeof(double) * N);
+        hil_vec_zero(H, m * m);
+        for (size_t i = 0; i < keep; i++) H[i * m + i] = theta[i];
+        j = keep;
+        sweeps++;
+    }
+
+    memcpy(out_values, theta, sizeof(double) * k);
+    if (out_vectors) {
+        hil_spectrum_ritz(V, Y, m, k, N, buf, out_vectors);
+        hil_pca_fix_signs(out_vectors, k, N);
+    }
+    if (out_info) {
+        out_info->matvecs = matvecs;
+        out_info->restarts = sweeps;
+        out_info->converged = converged;
+    }
+    return 1;
+}
 
+int hil_field_spectrum(
+    const hil_field_t *field,
+    hil_spectrum_op_t op,
+    size_t k,
+    size_t ncv,
+    size_t max_restarts,
+    double tol,
+    const double *start,
+    double *out_values,
+    double *out_vectors,
+    hil_spectrum_info_t *out_info
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_field_spectrum_scratch(field, op, k, ncv));
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_field_spectrum_kernel(field, op, k, ncv, max_restarts, tol, start,
+                                             out_values, out_vectors, out_info, &ws);
+    HIL_STATS_END(HIL_STAT_FIELD_SPECTRUM, t0, ws.requested, hil_stat_rows(field));
+    hil_workspace_free(&ws);
+    return ok;
+}
 
 /* ============================================================================
- * Graph Integrity & Basic Structure
+ * Snapshot Batches (Time Series)
  * ============================================================================
  */
 
-int hil_graph_validate(const hil_graph_t *graph) {
-    if (!graph) return 0;
-    if (graph->num_nodes == 0) return 0;
+int hil_field_summary_batch(
+    const hil_field_t *fields,
+    size_t count,
+    hil_field_summary_t *out,
+    double *out_centroids
+) {
+    /* Per-thread centroid / u scratch for min(threads, count) threads. */
+    size_t threads = hil_ws_threads();
+    if (threads > count) threads = count;
+    const size_t d = (fields && count) ? fields[0].coordinates.cols : 0;
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, d ? hil_ws_need(sizeof(double) * 2 * d * threads) : 0);
+    const int ok = hil_field_summary_batch_ws(fields, count, out, out_centroids, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
 
-    /* Edge arrays can be NULL if num_edges == 0 */
-    if (graph->num_edges > 0) {
-        if (!graph->src || !graph->dst || !graph->weight) return 0;
+static int hil_field_summary_batch_kernel(
+    const hil_field_t *fields,
+    size_t count,
+    hil_field_summary_t *out,
+    double *out_centroids,
+    hil_workspace_t *ws
+) {
+    if (!fields || count == 0 || !out || !ws) return 0;
+    const size_t d = fields[0].coordinates.cols;
+    if (d == 0) return 0;
+    for (size_t t = 0; t < count; t++) {
+        const hil_matrix_t *M = &fields[t].coordinates;
+        if (!M->data || M->rows == 0 || M->cols != d) return 0;
     }
 
-    /* Validate indices and finite weights */
-    for (size_t e = 0; e < graph->num_edges; e++) {
-        uint32_t s = graph->src[e];
-        uint32_t d = graph->dst[e];
-        if ((size_t)s >= graph->num_nodes) return 0;
-        if ((size_t)d >= graph->num_nodes) return 0;
-
-        double w = graph->weight[e];
-        /* weights must be finite and non-negative for structural metrics */
-        if (!isfinite(w)) return 0;
-        if (w < 0.0) return 0;
+    hil_workspace_reset(ws);
+
+    int threads = 1;
+    #ifdef _OPENMP
+    threads = omp_get_max_threads();
+    if ((size_t)threads > count) threads = (int)count;
+    #endif
+
+    /* Per-thread centroid / u scratch, carved before the region. */
+    double *scratch = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * d * (size_t)threads);
+    if (!scratch) return 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(threads)
+    #endif
+    {
+        size_t th = 0;
+        #ifdef _OPENMP
+        th = (size_t)omp_get_thread_num();
+        #endif
+        double *t_scratch = scratch + th * 2 * d;
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(dynamic, 16)
+        #endif
+        for (long long tt = 0; tt < (long long)count; tt++) {
+            const size_t t = (size_t)tt;
+            hil_field_summary_rows(&fields[t].coordinates, &out[t], NULL, t_scratch);
+            if (out_centroids) memcpy(out_centroids + t * d, t_scratch, sizeof(double) * d);
+        }
     }
 
     return 1;
 }
 
-void hil_graph_degree(const hil_graph_t *graph, double *out_degree) {
-    if (!graph || !out_degree) return;
-    const size_t n = graph->num_nodes;
-
-    for (size_t i = 0; i < n; i++) out_degree[i] = 0.0;
-
-    for (size_t e = 0; e < graph->num_edges; e++) {
-        const uint32_t s = graph->src[e];
-        const uint32_t d = graph->dst[e];
-        const double   w = graph->weight[e];
+int hil_field_summary_batch_ws(
+    const hil_field_t *fields,
+    size_t count,
+    hil_field_summary_t *out,
+    double *out_centroids,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_field_summary_batch_kernel(fields, count, out, out_centroids, ws);
+#ifdef HIL_STATS
+    uint64_t rows = 0;
+    for (size_t i = 0; fields && i < count; i++) rows += hil_stat_rows(&fields[i]);
+    HIL_STATS_END(HIL_STAT_FIELD_SUMMARY_BATCH, t0, HIL_STAT_WS_BYTES(ws), rows);
+#else
+    HIL_STATS_END(HIL_STAT_FIELD_SUMMARY_BATCH, t0, 0, 0);
+#endif
+    return ok;
+}
 
-        /* Weighted degree accumulation */
-        out_degree[s] += w;
-        out_degree[d] += w;
+/* Dispersion of one group x k block about its mean (mean: k scratch). */
+static double hil_block_dispersion(
+    const double *block,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *mean
+) {
+    hil_vec_zero(mean, k);
+    for (size_t g = 0; g < group; g++) hil_vec_add_inplace(mean, block + g * k, k);
+    hil_vec_scale_inplace(mean, k, 1.0 / (double)group);
+
+    double disp = 0.0;
+    for (size_t g = 0; g < group; g++) {
+        const double *x = block + g * k;
+        double v = 0.0;
+        if (norm == HIL_NORM_L2) {
+            for (size_t j = 0; j < k; j++) {
+                const double diff = x[j] - mean[j];
+                v += diff * diff;
+            }
+            v = sqrt(v);
+        } else {
+            for (size_t j = 0; j < k; j++) {
+                const double diff = fabs(x[j] - mean[j]);
+                if (diff > v) v = diff;
+            }
+        }
+        if (v > disp) disp = v;
     }
+    return disp;
 }
 
-/* ============================================================================
- * Structural Diagnostics (Graph-Theoretic)
- * ============================================================================
- */
+int hil_macrostate_dispersion_batch(
+    const double *stack,
+    size_t count,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *out_dispersion
+) {
+    /* Per-thread k-sized mean for min(threads, count) threads. */
+    size_t threads = hil_ws_threads();
+    if (threads > count) threads = count ? count : 1;
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, (stack && group > 1 && k)
+                                ? hil_ws_need(sizeof(double) * k * threads) : 0);
+    const int ok = hil_macrostate_dispersion_batch_ws(stack, count, group, k, norm,
+                                                      out_dispersion, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
 
-double hil_graph_density(const hil_graph_t *graph) {
-    if (!graph) return 0.0;
-    const double n = (double)graph->num_nodes;
+static int hil_macrostate_dispersion_batch_kernel(
+    const double *stack,
+    size_t count,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *out_dispersion,
+    hil_workspace_t *ws
+) {
+    if (!out_dispersion || !ws) return 0;
+    if (norm != HIL_NORM_L2 && norm != HIL_NORM_LINF) return 0;
+    if (group <= 1) {
+        hil_vec_zero(out_dispersion, count);
+        return 1;
+    }
+    if (!stack || k == 0) return 0;
+
+    hil_workspace_reset(ws);
+
+    int threads = 1;
+    #ifdef _OPENMP
+    threads = omp_get_max_threads();
+    if ((size_t)threads > count) threads = count ? (int)count : 1;
+    #endif
+
+    double *mean = (double*)hil_workspace_alloc(ws, sizeof(double) * k * (size_t)threads);
+    if (!mean) return 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel num_threads(threads)
+    #endif
+    {
+        size_t th = 0;
+        #ifdef _OPENMP
+        th = (size_t)omp_get_thread_num();
+        #endif
+        double *t_mean = mean + th * k;
+
+        #ifdef _OPENMP
+        #pragma omp for schedule(static)
+        #endif
+        for (long long tt = 0; tt < (long long)count; tt++) {
+            const size_t t = (size_t)tt;
+            out_dispersion[t] = hil_block_dispersion(stack + t * group * k, group, k, norm, t_mean);
+        }
+    }
 
-    if (n <= 1.0) return 0.0;
+    return 1;
+}
 
-    /* For a simple undirected graph, max edges = n*(n-1)/2.
-       We do not enforce simple-graph constraints; this is a structural proxy. */
-    const double max_e = (n * (n - 1.0)) / 2.0;
-    const double e = (double)graph->num_edges;
+int hil_macrostate_dispersion_batch_ws(
+    const double *stack,
+    size_t count,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *out_dispersion,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_macrostate_dispersion_batch_kernel(stack, count, group, k, norm,
+                                                          out_dispersion, ws);
+    HIL_STATS_END(HIL_STAT_MACROSTATE_DISPERSION_BATCH, t0, HIL_STAT_WS_BYTES(ws),
+                  (uint64_t)count * group);
+    return ok;
+}
 
-    if (max_e <= 0.0) return 0.0;
-    double d = e / max_e;
+static double hil_fiber_entropy_row(const double *x, size_t k) {
+    double sum = 0.0;
+    for (size_t j = 0; j < k; j++) sum += fabs(x[j]);
+    if (sum <= HIL_EPS) return 0.0;
 
-    if (d < 0.0) d = 0.0;
-    if (d > 1.0) d = 1.0;
-    return d;
+    double H = 0.0;
+    for (size_t j = 0; j < k; j++) {
+        const double p = fabs(x[j]) / sum;
+        if (p > HIL_EPS) H -= p * hil_safe_log(p);
+    }
+    return H;
 }
 
-double hil_graph_entropy(const hil_graph_t *graph) {
-    if (!graph) return 0.0;
-    if (graph->num_nodes == 0) return 0.0;
+static int hil_fiber_entropy_batch_kernel(const hil_field_t *sigmas, double *out_entropy) {
+    if (!sigmas || !out_entropy) return 0;
+    const hil_matrix_t M = sigmas->coordinates;
+    if (M.rows > 0 && (!M.data || M.cols == 0)) return 0;
+
+    #ifdef _OPENMP
+    #pragma omp parallel for schedule(static)
+    #endif
+    for (long long rr = 0; rr < (long long)M.rows; rr++) {
+        const size_t r = (size_t)rr;
+        out_entropy[r] = hil_fiber_entropy_row(hil_matrix_row(&M, r), M.cols);
+    }
+    return 1;
+}
 
-    /* Structural entropy computed over weighted degree distribution:
-       p_i = deg_i / sum(deg), H = -sum p_i log p_i
-       This is purely structural (no semantics). */
+int hil_fiber_entropy_batch(const hil_field_t *sigmas, double *out_entropy) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_fiber_entropy_batch_kernel(sigmas, out_entropy);
+    HIL_STATS_END(HIL_STAT_FIBER_ENTROPY_BATCH, t0, 0, hil_stat_rows(sigmas));
+    return ok;
+}
 
-    double *deg = (double*)malloc(sizeof(double) * graph->num_nodes);
-    if (!deg) return 0.0;
+/* ============================================================================
+ * Mixed Precision (float32 Storage)
+ * ============================================================================
+ *
+ * Graph kernels borrow the topology of a float32 graph as a hil_graph_t view
+ * (weight NULL) and hand the float weights to the shared bodies above, so
+ * each algorithm keeps a single implementation. Field kernels widen rows
+ * through hil_vec_*_f32, which match the double helpers on widened data.
+ */
 
-    hil_graph_degree(graph, deg);
+static hil_graph_t hil_graph_f32_topology(const hil_graph_f32_t *graph) {
+    hil_graph_t t;
+    t.num_nodes = graph->num_nodes;
+    t.num_edges = graph->num_edges;
+    t.src = graph->src;
+    t.dst = graph->dst;
+    t.weight = NULL;
+    return t;
+}
 
-    double sum_deg = 0.0;
-    for (size_t i = 0; i < graph->num_nodes; i++) sum_deg += deg[i];
+int hil_graph_validate_f32(const hil_graph_f32_t *graph) {
+    if (!graph) return 0;
+    if (graph->num_nodes == 0) return 0;
 
-    if (sum_deg <= HIL_EPS) {
-        free(deg);
-        return 0.0;
+    if (graph->num_edges > 0) {
+        if (!graph->src || !graph->dst || !graph->weight) return 0;
     }
 
-    double H = 0.0;
-    for (size_t i = 0; i < graph->num_nodes; i++) {
-        double p = deg[i] / sum_deg;
-        if (p > HIL_EPS) {
-            H -= p * hil_safe_log(p);
-        }
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        if ((size_t)graph->src[e] >= graph->num_nodes) return 0;
+        if ((size_t)graph->dst[e] >= graph->num_nodes) return 0;
+
+        const float w = graph->weight[e];
+        if (!isfinite(w)) return 0;
+        if (w < 0.0f) return 0;
     }
 
-    free(deg);
-    return H;
+    return 1;
 }
 
-size_t hil_graph_connected_components(const hil_graph_t *graph) {
-    if (!graph) return 0;
+/* hil_graph_degree over float32 weights. */
+static void hil_graph_degree_f32(const hil_graph_f32_t *graph, double *out_degree) {
     const size_t n = graph->num_nodes;
-    const size_t m = graph->num_edges;
-    if (n == 0) return 0;
 
-    /* Build adjacency lists (undirected) */
-    size_t *deg = (size_t*)calloc(n, sizeof(size_t));
-    if (!deg) return 0;
+    for (size_t i = 0; i < n; i++) out_degree[i] = 0.0;
 
-    for (size_t e = 0; e < m; e++) {
-        uint32_t s = graph->src[e], d = graph->dst[e];
-        if ((size_t)s < n && (size_t)d < n) {
-            deg[s]++; deg[d]++;
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        const double w = (double)graph->weight[e];
+        out_degree[graph->src[e]] += w;
+        out_degree[graph->dst[e]] += w;
+    }
+}
+
+/* hil_normalized_rows of the widened rows of M; still a double copy, since
+   the Gram sweep accumulates in double. Caller frees. */
+static double *hil_normalized_rows_f32(const hil_matrix_f32_t *M) {
+    const size_t n = M->rows;
+    const size_t d = M->cols;
+
+    double *V = (double*)malloc(sizeof(double) * n * d);
+    if (!V) return NULL;
+
+    const hil_vec_dot_f32_fn dot = hil_vec_dot_f32_for(d);
+    for (size_t r = 0; r < n; r++) {
+        const float *row = hil_matrix_f32_row(M, r);
+        double *vr = V + (r * d);
+        double nrm = sqrt(dot(row, row, d));
+        if (nrm == 0.0) nrm = 1.0;
+        for (size_t c = 0; c < d; c++) vr[c] = (double)row[c] / nrm;
+    }
+
+    return V;
+}
+
+/* Move a double CSR into float32 storage, rounding the weights; consumes
+   src either way. */
+static int hil_csr_narrow(hil_graph_csr_t *src, hil_graph_csr_f32_t *dst) {
+    float *w = NULL;
+    if (src->num_edges > 0) {
+        w = (float*)malloc(sizeof(float) * src->num_edges);
+        if (!w) {
+            hil_graph_csr_free(src);
+            return 0;
         }
+        for (size_t e = 0; e < src->num_edges; e++) w[e] = (float)src->weight[e];
     }
 
-    size_t *offset = (size_t*)malloc(sizeof(size_t) * (n + 1));
-    if (!offset) { free(deg); return 0; }
+    dst->num_nodes = src->num_nodes;
+    dst->num_edges = src->num_edges;
+    dst->symmetric = src->symmetric;
+    dst->offsets = src->offsets;
+    dst->indices = src->indices;
+    dst->weight = w;
 
-    offset[0] = 0;
-    for (size_t i = 0; i < n; i++) offset[i + 1] = offset[i] + deg[i];
+    free(src->weight);
+    memset(src, 0, sizeof(*src));
+    return 1;
+}
 
-    uint32_t *adj = (uint32_t*)malloc(sizeof(uint32_t) * offset[n]);
-    if (!adj) { free(offset); free(deg); return 0; }
+static int hil_graph_build_cosine_f32_kernel(
+    const hil_field_f32_t *field,
+    hil_graph_f32_t *out_graph
+) {
+    if (!field || !out_graph) return 0;
+    const hil_matrix_f32_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
 
-    /* temp counters */
-    size_t *cur = (size_t*)calloc(n, sizeof(size_t));
-    if (!cur) { free(adj); free(offset); free(deg); return 0; }
+    const size_t n = M.rows;
+    const size_t d = M.cols;
+    if (n > (size_t)UINT32_MAX) return 0;
 
-    for (size_t e = 0; e < m; e++) {
-        uint32_t s = graph->src[e], d = graph->dst[e];
-        if ((size_t)s < n && (size_t)d < n) {
-            adj[offset[s] + cur[s]++] = d;
-            adj[offset[d] + cur[d]++] = s;
-        }
-    }
+    const size_t m = (n * (n - 1)) / 2;
+    if (out_graph->num_edges != m) return 0;
+    if (m > 0 && (!out_graph->src || !out_graph->dst || !out_graph->weight)) return 0;
 
-    free(cur);
+    out_graph->num_nodes = n;
+    if (m == 0) return 1;
 
-    /* BFS over components */
-    uint8_t *seen = (uint8_t*)calloc(n, sizeof(uint8_t));
-    uint32_t *queue = (uint32_t*)malloc(sizeof(uint32_t) * n);
-    if (!seen || !queue) {
-        free(queue); free(seen); free(adj); free(offset); free(deg);
-        return 0;
-    }
+    double *V = hil_normalized_rows_f32(&M);
+    if (!V) return 0;
 
-    size_t comps = 0;
+    hil_cosine_sweep(V, n, d, out_graph->src, out_graph->dst, NULL, out_graph->weight);
 
-    for (size_t i = 0; i < n; i++) {
-        if (seen[i]) continue;
-
-        comps++;
-        /* BFS from i */
-        size_t qh = 0, qt = 0;
-        queue[qt++] = (uint32_t)i;
-        seen[i] = 1;
-
-        while (qh < qt) {
-            uint32_t v = queue[qh++];
-            for (size_t k = offset[v]; k < offset[v + 1]; k++) {
-                uint32_t u = adj[k];
-                if (!seen[u]) {
-                    seen[u] = 1;
-                    queue[qt++] = u;
-                }
-            }
-        }
-    }
+    free(V);
+    return 1;
+}
 
-    free(queue);
-    free(seen);
-    free(adj);
-    free(offset);
-    free(deg);
+int hil_graph_build_cosine_f32(const hil_field_f32_t *field, hil_graph_f32_t *out_graph) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_cosine_f32_kernel(field, out_graph);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_COSINE_F32, t0,
+                  (ok ? hil_stat_rows_f32(field) * field->coordinates.cols * sizeof(double)
+                      + out_graph->num_edges * (2 * sizeof(uint32_t) + sizeof(float)) : 0),
+                  (ok ? out_graph->num_edges : 0));
+    return ok;
+}
 
-    return comps;
+static int hil_graph_build_knn_csr_f32_kernel(
+    const hil_field_f32_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_f32_t *out_csr
+) {
+    if (!field || !out_csr) return 0;
+    const hil_matrix_f32_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+    if (M.rows > (size_t)UINT32_MAX) return 0;
+
+    double *V = hil_normalized_rows_f32(&M);
+    if (!V) return 0;
+
+    /* Selection runs on the double weights (so ties resolve exactly as in
+       the double builder); they are held only until narrowed. */
+    hil_graph_csr_t wide;
+    const int ok = hil_knn_csr_from_rows(V, M.rows, M.cols, k, min_weight, &wide);
+    free(V);
+    if (!ok) return 0;
+    return hil_csr_narrow(&wide, out_csr);
 }
 
-/* ============================================================================
- * Field Diagnostics (Geometric)
- * ============================================================================
- */
+int hil_graph_build_knn_csr_f32(
+    const hil_field_f32_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_f32_t *out_csr
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_knn_csr_f32_kernel(field, k, min_weight, out_csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_KNN_CSR_F32, t0,
+                  (ok ? hil_stat_rows_f32(field) * field->coordinates.cols * sizeof(double)
+                      + hil_stat_csr_f32_bytes(out_csr) : 0),
+                  (ok ? out_csr->num_edges : 0));
+    return ok;
+}
 
-double hil_field_mean_norm(const hil_field_t *field) {
-    if (!field) return 0.0;
-    const hil_matrix_t M = field->coordinates;
-    if (!M.data || M.rows == 0 || M.cols == 0) return 0.0;
+static int hil_graph_build_csr_f32_kernel(
+    const hil_graph_f32_t *graph,
+    hil_graph_csr_f32_t *out_csr
+) {
+    if (!graph || !out_csr) return 0;
+
+    const hil_graph_t topo = hil_graph_f32_topology(graph);
+    hil_graph_csr_t view;
+    float *w = NULL;
+    if (!hil_graph_build_csr_body(&topo, graph->weight, &view, &w)) return 0;
+
+    out_csr->num_nodes = view.num_nodes;
+    out_csr->num_edges = view.num_edges;
+    out_csr->symmetric = view.symmetric;
+    out_csr->offsets = view.offsets;
+    out_csr->indices = view.indices;
+    out_csr->weight = w;
+    return 1;
+}
 
-    double sum = 0.0;
-    for (size_t r = 0; r < M.rows; r++) {
-        const double *row = M.data + (r * M.cols);
-        sum += hil_vec_norm(row, M.cols);
-    }
+int hil_graph_build_csr_f32(const hil_graph_f32_t *graph, hil_graph_csr_f32_t *out_csr) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_build_csr_f32_kernel(graph, out_csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_BUILD_CSR_F32, t0, (ok ? hil_stat_csr_f32_bytes(out_csr) : 0),
+                  (graph ? graph->num_edges : 0));
+    return ok;
+}
 
-    return sum / (double)M.rows;
+double hil_graph_entropy_f32(const hil_graph_f32_t *graph) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, graph ? hil_ws_need(sizeof(double) * graph->num_nodes) : 0);
+    const double H = hil_graph_entropy_f32_ws(graph, &ws);
+    hil_workspace_free(&ws);
+    return H;
 }
 
-double hil_field_coherence(const hil_field_t *field) {
-    if (!field) return 0.0;
-    const hil_matrix_t M = field->coordinates;
-    if (!M.data || M.rows == 0 || M.cols == 0) return 0.0;
+static double hil_graph_entropy_f32_kernel(const hil_graph_f32_t *graph, hil_workspace_t *ws) {
+    if (!graph || !ws) return 0.0;
+    if (graph->num_nodes == 0) return 0.0;
+    hil_workspace_reset(ws);
 
-    /* Coherence proxy: mean cosine similarity to centroid.
-       Purely geometric; no semantics. */
+    double *deg = (double*)hil_workspace_alloc(ws, sizeof(double) * graph->num_nodes);
+    if (!deg) return 0.0;
 
-    double *centroid = (double*)malloc(sizeof(double) * M.cols);
-    if (!centroid) return 0.0;
+    hil_graph_degree_f32(graph, deg);
+    return hil_degree_entropy(deg, graph->num_nodes, NULL);
+}
 
-    hil_vec_zero(centroid, M.cols);
+double hil_graph_entropy_f32_ws(const hil_graph_f32_t *graph, hil_workspace_t *ws) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double H = hil_graph_entropy_f32_kernel(graph, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_ENTROPY_F32, t0, HIL_STAT_WS_BYTES(ws),
+                  (graph ? graph->num_edges : 0));
+    return H;
+}
 
-    for (size_t r = 0; r < M.rows; r++) {
-        const double *row = M.data + (r * M.cols);
-        hil_vec_add_inplace(centroid, row, M.cols);
+double hil_graph_out_entropy_f32(const hil_graph_f32_t *graph) {
+    if (!graph || graph->num_nodes == 0) return 0.0;
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const size_t n = graph->num_nodes;
+
+    double *strength = (double*)calloc(n, sizeof(double));
+    if (!strength) return 0.0;
+
+    for (size_t e = 0; e < graph->num_edges; e++) {
+        strength[graph->src[e]] += (double)graph->weight[e];
     }
 
-    hil_vec_scale_inplace(centroid, M.cols, 1.0 / (double)M.rows);
+    const double H = hil_degree_entropy(strength, n, NULL);
+    free(strength);
+    HIL_STATS_END(HIL_STAT_GRAPH_OUT_ENTROPY_F32, t0, (uint64_t)n * sizeof(double),
+                  graph->num_edges);
+    return H;
+}
 
-    const double c_norm = hil_clamp_min(hil_vec_norm(centroid, M.cols), HIL_EPS);
+int hil_graph_metrics_f32(
+    const hil_graph_f32_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, hil_graph_metrics_scratch(graph ? graph->num_nodes : 0, out_degree));
+    const int ok = hil_graph_metrics_f32_ws(graph, out, out_degree, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
 
-    double sum_cos = 0.0;
-    for (size_t r = 0; r < M.rows; r++) {
-        const double *row = M.data + (r * M.cols);
-        const double r_norm = hil_clamp_min(hil_vec_norm(row, M.cols), HIL_EPS);
-        const double dot = hil_vec_dot(row, centroid, M.cols);
-        sum_cos += dot / (r_norm * c_norm);
-    }
+static int hil_graph_metrics_f32_kernel(
+    const hil_graph_f32_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+) {
+    if (!graph) return 0;
+    const hil_graph_t topo = hil_graph_f32_topology(graph);
+    return hil_graph_metrics_body(&topo, graph->weight, out, out_degree, ws);
+}
 
-    free(centroid);
-    return sum_cos / (double)M.rows;
+int hil_graph_metrics_f32_ws(
+    const hil_graph_f32_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const int ok = hil_graph_metrics_f32_kernel(graph, out, out_degree, ws);
+    HIL_STATS_END(HIL_STAT_GRAPH_METRICS_F32, t0, HIL_STAT_WS_BYTES(ws),
+                  (graph ? graph->num_edges : 0));
+    return ok;
 }
 
-/* ============================================================================
- * Epistemic Stability
- * ============================================================================
- */
+/* hil_csr_row_sum over float32 weights. */
+static double hil_csr_row_sum_f32(const hil_graph_csr_f32_t *csr, size_t i) {
+    double s = 0.0;
+    for (uint64_t k = csr->offsets[i]; k < csr->offsets[i + 1]; k++) {
+        s += (double)csr->weight[k];
+    }
+    return s;
+}
 
-double hil_epistemic_stability(const hil_field_t *field, const hil_graph_t *graph) {
-    (void)graph; /* reserved: stability may later incorporate graph terms */
+static double hil_graph_entropy_csr_f32_kernel(const hil_graph_csr_f32_t *csr) {
+    if (!csr) return 0.0;
+    if (csr->num_nodes == 0) return 0.0;
 
-    if (!field) return 0.0;
+    double sum_deg = 0.0;
+    for (size_t i = 0; i < csr->num_nodes; i++) sum_deg += hil_csr_row_sum_f32(csr, i);
 
-    /* First-pass stability as sensitivity of coherence under bounded perturbation:
-         S = |C(field) - C(perturbed(field, eps))| / eps
-       This yields a diagnostic “instability” magnitude.
-       Interpretation is left to Python/theory layer; we only compute.
-    */
+    if (sum_deg <= HIL_EPS) return 0.0;
 
-    const double eps = 1e-6;
+    double H = 0.0;
+    for (size_t i = 0; i < csr->num_nodes; i++) {
+        double p = hil_csr_row_sum_f32(csr, i) / sum_deg;
+        if (p > HIL_EPS) {
+            H -= p * hil_safe_log(p);
+        }
+    }
+
+    return H;
+}
+
+double hil_graph_entropy_csr_f32(const hil_graph_csr_f32_t *csr) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    const double H = hil_graph_entropy_csr_f32_kernel(csr);
+    HIL_STATS_END(HIL_STAT_GRAPH_ENTROPY_CSR_F32, t0, 0, (csr ? csr->num_edges : 0));
+    return H;
+}
 
-    double C0 = hil_field_coherence(field);
+/* hil_summary_accumulate over a float32 row. */
+static double hil_summary_accumulate_f32(
+    hil_vec_dot_f32_fn dot,
+    const float *row,
+    size_t cols,
+    double *centroid,
+    double *u
+) {
+    const double r_norm = sqrt(dot(row, row, cols));
+    const double inv = 1.0 / hil_clamp_min(r_norm, HIL_EPS);
+
+    hil_vec_add_f32_inplace(centroid, row, cols);
+    for (size_t k = 0; k < cols; k++) u[k] += (double)row[k] * inv;
+    return r_norm;
+}
 
-    /* Copy field coordinates for perturbation (do not mutate caller state) */
-    const hil_matrix_t M = field->coordinates;
-    if (!M.data || M.rows == 0 || M.cols == 0) return 0.0;
+/* hil_field_summary_impl over float32 storage; allocates from ws without
+   resetting it. */
+static int hil_field_summary_f32_impl(
+    const hil_field_f32_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+) {
+    if (!field || !out || !ws) return 0;
+    const hil_matrix_f32_t M = field->coordinates;
+    if (!M.data || M.rows == 0 || M.cols == 0) return 0;
+
+    double *centroid = (double*)hil_workspace_alloc(ws, sizeof(double) * 2 * M.cols);
+    if (!centroid) return 0;
+    double *u = centroid + M.cols;
+
+    hil_vec_zero(centroid, 2 * M.cols);
+
+    const hil_vec_dot_f32_fn dot = hil_vec_dot_f32_for(M.cols);
+    double sum_norm = 0.0;
+    for (size_t r = 0; r < M.rows; r++) {
+        const double r_norm = hil_summary_accumulate_f32(
+            dot, hil_matrix_f32_row(&M, r), M.cols, centroid, u
+        );
+        if (out_row_norms) out_row_norms[r] = r_norm;
+        sum_norm += r_norm;
+    }
 
-    hil_field_t tmp;
-    tmp.coordinates.rows = M.rows;
-    tmp.coordinates.cols = M.cols;
-    tmp.coordinates.data = (double*)malloc(sizeof(double) * M.rows * M.cols);
-    if (!tmp.coordinates.data) return 0.0;
+    out->mean_norm = sum_norm / (double)M.rows;
+    out->coherence = hil_summary_coherence(
+        centroid, u, M.cols, M.rows, &out->centroid_norm
+    );
 
-    memcpy(tmp.coordinates.data, M.data, sizeof(double) * M.rows * M.cols);
+    return 1;
+}
 
-    hil_field_perturb(&tmp, eps);
+int hil_field_summary_f32(
+    const hil_field_f32_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms
+) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, field ? hil_ws_need(sizeof(double) * 2 * field->coordinates.cols) : 0);
+    const int ok = hil_field_summary_f32_ws(field, out, out_row_norms, &ws);
+    hil_workspace_free(&ws);
+    return ok;
+}
 
-    double C1 = hil_field_coherence(&tmp);
+int hil_field_summary_f32_ws(
+    const hil_field_f32_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    hil_workspace_reset(ws);
+    const int ok = hil_field_summary_f32_impl(field, out, out_row_norms, ws);
+    HIL_STATS_END(HIL_STAT_FIELD_SUMMARY_F32, t0, HIL_STAT_WS_BYTES(ws),
+                  hil_stat_rows_f32(field));
+    return ok;
+}
 
-    hil_field_free(&tmp);
+double hil_field_coherence_f32(const hil_field_f32_t *field) {
+    hil_workspace_t ws;
+    hil_workspace_init(&ws, field ? hil_ws_need(sizeof(double) * 2 * field->coordinates.cols) : 0);
+    const double C = hil_field_coherence_f32_ws(field, &ws);
+    hil_workspace_free(&ws);
+    return C;
+}
 
-    return fabs(C1 - C0) / eps;
+double hil_field_coherence_f32_ws(const hil_field_f32_t *field, hil_workspace_t *ws) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    hil_field_summary_t summary;
+    hil_workspace_reset(ws);
+    const double C = hil_field_summary_f32_impl(field, &summary, NULL, ws)
+        ? summary.coherence
+        : 0.0;
+    HIL_STATS_END(HIL_STAT_FIELD_COHERENCE_F32, t0, HIL_STAT_WS_BYTES(ws),
+                  hil_stat_rows_f32(field));
+    return C;
 }
 
 /* ============================================================================
@@ -311,7 +3961,7 @@ double hil_epistemic_stability(const hil_field_t *field, const hil_graph_t *grap
  * ============================================================================
  */
 
-void hil_field_perturb(hil_field_t *field, double epsilon) {
+static void hil_field_perturb_kernel(hil_field_t *field, double epsilon) {
     if (!field) return;
     hil_matrix_t M = field->coordinates;
     if (!M.data || M.rows == 0 || M.cols == 0) return;
@@ -320,22 +3970,18 @@ void hil_field_perturb(hil_field_t *field, double epsilon) {
        Add +/-epsilon pattern across coordinates, then renormalize each row
        to preserve scale and avoid numerical blow-up. */
 
+    const hil_vec_dot_fn dot = hil_vec_dot_for(M.cols);
     for (size_t r = 0; r < M.rows; r++) {
-        double *row = M.data + (r * M.cols);
-
-        for (size_t c = 0; c < M.cols; c++) {
-            size_t idx = r * M.cols + c;
-            row[c] += epsilon * hil_det_sign(idx);
-        }
-
-        /* Optional renormalization to unit norm (numerical stability) */
-        double nrm = hil_vec_norm(row, M.cols);
-        if (nrm > HIL_EPS) {
-            hil_vec_scale_inplace(row, M.cols, 1.0 / nrm);
-        }
+        hil_perturb_row(dot, hil_matrix_row(&M, r), r, M.cols, epsilon);
     }
 }
 
+void hil_field_perturb(hil_field_t *field, double epsilon) {
+    const uint64_t t0 = HIL_STATS_BEGIN();
+    hil_field_perturb_kernel(field, epsilon);
+    HIL_STATS_END(HIL_STAT_FIELD_PERTURB, t0, 0, hil_stat_rows(field));
+}
+
 /* ============================================================================
  * Memory Management Helpers
  * ============================================================================
@@ -354,6 +4000,7 @@ void hil_matrix_free(hil_matrix_t *mat) {
     mat->data = NULL;
     mat->rows = 0;
     mat->cols = 0;
+    mat->stride = 0;
 }
 
 void hil_graph_free(hil_graph_t *graph) {
@@ -368,6 +4015,52 @@ void hil_graph_free(hil_graph_t *graph) {
     graph->num_edges = 0;
 }
 
+void hil_graph_csr_free(hil_graph_csr_t *csr) {
+    if (!csr) return;
+    free(csr->offsets);
+    free(csr->indices);
+    free(csr->weight);
+    csr->offsets = NULL;
+    csr->indices = NULL;
+    csr->weight = NULL;
+    csr->num_nodes = 0;
+    csr->num_edges = 0;
+}
+
+void hil_graph_f32_free(hil_graph_f32_t *graph) {
+    if (!graph) return;
+    free(graph->src);
+    free(graph->dst);
+    free(graph->weight);
+    graph->src = NULL;
+    graph->dst = NULL;
+    graph->weight = NULL;
+    graph->num_nodes = 0;
+    graph->num_edges = 0;
+}
+
+void hil_graph_csr_f32_free(hil_graph_csr_f32_t *csr) {
+    if (!csr) return;
+    free(csr->offsets);
+    free(csr->indices);
+    free(csr->weight);
+    csr->offsets = NULL;
+    csr->indices = NULL;
+    csr->weight = NULL;
+    csr->num_nodes = 0;
+    csr->num_edges = 0;
+}
+
+void hil_graph_packed_free(hil_graph_packed_t *packed) {
+    if (!packed) return;
+    free(packed->offsets);
+    free(packed->stream);
+    packed->offsets = NULL;
+    packed->stream = NULL;
+    packed->num_nodes = 0;
+    packed->num_edges = 0;
+}
+
 void hil_field_free(hil_field_t *field) {
     if (!field) return;
     hil_matrix_free(&field->coordinates);
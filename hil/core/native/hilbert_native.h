@@ -43,14 +43,24 @@ typedef struct {
 
 /*
  * Dense matrix representation.
- * Row-major, contiguous memory.
+ * Row-major; row r starts at data + r * stride.
+ *
+ * stride 0 means contiguous rows (stride == cols), so zero-initialised
+ * matrices keep the packed layout. Strided matrices are borrowed views
+ * (e.g. column slices of a wider buffer); kernels read rows through
+ * hil_matrix_row and never assume packing.
  */
 typedef struct {
     double *data;
     size_t  rows;
     size_t  cols;
+    size_t  stride;  /* elements between row starts; 0 = cols */
 } hil_matrix_t;
 
+static inline double *hil_matrix_row(const hil_matrix_t *M, size_t r) {
+    return M->data + r * (M->stride ? M->stride : M->cols);
+}
+
 /*
  * Graph representation.
  *
@@ -69,6 +79,27 @@ typedef struct {
     double   *weight;  /* edge weights (structural strength) */
 } hil_graph_t;
 
+/*
+ * Compressed sparse row (CSR) graph representation.
+ *
+ * Row i holds the outgoing neighbours of node i:
+ *   indices[offsets[i] .. offsets[i+1]) with matching weights.
+ * Neighbour order within a row is defined by the builder.
+ *
+ * num_edges counts stored entries (offsets[num_nodes]).
+ * symmetric is 1 when every undirected edge is stored in both endpoint
+ * rows (an adjacency view of an edge list), 0 for directed graphs.
+ */
+typedef struct {
+    size_t    num_nodes;
+    size_t    num_edges;
+    int       symmetric;
+
+    uint64_t *offsets;  /* row offsets, length num_nodes + 1 */
+    uint32_t *indices;  /* neighbour node indices, length num_edges */
+    double   *weight;   /* edge weights, length num_edges */
+} hil_graph_csr_t;
+
 /*
  * Hilbert Epistemic Field representation.
  *
@@ -79,6 +110,181 @@ typedef struct {
     hil_matrix_t coordinates;   /* element embeddings */
 } hil_field_t;
 
+/*
+ * float32 storage variants.
+ *
+ * Same layouts as above with float elements, for fields and graphs too
+ * large to hold in double. Only storage is narrowed: kernels taking these
+ * types widen on load and accumulate in double (see Mixed Precision below).
+ */
+typedef struct {
+    float  *data;
+    size_t  rows;
+    size_t  cols;
+    size_t  stride;  /* elements between row starts; 0 = cols */
+} hil_matrix_f32_t;
+
+static inline float *hil_matrix_f32_row(const hil_matrix_f32_t *M, size_t r) {
+    return M->data + r * (M->stride ? M->stride : M->cols);
+}
+
+typedef struct {
+    size_t    num_nodes;
+    size_t    num_edges;
+    uint32_t *src;
+    uint32_t *dst;
+    float    *weight;
+} hil_graph_f32_t;
+
+typedef struct {
+    size_t    num_nodes;
+    size_t    num_edges;
+    int       symmetric;
+    uint64_t *offsets;
+    uint32_t *indices;
+    float    *weight;
+} hil_graph_csr_f32_t;
+
+typedef struct {
+    hil_matrix_f32_t coordinates;
+} hil_field_f32_t;
+
+
+/* ============================================================================
+ * Workspace (Scratch Arena)
+ * ============================================================================
+ */
+
+/*
+ * Caller-owned scratch arena for the _ws variants below.
+ *
+ * Create once, pass to any number of _ws calls, free once. Each _ws call
+ * resets the arena on entry, so scratch never outlives the call that
+ * allocated it. Requests past capacity are served from one-off blocks; the
+ * next reset grows the arena to the largest call seen, after which a
+ * repeated call pattern performs no allocation at all.
+ *
+ * A workspace is not thread-safe: use one per calling thread.
+ * Plain (non-_ws) functions create and free a temporary workspace, sized
+ * up front to the kernel's scratch so the call allocates one block.
+ */
+typedef struct {
+    void   *block;           /* primary block (raw allocation) */
+    size_t  capacity;        /* usable bytes in block */
+    size_t  used;            /* bytes handed out from block since reset */
+    size_t  requested;       /* bytes requested since reset, incl. overflow */
+    size_t  peak;            /* largest per-call request seen */
+
+    void  **overflow;        /* one-off blocks for requests past capacity */
+    size_t  overflow_count;
+    size_t  overflow_cap;
+} hil_workspace_t;
+
+/* initial_bytes may be 0 (grow on demand). Returns 1 on success. */
+int hil_workspace_init(hil_workspace_t *ws, size_t initial_bytes);
+
+/* Invalidate all prior allocations; grow to the observed peak. */
+void hil_workspace_reset(hil_workspace_t *ws);
+
+/* 64-byte aligned scratch valid until the next reset. NULL on failure. */
+void *hil_workspace_alloc(hil_workspace_t *ws, size_t bytes);
+
+void hil_workspace_free(hil_workspace_t *ws);
+
+
+/* ============================================================================
+ * Instrumentation (Compile-Time Optional)
+ * ============================================================================
+ *
+ * Build with -DHIL_STATS to accumulate per-kernel counters: calls,
+ * cumulative wall nanoseconds, bytes requested (workspace scratch plus
+ * owned outputs) and items processed (edges for graph kernels, rows for
+ * field kernels, documents for the lexicon). Counters are process-wide and
+ * updated atomically with relaxed ordering, so concurrent callers are
+ * counted but never synchronised. Without HIL_STATS the timing hooks
+ * compile away and the snapshot is always empty.
+ *
+ * A plain function and its _ws variant share one counter.
+ */
+
+typedef enum {
+    HIL_STAT_GRAPH_BUILD_COSINE = 0,
+    HIL_STAT_GRAPH_BUILD_KNN_CSR,
+    HIL_STAT_GRAPH_ENTROPY,
+    HIL_STAT_GRAPH_COMPONENTS,
+    HIL_STAT_GRAPH_METRICS,
+    HIL_STAT_GRAPH_BUILD_CSR,
+    HIL_STAT_GRAPH_ENTROPY_CSR,
+    HIL_STAT_GRAPH_COMPONENTS_CSR,
+    HIL_STAT_FIELD_COHERENCE,
+    HIL_STAT_FIELD_SUMMARY,
+    HIL_STAT_EPISTEMIC_STABILITY,
+    HIL_STAT_EPISTEMIC_STABILITY_CURVE,
+    HIL_STAT_LEAVE_ONE_OUT,
+    HIL_STAT_PCA_AXES,
+    HIL_STAT_PCA_AXES_BATCH,
+    HIL_STAT_GEOMETRY_DELTA_LOO,
+    HIL_STAT_FIELD_PERTURB,
+    HIL_STAT_LEXICON_ADD,
+    HIL_STAT_LEXICON_FINISH,
+    HIL_STAT_GRAPH_BUILD_COSINE_F32,
+    HIL_STAT_GRAPH_BUILD_KNN_CSR_F32,
+    HIL_STAT_GRAPH_BUILD_CSR_F32,
+    HIL_STAT_GRAPH_ENTROPY_F32,
+    HIL_STAT_GRAPH_METRICS_F32,
+    HIL_STAT_GRAPH_ENTROPY_CSR_F32,
+    HIL_STAT_FIELD_SUMMARY_F32,
+    HIL_STAT_FIELD_COHERENCE_F32,
+    HIL_STAT_FIELD_SUMMARY_BATCH,
+    HIL_STAT_MACROSTATE_DISPERSION_BATCH,
+    HIL_STAT_FIBER_ENTROPY_BATCH,
+    HIL_STAT_GRAPH_PACK,
+    HIL_STAT_GRAPH_ENTROPY_PACKED,
+    HIL_STAT_GRAPH_COMPONENTS_PACKED,
+    HIL_STAT_ANN_ADD,
+    HIL_STAT_ANN_QUERY,
+    HIL_STAT_FIELD_SPECTRUM,
+    HIL_STAT_GRAPH_OUT_ENTROPY,
+    HIL_STAT_GRAPH_OUT_ENTROPY_F32,
+    HIL_STAT_COUNT
+} hil_stat_slot_t;
+
+typedef struct {
+    const char *name;         /* kernel name without the hil_ prefix */
+    uint64_t calls;
+    uint64_t nanoseconds;
+    uint64_t bytes;
+    uint64_t items;
+} hil_stat_entry_t;
+
+/* 1 when built with HIL_STATS, else 0. */
+int hil_stats_enabled(void);
+
+/*
+ * Copy up to cap counters (slot order) into out. Returns the number of
+ * slots (HIL_STAT_COUNT) when enabled, 0 otherwise.
+ */
+size_t hil_stats_snapshot(hil_stat_entry_t *out, size_t cap);
+
+/* Zero every counter. */
+void hil_stats_reset(void);
+
+/* Hooks for kernels in other translation units (e.g. hilbert_lexicon.c);
+   no-ops without HIL_STATS. */
+uint64_t hil_stats_clock(void);
+void hil_stats_record(hil_stat_slot_t slot, uint64_t start, uint64_t bytes, uint64_t items);
+
+/* Call-site form of the hooks: without HIL_STATS the clock read and the
+   bytes/items expressions are not evaluated at all. */
+#ifdef HIL_STATS
+#define HIL_STATS_BEGIN() hil_stats_clock()
+#define HIL_STATS_END(slot, t0, bytes, items) \
+    hil_stats_record((slot), (t0), (uint64_t)(bytes), (uint64_t)(items))
+#else
+#define HIL_STATS_BEGIN() ((uint64_t)0)
+#define HIL_STATS_END(slot, t0, bytes, items) ((void)(t0))
+#endif
+
 
 /* ============================================================================
  * Graph Integrity & Basic Structure
@@ -104,6 +310,57 @@ void hil_graph_degree(
 );
 
 
+/* ============================================================================
+ * Structural Construction
+ * ============================================================================
+ */
+
+/*
+ * Build the fully-connected cosine graph of a field.
+ *
+ * Rows are L2-normalised once (zero rows are left at zero), and every pair
+ * i < j receives the edge weight w = (cos + 1) / 2 in [0, 1].
+ *
+ * Edges are written in row-major upper-triangle order:
+ *   (0,1), (0,2), ..., (0,n-1), (1,2), ..., (n-2,n-1)
+ * which is the ordering produced by hil.core.api.build_structure.
+ *
+ * The caller owns the output arrays: out_graph->src, dst and weight must be
+ * preallocated with num_edges = n*(n-1)/2 entries. num_nodes is set to n.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_graph_build_cosine(
+    const hil_field_t *field,
+    hil_graph_t *out_graph
+);
+
+
+/*
+ * Build a sparse cosine graph of a field in CSR form.
+ *
+ * Weights follow hil_graph_build_cosine: w = (cos + 1) / 2 on normalised rows.
+ * For each node i, candidate neighbours j != i are filtered by:
+ *  - min_weight: keep only w >= min_weight (pass 0.0 to disable)
+ *  - k:          keep the k highest-weight survivors (pass 0 to disable);
+ *                ties are broken by the smaller neighbour index
+ *
+ * The result is directed (i -> j, symmetric = 0); row i lists its kept
+ * neighbours in ascending index order. Memory is O(n*k) for k > 0.
+ *
+ * out_csr arrays are allocated by this function and must be released with
+ * hil_graph_csr_free.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_graph_build_knn_csr(
+    const hil_field_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_t *out_csr
+);
+
+
 /* ============================================================================
  * Structural Diagnostics (Graph-Theoretic)
  * ============================================================================
@@ -123,11 +380,265 @@ double hil_graph_density(const hil_graph_t *graph);
  * No semantic interpretation is applied.
  */
 double hil_graph_entropy(const hil_graph_t *graph);
+double hil_graph_entropy_ws(const hil_graph_t *graph, hil_workspace_t *ws);
+
+/*
+ * Structural entropy over the out-strength distribution.
+ *
+ * p_i = (sum of weights of edges with src == i) / sum(weight): the
+ * definition of hil.core.metrics.entropy.structural_entropy for edge lists,
+ * and hil_graph_entropy_csr on the directed CSR of the same edges.
+ * hil_graph_entropy counts both endpoints instead.
+ */
+double hil_graph_out_entropy(const hil_graph_t *graph);
 
 /*
  * Compute connected component count.
  */
 size_t hil_graph_connected_components(const hil_graph_t *graph);
+size_t hil_graph_connected_components_ws(const hil_graph_t *graph, hil_workspace_t *ws);
+
+/*
+ * Weakly connected components with optional per-node labels and sizes.
+ *
+ * Lock-free union-find straight over src/dst; threads split the edge list
+ * under OpenMP. The result does not depend on thread count or schedule:
+ * labels are dense in [0, count), numbered in order of each component's
+ * smallest node.
+ *
+ * out_labels may be NULL, or hold num_nodes entries.
+ * out_sizes may be NULL, or hold num_nodes entries; the first count are
+ * written with the node count of each label.
+ *
+ * Returns the component count (0 on failure).
+ */
+size_t hil_graph_components(
+    const hil_graph_t *graph,
+    uint32_t *out_labels,
+    uint64_t *out_sizes
+);
+size_t hil_graph_components_ws(
+    const hil_graph_t *graph,
+    uint32_t *out_labels,
+    uint64_t *out_sizes,
+    hil_workspace_t *ws
+);
+
+
+
+/*
+ * Fused structural summary of a graph.
+ *
+ * Produced by hil_graph_metrics from a single pass over the edge arrays.
+ */
+typedef struct {
+    double mean_degree;     /* mean weighted degree, sum(deg) / num_nodes */
+    double total_weight;    /* sum of edge weights */
+    double density;         /* as hil_graph_density */
+    double degree_entropy;  /* as hil_graph_entropy (both endpoints) */
+    double out_entropy;     /* as hil_graph_out_entropy (structural_entropy) */
+    size_t components;      /* as hil_graph_connected_components */
+} hil_graph_metrics_t;
+
+/*
+ * Compute degree, density, both entropies and component count together.
+ *
+ * One streaming pass over src/dst/weight accumulates the weighted degree
+ * and out-strength and unions edge endpoints; entropies and component count
+ * are then read off node-sized state. Values match the individual functions
+ * above.
+ *
+ * out_degree is optional (may be NULL); when given it must have length
+ * num_nodes and receives the hil_graph_degree sequence.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_graph_metrics(
+    const hil_graph_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree
+);
+int hil_graph_metrics_ws(
+    const hil_graph_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+);
+
+
+/* ============================================================================
+ * Persistent Adjacency (CSR View)
+ * ============================================================================
+ *
+ * Build the undirected adjacency of an edge list once, then evaluate any
+ * number of structural diagnostics on it without re-walking the edge list.
+ */
+
+/*
+ * Build the symmetric CSR adjacency of a graph.
+ *
+ * Each edge (s, d, w) is stored as s -> d and d -> s with weight w
+ * (self-loops are stored twice in row s). Rows preserve edge-list order.
+ *
+ * out_csr arrays are allocated by this function and must be released with
+ * hil_graph_csr_free.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_graph_build_csr(
+    const hil_graph_t *graph,
+    hil_graph_csr_t *out_csr
+);
+
+/*
+ * Weighted degree as row weight sums.
+ *
+ * For a view built by hil_graph_build_csr this equals hil_graph_degree;
+ * for a directed CSR graph it is the out-strength.
+ * Output array must be preallocated with length = num_nodes.
+ */
+void hil_graph_degree_csr(
+    const hil_graph_csr_t *csr,
+    double *out_degree
+);
+
+/*
+ * Structural density over a CSR graph.
+ *
+ * Symmetric views count num_edges / 2 undirected edges against n(n-1)/2;
+ * directed graphs count num_edges against n(n-1). Returns a scalar in [0, 1].
+ */
+double hil_graph_density_csr(const hil_graph_csr_t *csr);
+
+/*
+ * Structural entropy over the CSR degree distribution.
+ *
+ * Matches hil_graph_entropy for a view built by hil_graph_build_csr.
+ * Performs no allocation.
+ */
+double hil_graph_entropy_csr(const hil_graph_csr_t *csr);
+
+/*
+ * Connected component count over a CSR graph.
+ *
+ * Every stored entry joins its two endpoints, so directed graphs report
+ * weakly connected components. Matches hil_graph_connected_components for
+ * a view built by hil_graph_build_csr.
+ */
+size_t hil_graph_connected_components_csr(const hil_graph_csr_t *csr);
+size_t hil_graph_connected_components_csr_ws(
+    const hil_graph_csr_t *csr,
+    hil_workspace_t *ws
+);
+
+
+/* ============================================================================
+ * Packed Adjacency (Compressed CSR)
+ * ============================================================================
+ *
+ * A CSR graph with 16-bit fixed-point weights and delta-varint neighbour
+ * lists, for structure too large to keep as uint32 indices plus double
+ * weights (12 bytes per stored entry). Rows are sorted by neighbour index;
+ * each entry is the LEB128 varint gap from the previous index (the first
+ * from 0) followed by its weight as 2 little-endian bytes. Gaps below 128
+ * pack an entry into 3 bytes, below 16384 into 4. Rows keep one uint64
+ * offset each, as in hil_graph_csr_t. The degree, entropy and component
+ * kernels below decode in their inner loops; nothing is expanded back to a
+ * CSR view.
+ *
+ * Weights must lie in [0, 1] (cosine similarity structure). Stored values
+ * are q = round(w * HIL_PACKED_WEIGHT_SCALE), read back as q / SCALE, so
+ * every weight is within 1 / (2 * SCALE) of the original.
+ */
+
+#define HIL_PACKED_WEIGHT_SCALE 65535u
+
+typedef struct {
+    size_t    num_nodes;
+    size_t    num_edges;
+    int       symmetric;
+
+    uint64_t *offsets;  /* row byte offsets into stream, length num_nodes + 1 */
+    uint8_t  *stream;   /* (varint gap, uint16 weight) entries, offsets[num_nodes] bytes */
+} hil_graph_packed_t;
+
+/*
+ * Pack a CSR graph.
+ *
+ * Each row is re-ordered by neighbour index (weights follow their indices);
+ * no diagnostic below depends on the order within a row.
+ *
+ * out arrays are allocated by this function and must be released with
+ * hil_graph_packed_free.
+ *
+ * Returns 1 on success, 0 on invalid input (indices out of range, weights
+ * outside [0, 1]) or allocation failure.
+ */
+int hil_graph_pack_csr(
+    const hil_graph_csr_t *csr,
+    hil_graph_packed_t *out
+);
+
+/*
+ * Pack the symmetric adjacency of an edge-list graph.
+ *
+ * Same rows as hil_graph_build_csr, sorted, without materializing the
+ * intermediate CSR view.
+ */
+int hil_graph_pack(
+    const hil_graph_t *graph,
+    hil_graph_packed_t *out
+);
+
+/*
+ * Bytes held by a packed graph (row offsets and stream).
+ */
+size_t hil_graph_packed_bytes(const hil_graph_packed_t *packed);
+
+/*
+ * Weighted degree as dequantized row sums.
+ *
+ * Rows are summed exactly in integers before scaling, so the result does
+ * not depend on storage order. Output array must be preallocated with
+ * length = num_nodes.
+ */
+void hil_graph_degree_packed(
+    const hil_graph_packed_t *packed,
+    double *out_degree
+);
+
+/*
+ * Structural entropy over the dequantized degree distribution.
+ *
+ * Performs no allocation.
+ */
+double hil_graph_entropy_packed(const hil_graph_packed_t *packed);
+
+/*
+ * Bound on |H(original) - H(packed)| from quantization alone.
+ *
+ * With m stored entries, each rounded by at most d = 1 / (2 * SCALE), the
+ * row sums move by D <= m * d in total, so the degree distributions are
+ * within total variation T <= D / (S - D), S the packed weight total. The
+ * Fannes-Audenaert inequality then gives
+ *
+ *   |dH| <= T * ln(n - 1) + h(T),   h(T) = -T ln T - (1 - T) ln(1 - T).
+ *
+ * Returns ln(n), the trivial bound, when T >= 1 - 1/n or S <= D. The
+ * HIL_EPS cut on tiny degree probabilities is not accounted for.
+ */
+double hil_graph_entropy_packed_bound(const hil_graph_packed_t *packed);
+
+/*
+ * Connected component count over a packed graph.
+ *
+ * Matches hil_graph_connected_components_csr on the graph that was packed.
+ */
+size_t hil_graph_connected_components_packed(const hil_graph_packed_t *packed);
+size_t hil_graph_connected_components_packed_ws(
+    const hil_graph_packed_t *packed,
+    hil_workspace_t *ws
+);
 
 
 /* ============================================================================
@@ -147,6 +658,94 @@ double hil_field_mean_norm(const hil_field_t *field);
  * relations in the embedding space.
  */
 double hil_field_coherence(const hil_field_t *field);
+double hil_field_coherence_ws(const hil_field_t *field, hil_workspace_t *ws);
+
+/*
+ * Fused geometric summary, computed in a single pass over the coordinates.
+ *
+ * Uses sum_r cos(x_r, c) = <sum_r x_r / |x_r|, c> / |c|, so row norms,
+ * centroid and the normalized-row sum are accumulated together.
+ *
+ * out_row_norms (nullable) receives the M.rows row norms for reuse.
+ * Returns 1 on success, 0 on failure.
+ */
+typedef struct {
+    double mean_norm;
+    double centroid_norm;
+    double coherence;
+} hil_field_summary_t;
+
+int hil_field_summary(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms
+);
+int hil_field_summary_ws(
+    const hil_field_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+);
+
+
+/* ============================================================================
+ * Linear Operators
+ * ============================================================================
+ */
+
+/*
+ * Top-k eigenpairs of a field operator, matrix-free.
+ *
+ *   HIL_SPECTRUM_GRAM:       G = X X^T                    (N = rows)
+ *   HIL_SPECTRUM_COVARIANCE: C = (X - mu)^T (X - mu) / rows (N = cols)
+ *
+ * Thick-restart Lanczos with full reorthogonalisation: each step costs one
+ * application of the operator as two passes over the rows (X^T v, then
+ * X t), so neither G nor C is ever formed and memory is O((ncv + 1) * N).
+ * The ncv x ncv projected matrix is solved by Jacobi rotations; after each
+ * sweep the leading ncv / 2 (at least k) Ritz vectors are kept and the
+ * sweep resumes from the residual. Stops once each of the top k Ritz pairs
+ * has residual <= tol * |lambda_1|, or after max_restarts sweeps.
+ *
+ *  - ncv: Krylov basis size, k < ncv <= N when k < N; 0 selects
+ *    min(N, max(2k + 1, k + 16))
+ *  - start (nullable, N): start vector; otherwise a fixed-seed
+ *    deterministic start is used
+ *  - out_values (k): eigenvalues, descending
+ *  - out_vectors (nullable, k * N): unit eigenvectors, row-major, each
+ *    signed so its largest-magnitude entry is positive
+ *  - out_info (nullable): operator applications, sweeps and converged pairs
+ *
+ * Operator applications and reorthogonalisation run in parallel when built
+ * with OpenMP; every sum is taken in a fixed order, so output is
+ * thread-count independent for a given start vector.
+ *
+ * Requires 1 <= k <= N. Returns 1 on success (converged or not; see
+ * out_info), 0 on invalid input or allocation failure.
+ */
+typedef enum {
+    HIL_SPECTRUM_GRAM = 0,
+    HIL_SPECTRUM_COVARIANCE = 1
+} hil_spectrum_op_t;
+
+typedef struct {
+    size_t matvecs;    /* operator applications */
+    size_t restarts;   /* Lanczos sweeps after the first */
+    size_t converged;  /* leading pairs within tol (k when converged) */
+} hil_spectrum_info_t;
+
+int hil_field_spectrum(
+    const hil_field_t *field,
+    hil_spectrum_op_t op,
+    size_t k,
+    size_t ncv,
+    size_t max_restarts,
+    double tol,
+    const double *start,
+    double *out_values,
+    double *out_vectors,
+    hil_spectrum_info_t *out_info
+);
 
 
 /* ============================================================================
@@ -164,6 +763,350 @@ double hil_epistemic_stability(
     const hil_field_t *field,
     const hil_graph_t *graph
 );
+double hil_epistemic_stability_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    hil_workspace_t *ws
+);
+
+/*
+ * Coherence sensitivity curve over several perturbation magnitudes.
+ *
+ *   out_sensitivity[k] = |C(perturbed(field, epsilons[k])) - C(field)| / epsilons[k]
+ *
+ * with the hil_field_perturb pattern. The perturbed fields are never
+ * materialised: each row is perturbed in a row-sized buffer and folded into
+ * per-epsilon coherence accumulators, so the whole curve costs one pass over
+ * the coordinates and O(count * cols) scratch. hil_epistemic_stability is
+ * the single-point curve at epsilon = 1e-6.
+ *
+ * All epsilons must be > 0. Returns 1 on success, 0 on failure.
+ */
+int hil_epistemic_stability_curve(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity
+);
+int hil_epistemic_stability_curve_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    const double *epsilons,
+    size_t count,
+    double *out_sensitivity,
+    hil_workspace_t *ws
+);
+
+
+/*
+ * Leave-one-out entropy and coherence for every element of a field.
+ *
+ * For each element i, computes the diagnostics of the field / graph with
+ * element i removed, without rebuilding either:
+ *  - out_entropy[i]:   hil_graph_out_entropy of the graph with node i and
+ *                      its incident edges removed, derived from the baseline
+ *                      out-strengths by dropping node i's own and
+ *                      subtracting its in-edges from their sources
+ *  - out_coherence[i]: hil_field_coherence of the field without row i,
+ *                      derived from the baseline centroid, the sum of unit
+ *                      rows and the per-row centroid dots
+ *
+ * Removing a node's edges equals rebuilding the complete or thresholded
+ * cosine graph without that element (weights depend only on the pair).
+ *
+ * graph is the edge list over the same num_nodes as field rows; it may be
+ * NULL when out_entropy is NULL.
+ * Either output may be NULL to skip it; otherwise length = rows.
+ *
+ * Tolerance: algebraically exact; results agree with explicit rebuilds to
+ * within ~1e-10 absolute for O(1) data, with entropy terms of p <= HIL_EPS
+ * retained rather than dropped.
+ *
+ * Elements are processed in parallel when built with OpenMP; each result
+ * depends only on its own index, so output is thread-count independent.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_leave_one_out_diagnostics(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    double *out_entropy,
+    double *out_coherence
+);
+int hil_leave_one_out_diagnostics_ws(
+    const hil_field_t *field,
+    const hil_graph_t *graph,
+    double *out_entropy,
+    double *out_coherence,
+    hil_workspace_t *ws
+);
+
+
+/* ============================================================================
+ * Geometric Delta (PCA / Procrustes)
+ * ============================================================================
+ */
+
+/* Largest number of principal axes the projection kernels solve for. */
+#define HIL_PCA_MAX_AXES 3
+
+/*
+ * Leading principal axes of a field.
+ *
+ * Block subspace iteration on the centered scatter matrix with a k x k
+ * Rayleigh-Ritz step per iteration; the scatter is applied matrix-free, so
+ * each iteration costs O(rows * cols * k). Stops once every Ritz pair has
+ * residual <= tol * lambda_1, or after max_iter iterations.
+ *
+ *  - warm_axes (nullable, k * cols): starting axes, e.g. the axes of a
+ *    baseline field; otherwise a fixed-seed deterministic start is used
+ *  - out_axes (k * cols): unit axes, row-major, by descending variance,
+ *    each signed so its largest-magnitude entry is positive
+ *  - out_mean (nullable, cols): column means
+ *  - out_variance (nullable, k): variance along each axis (divisor rows - 1)
+ *
+ * Requires 1 <= k <= min(cols, HIL_PCA_MAX_AXES).
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_pca_axes(
+    const hil_field_t *field,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_mean,
+    double *out_variance
+);
+int hil_pca_axes_ws(
+    const hil_field_t *field,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_mean,
+    double *out_variance,
+    hil_workspace_t *ws
+);
+
+/*
+ * hil_pca_axes over count fields sharing one column count, in one call.
+ *
+ * Field f writes out_axes[f * k * cols ..], out_means[f * cols ..] and
+ * out_variances[f * k ..]. warm_axes (nullable) is shared by all fields.
+ * Fields are solved in parallel when built with OpenMP; each result depends
+ * only on its own field, so output is thread-count independent.
+ */
+int hil_pca_axes_batch(
+    const hil_field_t *fields,
+    size_t count,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_means,
+    double *out_variances
+);
+int hil_pca_axes_batch_ws(
+    const hil_field_t *fields,
+    size_t count,
+    size_t k,
+    const double *warm_axes,
+    size_t max_iter,
+    double tol,
+    double *out_axes,
+    double *out_means,
+    double *out_variances,
+    hil_workspace_t *ws
+);
+
+/*
+ * Leave-one-out geometry delta for every element of a field.
+ *
+ * out_delta[i] is the orthogonal Procrustes distance between the 2D PCA
+ * projection of the field without row i and the baseline 2D projection
+ * with row i dropped, both centered and Frobenius-normalised
+ * (hil.core.metrics.geometry_delta.geometry_delta_procrustes_2d); 0 when
+ * either projection is degenerate.
+ *
+ * Nothing is rebuilt per element: removing row i downdates the centered
+ * scatter by n / (n - 1) * y_i y_i^T (y_i = x_i - mean), and the
+ * leave-one-out axes are solved by subspace iteration warm-started from the
+ * baseline axes, which a rank-1 downdate barely moves. When cols <= rows
+ * the scatter is formed once (O(rows * cols^2)) and applied densely.
+ *
+ * Tolerance: the projected subspace is converged to tol (relative); the
+ * 2D Procrustes step is closed form.
+ *
+ * Elements are processed in parallel when built with OpenMP; output is
+ * thread-count independent.
+ *
+ * Requires rows >= 3 and cols >= 2.
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_geometry_delta_loo(
+    const hil_field_t *field,
+    size_t max_iter,
+    double tol,
+    double *out_delta
+);
+int hil_geometry_delta_loo_ws(
+    const hil_field_t *field,
+    size_t max_iter,
+    double tol,
+    double *out_delta,
+    hil_workspace_t *ws
+);
+
+
+/* ============================================================================
+ * Snapshot Batches (Time Series)
+ * ============================================================================
+ *
+ * Diagnostics of T snapshots (ticks) in one call, for sweeps where per-call
+ * overhead would otherwise dominate. Snapshots are processed in parallel
+ * when built with OpenMP; each result depends only on its own snapshot, so
+ * output is thread-count independent.
+ */
+
+/*
+ * hil_field_summary for count snapshots sharing one column count.
+ *
+ * fields[t] is snapshot t, typically a row-range view into one field buffer
+ * (the binding takes row offsets). out[t] receives its summary and
+ * out_centroids (nullable, count * cols) its centroid, row-major.
+ *
+ * Returns 1 on success, 0 on invalid input (any empty snapshot) or
+ * allocation failure.
+ */
+int hil_field_summary_batch(
+    const hil_field_t *fields,
+    size_t count,
+    hil_field_summary_t *out,
+    double *out_centroids
+);
+int hil_field_summary_batch_ws(
+    const hil_field_t *fields,
+    size_t count,
+    hil_field_summary_t *out,
+    double *out_centroids,
+    hil_workspace_t *ws
+);
+
+typedef enum {
+    HIL_NORM_L2 = 0,
+    HIL_NORM_LINF = 1
+} hil_norm_t;
+
+/*
+ * Macrostate dispersion of count snapshots, each built under group moduli
+ * settings (hil.core.timebase.macrostate_dispersion per snapshot).
+ *
+ * stack is count x group x k, row-major. With m_t the mean over the group:
+ *  - HIL_NORM_L2:   out_dispersion[t] = max_g |stack[t, g] - m_t|
+ *  - HIL_NORM_LINF: out_dispersion[t] = max_g,j |stack[t, g, j] - m_t[j]|
+ * and 0 when group <= 1.
+ *
+ * Returns 1 on success, 0 on invalid input or allocation failure.
+ */
+int hil_macrostate_dispersion_batch(
+    const double *stack,
+    size_t count,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *out_dispersion
+);
+int hil_macrostate_dispersion_batch_ws(
+    const double *stack,
+    size_t count,
+    size_t group,
+    size_t k,
+    hil_norm_t norm,
+    double *out_dispersion,
+    hil_workspace_t *ws
+);
+
+/*
+ * Fiber entropy of each macrostate (row) of sigmas: Shannon entropy (natural
+ * log) of the coordinate-magnitude distribution p_j = |x_j| / sum_j |x_j|,
+ * under the counting reference measure on the k coordinates. Follows the
+ * hil_graph_entropy conventions: 0 when sum_j |x_j| <= HIL_EPS, and terms
+ * with p_j <= HIL_EPS dropped.
+ *
+ * out_entropy has sigmas.rows entries. Returns 1 on success, 0 on invalid
+ * input.
+ */
+int hil_fiber_entropy_batch(const hil_field_t *sigmas, double *out_entropy);
+
+
+/* ============================================================================
+ * Mixed Precision (float32 Storage)
+ * ============================================================================
+ *
+ * float32 counterparts of the construction and diagnostic kernels above,
+ * with identical semantics and output ordering. Elements are widened to
+ * double on load and every reduction accumulates in double, so each result
+ * equals its double kernel run on the widened inputs; builders round only
+ * the stored weights. Versus double storage this halves the bytes streamed
+ * by coherence and graph metrics.
+ */
+
+/* hil_graph_validate for float32 weights. */
+int hil_graph_validate_f32(const hil_graph_f32_t *graph);
+
+/* hil_graph_build_cosine; weights are the double weights rounded to float. */
+int hil_graph_build_cosine_f32(const hil_field_f32_t *field, hil_graph_f32_t *out_graph);
+
+/*
+ * hil_graph_build_knn_csr; neighbours are selected on the double weights,
+ * then stored rounded to float. Free with hil_graph_csr_f32_free.
+ */
+int hil_graph_build_knn_csr_f32(
+    const hil_field_f32_t *field,
+    size_t k,
+    double min_weight,
+    hil_graph_csr_f32_t *out_csr
+);
+
+/* hil_graph_build_csr over float32 weights (copied, not rounded). */
+int hil_graph_build_csr_f32(const hil_graph_f32_t *graph, hil_graph_csr_f32_t *out_csr);
+
+double hil_graph_entropy_f32(const hil_graph_f32_t *graph);
+double hil_graph_entropy_f32_ws(const hil_graph_f32_t *graph, hil_workspace_t *ws);
+double hil_graph_out_entropy_f32(const hil_graph_f32_t *graph);
+
+int hil_graph_metrics_f32(
+    const hil_graph_f32_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree
+);
+int hil_graph_metrics_f32_ws(
+    const hil_graph_f32_t *graph,
+    hil_graph_metrics_t *out,
+    double *out_degree,
+    hil_workspace_t *ws
+);
+
+double hil_graph_entropy_csr_f32(const hil_graph_csr_f32_t *csr);
+
+int hil_field_summary_f32(
+    const hil_field_f32_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms
+);
+int hil_field_summary_f32_ws(
+    const hil_field_f32_t *field,
+    hil_field_summary_t *out,
+    double *out_row_norms,
+    hil_workspace_t *ws
+);
+
+double hil_field_coherence_f32(const hil_field_f32_t *field);
+double hil_field_coherence_f32_ws(const hil_field_f32_t *field, hil_workspace_t *ws);
 
 
 /* ============================================================================
@@ -190,12 +1133,17 @@ void hil_field_perturb(
  */
 
 /*
- * Free helpers for structures allocated externally.
+ * Free helpers for structures allocated externally or by the
+ * structural construction functions above.
  * These functions do NOT allocate memory.
  */
 void hil_vector_free(hil_vector_t *vec);
 void hil_matrix_free(hil_matrix_t *mat);
 void hil_graph_free(hil_graph_t *graph);
+void hil_graph_csr_free(hil_graph_csr_t *csr);
+void hil_graph_f32_free(hil_graph_f32_t *graph);
+void hil_graph_csr_f32_free(hil_graph_csr_f32_t *csr);
+void hil_graph_packed_free(hil_graph_packed_t *packed);
 void hil_field_free(hil_field_t *field);
 
 
@@ -0,0 +1,1503 @@
+/*
+ * hilbert_test.c
+ *
+ * Benchmark harness for the native kernel: every numeric entry point of
+ * hilbert_native.h and hilbert_math.h, and the hilbert_ann.h index, swept
+ * over field size (n), width (d), edge density and thread count.
+ *
+ * Build and run (standalone; not part of the Python extension):
+ *
+ *   cc -std=c11 -O2 -fopenmp -o hilbert_bench \
+ *      hilbert_test.c hilbert_native.c hilbert_math.c hilbert_ann.c -lm
+ *   ./hilbert_bench --quick --json bench.json
+ *   ./hilbert_bench --baseline bench.json --max-slowdown 0.25
+ *
+ * Output:
+ *  - a table on stderr
+ *  - JSON (schema "hil-native-bench/1") to --json PATH, or stdout; one
+ *    result object per line so baselines can be diffed and parsed simply
+ *
+ * Each result reports the best and median time per call, ns per element
+ * and GB/s. "Elements" are named by unit: coordinates (n * d) for field
+ * kernels, edges for edge-list and CSR kernels, pairs for the pairwise
+ * builders, calls for O(1) kernels. Bytes are a nominal traffic model
+ * (each input read once, each output written once), not a measurement.
+ * Approximate kernels also report recall against their exact counterpart
+ * ("recall": null elsewhere); the ANN query reports recall@k of the index
+ * against hil_graph_build_knn_csr.
+ *
+ * With --baseline, results are matched by (name, n, d, density, threads)
+ * and any ns/element slower than the baseline by more than --max-slowdown
+ * is reported; the exit status is then 2.
+ *
+ * Inputs are generated from a fixed seed, so every run measures the same
+ * data. The memory helpers (hil_*_free) are not benchmarked.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include "hilbert_native.h"
+#include "hilbert_math.h"
+#include "hilbert_ann.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+
+/* ============================================================================
+ * Configuration
+ * ============================================================================
+ */
+
+#define HIL_BENCH_MAX_SWEEP   8
+#define HIL_BENCH_MAX_SAMPLES 1000
+#define HIL_BENCH_BATCH       8     /* fields per hil_pca_axes_batch call */
+#define HIL_BENCH_TICK_ROWS   16    /* rows per snapshot in the tick batches */
+#define HIL_BENCH_MODULI      4     /* moduli settings per dispersion snapshot */
+#define HIL_BENCH_KNN_K       16
+#define HIL_BENCH_CURVE       4     /* epsilons per stability curve */
+#define HIL_BENCH_ANN_EF      64    /* layer-0 candidates per ANN query */
+#define HIL_BENCH_SPECTRUM_K  8     /* leading eigenpairs per hil_field_spectrum call */
+
+typedef struct {
+    size_t n[HIL_BENCH_MAX_SWEEP];       size_t n_count;
+    size_t d[HIL_BENCH_MAX_SWEEP];       size_t d_count;
+    double density[HIL_BENCH_MAX_SWEEP]; size_t density_count;
+    int    threads[HIL_BENCH_MAX_SWEEP]; size_t threads_count;
+    double min_time_ms;
+    const char *filter;
+    const char *json_path;
+    const char *baseline_path;
+    double max_slowdown;
+} hil_bench_config_t;
+
+
+/* ============================================================================
+ * Inputs
+ * ============================================================================
+ */
+
+typedef struct {
+    size_t n, d;
+    double density;
+
+    hil_field_t field;
+    hil_field_t scratch;        /* mutable copy for hil_field_perturb */
+    double *a, *b;              /* n * d vectors for the math kernels */
+
+    hil_graph_t graph;          /* random undirected edge list */
+    hil_graph_csr_t csr;        /* symmetric adjacency of graph */
+    hil_graph_packed_t packed;  /* csr with 16-bit weights and varint indices */
+    hil_graph_t cosine;         /* preallocated hil_graph_build_cosine output */
+    double *spectrum;           /* K * n hil_field_spectrum eigenvectors (first use) */
+
+    double *deg;
+    double *out_a, *out_b;
+    uint32_t *labels;
+    uint64_t *sizes;
+
+    hil_field_t batch[HIL_BENCH_BATCH];
+    double *axes, *mean, *variance;
+    double *batch_axes, *batch_means, *batch_variances;
+
+    hil_field_t *ticks;         /* the field split into HIL_BENCH_TICK_ROWS snapshots */
+    size_t tick_count;
+    hil_field_summary_t *tick_summaries;
+    double *tick_centroids;
+
+    /* float32 copies of field, a/b, graph and csr for the *_f32 kernels */
+    hil_field_f32_t field_f32;
+    float *a_f32, *b_f32;
+    hil_graph_f32_t graph_f32;
+    hil_graph_csr_f32_t csr_f32;
+    hil_graph_f32_t cosine_f32;
+
+    /* ANN index over field (built on first use), queried for every node */
+    hil_ann_t *ann;
+    uint32_t *ann_nodes, *ann_ids;
+    double *ann_weight;
+
+    hil_workspace_t ws;
+    volatile double sink;       /* keeps results observable */
+} hil_bench_ctx_t;
+
+static uint64_t hil_bench_mix(uint64_t *s) {
+    uint64_t z = (*s += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static double hil_bench_uniform(uint64_t *s) {
+    return (double)(hil_bench_mix(s) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void *hil_bench_alloc(size_t bytes) {
+    void *p = calloc(1, bytes ? bytes : 1);
+    if (!p) {
+        fprintf(stderr, "hilbert_bench: out of memory (%zu bytes)\n", bytes);
+        exit(1);
+    }
+    return p;
+}
+
+/* Field of n x d coordinates: four shifted clusters plus noise. The
+   shifts differ so the leading variances are distinct (tied variances
+   would stall the PCA kernels at max_iter). */
+static void hil_bench_field(hil_bench_ctx_t *c, size_t n, size_t d) {
+    uint64_t s = 0x48494c42454e4348ull ^ (n * 1315423911u) ^ d;
+    double *X = (double*)hil_bench_alloc(sizeof(double) * n * d);
+
+    for (size_t r = 0; r < n; r++) {
+        const size_t cluster = r % 4;
+        for (size_t k = 0; k < d; k++) {
+            const double centre = (k % 4 == cluster) ? 1.0 + (double)cluster : 0.0;
+            X[r * d + k] = centre + hil_bench_uniform(&s) - 0.5;
+        }
+    }
+
+    c->n = n;
+    c->d = d;
+    c->field.coordinates = (hil_matrix_t){ X, n, d, 0 };
+
+    double *Y = (double*)hil_bench_alloc(sizeof(double) * n * d);
+    memcpy(Y, X, sizeof(double) * n * d);
+    c->scratch.coordinates = (hil_matrix_t){ Y, n, d, 0 };
+
+    c->a = (double*)hil_bench_alloc(sizeof(double) * n * d);
+    c->b = (double*)hil_bench_alloc(sizeof(double) * n * d);
+    for (size_t i = 0; i < n * d; i++) {
+        c->a[i] = hil_bench_uniform(&s) + 0.5;
+        c->b[i] = hil_bench_uniform(&s) + 0.5;
+    }
+
+    c->deg = (double*)hil_bench_alloc(sizeof(double) * n);
+    c->out_a = (double*)hil_bench_alloc(sizeof(double) * n);
+    c->out_b = (double*)hil_bench_alloc(sizeof(double) * n);
+    c->labels = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * n);
+    c->sizes = (uint64_t*)hil_bench_alloc(sizeof(uint64_t) * n);
+
+    c->axes = (double*)hil_bench_alloc(sizeof(double) * HIL_PCA_MAX_AXES * d);
+    c->mean = (double*)hil_bench_alloc(sizeof(double) * d);
+    c->variance = (double*)hil_bench_alloc(sizeof(double) * HIL_PCA_MAX_AXES);
+
+    /* hil_pca_axes_batch input: the field split into equal row blocks. */
+    const size_t rows = (n >= HIL_BENCH_BATCH) ? n / HIL_BENCH_BATCH : 1;
+    for (size_t f = 0; f < HIL_BENCH_BATCH; f++) {
+        const size_t start = (f * rows < n) ? f * rows : 0;
+        c->batch[f].coordinates = (hil_matrix_t){ X + start * d, rows, d, 0 };
+    }
+    c->batch_axes = (double*)hil_bench_alloc(sizeof(double) * HIL_BENCH_BATCH * 2 * d);
+    c->batch_means = (double*)hil_bench_alloc(sizeof(double) * HIL_BENCH_BATCH * d);
+    c->batch_variances = (double*)hil_bench_alloc(sizeof(double) * HIL_BENCH_BATCH * 2);
+
+    /* Snapshot batches: consecutive row blocks, as a time series would be. */
+    c->tick_count = (n >= HIL_BENCH_TICK_ROWS) ? n / HIL_BENCH_TICK_ROWS : 1;
+    const size_t tick_rows = (n >= HIL_BENCH_TICK_ROWS) ? HIL_BENCH_TICK_ROWS : n;
+    c->ticks = (hil_field_t*)hil_bench_alloc(sizeof(hil_field_t) * c->tick_count);
+    for (size_t t = 0; t < c->tick_count; t++) {
+        c->ticks[t].coordinates = (hil_matrix_t){ X + t * tick_rows * d, tick_rows, d, 0 };
+    }
+    c->tick_summaries = (hil_field_summary_t*)hil_bench_alloc(
+        sizeof(hil_field_summary_t) * c->tick_count);
+    c->tick_centroids = (double*)hil_bench_alloc(sizeof(double) * c->tick_count * d);
+
+    float *X32 = (float*)hil_bench_alloc(sizeof(float) * n * d);
+    c->a_f32 = (float*)hil_bench_alloc(sizeof(float) * n * d);
+    c->b_f32 = (float*)hil_bench_alloc(sizeof(float) * n * d);
+    for (size_t i = 0; i < n * d; i++) {
+        X32[i] = (float)X[i];
+        c->a_f32[i] = (float)c->a[i];
+        c->b_f32[i] = (float)c->b[i];
+    }
+    c->field_f32.coordinates = (hil_matrix_f32_t){ X32, n, d, 0 };
+}
+
+/* Undirected edge list: each pair i < j kept with probability density. */
+static void hil_bench_graph(hil_bench_ctx_t *c, double density) {
+    const size_t n = c->n;
+    uint64_t s = 0x4752415048ull ^ (uint64_t)(density * 1e6) ^ n;
+    const double pairs = 0.5 * (double)n * (double)(n - 1);
+    size_t cap = (size_t)(pairs * density * 1.1) + 64;
+
+    hil_graph_t *g = &c->graph;
+    g->num_nodes = n;
+    g->num_edges = 0;
+    g->src = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * cap);
+    g->dst = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * cap);
+    g->weight = (double*)hil_bench_alloc(sizeof(double) * cap);
+
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = i + 1; j < n; j++) {
+            if (density < 1.0 && hil_bench_uniform(&s) >= density) continue;
+            if (g->num_edges == cap) {
+                cap *= 2;
+                g->src = (uint32_t*)realloc(g->src, sizeof(uint32_t) * cap);
+                g->dst = (uint32_t*)realloc(g->dst, sizeof(uint32_t) * cap);
+                g->weight = (double*)realloc(g->weight, sizeof(double) * cap);
+                if (!g->src || !g->dst || !g->weight) {
+                    fprintf(stderr, "hilbert_bench: out of memory\n");
+                    exit(1);
+                }
+            }
+            g->src[g->num_edges] = (uint32_t)i;
+            g->dst[g->num_edges] = (uint32_t)j;
+            g->weight[g->num_edges] = hil_bench_uniform(&s);
+            g->num_edges++;
+        }
+    }
+
+    c->density = density;
+    if (!hil_graph_build_csr(g, &c->csr)) {
+        fprintf(stderr, "hilbert_bench: hil_graph_build_csr failed\n");
+        exit(1);
+    }
+    if (!hil_graph_pack_csr(&c->csr, &c->packed)) {
+        fprintf(stderr, "hilbert_bench: hil_graph_pack_csr failed\n");
+        exit(1);
+    }
+
+    hil_graph_f32_t *g32 = &c->graph_f32;
+    g32->num_nodes = n;
+    g32->num_edges = g->num_edges;
+    g32->src = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * (g->num_edges + 1));
+    g32->dst = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * (g->num_edges + 1));
+    g32->weight = (float*)hil_bench_alloc(sizeof(float) * (g->num_edges + 1));
+    memcpy(g32->src, g->src, sizeof(uint32_t) * g->num_edges);
+    memcpy(g32->dst, g->dst, sizeof(uint32_t) * g->num_edges);
+    for (size_t e = 0; e < g->num_edges; e++) g32->weight[e] = (float)g->weight[e];
+    if (!hil_graph_build_csr_f32(g32, &c->csr_f32)) {
+        fprintf(stderr, "hilbert_bench: hil_graph_build_csr_f32 failed\n");
+        exit(1);
+    }
+}
+
+static void hil_bench_graph_free(hil_bench_ctx_t *c) {
+    hil_graph_free(&c->graph);
+    hil_graph_csr_free(&c->csr);
+    hil_graph_packed_free(&c->packed);
+    hil_graph_free(&c->cosine);
+    hil_graph_f32_free(&c->graph_f32);
+    hil_graph_csr_f32_free(&c->csr_f32);
+    hil_graph_f32_free(&c->cosine_f32);
+    memset(&c->graph, 0, sizeof(c->graph));
+    memset(&c->csr, 0, sizeof(c->csr));
+    memset(&c->packed, 0, sizeof(c->packed));
+    memset(&c->cosine, 0, sizeof(c->cosine));
+    memset(&c->graph_f32, 0, sizeof(c->graph_f32));
+    memset(&c->csr_f32, 0, sizeof(c->csr_f32));
+    memset(&c->cosine_f32, 0, sizeof(c->cosine_f32));
+}
+
+static void hil_bench_field_free(hil_bench_ctx_t *c) {
+    hil_bench_graph_free(c);
+    hil_field_free(&c->field);
+    hil_field_free(&c->scratch);
+    free(c->a);  free(c->b);
+    free(c->deg);  free(c->out_a);  free(c->out_b);
+    free(c->labels);  free(c->sizes);
+    free(c->axes);  free(c->mean);  free(c->variance);
+    free(c->batch_axes);  free(c->batch_means);  free(c->batch_variances);
+    free(c->ticks);  free(c->tick_summaries);  free(c->tick_centroids);
+    free(c->spectrum);
+    free(c->field_f32.coordinates.data);  free(c->a_f32);  free(c->b_f32);
+    hil_ann_free(c->ann);
+    free(c->ann_nodes);  free(c->ann_ids);  free(c->ann_weight);
+}
+
+
+/* ============================================================================
+ * Kernels Under Test
+ * ============================================================================
+ *
+ * Each entry runs one call and states its element count and nominal bytes.
+ * HIL_BENCH_GRAPH kernels are swept over density; HIL_BENCH_PARALLEL
+ * kernels over thread count. max_n caps kernels that are quadratic in n.
+ * Approximate kernels are scored once after timing (hil_bench_recall).
+ */
+
+#define HIL_BENCH_GRAPH    1u
+#define HIL_BENCH_PARALLEL 2u
+
+typedef struct {
+    double elements;
+    double bytes;
+    const char *unit;
+} hil_bench_model_t;
+
+typedef struct {
+    const char *name;
+    unsigned flags;
+    size_t max_n;
+    void (*run)(hil_bench_ctx_t *c);
+    hil_bench_model_t (*model)(const hil_bench_ctx_t *c);
+} hil_bench_t;
+
+static double hil_bench_coords(const hil_bench_ctx_t *c) {
+    return (double)c->n * (double)c->d;
+}
+
+static double hil_bench_pairs(const hil_bench_ctx_t *c) {
+    return 0.5 * (double)c->n * (double)(c->n - 1);
+}
+
+static double hil_bench_edge_bytes(const hil_bench_ctx_t *c) {
+    return (double)c->graph.num_edges * 16.0;
+}
+
+static double hil_bench_csr_bytes(const hil_bench_ctx_t *c) {
+    return (double)(c->n + 1) * 8.0 + (double)c->csr.num_edges * 12.0;
+}
+
+static double hil_bench_edge_bytes_f32(const hil_bench_ctx_t *c) {
+    return (double)c->graph.num_edges * 12.0;
+}
+
+static double hil_bench_csr_bytes_f32(const hil_bench_ctx_t *c) {
+    return (double)(c->n + 1) * 8.0 + (double)c->csr.num_edges * 8.0;
+}
+
+/* ---- Models ------------------------------------------------------------- */
+
+static hil_bench_model_t hil_model_coords_r1(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 8.0 * hil_bench_coords(c), "coord" };
+}
+
+static hil_bench_model_t hil_model_coords_r2(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 16.0 * hil_bench_coords(c), "coord" };
+}
+
+static hil_bench_model_t hil_model_coords_rw2(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 24.0 * hil_bench_coords(c), "coord" };
+}
+
+static hil_bench_model_t hil_model_coords_r1_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 4.0 * hil_bench_coords(c), "coord" };
+}
+
+static hil_bench_model_t hil_model_coords_r2_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 8.0 * hil_bench_coords(c), "coord" };
+}
+
+/* float32 source, double destination read and written. */
+static hil_bench_model_t hil_model_coords_rw2_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ hil_bench_coords(c), 20.0 * hil_bench_coords(c), "coord" };
+}
+
+static hil_bench_model_t hil_model_call(const hil_bench_ctx_t *c) {
+    (void)c;
+    return (hil_bench_model_t){ 1.0, 0.0, "call" };
+}
+
+static hil_bench_model_t hil_model_edges(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->graph.num_edges, hil_bench_edge_bytes(c) + 8.0 * (double)c->n, "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_build_csr(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->graph.num_edges, hil_bench_edge_bytes(c) + hil_bench_csr_bytes(c), "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_csr(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ (double)c->csr.num_edges, hil_bench_csr_bytes(c), "edge" };
+}
+
+static hil_bench_model_t hil_model_pack(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->csr.num_edges,
+        hil_bench_csr_bytes(c) + (double)hil_graph_packed_bytes(&c->packed),
+        "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_packed(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->csr.num_edges, (double)hil_graph_packed_bytes(&c->packed), "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_edges_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->graph.num_edges, hil_bench_edge_bytes_f32(c) + 8.0 * (double)c->n, "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_build_csr_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->graph.num_edges,
+        hil_bench_edge_bytes_f32(c) + hil_bench_csr_bytes_f32(c),
+        "edge"
+    };
+}
+
+static hil_bench_model_t hil_model_csr_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ (double)c->csr.num_edges, hil_bench_csr_bytes_f32(c), "edge" };
+}
+
+static hil_bench_model_t hil_model_loo(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        hil_bench_coords(c) + (double)c->graph.num_edges,
+        8.0 * hil_bench_coords(c) + 2.0 * hil_bench_edge_bytes(c) + 24.0 * (double)c->n,
+        "coord+edge"
+    };
+}
+
+static hil_bench_model_t hil_model_cosine(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        hil_bench_pairs(c), 8.0 * hil_bench_coords(c) + 16.0 * hil_bench_pairs(c), "pair"
+    };
+}
+
+static hil_bench_model_t hil_model_knn(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        hil_bench_pairs(c),
+        8.0 * hil_bench_coords(c) + 12.0 * (double)(c->n * HIL_BENCH_KNN_K),
+        "pair"
+    };
+}
+
+static hil_bench_model_t hil_model_ann_add(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){ (double)c->n, 16.0 * hil_bench_coords(c), "row" };
+}
+
+static hil_bench_model_t hil_model_ann_query(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        (double)c->n, 4.0 * (double)c->n + 12.0 * (double)(c->n * HIL_BENCH_KNN_K), "query"
+    };
+}
+
+static hil_bench_model_t hil_model_cosine_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        hil_bench_pairs(c), 4.0 * hil_bench_coords(c) + 12.0 * hil_bench_pairs(c), "pair"
+    };
+}
+
+static hil_bench_model_t hil_model_knn_f32(const hil_bench_ctx_t *c) {
+    return (hil_bench_model_t){
+        hil_bench_pairs(c),
+        4.0 * hil_bench_coords(c) + 8.0 * (double)(c->n * HIL_BENCH_KNN_K),
+        "pair"
+    };
+}
+
+/* ---- Math helpers --------------------------------------------------------- */
+
+static void hil_run_vec_dot(hil_bench_ctx_t *c) {
+    c->sink += hil_vec_dot(c->a, c->b, c->n * c->d);
+}
+
+static void hil_run_vec_norm(hil_bench_ctx_t *c) {
+    c->sink += hil_vec_norm(c->a, c->n * c->d);
+}
+
+static void hil_run_vec_zero(hil_bench_ctx_t *c) {
+    hil_vec_zero(c->scratch.coordinates.data, c->n * c->d);
+}
+
+static void hil_run_vec_add(hil_bench_ctx_t *c) {
+    hil_vec_add_inplace(c->scratch.coordinates.data, c->a, c->n * c->d);
+}
+
+static void hil_run_vec_scale(hil_bench_ctx_t *c) {
+    hil_vec_scale_inplace(c->scratch.coordinates.data, c->n * c->d, 0.5);
+}
+
+static void hil_run_vec_copy(hil_bench_ctx_t *c) {
+    hil_vec_copy(c->scratch.coordinates.data, c->a, c->n * c->d);
+}
+
+static void hil_run_vec_dot_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_vec_dot_f32(c->a_f32, c->b_f32, c->n * c->d);
+}
+
+static void hil_run_vec_norm_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_vec_norm_f32(c->a_f32, c->n * c->d);
+}
+
+static void hil_run_vec_add_f32(hil_bench_ctx_t *c) {
+    hil_vec_add_f32_inplace(c->scratch.coordinates.data, c->a_f32, c->n * c->d);
+}
+
+/* n row dots of length d, dispatched per call vs resolved once. */
+static void hil_run_vec_dot_rows(hil_bench_ctx_t *c) {
+    for (size_t r = 0; r < c->n; r++) {
+        c->sink += hil_vec_dot(c->a + r * c->d, c->b + r * c->d, c->d);
+    }
+}
+
+static void hil_run_vec_dot_for_rows(hil_bench_ctx_t *c) {
+    const hil_vec_dot_fn dot = hil_vec_dot_for(c->d);
+    for (size_t r = 0; r < c->n; r++) {
+        c->sink += dot(c->a + r * c->d, c->b + r * c->d, c->d);
+    }
+}
+
+static void hil_run_vec_dot_f32_for_rows(hil_bench_ctx_t *c) {
+    const hil_vec_dot_f32_fn dot = hil_vec_dot_f32_for(c->d);
+    for (size_t r = 0; r < c->n; r++) {
+        c->sink += dot(c->a_f32 + r * c->d, c->b_f32 + r * c->d, c->d);
+    }
+}
+
+/* Scalar helpers are timed over the n * d inputs in a[] (all in (0.5, 1.5)). */
+#define HIL_BENCH_SCALAR(fn, expr)                                  \
+    static void fn(hil_bench_ctx_t *c) {                            \
+        const size_t len = c->n * c->d;                             \
+        double acc = 0.0;                                           \
+        for (size_t i = 0; i < len; i++) {                          \
+            const double x = c->a[i];                               \
+            acc += (expr);                                          \
+        }                                                           \
+        c->sink += acc;                                             \
+    }
+
+HIL_BENCH_SCALAR(hil_run_clamp_min, hil_clamp_min(x - 1.0, HIL_EPS))
+HIL_BENCH_SCALAR(hil_run_safe_log, hil_safe_log(x))
+HIL_BENCH_SCALAR(hil_run_safe_log1p, hil_safe_log1p(x - 0.5))
+HIL_BENCH_SCALAR(hil_run_safe_exp, hil_safe_exp(x))
+HIL_BENCH_SCALAR(hil_run_decay_exponential, hil_decay_exponential(x, 0.75))
+HIL_BENCH_SCALAR(hil_run_decay_linear, hil_decay_linear(x, 1.25))
+HIL_BENCH_SCALAR(hil_run_decay_power, hil_decay_power(x, 1.5))
+HIL_BENCH_SCALAR(hil_run_det_sign, hil_det_sign(i) * x)
+
+#undef HIL_BENCH_SCALAR
+
+/* ---- Workspace ------------------------------------------------------------ */
+
+/* One reset plus 64 allocations of mixed size, the pattern of a _ws call. */
+static void hil_run_workspace(hil_bench_ctx_t *c) {
+    hil_workspace_reset(&c->ws);
+    for (size_t i = 0; i < 64; i++) {
+        void *p = hil_workspace_alloc(&c->ws, 64 + (i % 8) * 1024);
+        c->sink += (p != NULL);
+    }
+}
+
+/* ---- Graph structure and diagnostics -------------------------------------- */
+
+static void hil_run_graph_validate(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_validate(&c->graph);
+}
+
+static void hil_run_graph_degree(hil_bench_ctx_t *c) {
+    hil_graph_degree(&c->graph, c->deg);
+}
+
+static void hil_run_graph_density(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_density(&c->graph);
+}
+
+static void hil_run_graph_entropy(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy(&c->graph);
+}
+
+static void hil_run_graph_entropy_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy_ws(&c->graph, &c->ws);
+}
+
+static void hil_run_graph_cc(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_connected_components(&c->graph);
+}
+
+static void hil_run_graph_cc_ws(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_connected_components_ws(&c->graph, &c->ws);
+}
+
+static void hil_run_graph_components(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_components(&c->graph, c->labels, c->sizes);
+}
+
+static void hil_run_graph_components_ws(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_components_ws(&c->graph, c->labels, c->sizes, &c->ws);
+}
+
+static void hil_run_graph_metrics(hil_bench_ctx_t *c) {
+    hil_graph_metrics_t m;
+    c->sink += hil_graph_metrics(&c->graph, &m, c->deg) ? m.degree_entropy : 0.0;
+}
+
+static void hil_run_graph_metrics_ws(hil_bench_ctx_t *c) {
+    hil_graph_metrics_t m;
+    c->sink += hil_graph_metrics_ws(&c->graph, &m, c->deg, &c->ws) ? m.degree_entropy : 0.0;
+}
+
+static void hil_run_graph_build_csr(hil_bench_ctx_t *c) {
+    hil_graph_csr_t csr;
+    if (hil_graph_build_csr(&c->graph, &csr)) {
+        c->sink += (double)csr.num_edges;
+        hil_graph_csr_free(&csr);
+    }
+}
+
+static void hil_run_graph_degree_csr(hil_bench_ctx_t *c) {
+    hil_graph_degree_csr(&c->csr, c->deg);
+}
+
+static void hil_run_graph_density_csr(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_density_csr(&c->csr);
+}
+
+static void hil_run_graph_entropy_csr(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy_csr(&c->csr);
+}
+
+static void hil_run_graph_cc_csr(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_connected_components_csr(&c->csr);
+}
+
+static void hil_run_graph_cc_csr_ws(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_connected_components_csr_ws(&c->csr, &c->ws);
+}
+
+static void hil_run_graph_pack_csr(hil_bench_ctx_t *c) {
+    hil_graph_packed_t packed;
+    if (hil_graph_pack_csr(&c->csr, &packed)) {
+        c->sink += (double)packed.num_edges;
+        hil_graph_packed_free(&packed);
+    }
+}
+
+static void hil_run_graph_degree_packed(hil_bench_ctx_t *c) {
+    hil_graph_degree_packed(&c->packed, c->deg);
+}
+
+static void hil_run_graph_entropy_packed(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy_packed(&c->packed);
+}
+
+static void hil_run_graph_cc_packed_ws(hil_bench_ctx_t *c) {
+    c->sink += (double)hil_graph_connected_components_packed_ws(&c->packed, &c->ws);
+}
+
+/* ---- Structural construction ---------------------------------------------- */
+
+static void hil_run_build_cosine(hil_bench_ctx_t *c) {
+    if (!c->cosine.src) {
+        const size_t m = c->n * (c->n - 1) / 2;
+        c->cosine.src = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * m);
+        c->cosine.dst = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * m);
+        c->cosine.weight = (double*)hil_bench_alloc(sizeof(double) * m);
+        c->cosine.num_edges = m;
+    }
+    c->sink += hil_graph_build_cosine(&c->field, &c->cosine);
+}
+
+static void hil_run_build_knn_csr(hil_bench_ctx_t *c) {
+    hil_graph_csr_t csr;
+    if (hil_graph_build_knn_csr(&c->field, HIL_BENCH_KNN_K, 0.0, &csr)) {
+        c->sink += (double)csr.num_edges;
+        hil_graph_csr_free(&csr);
+    }
+}
+
+/* ---- ANN index ------------------------------------------------------------ */
+
+static hil_ann_t *hil_bench_ann_build(const hil_bench_ctx_t *c) {
+    const hil_ann_params_t params = { HIL_ANN_DEFAULT_M, HIL_ANN_DEFAULT_EF_CONSTRUCTION, 0 };
+    hil_ann_t *ann = hil_ann_create(c->d, &params);
+    if (ann && !hil_ann_add(ann, &c->field)) {
+        hil_ann_free(ann);
+        ann = NULL;
+    }
+    return ann;
+}
+
+static void hil_run_ann_add(hil_bench_ctx_t *c) {
+    hil_ann_t *ann = hil_bench_ann_build(c);
+    if (ann) {
+        c->sink += (double)hil_ann_max_level(ann);
+        hil_ann_free(ann);
+    }
+}
+
+static void hil_run_ann_query(hil_bench_ctx_t *c) {
+    if (!c->ann) {
+        c->ann = hil_bench_ann_build(c);
+        if (!c->ann) {
+            fprintf(stderr, "hilbert_bench: ANN index build failed\n");
+            exit(1);
+        }
+        c->ann_nodes = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * c->n);
+        c->ann_ids = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * c->n * HIL_BENCH_KNN_K);
+        c->ann_weight = (double*)hil_bench_alloc(sizeof(double) * c->n * HIL_BENCH_KNN_K);
+        for (size_t i = 0; i < c->n; i++) c->ann_nodes[i] = (uint32_t)i;
+    }
+    c->sink += hil_ann_query_nodes(c->ann, c->ann_nodes, c->n, HIL_BENCH_KNN_K, HIL_BENCH_ANN_EF,
+                                   c->ann_ids, c->ann_weight);
+}
+
+/* Fraction of the exact kNN edges among the last query's results. */
+static double hil_recall_ann_query(hil_bench_ctx_t *c) {
+    hil_graph_csr_t exact;
+    if (!c->ann_ids || !hil_graph_build_knn_csr(&c->field, HIL_BENCH_KNN_K, 0.0, &exact)) return -1.0;
+
+    size_t hits = 0;
+    for (size_t i = 0; i < c->n; i++) {
+        const uint32_t *found = c->ann_ids + i * HIL_BENCH_KNN_K;
+        for (uint64_t e = exact.offsets[i]; e < exact.offsets[i + 1]; e++) {
+            for (size_t t = 0; t < HIL_BENCH_KNN_K; t++) {
+                if (found[t] == exact.indices[e]) {
+                    hits++;
+                    break;
+                }
+            }
+        }
+    }
+    const double recall = exact.num_edges ? (double)hits / (double)exact.num_edges : 1.0;
+    hil_graph_csr_free(&exact);
+    return recall;
+}
+
+/* Leading Gram eigenpairs without forming the n x n matrix. */
+static void hil_run_field_spectrum(hil_bench_ctx_t *c) {
+    const size_t k = (HIL_BENCH_SPECTRUM_K < c->n) ? HIL_BENCH_SPECTRUM_K : c->n;
+    double values[HIL_BENCH_SPECTRUM_K];
+    if (!c->spectrum) {
+        c->spectrum = (double*)hil_bench_alloc(sizeof(double) * HIL_BENCH_SPECTRUM_K * c->n);
+    }
+    c->sink += hil_field_spectrum(&c->field, HIL_SPECTRUM_GRAM, k, 0, 100, 1e-10, NULL,
+                                  values, c->spectrum, NULL);
+    c->sink += values[0];
+}
+
+/* ---- Mixed precision (float32 storage) ------------------------------------ */
+
+static void hil_run_graph_validate_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_validate_f32(&c->graph_f32);
+}
+
+static void hil_run_graph_entropy_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy_f32_ws(&c->graph_f32, &c->ws);
+}
+
+static void hil_run_graph_metrics_f32(hil_bench_ctx_t *c) {
+    hil_graph_metrics_t m;
+    c->sink += hil_graph_metrics_f32_ws(&c->graph_f32, &m, c->deg, &c->ws) ? m.degree_entropy : 0.0;
+}
+
+static void hil_run_graph_build_csr_f32(hil_bench_ctx_t *c) {
+    hil_graph_csr_f32_t csr;
+    if (hil_graph_build_csr_f32(&c->graph_f32, &csr)) {
+        c->sink += (double)csr.num_edges;
+        hil_graph_csr_f32_free(&csr);
+    }
+}
+
+static void hil_run_graph_entropy_csr_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_graph_entropy_csr_f32(&c->csr_f32);
+}
+
+static void hil_run_build_cosine_f32(hil_bench_ctx_t *c) {
+    if (!c->cosine_f32.src) {
+        const size_t m = c->n * (c->n - 1) / 2;
+        c->cosine_f32.src = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * m);
+        c->cosine_f32.dst = (uint32_t*)hil_bench_alloc(sizeof(uint32_t) * m);
+        c->cosine_f32.weight = (float*)hil_bench_alloc(sizeof(float) * m);
+        c->cosine_f32.num_edges = m;
+    }
+    c->sink += hil_graph_build_cosine_f32(&c->field_f32, &c->cosine_f32);
+}
+
+static void hil_run_build_knn_csr_f32(hil_bench_ctx_t *c) {
+    hil_graph_csr_f32_t csr;
+    if (hil_graph_build_knn_csr_f32(&c->field_f32, HIL_BENCH_KNN_K, 0.0, &csr)) {
+        c->sink += (double)csr.num_edges;
+        hil_graph_csr_f32_free(&csr);
+    }
+}
+
+static void hil_run_field_coherence_f32(hil_bench_ctx_t *c) {
+    c->sink += hil_field_coherence_f32_ws(&c->field_f32, &c->ws);
+}
+
+static void hil_run_field_summary_f32(hil_bench_ctx_t *c) {
+    hil_field_summary_t s;
+    c->sink += hil_field_summary_f32_ws(&c->field_f32, &s, c->out_a, &c->ws) ? s.coherence : 0.0;
+}
+
+/* ---- Field diagnostics and stability -------------------------------------- */
+
+static void hil_run_field_mean_norm(hil_bench_ctx_t *c) {
+    c->sink += hil_field_mean_norm(&c->field);
+}
+
+static void hil_run_field_coherence(hil_bench_ctx_t *c) {
+    c->sink += hil_field_coherence(&c->field);
+}
+
+static void hil_run_field_coherence_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_field_coherence_ws(&c->field, &c->ws);
+}
+
+static void hil_run_field_summary(hil_bench_ctx_t *c) {
+    hil_field_summary_t s;
+    c->sink += hil_field_summary(&c->field, &s, c->out_a) ? s.coherence : 0.0;
+}
+
+static void hil_run_field_summary_ws(hil_bench_ctx_t *c) {
+    hil_field_summary_t s;
+    c->sink += hil_field_summary_ws(&c->field, &s, c->out_a, &c->ws) ? s.coherence : 0.0;
+}
+
+static void hil_run_stability(hil_bench_ctx_t *c) {
+    c->sink += hil_epistemic_stability(&c->field, NULL);
+}
+
+static void hil_run_stability_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_epistemic_stability_ws(&c->field, NULL, &c->ws);
+}
+
+static const double hil_bench_epsilons[HIL_BENCH_CURVE] = { 1e-6, 1e-4, 1e-3, 1e-2 };
+
+static void hil_run_stability_curve(hil_bench_ctx_t *c) {
+    double out[HIL_BENCH_CURVE];
+    if (hil_epistemic_stability_curve(&c->field, NULL, hil_bench_epsilons, HIL_BENCH_CURVE, out)) {
+        c->sink += out[0];
+    }
+}
+
+static void hil_run_stability_curve_ws(hil_bench_ctx_t *c) {
+    double out[HIL_BENCH_CURVE];
+    if (hil_epistemic_stability_curve_ws(&c->field, NULL, hil_bench_epsilons,
+                                         HIL_BENCH_CURVE, out, &c->ws)) {
+        c->sink += out[0];
+    }
+}
+
+static void hil_run_loo(hil_bench_ctx_t *c) {
+    c->sink += hil_leave_one_out_diagnostics(&c->field, &c->graph, c->out_a, c->out_b);
+}
+
+static void hil_run_loo_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_leave_one_out_diagnostics_ws(&c->field, &c->graph, c->out_a, c->out_b, &c->ws);
+}
+
+static void hil_run_field_perturb(hil_bench_ctx_t *c) {
+    hil_field_perturb(&c->scratch, 1e-6);
+}
+
+/* ---- Geometric delta ------------------------------------------------------ */
+
+static void hil_run_pca_axes(hil_bench_ctx_t *c) {
+    c->sink += hil_pca_axes(&c->field, 2, NULL, 200, 1e-10, c->axes, c->mean, c->variance);
+}
+
+static void hil_run_pca_axes_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_pca_axes_ws(&c->field, 2, NULL, 200, 1e-10,
+                               c->axes, c->mean, c->variance, &c->ws);
+}
+
+static void hil_run_pca_axes_batch(hil_bench_ctx_t *c) {
+    c->sink += hil_pca_axes_batch(c->batch, HIL_BENCH_BATCH, 2, NULL, 200, 1e-10,
+                                  c->batch_axes, c->batch_means, c->batch_variances);
+}
+
+static void hil_run_pca_axes_batch_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_pca_axes_batch_ws(c->batch, HIL_BENCH_BATCH, 2, NULL, 200, 1e-10,
+                                     c->batch_axes, c->batch_means, c->batch_variances, &c->ws);
+}
+
+/* ---- Snapshot batches ----------------------------------------------------- */
+
+/* Per-snapshot calls: the overhead hil_field_summary_batch removes. */
+static void hil_run_field_summary_ticks(hil_bench_ctx_t *c) {
+    for (size_t t = 0; t < c->tick_count; t++) {
+        c->sink += hil_field_summary_ws(&c->ticks[t], &c->tick_summaries[t], NULL, &c->ws);
+    }
+}
+
+static void hil_run_field_summary_batch_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_field_summary_batch_ws(c->ticks, c->tick_count, c->tick_summaries,
+                                          c->tick_centroids, &c->ws);
+}
+
+static void hil_run_macrostate_dispersion_batch_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_macrostate_dispersion_batch_ws(c->a, c->n / HIL_BENCH_MODULI, HIL_BENCH_MODULI,
+                                                  c->d, HIL_NORM_L2, c->out_a, &c->ws);
+}
+
+static void hil_run_geometry_delta_loo(hil_bench_ctx_t *c) {
+    c->sink += hil_geometry_delta_loo(&c->field, 200, 1e-10, c->out_a);
+}
+
+static void hil_run_geometry_delta_loo_ws(hil_bench_ctx_t *c) {
+    c->sink += hil_geometry_delta_loo_ws(&c->field, 200, 1e-10, c->out_a, &c->ws);
+}
+
+static const hil_bench_t hil_benchmarks[] = {
+    /* hilbert_math.h */
+    { "hil_vec_dot",             0, 0, hil_run_vec_dot,            hil_model_coords_r2 },
+    { "hil_vec_norm",            0, 0, hil_run_vec_norm,           hil_model_coords_r1 },
+    { "hil_vec_zero",            0, 0, hil_run_vec_zero,           hil_model_coords_r1 },
+    { "hil_vec_add_inplace",     0, 0, hil_run_vec_add,            hil_model_coords_rw2 },
+    { "hil_vec_scale_inplace",   0, 0, hil_run_vec_scale,          hil_model_coords_r2 },
+    { "hil_vec_copy",            0, 0, hil_run_vec_copy,           hil_model_coords_r2 },
+    { "hil_clamp_min",           0, 0, hil_run_clamp_min,          hil_model_coords_r1 },
+    { "hil_safe_log",            0, 0, hil_run_safe_log,           hil_model_coords_r1 },
+    { "hil_safe_log1p",          0, 0, hil_run_safe_log1p,         hil_model_coords_r1 },
+    { "hil_safe_exp",            0, 0, hil_run_safe_exp,           hil_model_coords_r1 },
+    { "hil_decay_exponential",   0, 0, hil_run_decay_exponential,  hil_model_coords_r1 },
+    { "hil_decay_linear",        0, 0, hil_run_decay_linear,       hil_model_coords_r1 },
+    { "hil_decay_power",         0, 0, hil_run_decay_power,        hil_model_coords_r1 },
+    { "hil_det_sign",            0, 0, hil_run_det_sign,           hil_model_coords_r1 },
+    { "hil_vec_dot_f32",         0, 0, hil_run_vec_dot_f32,        hil_model_coords_r2_f32 },
+    { "hil_vec_norm_f32",        0, 0, hil_run_vec_norm_f32,       hil_model_coords_r1_f32 },
+    { "hil_vec_add_f32_inplace", 0, 0, hil_run_vec_add_f32,        hil_model_coords_rw2_f32 },
+    { "hil_vec_dot_rows",        0, 0, hil_run_vec_dot_rows,       hil_model_coords_r2 },
+    { "hil_vec_dot_for_rows",    0, 0, hil_run_vec_dot_for_rows,   hil_model_coords_r2 },
+    { "hil_vec_dot_f32_for_rows", 0, 0, hil_run_vec_dot_f32_for_rows, hil_model_coords_r2_f32 },
+
+    /* hilbert_native.h: workspace */
+    { "hil_workspace_alloc",     0, 0, hil_run_workspace,          hil_model_call },
+
+    /* hilbert_native.h: edge-list graphs */
+    { "hil_graph_validate",      HIL_BENCH_GRAPH, 0, hil_run_graph_validate, hil_model_edges },
+    { "hil_graph_degree",        HIL_BENCH_GRAPH, 0, hil_run_graph_degree,   hil_model_edges },
+    { "hil_graph_density",       HIL_BENCH_GRAPH, 0, hil_run_graph_density,  hil_model_call },
+    { "hil_graph_entropy",       HIL_BENCH_GRAPH, 0, hil_run_graph_entropy,    hil_model_edges },
+    { "hil_graph_entropy_ws",    HIL_BENCH_GRAPH, 0, hil_run_graph_entropy_ws, hil_model_edges },
+    { "hil_graph_connected_components",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_cc, hil_model_edges },
+    { "hil_graph_connected_components_ws",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_cc_ws, hil_model_edges },
+    { "hil_graph_components",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_components, hil_model_edges },
+    { "hil_graph_components_ws",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_components_ws, hil_model_edges },
+    { "hil_graph_metrics",       HIL_BENCH_GRAPH, 0, hil_run_graph_metrics,    hil_model_edges },
+    { "hil_graph_metrics_ws",    HIL_BENCH_GRAPH, 0, hil_run_graph_metrics_ws, hil_model_edges },
+
+    /* hilbert_native.h: CSR views */
+    { "hil_graph_build_csr",     HIL_BENCH_GRAPH, 0, hil_run_graph_build_csr,   hil_model_build_csr },
+    { "hil_graph_degree_csr",    HIL_BENCH_GRAPH, 0, hil_run_graph_degree_csr,  hil_model_csr },
+    { "hil_graph_density_csr",   HIL_BENCH_GRAPH, 0, hil_run_graph_density_csr, hil_model_call },
+    { "hil_graph_entropy_csr",   HIL_BENCH_GRAPH, 0, hil_run_graph_entropy_csr, hil_model_csr },
+    { "hil_graph_connected_components_csr",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_cc_csr, hil_model_csr },
+    { "hil_graph_connected_components_csr_ws",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_cc_csr_ws, hil_model_csr },
+
+    /* hilbert_native.h: packed views */
+    { "hil_graph_pack_csr",      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0,
+      hil_run_graph_pack_csr, hil_model_pack },
+    { "hil_graph_degree_packed", HIL_BENCH_GRAPH, 0, hil_run_graph_degree_packed,  hil_model_packed },
+    { "hil_graph_entropy_packed", HIL_BENCH_GRAPH, 0, hil_run_graph_entropy_packed, hil_model_packed },
+    { "hil_graph_connected_components_packed_ws",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_graph_cc_packed_ws, hil_model_packed },
+
+    /* hilbert_native.h: construction */
+    { "hil_graph_build_cosine",  0, 4096, hil_run_build_cosine,  hil_model_cosine },
+    { "hil_graph_build_knn_csr", 0, 4096, hil_run_build_knn_csr, hil_model_knn },
+
+    /* hilbert_native.h: linear operators */
+    /* nominal: one operator application (two passes) per call */
+    { "hil_field_spectrum",      HIL_BENCH_PARALLEL, 0, hil_run_field_spectrum, hil_model_coords_r2 },
+
+    /* hilbert_native.h: field diagnostics and stability */
+    { "hil_field_mean_norm",     0, 0, hil_run_field_mean_norm,    hil_model_coords_r1 },
+    { "hil_field_coherence",     0, 0, hil_run_field_coherence,    hil_model_coords_r1 },
+    { "hil_field_coherence_ws",  0, 0, hil_run_field_coherence_ws, hil_model_coords_r1 },
+    { "hil_field_summary",       0, 0, hil_run_field_summary,      hil_model_coords_r1 },
+    { "hil_field_summary_ws",    0, 0, hil_run_field_summary_ws,   hil_model_coords_r1 },
+    { "hil_epistemic_stability", 0, 0, hil_run_stability,          hil_model_coords_r1 },
+    { "hil_epistemic_stability_ws", 0, 0, hil_run_stability_ws,    hil_model_coords_r1 },
+    { "hil_epistemic_stability_curve",    0, 0, hil_run_stability_curve,    hil_model_coords_r1 },
+    { "hil_epistemic_stability_curve_ws", 0, 0, hil_run_stability_curve_ws, hil_model_coords_r1 },
+    { "hil_leave_one_out_diagnostics",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_loo, hil_model_loo },
+    { "hil_leave_one_out_diagnostics_ws",
+      HIL_BENCH_GRAPH | HIL_BENCH_PARALLEL, 0, hil_run_loo_ws, hil_model_loo },
+    { "hil_field_perturb",       0, 0, hil_run_field_perturb,      hil_model_coords_r2 },
+
+    /* hilbert_native.h: mixed precision (float32 storage) */
+    { "hil_graph_validate_f32",  HIL_BENCH_GRAPH, 0, hil_run_graph_validate_f32, hil_model_edges_f32 },
+    { "hil_graph_entropy_f32_ws", HIL_BENCH_GRAPH, 0, hil_run_graph_entropy_f32, hil_model_edges_f32 },
+    { "hil_graph_metrics_f32_ws", HIL_BENCH_GRAPH, 0, hil_run_graph_metrics_f32, hil_model_edges_f32 },
+    { "hil_graph_build_csr_f32", HIL_BENCH_GRAPH, 0, hil_run_graph_build_csr_f32,
+      hil_model_build_csr_f32 },
+    { "hil_graph_entropy_csr_f32", HIL_BENCH_GRAPH, 0, hil_run_graph_entropy_csr_f32,
+      hil_model_csr_f32 },
+    { "hil_graph_build_cosine_f32",  0, 4096, hil_run_build_cosine_f32,  hil_model_cosine_f32 },
+    { "hil_graph_build_knn_csr_f32", 0, 4096, hil_run_build_knn_csr_f32, hil_model_knn_f32 },
+    { "hil_field_coherence_f32_ws", 0, 0, hil_run_field_coherence_f32, hil_model_coords_r1_f32 },
+    { "hil_field_summary_f32_ws",   0, 0, hil_run_field_summary_f32,   hil_model_coords_r1_f32 },
+
+    /* hilbert_native.h: geometric delta */
+    { "hil_pca_axes",            0, 0, hil_run_pca_axes,    hil_model_coords_r1 },
+    { "hil_pca_axes_ws",         0, 0, hil_run_pca_axes_ws, hil_model_coords_r1 },
+    { "hil_pca_axes_batch",      HIL_BENCH_PARALLEL, 0, hil_run_pca_axes_batch,    hil_model_coords_r1 },
+    { "hil_pca_axes_batch_ws",   HIL_BENCH_PARALLEL, 0, hil_run_pca_axes_batch_ws, hil_model_coords_r1 },
+    { "hil_geometry_delta_loo",  HIL_BENCH_PARALLEL, 2048, hil_run_geometry_delta_loo, hil_model_coords_r1 },
+    { "hil_geometry_delta_loo_ws",
+      HIL_BENCH_PARALLEL, 2048, hil_run_geometry_delta_loo_ws, hil_model_coords_r1 },
+
+    /* hilbert_native.h: snapshot batches */
+    { "hil_field_summary_ticks", 0, 0, hil_run_field_summary_ticks, hil_model_coords_r1 },
+    { "hil_field_summary_batch_ws",
+      HIL_BENCH_PARALLEL, 0, hil_run_field_summary_batch_ws, hil_model_coords_r1 },
+    { "hil_macrostate_dispersion_batch_ws",
+      HIL_BENCH_PARALLEL, 0, hil_run_macrostate_dispersion_batch_ws, hil_model_coords_r1 },
+
+    /* hilbert_ann.h */
+    { "hil_ann_add",             0, 4096, hil_run_ann_add, hil_model_ann_add },
+    { "hil_ann_query_nodes",     HIL_BENCH_PARALLEL, 4096, hil_run_ann_query, hil_model_ann_query },
+};
+
+#define HIL_BENCH_COUNT (sizeof(hil_benchmarks) / sizeof(hil_benchmarks[0]))
+
+/* Recall of an approximate kernel's last run; < 0 for exact kernels. */
+static double hil_bench_recall(const hil_bench_t *b, hil_bench_ctx_t *c) {
+    if (b->run == hil_run_ann_query) return hil_recall_ann_query(c);
+    return -1.0;
+}
+
+
+/* ============================================================================
+ * Timing
+ * ============================================================================
+ */
+
+typedef struct {
+    const char *name;
+    const char *unit;
+    size_t n, d, edges;
+    double density;             /* < 0: not swept (field-only kernel) */
+    int threads;
+    size_t reps;
+    double best_ns, median_ns;
+    double ns_per_element;
+    double gb_per_s;
+    double recall;              /* < 0: not an approximate kernel */
+} hil_bench_result_t;
+
+static double hil_bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static int hil_bench_cmp(const void *a, const void *b) {
+    const double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+/* One warm-up call, then repeat until min_time_ms has elapsed (at least 3
+   and at most HIL_BENCH_MAX_SAMPLES calls). */
+static hil_bench_result_t hil_bench_measure(
+    const hil_bench_t *b,
+    hil_bench_ctx_t *c,
+    double min_time_ms
+) {
+    static double samples[HIL_BENCH_MAX_SAMPLES];
+    size_t reps = 0;
+    double total = 0.0;
+
+    b->run(c);
+    while (reps < HIL_BENCH_MAX_SAMPLES && (reps < 3 || total < min_time_ms * 1e6)) {
+        const double t0 = hil_bench_now_ns();
+        b->run(c);
+        samples[reps] = hil_bench_now_ns() - t0;
+        total += samples[reps];
+        reps++;
+    }
+    qsort(samples, reps, sizeof(double), hil_bench_cmp);
+
+    const hil_bench_model_t m = b->model(c);
+    hil_bench_result_t r;
+    r.name = b->name;
+    r.unit = m.unit;
+    r.n = c->n;
+    r.d = c->d;
+    r.edges = (b->flags & HIL_BENCH_GRAPH) ? c->graph.num_edges : 0;
+    r.density = (b->flags & HIL_BENCH_GRAPH) ? c->density : -1.0;
+    r.threads = 1;
+    r.reps = reps;
+    r.best_ns = samples[0];
+    r.median_ns = samples[reps / 2];
+    r.ns_per_element = (m.elements > 0.0) ? r.best_ns / m.elements : 0.0;
+    r.gb_per_s = (r.best_ns > 0.0) ? m.bytes / r.best_ns : 0.0;
+    r.recall = hil_bench_recall(b, c);
+    return r;
+}
+
+
+/* ============================================================================
+ * Output and Baselines
+ * ============================================================================
+ */
+
+static void hil_bench_json_result(FILE *f, const hil_bench_result_t *r, int last) {
+    fprintf(f, "    {\"name\": \"%s\", \"unit\": \"%s\", \"n\": %zu, \"d\": %zu, ",
+            r->name, r->unit, r->n, r->d);
+    if (r->density < 0.0) {
+        fprintf(f, "\"density\": null, ");
+    } else {
+        fprintf(f, "\"density\": %.6g, ", r->density);
+    }
+    fprintf(f, "\"edges\": %zu, \"threads\": %d, \"reps\": %zu, "
+               "\"best_ns\": %.1f, \"median_ns\": %.1f, "
+               "\"ns_per_element\": %.6g, \"gb_per_s\": %.6g, ",
+            r->edges, r->threads, r->reps, r->best_ns, r->median_ns,
+            r->ns_per_element, r->gb_per_s);
+    if (r->recall < 0.0) {
+        fprintf(f, "\"recall\": null}%s\n", last ? "" : ",");
+    } else {
+        fprintf(f, "\"recall\": %.6g}%s\n", r->recall, last ? "" : ",");
+    }
+}
+
+static void hil_bench_json(
+    FILE *f,
+    const hil_bench_config_t *cfg,
+    const hil_bench_result_t *results,
+    size_t count
+) {
+    int max_threads = 1, openmp = 0;
+    #ifdef _OPENMP
+    max_threads = omp_get_max_threads();
+    openmp = 1;
+    #endif
+
+    fprintf(f, "{\n");
+    fprintf(f, "  \"schema\": \"hil-native-bench/1\",\n");
+    fprintf(f, "  \"vec_backend\": \"%s\",\n", hil_vec_backend());
+    fprintf(f, "  \"openmp\": %s,\n", openmp ? "true" : "false");
+    fprintf(f, "  \"max_threads\": %d,\n", max_threads);
+    fprintf(f, "  \"min_time_ms\": %.6g,\n", cfg->min_time_ms);
+    fprintf(f, "  \"results\": [\n");
+    for (size_t i = 0; i < count; i++) hil_bench_json_result(f, &results[i], i + 1 == count);
+    fprintf(f, "  ]\n}\n");
+}
+
+typedef struct {
+    char name[96];
+    size_t n, d;
+    double density;
+    int threads;
+    double ns_per_element;
+} hil_bench_baseline_t;
+
+static const char *hil_bench_field_after(const char *line, const char *key) {
+    const char *p = strstr(line, key);
+    return p ? p + strlen(key) : NULL;
+}
+
+/* Parse one result line as written by hil_bench_json_result. */
+static int hil_bench_parse_line(const char *line, hil_bench_baseline_t *out) {
+    const char *p = hil_bench_field_after(line, "\"name\": \"");
+    if (!p) return 0;
+    const char *q = strchr(p, '"');
+    if (!q || (size_t)(q - p) >= sizeof(out->name)) return 0;
+    memcpy(out->name, p, (size_t)(q - p));
+    out->name[q - p] = '\0';
+
+    const char *n = hil_bench_field_after(line, "\"n\": ");
+    const char *d = hil_bench_field_after(line, "\"d\": ");
+    const char *den = hil_bench_field_after(line, "\"density\": ");
+    const char *t = hil_bench_field_after(line, "\"threads\": ");
+    const char *ns = hil_bench_field_after(line, "\"ns_per_element\": ");
+    if (!n || !d || !den || !t || !ns) return 0;
+
+    out->n = (size_t)strtoull(n, NULL, 10);
+    out->d = (size_t)strtoull(d, NULL, 10);
+    out->density = (strncmp(den, "null", 4) == 0) ? -1.0 : strtod(den, NULL);
+    out->threads = (int)strtol(t, NULL, 10);
+    out->ns_per_element = strtod(ns, NULL);
+    return 1;
+}
+
+/* Returns the number of regressions, or -1 if the baseline is unreadable. */
+static long hil_bench_compare(
+    const char *path,
+    double max_slowdown,
+    const hil_bench_result_t *results,
+    size_t count
+) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "hilbert_bench: cannot read baseline %s\n", path);
+        return -1;
+    }
+
+    long regressions = 0;
+    size_t matched = 0;
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        hil_bench_baseline_t base;
+        if (!hil_bench_parse_line(line, &base)) continue;
+
+        for (size_t i = 0; i < count; i++) {
+            const hil_bench_result_t *r = &results[i];
+            if (strcmp(r->name, base.name) != 0 || r->n != base.n || r->d != base.d ||
+                r->threads != base.threads || fabs(r->density - base.density) > 1e-9) {
+                continue;
+            }
+            matched++;
+            if (base.ns_per_element > 0.0 &&
+                r->ns_per_element > base.ns_per_element * (1.0 + max_slowdown)) {
+                fprintf(stderr,
+                        "REGRESSION %-40s n=%zu d=%zu threads=%d: %.4g -> %.4g ns/elem (+%.0f%%)\n",
+                        r->name, r->n, r->d, r->threads, base.ns_per_element, r->ns_per_element,
+                        100.0 * (r->ns_per_element / base.ns_per_element - 1.0));
+                regressions++;
+            }
+            break;
+        }
+    }
+    fclose(f);
+
+    fprintf(stderr, "baseline: %zu matched, %ld regressed (max slowdown %.0f%%)\n",
+            matched, regressions, 100.0 * max_slowdown);
+    return regressions;
+}
+
+
+/* ============================================================================
+ * Driver
+ * ============================================================================
+ */
+
+static size_t hil_bench_parse_sizes(const char *s, size_t *out) {
+    size_t count = 0;
+    while (*s && count < HIL_BENCH_MAX_SWEEP) {
+        char *end;
+        const unsigned long long v = strtoull(s, &end, 10);
+        if (end == s) break;
+        out[count++] = (size_t)v;
+        s = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+static size_t hil_bench_parse_doubles(const char *s, double *out) {
+    size_t count = 0;
+    while (*s && count < HIL_BENCH_MAX_SWEEP) {
+        char *end;
+        const double v = strtod(s, &end);
+        if (end == s) break;
+        out[count++] = v;
+        s = (*end == ',') ? end + 1 : end;
+    }
+    return count;
+}
+
+static void hil_bench_usage(void) {
+    fprintf(stderr,
+            "usage: hilbert_bench [--quick] [--sizes N,..] [--dims D,..] [--densities P,..]\n"
+            "                     [--threads T,..] [--min-time MS] [--filter SUBSTR]\n"
+            "                     [--json PATH] [--baseline PATH] [--max-slowdown FRACTION]\n");
+}
+
+static int hil_bench_configure(int argc, char **argv, hil_bench_config_t *cfg) {
+    static const size_t sizes[] = { 256, 1024, 4096 };
+    static const size_t dims[] = { 16, 64, 256 };
+    static const double densities[] = { 0.01, 0.1, 1.0 };
+
+    memset(cfg, 0, sizeof(*cfg));
+    memcpy(cfg->n, sizes, sizeof(sizes));             cfg->n_count = 3;
+    memcpy(cfg->d, dims, sizeof(dims));               cfg->d_count = 3;
+    memcpy(cfg->density, densities, sizeof(densities)); cfg->density_count = 3;
+    cfg->threads[0] = 1;
+    cfg->threads_count = 1;
+    #ifdef _OPENMP
+    if (omp_get_max_threads() > 1) cfg->threads[cfg->threads_count++] = omp_get_max_threads();
+    #endif
+    cfg->min_time_ms = 50.0;
+    cfg->max_slowdown = 0.25;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (strcmp(a, "--quick") == 0) {
+            cfg->n[0] = 256;   cfg->n[1] = 1024;  cfg->n_count = 2;
+            cfg->d[0] = 16;    cfg->d[1] = 64;    cfg->d_count = 2;
+            cfg->density[0] = 0.01;  cfg->density[1] = 0.1;  cfg->density_count = 2;
+            cfg->min_time_ms = 10.0;
+            continue;
+        }
+        if (!v) {
+            hil_bench_usage();
+            return 0;
+        }
+        if (strcmp(a, "--sizes") == 0) {
+            cfg->n_count = hil_bench_parse_sizes(v, cfg->n);
+        } else if (strcmp(a, "--dims") == 0) {
+            cfg->d_count = hil_bench_parse_sizes(v, cfg->d);
+        } else if (strcmp(a, "--densities") == 0) {
+            cfg->density_count = hil_bench_parse_doubles(v, cfg->density);
+        } else if (strcmp(a, "--threads") == 0) {
+            size_t t[HIL_BENCH_MAX_SWEEP];
+            cfg->threads_count = hil_bench_parse_sizes(v, t);
+            for (size_t k = 0; k < cfg->threads_count; k++) cfg->threads[k] = (int)t[k];
+        } else if (strcmp(a, "--min-time") == 0) {
+            cfg->min_time_ms = strtod(v, NULL);
+        } else if (strcmp(a, "--filter") == 0) {
+            cfg->filter = v;
+        } else if (strcmp(a, "--json") == 0) {
+            cfg->json_path = v;
+        } else if (strcmp(a, "--baseline") == 0) {
+            cfg->baseline_path = v;
+        } else if (strcmp(a, "--max-slowdown") == 0) {
+            cfg->max_slowdown = strtod(v, NULL);
+        } else {
+            hil_bench_usage();
+            return 0;
+        }
+        i++;
+    }
+
+    for (size_t k = 0; k < cfg->n_count; k++) {
+        if (cfg->n[k] < 3) {
+            fprintf(stderr, "hilbert_bench: sizes must be >= 3\n");
+            return 0;
+        }
+    }
+    for (size_t k = 0; k < cfg->d_count; k++) {
+        if (cfg->d[k] < 2) {
+            fprintf(stderr, "hilbert_bench: dims must be >= 2\n");
+            return 0;
+        }
+    }
+    for (size_t k = 0; k < cfg->density_count; k++) {
+        if (!(cfg->density[k] > 0.0 && cfg->density[k] <= 1.0)) {
+            fprintf(stderr, "hilbert_bench: densities must be in (0, 1]\n");
+            return 0;
+        }
+    }
+    for (size_t k = 0; k < cfg->threads_count; k++) {
+        if (cfg->threads[k] < 1) {
+            fprintf(stderr, "hilbert_bench: thread counts must be >= 1\n");
+            return 0;
+        }
+    }
+    return cfg->n_count && cfg->d_count && cfg->density_count && cfg->threads_count;
+}
+
+static int hil_bench_selected(const hil_bench_config_t *cfg, const hil_bench_t *b, size_t n) {
+    if (cfg->filter && !strstr(b->name, cfg->filter)) return 0;
+    return b->max_n == 0 || n <= b->max_n;
+}
+
+/* Thread counts are only swept for OpenMP kernels; the rest run once. */
+static void hil_bench_run_one(
+    const hil_bench_config_t *cfg,
+    const hil_bench_t *b,
+    hil_bench_ctx_t *c,
+    hil_bench_result_t **results,
+    size_t *count,
+    size_t *cap
+) {
+    const size_t sweeps = (b->flags & HIL_BENCH_PARALLEL) ? cfg->threads_count : 1;
+
+    for (size_t t = 0; t < sweeps; t++) {
+        const int threads = (b->flags & HIL_BENCH_PARALLEL) ? cfg->threads[t] : 1;
+        #ifdef _OPENMP
+        omp_set_num_threads(threads);
+        #endif
+
+        hil_bench_result_t r = hil_bench_measure(b, c, cfg->min_time_ms);
+        r.threads = threads;
+
+        if (*count == *cap) {
+            *cap = *cap ? 2 * *cap : 256;
+            *results = (hil_bench_result_t*)realloc(*results, sizeof(hil_bench_result_t) * *cap);
+            if (!*results) {
+                fprintf(stderr, "hilbert_bench: out of memory\n");
+                exit(1);
+            }
+        }
+        (*results)[(*count)++] = r;
+
+        fprintf(stderr, "%-40s n=%-6zu d=%-4zu ", r.name, r.n, r.d);
+        if (r.density < 0.0) {
+            fprintf(stderr, "%-16s", "");
+        } else {
+            fprintf(stderr, "p=%-6.3g m=%-7zu ", r.density, r.edges);
+        }
+        fprintf(stderr, "t=%-3d %12.0f ns  %9.4g ns/%s  %7.3f GB/s",
+                r.threads, r.best_ns, r.ns_per_element, r.unit, r.gb_per_s);
+        if (r.recall >= 0.0) fprintf(stderr, "  recall %.4f", r.recall);
+        fprintf(stderr, "\n");
+    }
+}
+
+int main(int argc, char **argv) {
+    hil_bench_config_t cfg;
+    if (!hil_bench_configure(argc, argv, &cfg)) return 1;
+
+    #ifdef _OPENMP
+    const int default_threads = omp_get_max_threads();
+    #endif
+
+    hil_bench_result_t *results = NULL;
+    size_t count = 0, cap = 0;
+
+    fprintf(stderr, "hilbert_bench: vec backend %s\n", hil_vec_backend());
+
+    for (size_t in = 0; in < cfg.n_count; in++) {
+        for (size_t id = 0; id < cfg.d_count; id++) {
+            hil_bench_ctx_t c;
+            memset(&c, 0, sizeof(c));
+            hil_bench_field(&c, cfg.n[in], cfg.d[id]);
+            hil_workspace_init(&c.ws, 0);
+
+            /* Field and math kernels: once per (n, d). */
+            for (size_t b = 0; b < HIL_BENCH_COUNT; b++) {
+                const hil_bench_t *bench = &hil_benchmarks[b];
+                if ((bench->flags & HIL_BENCH_GRAPH) || !hil_bench_selected(&cfg, bench, c.n)) continue;
+                hil_bench_run_one(&cfg, bench, &c, &results, &count, &cap);
+            }
+
+            /* Graph kernels: once per density. They do not read d, so only
+               the first width is swept. */
+            for (size_t ip = 0; id == 0 && ip < cfg.density_count; ip++) {
+                hil_bench_graph(&c, cfg.density[ip]);
+                for (size_t b = 0; b < HIL_BENCH_COUNT; b++) {
+                    const hil_bench_t *bench = &hil_benchmarks[b];
+                    if (!(bench->flags & HIL_BENCH_GRAPH) || !hil_bench_selected(&cfg, bench, c.n)) continue;
+                    hil_bench_run_one(&cfg, bench, &c, &results, &count, &cap);
+                }
+                hil_bench_graph_free(&c);
+            }
+
+            #ifdef _OPENMP
+            omp_set_num_threads(default_threads);
+            #endif
+            hil_workspace_free(&c.ws);
+            hil_bench_field_free(&c);
+        }
+    }
+
+    if (cfg.json_path) {
+        FILE *f = fopen(cfg.json_path, "w");
+        if (!f) {
+            fprintf(stderr, "hilbert_bench: cannot write %s\n", cfg.json_path);
+            free(results);
+            return 1;
+        }
+        hil_bench_json(f, &cfg, results, count);
+        fclose(f);
+    } else if (!cfg.baseline_path) {
+        hil_bench_json(stdout, &cfg, results, count);
+    }
+
+    int status = 0;
+    if (cfg.baseline_path) {
+        const long regressions = hil_bench_compare(cfg.baseline_path, cfg.max_slowdown, results, count);
+        status = (regressions < 0) ? 1 : (regressions > 0) ? 2 : 0;
+    }
+
+    free(results);
+    return status;
+}
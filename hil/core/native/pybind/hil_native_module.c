@@ -0,0 +1,2452 @@
+/*
+ * hil/core/native/pybind/hil_native_module.c
+ *
+ * CPython extension `hil.core.native._native`.
+ *
+ * Thin binding layer over hilbert_native.h, hilbert_lexicon.h and
+ * hilbert_ann.h. Arrays are accepted through the buffer protocol and
+ * wrapped in place as hil_matrix_t / hil_graph_t / hil_graph_csr_t views:
+ * no element is copied on the way in.
+ *
+ * Accepted layouts:
+ *  - 1D arrays: contiguous, exact element type (float64, float32, uint32, uint64)
+ *  - 2D float64 / float32 matrices: unit column stride, any non-negative row stride
+ *
+ * The `*_f32` methods take float32 vectors and weights (hil_*_f32_t views)
+ * and return float32 weights; their reductions still accumulate in double.
+ *
+ * Anything else raises ValueError, because wrapping it would require a copy.
+ * Conversions are the caller's decision (see `copy=True` in _shim.py).
+ *
+ * Arrays allocated by native builders are handed back as `_native.Buffer`
+ * objects that own the allocation and export it through the buffer protocol,
+ * so np.asarray(...) wraps them without copying either.
+ *
+ * The GIL is released for the duration of every kernel call.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../hilbert_native.h"
+#include "../hilbert_math.h"
+#include "../hilbert_lexicon.h"
+#include "../hilbert_ann.h"
+
+/* ============================================================================
+ * Buffer Views
+ * ============================================================================
+ */
+
+#define HIL_PY_MAX_VIEWS 8
+
+/* Buffers held for the duration of one call; released together. */
+typedef struct {
+    Py_buffer view[HIL_PY_MAX_VIEWS];
+    int count;
+} hil_py_views_t;
+
+static void hil_py_release(hil_py_views_t *v) {
+    for (int i = 0; i < v->count; i++) PyBuffer_Release(&v->view[i]);
+    v->count = 0;
+}
+
+/*
+ * Format check for a single native-order element code. The byte-order
+ * prefixes '<', '>' and '!' are accepted only when they match the host.
+ */
+static int hil_py_format_is(const char *fmt, const char *codes) {
+    if (!fmt) fmt = "B";
+    if (*fmt == '@' || *fmt == '=') {
+        fmt++;
+    } else if (*fmt == '<' || *fmt == '>' || *fmt == '!') {
+        const uint16_t probe = 1;
+        const int little = (*(const uint8_t*)&probe == 1);
+        if ((*fmt == '<') != little) return 0;
+        fmt++;
+    }
+    return fmt[0] != '\0' && fmt[1] == '\0' && strchr(codes, fmt[0]) != NULL;
+}
+
+static Py_buffer *hil_py_acquire(
+    hil_py_views_t *v,
+    PyObject *obj,
+    int writable,
+    const char *name
+) {
+    if (v->count >= HIL_PY_MAX_VIEWS) {
+        PyErr_SetString(PyExc_RuntimeError, "too many buffer views in one call");
+        return NULL;
+    }
+    Py_buffer *b = &v->view[v->count];
+    int flags = PyBUF_STRIDES | PyBUF_FORMAT;
+    if (writable) flags |= PyBUF_WRITABLE;
+    if (PyObject_GetBuffer(obj, b, flags) != 0) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s: object does not expose a strided%s buffer",
+                     name, writable ? " writable" : "");
+        return NULL;
+    }
+    v->count++;
+    return b;
+}
+
+/*
+ * Borrow a contiguous 1D buffer of the given element size and codes.
+ * Returns the data pointer (never NULL on success) or NULL with an
+ * exception set.
+ */
+static void *hil_py_vector(
+    hil_py_views_t *v,
+    PyObject *obj,
+    Py_ssize_t itemsize,
+    const char *codes,
+    const char *type_name,
+    int writable,
+    size_t *out_length,
+    const char *name
+) {
+    Py_buffer *b = hil_py_acquire(v, obj, writable, name);
+    if (!b) return NULL;
+
+    if (b->ndim != 1) {
+        PyErr_Format(PyExc_ValueError, "%s: expected a 1D array", name);
+        return NULL;
+    }
+    if (b->itemsize != itemsize || !hil_py_format_is(b->format, codes)) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s: expected %s elements (converting would copy; pass copy=True)",
+                     name, type_name);
+        return NULL;
+    }
+    if (b->shape[0] > 1 && b->strides[0] != itemsize) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s: array is not contiguous (wrapping would copy; pass copy=True)",
+                     name);
+        return NULL;
+    }
+
+    *out_length = (size_t)b->shape[0];
+    /* Empty buffers may report a NULL pointer; kernels only need non-NULL. */
+    return b->buf ? b->buf : (void*)b;
+}
+
+#define HIL_PY_F64(v, o, wr, len, name) \
+    ((double*)hil_py_vector((v), (o), 8, "d", "float64", (wr), (len), (name)))
+#define HIL_PY_F32(v, o, wr, len, name) \
+    ((float*)hil_py_vector((v), (o), 4, "f", "float32", (wr), (len), (name)))
+#define HIL_PY_U32(v, o, len, name) \
+    ((uint32_t*)hil_py_vector((v), (o), 4, "IL", "uint32", 0, (len), (name)))
+#define HIL_PY_U64(v, o, len, name) \
+    ((uint64_t*)hil_py_vector((v), (o), 8, "LQ", "uint64", 0, (len), (name)))
+#define HIL_PY_BYTES(v, o, len, name) \
+    ((uint8_t*)hil_py_vector((v), (o), 1, "B", "uint8", 0, (len), (name)))
+#define HIL_PY_U32_OUT(v, o, len, name) \
+    ((uint32_t*)hil_py_vector((v), (o), 4, "IL", "uint32", 1, (len), (name)))
+#define HIL_PY_U64_OUT(v, o, len, name) \
+    ((uint64_t*)hil_py_vector((v), (o), 8, "LQ", "uint64", 1, (len), (name)))
+
+/*
+ * Borrow a 2D buffer of itemsize-byte elements as a row-major matrix view.
+ * Columns must be contiguous; rows may be strided (e.g. X[:, :k] or X[::2]
+ * of a C-ordered array).
+ */
+static int hil_py_matrix(
+    hil_py_views_t *v,
+    PyObject *obj,
+    Py_ssize_t itemsize,
+    const char *codes,
+    const char *type_name,
+    void **out_data,
+    size_t *out_rows,
+    size_t *out_cols,
+    size_t *out_stride,
+    const char *name
+) {
+    Py_buffer *b = hil_py_acquire(v, obj, 0, name);
+    if (!b) return 0;
+
+    if (b->ndim != 2) {
+        PyErr_Format(PyExc_ValueError, "%s: expected a 2D array", name);
+        return 0;
+    }
+    if (b->itemsize != itemsize || !hil_py_format_is(b->format, codes)) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s: expected %s elements (converting would copy; pass copy=True)",
+                     name, type_name);
+        return 0;
+    }
+
+    const Py_ssize_t rows = b->shape[0];
+    const Py_ssize_t cols = b->shape[1];
+    const Py_ssize_t rs = b->strides[0];
+    const Py_ssize_t cs = b->strides[1];
+
+    if (rows < 1 || cols < 1) {
+        PyErr_Format(PyExc_ValueError, "%s: array must be non-empty", name);
+        return 0;
+    }
+    if ((cols > 1 && cs != itemsize) ||
+        (rows > 1 && (rs < 0 || rs % itemsize != 0 || rs / itemsize < cols))) {
+        PyErr_Format(PyExc_ValueError,
+                     "%s: rows must be contiguous with non-negative row stride "
+                     "(wrapping would copy; pass copy=True)",
+                     name);
+        return 0;
+    }
+
+    *out_data = b->buf;
+    *out_rows = (size_t)rows;
+    *out_cols = (size_t)cols;
+    *out_stride = (rows > 1) ? (size_t)(rs / itemsize) : (size_t)cols;
+    return 1;
+}
+
+/* Borrow a 2D float64 buffer as a field view. */
+static int hil_py_field(
+    hil_py_views_t *v,
+    PyObject *obj,
+    hil_field_t *out,
+    const char *name
+) {
+    hil_matrix_t *M = &out->coordinates;
+    void *data = NULL;
+    if (!hil_py_matrix(v, obj, 8, "d", "float64", &data,
+                       &M->rows, &M->cols, &M->stride, name)) return 0;
+    M->data = (double*)data;
+    return 1;
+}
+
+/* Borrow a 2D float32 buffer as a field view. */
+static int hil_py_field_f32(
+    hil_py_views_t *v,
+    PyObject *obj,
+    hil_field_f32_t *out,
+    const char *name
+) {
+    hil_matrix_f32_t *M = &out->coordinates;
+    void *data = NULL;
+    if (!hil_py_matrix(v, obj, 4, "f", "float32", &data,
+                       &M->rows, &M->cols, &M->stride, name)) return 0;
+    M->data = (float*)data;
+    return 1;
+}
+
+/*
+ * Wrap src/dst/weight as edge arrays of equal length; weight is float32
+ * when f32 is set, else float64.
+ */
+static int hil_py_edges(
+    hil_py_views_t *v,
+    PyObject *src_obj,
+    PyObject *dst_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    int f32,
+    uint32_t **out_src,
+    uint32_t **out_dst,
+    void **out_w,
+    size_t *out_m
+) {
+    size_t ns = 0, nd = 0, nw = 0;
+    uint32_t *src = HIL_PY_U32(v, src_obj, &ns, "src");
+    if (!src) return 0;
+    uint32_t *dst = HIL_PY_U32(v, dst_obj, &nd, "dst");
+    if (!dst) return 0;
+    void *w = f32 ? (void*)HIL_PY_F32(v, w_obj, 0, &nw, "weight")
+                  : (void*)HIL_PY_F64(v, w_obj, 0, &nw, "weight");
+    if (!w) return 0;
+
+    if (ns != nd || ns != nw) {
+        PyErr_SetString(PyExc_ValueError, "src, dst, weight must have identical lengths");
+        return 0;
+    }
+    if (num_nodes < 1) {
+        PyErr_SetString(PyExc_ValueError, "num_nodes must be >= 1");
+        return 0;
+    }
+
+    *out_src = src;
+    *out_dst = dst;
+    *out_w = w;
+    *out_m = ns;
+    return 1;
+}
+
+static int hil_py_graph_invalid(void) {
+    PyErr_SetString(PyExc_ValueError,
+                    "graph failed validation (index out of range or invalid weight)");
+    return 0;
+}
+
+/* Wrap src/dst/weight as a validated edge-list graph view. */
+static int hil_py_graph(
+    hil_py_views_t *v,
+    PyObject *src_obj,
+    PyObject *dst_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    hil_graph_t *out
+) {
+    void *w = NULL;
+    if (!hil_py_edges(v, src_obj, dst_obj, w_obj, num_nodes, 0,
+                      &out->src, &out->dst, &w, &out->num_edges)) return 0;
+    out->num_nodes = (size_t)num_nodes;
+    out->weight = (double*)w;
+
+    if (!hil_graph_validate(out)) return hil_py_graph_invalid();
+    return 1;
+}
+
+/* As hil_py_graph, over float32 weights. */
+static int hil_py_graph_f32(
+    hil_py_views_t *v,
+    PyObject *src_obj,
+    PyObject *dst_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    hil_graph_f32_t *out
+) {
+    void *w = NULL;
+    if (!hil_py_edges(v, src_obj, dst_obj, w_obj, num_nodes, 1,
+                      &out->src, &out->dst, &w, &out->num_edges)) return 0;
+    out->num_nodes = (size_t)num_nodes;
+    out->weight = (float*)w;
+
+    if (!hil_graph_validate_f32(out)) return hil_py_graph_invalid();
+    return 1;
+}
+
+/*
+ * Wrap offsets/indices/weight as CSR arrays over num_nodes rows, checking
+ * row bounds and neighbour indices; weight is float32 when f32 is set.
+ */
+static int hil_py_csr_arrays(
+    hil_py_views_t *v,
+    PyObject *off_obj,
+    PyObject *idx_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    int f32,
+    uint64_t **out_off,
+    uint32_t **out_idx,
+    void **out_w,
+    size_t *out_m
+) {
+    size_t no = 0, ni = 0, nw = 0;
+    uint64_t *off = HIL_PY_U64(v, off_obj, &no, "offsets");
+    if (!off) return 0;
+    uint32_t *idx = HIL_PY_U32(v, idx_obj, &ni, "indices");
+    if (!idx) return 0;
+    void *w = f32 ? (void*)HIL_PY_F32(v, w_obj, 0, &nw, "weight")
+                  : (void*)HIL_PY_F64(v, w_obj, 0, &nw, "weight");
+    if (!w) return 0;
+
+    if (num_nodes < 1 || no != (size_t)num_nodes + 1) {
+        PyErr_SetString(PyExc_ValueError, "offsets must have length num_nodes + 1");
+        return 0;
+    }
+    if (ni != nw) {
+        PyErr_SetString(PyExc_ValueError, "indices, weight must have identical lengths");
+        return 0;
+    }
+
+    /* Row bounds and neighbour indices must be in range before any kernel
+       dereferences them. */
+    const size_t n = (size_t)num_nodes;
+    if (off[0] != 0 || off[n] != (uint64_t)ni) {
+        PyErr_SetString(PyExc_ValueError, "offsets must start at 0 and end at num_edges");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (off[i + 1] < off[i]) {
+            PyErr_SetString(PyExc_ValueError, "offsets must be non-decreasing");
+            return 0;
+        }
+    }
+    for (size_t e = 0; e < ni; e++) {
+        if ((size_t)idx[e] >= n) {
+            PyErr_SetString(PyExc_ValueError, "indices out of range");
+            return 0;
+        }
+    }
+
+    *out_off = off;
+    *out_idx = idx;
+    *out_w = w;
+    *out_m = ni;
+    return 1;
+}
+
+/* Wrap offsets/indices/weight as a CSR view over num_nodes rows. */
+static int hil_py_csr(
+    hil_py_views_t *v,
+    PyObject *off_obj,
+    PyObject *idx_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    int symmetric,
+    hil_graph_csr_t *out
+) {
+    void *w = NULL;
+    if (!hil_py_csr_arrays(v, off_obj, idx_obj, w_obj, num_nodes, 0,
+                           &out->offsets, &out->indices, &w, &out->num_edges)) return 0;
+    out->num_nodes = (size_t)num_nodes;
+    out->symmetric = symmetric;
+    out->weight = (double*)w;
+    return 1;
+}
+
+/* As hil_py_csr, over float32 weights. */
+static int hil_py_csr_f32(
+    hil_py_views_t *v,
+    PyObject *off_obj,
+    PyObject *idx_obj,
+    PyObject *w_obj,
+    Py_ssize_t num_nodes,
+    int symmetric,
+    hil_graph_csr_f32_t *out
+) {
+    void *w = NULL;
+    if (!hil_py_csr_arrays(v, off_obj, idx_obj, w_obj, num_nodes, 1,
+                           &out->offsets, &out->indices, &w, &out->num_edges)) return 0;
+    out->num_nodes = (size_t)num_nodes;
+    out->symmetric = symmetric;
+    out->weight = (float*)w;
+    return 1;
+}
+
+
+/*
+ * Wrap offsets/stream as a packed graph over num_nodes rows, checking row
+ * byte bounds. Entries are decoded defensively by the kernels, so the
+ * stream itself needs no validation.
+ */
+static int hil_py_packed(
+    hil_py_views_t *v,
+    PyObject *off_obj,
+    PyObject *stream_obj,
+    Py_ssize_t num_nodes,
+    Py_ssize_t num_edges,
+    hil_graph_packed_t *out
+) {
+    size_t no = 0, ns = 0;
+    uint64_t *off = HIL_PY_U64(v, off_obj, &no, "offsets");
+    if (!off) return 0;
+    uint8_t *stream = HIL_PY_BYTES(v, stream_obj, &ns, "stream");
+    if (!stream) return 0;
+
+    if (num_nodes < 1 || no != (size_t)num_nodes + 1) {
+        PyErr_SetString(PyExc_ValueError, "offsets must have length num_nodes + 1");
+        return 0;
+    }
+    if (num_edges < 0) {
+        PyErr_SetString(PyExc_ValueError, "num_edges must be >= 0");
+        return 0;
+    }
+    const size_t n = (size_t)num_nodes;
+    if (off[0] != 0 || off[n] != (uint64_t)ns) {
+        PyErr_SetString(PyExc_ValueError, "offsets must start at 0 and end at the stream length");
+        return 0;
+    }
+    for (size_t i = 0; i < n; i++) {
+        if (off[i + 1] < off[i]) {
+            PyErr_SetString(PyExc_ValueError, "offsets must be non-decreasing");
+            return 0;
+        }
+    }
+
+    out->num_nodes = n;
+    out->num_edges = (size_t)num_edges;
+    out->symmetric = 0;
+    out->offsets = off;
+    out->stream = stream;
+    return 1;
+}
+
+
+/* ============================================================================
+ * Owned Result Buffers
+ * ============================================================================
+ */
+
+/*
+ * One-dimensional buffer owning a malloc'd native allocation.
+ * Freed on deallocation; exported writable through the buffer protocol.
+ */
+typedef struct {
+    PyObject_HEAD
+    void *data;
+    Py_ssize_t length;
+    Py_ssize_t itemsize;
+    char format[2];
+} hil_py_buffer_t;
+
+static void hil_py_buffer_dealloc(PyObject *obj) {
+    hil_py_buffer_t *self = (hil_py_buffer_t*)obj;
+    free(self->data);
+    Py_TYPE(obj)->tp_free(obj);
+}
+
+static int hil_py_buffer_get(PyObject *obj, Py_buffer *view, int flags) {
+    hil_py_buffer_t *self = (hil_py_buffer_t*)obj;
+    (void)flags;
+
+    Py_INCREF(obj);
+    view->obj = obj;
+    view->buf = self->data;
+    view->len = self->length * self->itemsize;
+    view->readonly = 0;
+    view->itemsize = self->itemsize;
+    view->format = self->format;
+    view->ndim = 1;
+    view->shape = &self->length;
+    view->strides = &self->itemsize;
+    view->suboffsets = NULL;
+    view->internal = NULL;
+    return 0;
+}
+
+static Py_ssize_t hil_py_buffer_len(PyObject *obj) {
+    return ((hil_py_buffer_t*)obj)->length;
+}
+
+static PyBufferProcs hil_py_buffer_procs = {
+    hil_py_buffer_get,
+    NULL,
+};
+
+static PySequenceMethods hil_py_buffer_seq = {
+    .sq_length = hil_py_buffer_len,
+};
+
+static PyTypeObject hil_py_buffer_type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "hil.core.native._native.Buffer",
+    .tp_basicsize = sizeof(hil_py_buffer_t),
+    .tp_dealloc = hil_py_buffer_dealloc,
+    .tp_as_sequence = &hil_py_buffer_seq,
+    .tp_as_buffer = &hil_py_buffer_procs,
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_doc = "Native-owned 1D result buffer (wrap with numpy.asarray).",
+};
+
+/*
+ * Transfer ownership of *data into a new Buffer. On success *data is NULL;
+ * on failure *data is left for the caller to free.
+ */
+static PyObject *hil_py_buffer_take(
+    void **data,
+    size_t length,
+    Py_ssize_t itemsize,
+    char code
+) {
+    hil_py_buffer_t *self = PyObject_New(hil_py_buffer_t, &hil_py_buffer_type);
+    if (!self) return NULL;
+
+    if (!*data) {
+        /* Empty results still get a real allocation so consumers never see
+           a NULL buffer pointer. */
+        *data = malloc((size_t)itemsize);
+        if (!*data) {
+            Py_DECREF(self);
+            return PyErr_NoMemory();
+        }
+    }
+
+    self->data = *data;
+    self->length = (Py_ssize_t)length;
+    self->itemsize = itemsize;
+    self->format[0] = code;
+    self->format[1] = '\0';
+    *data = NULL;
+    return (PyObject*)self;
+}
+
+/*
+ * (offsets, indices, weight) tuple of Buffers. Takes whichever arrays it
+ * can; the caller frees what is left (NULL pointers after a full take).
+ */
+static PyObject *hil_py_csr_take(
+    size_t num_nodes,
+    size_t num_edges,
+    uint64_t **offsets,
+    uint32_t **indices,
+    void **weight,
+    Py_ssize_t w_itemsize,
+    char w_code
+) {
+    PyObject *off = NULL, *idx = NULL, *w = NULL, *out = NULL;
+
+    off = hil_py_buffer_take((void**)offsets, num_nodes + 1, 8, 'Q');
+    if (off) idx = hil_py_buffer_take((void**)indices, num_edges, 4, 'I');
+    if (idx) w = hil_py_buffer_take(weight, num_edges, w_itemsize, w_code);
+    if (w) out = PyTuple_Pack(3, off, idx, w);
+
+    Py_XDECREF(off);
+    Py_XDECREF(idx);
+    Py_XDECREF(w);
+    return out;
+}
+
+/* hil_py_csr_take for a double CSR; consumes csr either way. */
+static PyObject *hil_py_csr_result(hil_graph_csr_t *csr) {
+    PyObject *out = hil_py_csr_take(csr->num_nodes, csr->num_edges, &csr->offsets,
+                                    &csr->indices, (void**)&csr->weight, 8, 'd');
+    hil_graph_csr_free(csr);
+    return out;
+}
+
+/* hil_py_csr_take for a float32 CSR; consumes csr either way. */
+static PyObject *hil_py_csr_f32_result(hil_graph_csr_f32_t *csr) {
+    PyObject *out = hil_py_csr_take(csr->num_nodes, csr->num_edges, &csr->offsets,
+                                    &csr->indices, (void**)&csr->weight, 4, 'f');
+    hil_graph_csr_f32_free(csr);
+    return out;
+}
+
+/* Dict results shared by the double and float32 methods. */
+static PyObject *hil_py_metrics_dict(const hil_graph_metrics_t *m) {
+    return Py_BuildValue(
+        "{s:d,s:d,s:d,s:d,s:d,s:n}",
+        "mean_degree", m->mean_degree,
+        "total_weight", m->total_weight,
+        "density", m->density,
+        "degree_entropy", m->degree_entropy,
+        "out_entropy", m->out_entropy,
+        "components", (Py_ssize_t)m->components
+    );
+}
+
+static PyObject *hil_py_summary_dict(const hil_field_summary_t *s) {
+    return Py_BuildValue(
+        "{s:d,s:d,s:d}",
+        "mean_norm", s->mean_norm,
+        "centroid_norm", s->centroid_norm,
+        "coherence", s->coherence
+    );
+}
+
+
+/* ============================================================================
+ * Workspaces
+ * ============================================================================
+ *
+ * A hil_workspace_t held in a capsule lets repeated diagnostic calls reuse
+ * one scratch arena (the _ws variants). Methods taking an optional trailing
+ * workspace use a temporary one when it is None. A capsule must not be
+ * shared between threads.
+ */
+
+#define HIL_PY_WORKSPACE "hil.core.native.workspace"
+
+static void hil_py_workspace_destroy(PyObject *capsule) {
+    hil_workspace_t *ws = (hil_workspace_t*)PyCapsule_GetPointer(capsule, HIL_PY_WORKSPACE);
+    hil_workspace_free(ws);
+    free(ws);
+}
+
+static PyObject *hil_py_workspace_new(PyObject *self, PyObject *args) {
+    (void)self;
+    Py_ssize_t initial_bytes = 0;
+    if (!PyArg_ParseTuple(args, "|n", &initial_bytes)) return NULL;
+    if (initial_bytes < 0) {
+        PyErr_SetString(PyExc_ValueError, "initial_bytes must be >= 0");
+        return NULL;
+    }
+
+    hil_workspace_t *ws = (hil_workspace_t*)malloc(sizeof(hil_workspace_t));
+    if (!ws || !hil_workspace_init(ws, (size_t)initial_bytes)) {
+        free(ws);
+        return PyErr_NoMemory();
+    }
+    PyObject *capsule = PyCapsule_New(ws, HIL_PY_WORKSPACE, hil_py_workspace_destroy);
+    if (!capsule) {
+        hil_workspace_free(ws);
+        free(ws);
+    }
+    return capsule;
+}
+
+static PyObject *hil_py_workspace_info(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj;
+    if (!PyArg_ParseTuple(args, "O", &cap_obj)) return NULL;
+
+    const hil_workspace_t *ws =
+        (const hil_workspace_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_WORKSPACE);
+    if (!ws) return NULL;
+    return Py_BuildValue(
+        "{s:n,s:n,s:n}",
+        "capacity", (Py_ssize_t)ws->capacity,
+        "peak", (Py_ssize_t)ws->peak,
+        "overflow", (Py_ssize_t)ws->overflow_count
+    );
+}
+
+/* Optional workspace argument: NULL for None, else the capsule's arena. */
+static int hil_py_workspace_arg(PyObject *obj, hil_workspace_t **out) {
+    *out = NULL;
+    if (obj == Py_None) return 1;
+    *out = (hil_workspace_t*)PyCapsule_GetPointer(obj, HIL_PY_WORKSPACE);
+    return *out != NULL;
+}
+
+
+/* ============================================================================
+ * Structural Construction
+ * ============================================================================
+ */
+
+static PyObject *hil_py_graph_build_cosine(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *src_obj, *dst_obj, *w_obj;
+    if (!PyArg_ParseTuple(args, "OOOO", &x_obj, &src_obj, &dst_obj, &w_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    hil_graph_t graph;
+    size_t ns = 0, nd = 0, nw = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    graph.src = (uint32_t*)hil_py_vector(&v, src_obj, 4, "IL", "uint32", 1, &ns, "src");
+    if (!graph.src) goto done;
+    graph.dst = (uint32_t*)hil_py_vector(&v, dst_obj, 4, "IL", "uint32", 1, &nd, "dst");
+    if (!graph.dst) goto done;
+    graph.weight = HIL_PY_F64(&v, w_obj, 1, &nw, "weight");
+    if (!graph.weight) goto done;
+    if (ns != nd || ns != nw) {
+        PyErr_SetString(PyExc_ValueError, "src, dst, weight must have identical lengths");
+        goto done;
+    }
+    graph.num_nodes = field.coordinates.rows;
+    graph.num_edges = ns;
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_graph_build_cosine(&field, &graph);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_graph_build_knn_csr(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj;
+    Py_ssize_t k;
+    double min_weight;
+    if (!PyArg_ParseTuple(args, "Ond", &x_obj, &k, &min_weight)) return NULL;
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must be >= 0");
+        return NULL;
+    }
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    hil_graph_csr_t csr = {0};
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) {
+        hil_py_release(&v);
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_graph_build_knn_csr(&field, (size_t)k, min_weight, &csr);
+    Py_END_ALLOW_THREADS
+
+    hil_py_release(&v);
+    if (!ok) {
+        hil_graph_csr_free(&csr);
+        PyErr_SetString(PyExc_RuntimeError, "native graph_build_knn_csr failed");
+        return NULL;
+    }
+    return hil_py_csr_result(&csr);
+}
+
+
+/* ============================================================================
+ * Structural Diagnostics
+ * ============================================================================
+ */
+
+static PyObject *hil_py_graph_entropy(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj, *ws_obj = Py_None;
+    Py_ssize_t num_nodes;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "OOOn|O", &src_obj, &dst_obj, &w_obj, &num_nodes,
+                          &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_t graph;
+    double h = 0.0;
+
+    if (hil_py_graph(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = ws ? hil_graph_entropy_ws(&graph, ws) : hil_graph_entropy(&graph);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_out_entropy(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &src_obj, &dst_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_t graph;
+    double h = 0.0;
+
+    if (hil_py_graph(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = hil_graph_out_entropy(&graph);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_metrics(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj, *ws_obj = Py_None;
+    Py_ssize_t num_nodes;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "OOOn|O", &src_obj, &dst_obj, &w_obj, &num_nodes,
+                          &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_t graph;
+    hil_graph_metrics_t m;
+    int ok = 0;
+
+    if (hil_py_graph(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        ok = ws ? hil_graph_metrics_ws(&graph, &m, NULL, ws)
+                : hil_graph_metrics(&graph, &m, NULL);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        PyErr_SetString(PyExc_RuntimeError, "native graph_metrics failed");
+        return NULL;
+    }
+    return hil_py_metrics_dict(&m);
+}
+
+static PyObject *hil_py_graph_components(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj;
+    PyObject *labels_obj = Py_None, *sizes_obj = Py_None, *ws_obj = Py_None;
+    Py_ssize_t num_nodes;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "OOOn|OOO", &src_obj, &dst_obj, &w_obj, &num_nodes,
+                          &labels_obj, &sizes_obj, &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_t graph;
+    uint32_t *labels = NULL;
+    uint64_t *sizes = NULL;
+    size_t nl = 0, ns = 0, count = 0;
+
+    if (!hil_py_graph(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) goto done;
+    if (labels_obj != Py_None) {
+        labels = HIL_PY_U32_OUT(&v, labels_obj, &nl, "labels_out");
+        if (!labels) goto done;
+    }
+    if (sizes_obj != Py_None) {
+        sizes = HIL_PY_U64_OUT(&v, sizes_obj, &ns, "sizes_out");
+        if (!sizes) goto done;
+    }
+    if ((labels && nl != (size_t)num_nodes) || (sizes && ns != (size_t)num_nodes)) {
+        PyErr_SetString(PyExc_ValueError, "output arrays must have one entry per node");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    count = ws ? hil_graph_components_ws(&graph, labels, sizes, ws)
+               : hil_graph_components(&graph, labels, sizes);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyLong_FromSize_t(count);
+}
+
+static PyObject *hil_py_graph_build_csr(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &src_obj, &dst_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_t graph;
+    hil_graph_csr_t csr = {0};
+    int ok = 0;
+
+    if (hil_py_graph(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        ok = hil_graph_build_csr(&graph, &csr);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        hil_graph_csr_free(&csr);
+        PyErr_SetString(PyExc_RuntimeError, "native graph_build_csr failed");
+        return NULL;
+    }
+    return hil_py_csr_result(&csr);
+}
+
+static PyObject *hil_py_graph_entropy_csr(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *idx_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &off_obj, &idx_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_csr_t csr;
+    double h = 0.0;
+
+    if (hil_py_csr(&v, off_obj, idx_obj, w_obj, num_nodes, 0, &csr)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = hil_graph_entropy_csr(&csr);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_connected_components_csr(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *idx_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &off_obj, &idx_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_csr_t csr;
+    size_t count = 0;
+
+    if (hil_py_csr(&v, off_obj, idx_obj, w_obj, num_nodes, 0, &csr)) {
+        Py_BEGIN_ALLOW_THREADS
+        count = hil_graph_connected_components_csr(&csr);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyLong_FromSize_t(count);
+}
+
+static PyObject *hil_py_graph_pack_csr(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *idx_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &off_obj, &idx_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_csr_t csr;
+    hil_graph_packed_t packed = {0};
+    int ok = 0;
+
+    if (hil_py_csr(&v, off_obj, idx_obj, w_obj, num_nodes, 0, &csr)) {
+        Py_BEGIN_ALLOW_THREADS
+        ok = hil_graph_pack_csr(&csr, &packed);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        PyErr_SetString(PyExc_ValueError,
+                        "native graph_pack_csr failed (weights must lie in [0, 1])");
+        return NULL;
+    }
+
+    /* Read the stream length before the offsets change hands. */
+    const size_t nbytes = (size_t)packed.offsets[packed.num_nodes];
+    PyObject *off = NULL, *stream = NULL, *out = NULL;
+    off = hil_py_buffer_take((void**)&packed.offsets, packed.num_nodes + 1, 8, 'Q');
+    if (off) stream = hil_py_buffer_take((void**)&packed.stream, nbytes, 1, 'B');
+    if (stream) out = PyTuple_Pack(2, off, stream);
+
+    Py_XDECREF(off);
+    Py_XDECREF(stream);
+    hil_graph_packed_free(&packed);
+    return out;
+}
+
+static PyObject *hil_py_graph_degree_packed(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *stream_obj;
+    Py_ssize_t num_nodes, num_edges;
+    if (!PyArg_ParseTuple(args, "OOnn", &off_obj, &stream_obj, &num_nodes, &num_edges)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_packed_t packed;
+    double *degree = NULL;
+
+    if (hil_py_packed(&v, off_obj, stream_obj, num_nodes, num_edges, &packed)) {
+        degree = (double*)malloc(sizeof(double) * packed.num_nodes);
+        if (!degree) {
+            PyErr_NoMemory();
+        } else {
+            Py_BEGIN_ALLOW_THREADS
+            hil_graph_degree_packed(&packed, degree);
+            Py_END_ALLOW_THREADS
+        }
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    PyObject *out = hil_py_buffer_take((void**)&degree, (size_t)num_nodes, 8, 'd');
+    free(degree);
+    return out;
+}
+
+static PyObject *hil_py_graph_entropy_packed(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *stream_obj;
+    Py_ssize_t num_nodes, num_edges;
+    if (!PyArg_ParseTuple(args, "OOnn", &off_obj, &stream_obj, &num_nodes, &num_edges)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_packed_t packed;
+    double h = 0.0;
+
+    if (hil_py_packed(&v, off_obj, stream_obj, num_nodes, num_edges, &packed)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = hil_graph_entropy_packed(&packed);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_entropy_packed_bound(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *stream_obj;
+    Py_ssize_t num_nodes, num_edges;
+    if (!PyArg_ParseTuple(args, "OOnn", &off_obj, &stream_obj, &num_nodes, &num_edges)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_packed_t packed;
+    double bound = 0.0;
+
+    if (hil_py_packed(&v, off_obj, stream_obj, num_nodes, num_edges, &packed)) {
+        Py_BEGIN_ALLOW_THREADS
+        bound = hil_graph_entropy_packed_bound(&packed);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(bound);
+}
+
+static PyObject *hil_py_graph_connected_components_packed(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *stream_obj;
+    Py_ssize_t num_nodes, num_edges;
+    if (!PyArg_ParseTuple(args, "OOnn", &off_obj, &stream_obj, &num_nodes, &num_edges)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_packed_t packed;
+    size_t count = 0;
+
+    if (hil_py_packed(&v, off_obj, stream_obj, num_nodes, num_edges, &packed)) {
+        Py_BEGIN_ALLOW_THREADS
+        count = hil_graph_connected_components_packed(&packed);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyLong_FromSize_t(count);
+}
+
+
+/* ============================================================================
+ * Field Diagnostics and Stability
+ * ============================================================================
+ */
+
+static PyObject *hil_py_field_summary(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *norms_obj = Py_None, *ws_obj = Py_None;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "O|OO", &x_obj, &norms_obj, &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    hil_field_summary_t s;
+    double *norms = NULL;
+    size_t nn = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    if (norms_obj != Py_None) {
+        norms = HIL_PY_F64(&v, norms_obj, 1, &nn, "row_norms");
+        if (!norms) goto done;
+        if (nn != field.coordinates.rows) {
+            PyErr_SetString(PyExc_ValueError, "row_norms must have one entry per row");
+            goto done;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = ws ? hil_field_summary_ws(&field, &s, norms, ws)
+            : hil_field_summary(&field, &s, norms);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        PyErr_SetString(PyExc_RuntimeError, "native field_summary failed");
+        return NULL;
+    }
+    return hil_py_summary_dict(&s);
+}
+
+static PyObject *hil_py_epistemic_stability_curve(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *eps_obj, *out_obj;
+    if (!PyArg_ParseTuple(args, "OOO", &x_obj, &eps_obj, &out_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    double *eps = NULL, *out = NULL;
+    size_t ne = 0, no = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    eps = HIL_PY_F64(&v, eps_obj, 0, &ne, "epsilons");
+    if (!eps) goto done;
+    out = HIL_PY_F64(&v, out_obj, 1, &no, "sensitivity_out");
+    if (!out) goto done;
+    if (ne == 0 || ne != no) {
+        PyErr_SetString(PyExc_ValueError, "epsilons and output must be non-empty and equally long");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_epistemic_stability_curve(&field, NULL, eps, ne, out);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_leave_one_out_diagnostics(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *src_obj, *dst_obj, *w_obj, *e_obj, *c_obj;
+    if (!PyArg_ParseTuple(args, "OOOOOO", &x_obj, &src_obj, &dst_obj, &w_obj,
+                          &e_obj, &c_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    hil_graph_t graph;
+    double *e_out = NULL, *c_out = NULL;
+    size_t ne = 0, nc = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    const Py_ssize_t n = (Py_ssize_t)field.coordinates.rows;
+    if (!hil_py_graph(&v, src_obj, dst_obj, w_obj, n, &graph)) goto done;
+    e_out = HIL_PY_F64(&v, e_obj, 1, &ne, "entropy_out");
+    if (!e_out) goto done;
+    c_out = HIL_PY_F64(&v, c_obj, 1, &nc, "coherence_out");
+    if (!c_out) goto done;
+    if (ne != (size_t)n || nc != (size_t)n) {
+        PyErr_SetString(PyExc_ValueError, "output arrays must have one entry per row");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_leave_one_out_diagnostics(&field, &graph, e_out, c_out);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+
+/* ============================================================================
+ * Mixed Precision (float32 Storage)
+ * ============================================================================
+ *
+ * Same signatures and results as the double methods above; vectors and
+ * weights are float32 buffers and returned weights are float32 Buffers.
+ */
+
+static PyObject *hil_py_graph_build_cosine_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *src_obj, *dst_obj, *w_obj;
+    if (!PyArg_ParseTuple(args, "OOOO", &x_obj, &src_obj, &dst_obj, &w_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_f32_t field;
+    hil_graph_f32_t graph;
+    size_t ns = 0, nd = 0, nw = 0;
+    int ok = 0;
+
+    if (!hil_py_field_f32(&v, x_obj, &field, "vectors")) goto done;
+    graph.src = HIL_PY_U32_OUT(&v, src_obj, &ns, "src");
+    if (!graph.src) goto done;
+    graph.dst = HIL_PY_U32_OUT(&v, dst_obj, &nd, "dst");
+    if (!graph.dst) goto done;
+    graph.weight = HIL_PY_F32(&v, w_obj, 1, &nw, "weight");
+    if (!graph.weight) goto done;
+    if (ns != nd || ns != nw) {
+        PyErr_SetString(PyExc_ValueError, "src, dst, weight must have identical lengths");
+        goto done;
+    }
+    graph.num_nodes = field.coordinates.rows;
+    graph.num_edges = ns;
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_graph_build_cosine_f32(&field, &graph);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_graph_build_knn_csr_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj;
+    Py_ssize_t k;
+    double min_weight;
+    if (!PyArg_ParseTuple(args, "Ond", &x_obj, &k, &min_weight)) return NULL;
+    if (k < 0) {
+        PyErr_SetString(PyExc_ValueError, "k must be >= 0");
+        return NULL;
+    }
+
+    hil_py_views_t v = {0};
+    hil_field_f32_t field;
+    hil_graph_csr_f32_t csr = {0};
+    int ok = 0;
+
+    if (!hil_py_field_f32(&v, x_obj, &field, "vectors")) {
+        hil_py_release(&v);
+        return NULL;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_graph_build_knn_csr_f32(&field, (size_t)k, min_weight, &csr);
+    Py_END_ALLOW_THREADS
+
+    hil_py_release(&v);
+    if (!ok) {
+        hil_graph_csr_f32_free(&csr);
+        PyErr_SetString(PyExc_RuntimeError, "native graph_build_knn_csr_f32 failed");
+        return NULL;
+    }
+    return hil_py_csr_f32_result(&csr);
+}
+
+static PyObject *hil_py_graph_build_csr_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &src_obj, &dst_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_f32_t graph;
+    hil_graph_csr_f32_t csr = {0};
+    int ok = 0;
+
+    if (hil_py_graph_f32(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        ok = hil_graph_build_csr_f32(&graph, &csr);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        hil_graph_csr_f32_free(&csr);
+        PyErr_SetString(PyExc_RuntimeError, "native graph_build_csr_f32 failed");
+        return NULL;
+    }
+    return hil_py_csr_f32_result(&csr);
+}
+
+static PyObject *hil_py_graph_entropy_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj, *ws_obj = Py_None;
+    Py_ssize_t num_nodes;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "OOOn|O", &src_obj, &dst_obj, &w_obj, &num_nodes,
+                          &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_f32_t graph;
+    double h = 0.0;
+
+    if (hil_py_graph_f32(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = ws ? hil_graph_entropy_f32_ws(&graph, ws) : hil_graph_entropy_f32(&graph);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_out_entropy_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &src_obj, &dst_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_f32_t graph;
+    double h = 0.0;
+
+    if (hil_py_graph_f32(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = hil_graph_out_entropy_f32(&graph);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_graph_metrics_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *src_obj, *dst_obj, *w_obj, *ws_obj = Py_None;
+    Py_ssize_t num_nodes;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "OOOn|O", &src_obj, &dst_obj, &w_obj, &num_nodes,
+                          &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_f32_t graph;
+    hil_graph_metrics_t m;
+    int ok = 0;
+
+    if (hil_py_graph_f32(&v, src_obj, dst_obj, w_obj, num_nodes, &graph)) {
+        Py_BEGIN_ALLOW_THREADS
+        ok = ws ? hil_graph_metrics_f32_ws(&graph, &m, NULL, ws)
+                : hil_graph_metrics_f32(&graph, &m, NULL);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        PyErr_SetString(PyExc_RuntimeError, "native graph_metrics_f32 failed");
+        return NULL;
+    }
+    return hil_py_metrics_dict(&m);
+}
+
+static PyObject *hil_py_graph_entropy_csr_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *off_obj, *idx_obj, *w_obj;
+    Py_ssize_t num_nodes;
+    if (!PyArg_ParseTuple(args, "OOOn", &off_obj, &idx_obj, &w_obj, &num_nodes)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_graph_csr_f32_t csr;
+    double h = 0.0;
+
+    if (hil_py_csr_f32(&v, off_obj, idx_obj, w_obj, num_nodes, 0, &csr)) {
+        Py_BEGIN_ALLOW_THREADS
+        h = hil_graph_entropy_csr_f32(&csr);
+        Py_END_ALLOW_THREADS
+    }
+
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyFloat_FromDouble(h);
+}
+
+static PyObject *hil_py_field_summary_f32(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *norms_obj = Py_None, *ws_obj = Py_None;
+    hil_workspace_t *ws;
+    if (!PyArg_ParseTuple(args, "O|OO", &x_obj, &norms_obj, &ws_obj)) return NULL;
+    if (!hil_py_workspace_arg(ws_obj, &ws)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_f32_t field;
+    hil_field_summary_t s;
+    double *norms = NULL;
+    size_t nn = 0;
+    int ok = 0;
+
+    if (!hil_py_field_f32(&v, x_obj, &field, "vectors")) goto done;
+    if (norms_obj != Py_None) {
+        norms = HIL_PY_F64(&v, norms_obj, 1, &nn, "row_norms");
+        if (!norms) goto done;
+        if (nn != field.coordinates.rows) {
+            PyErr_SetString(PyExc_ValueError, "row_norms must have one entry per row");
+            goto done;
+        }
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = ws ? hil_field_summary_f32_ws(&field, &s, norms, ws)
+            : hil_field_summary_f32(&field, &s, norms);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) {
+        PyErr_SetString(PyExc_RuntimeError, "native field_summary_f32 failed");
+        return NULL;
+    }
+    return hil_py_summary_dict(&s);
+}
+
+
+/* ============================================================================
+ * Geometric Delta (PCA / Procrustes)
+ * ============================================================================
+ */
+
+/* Optional k * cols warm-start axes: None or a flat float64 buffer. */
+static int hil_py_warm_axes(
+    hil_py_views_t *v,
+    PyObject *obj,
+    size_t expected,
+    const double **out
+) {
+    *out = NULL;
+    if (obj == Py_None) return 1;
+    size_t nw = 0;
+    const double *w = HIL_PY_F64(v, obj, 0, &nw, "warm_axes");
+    if (!w) return 0;
+    if (nw != expected) {
+        PyErr_SetString(PyExc_ValueError, "warm_axes must hold k * cols entries");
+        return 0;
+    }
+    *out = w;
+    return 1;
+}
+
+static PyObject *hil_py_pca_axes(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *warm_obj, *axes_obj, *mean_obj, *var_obj;
+    Py_ssize_t k, max_iter;
+    double tol;
+    if (!PyArg_ParseTuple(args, "OnOndOOO", &x_obj, &k, &warm_obj, &max_iter, &tol,
+                          &axes_obj, &mean_obj, &var_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    const double *warm = NULL;
+    double *axes = NULL, *mean = NULL, *var = NULL;
+    size_t na = 0, nm = 0, nv = 0;
+    int ok = 0;
+
+    if (k < 1 || k > HIL_PCA_MAX_AXES || max_iter < 1) {
+        PyErr_SetString(PyExc_ValueError, "k must be in [1, 3] and max_iter >= 1");
+        return NULL;
+    }
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    const size_t d = field.coordinates.cols;
+    if (!hil_py_warm_axes(&v, warm_obj, (size_t)k * d, &warm)) goto done;
+    axes = HIL_PY_F64(&v, axes_obj, 1, &na, "axes_out");
+    if (!axes) goto done;
+    mean = HIL_PY_F64(&v, mean_obj, 1, &nm, "mean_out");
+    if (!mean) goto done;
+    var = HIL_PY_F64(&v, var_obj, 1, &nv, "variance_out");
+    if (!var) goto done;
+    if (na != (size_t)k * d || nm != d || nv != (size_t)k) {
+        PyErr_SetString(PyExc_ValueError, "outputs must hold k * cols, cols and k entries");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_pca_axes(&field, (size_t)k, warm, (size_t)max_iter, tol, axes, mean, var);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+/*
+ * Borrow uint64 row offsets 0 = off[0] < ... < off[n - 1] = rows of a field;
+ * *out_length receives n. NULL with an exception set on failure.
+ */
+static const uint64_t *hil_py_row_offsets(
+    hil_py_views_t *v,
+    PyObject *obj,
+    const hil_field_t *all,
+    size_t *out_length
+) {
+    const uint64_t *off = HIL_PY_U64(v, obj, out_length, "row_offsets");
+    if (!off) return NULL;
+    const size_t n = *out_length;
+    if (n < 2 || off[0] != 0 || off[n - 1] != all->coordinates.rows) {
+        PyErr_SetString(PyExc_ValueError, "row_offsets must run from 0 to the number of rows");
+        return NULL;
+    }
+    for (size_t i = 0; i + 1 < n; i++) {
+        if (off[i + 1] <= off[i]) {
+            PyErr_SetString(PyExc_ValueError, "row_offsets must be strictly increasing");
+            return NULL;
+        }
+    }
+    return off;
+}
+
+/* Row-range field views of `all`, one per offset interval (PyMem_Free). */
+static hil_field_t *hil_py_row_ranges(const hil_field_t *all, const uint64_t *off, size_t count) {
+    hil_field_t *fields = (hil_field_t*)PyMem_Malloc(sizeof(hil_field_t) * count);
+    if (!fields) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    for (size_t f = 0; f < count; f++) {
+        fields[f].coordinates = all->coordinates;
+        fields[f].coordinates.data = hil_matrix_row(&all->coordinates, (size_t)off[f]);
+        fields[f].coordinates.rows = (size_t)(off[f + 1] - off[f]);
+    }
+    return fields;
+}
+
+static PyObject *hil_py_pca_axes_batch(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *off_obj, *warm_obj, *axes_obj, *means_obj, *vars_obj;
+    Py_ssize_t k, max_iter;
+    double tol;
+    if (!PyArg_ParseTuple(args, "OOnOndOOO", &x_obj, &off_obj, &k, &warm_obj, &max_iter,
+                          &tol, &axes_obj, &means_obj, &vars_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t all;
+    hil_field_t *fields = NULL;
+    const uint64_t *off = NULL;
+    const double *warm = NULL;
+    double *axes = NULL, *means = NULL, *vars = NULL;
+    size_t no = 0, na = 0, nm = 0, nv = 0;
+    int ok = 0;
+
+    if (k < 1 || k > HIL_PCA_MAX_AXES || max_iter < 1) {
+        PyErr_SetString(PyExc_ValueError, "k must be in [1, 3] and max_iter >= 1");
+        return NULL;
+    }
+    if (!hil_py_field(&v, x_obj, &all, "vectors")) goto done;
+    const size_t d = all.coordinates.cols;
+    off = hil_py_row_offsets(&v, off_obj, &all, &no);
+    if (!off) goto done;
+    const size_t count = no - 1;
+    if (!hil_py_warm_axes(&v, warm_obj, (size_t)k * d, &warm)) goto done;
+    axes = HIL_PY_F64(&v, axes_obj, 1, &na, "axes_out");
+    if (!axes) goto done;
+    means = HIL_PY_F64(&v, means_obj, 1, &nm, "means_out");
+    if (!means) goto done;
+    vars = HIL_PY_F64(&v, vars_obj, 1, &nv, "variances_out");
+    if (!vars) goto done;
+    if (na != count * (size_t)k * d || nm != count * d || nv != count * (size_t)k) {
+        PyErr_SetString(PyExc_ValueError, "outputs must hold one block per field");
+        goto done;
+    }
+
+    fields = hil_py_row_ranges(&all, off, count);
+    if (!fields) goto done;
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_pca_axes_batch(fields, count, (size_t)k, warm, (size_t)max_iter, tol,
+                            axes, means, vars);
+    Py_END_ALLOW_THREADS
+
+done:
+    PyMem_Free(fields);
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_geometry_delta_loo(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *out_obj;
+    Py_ssize_t max_iter;
+    double tol;
+    if (!PyArg_ParseTuple(args, "OndO", &x_obj, &max_iter, &tol, &out_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    double *out = NULL;
+    size_t no = 0;
+    int ok = 0;
+
+    if (max_iter < 1) {
+        PyErr_SetString(PyExc_ValueError, "max_iter must be >= 1");
+        return NULL;
+    }
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    out = HIL_PY_F64(&v, out_obj, 1, &no, "delta_out");
+    if (!out) goto done;
+    if (no != field.coordinates.rows) {
+        PyErr_SetString(PyExc_ValueError, "delta_out must have one entry per row");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_geometry_delta_loo(&field, (size_t)max_iter, tol, out);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+
+/* ============================================================================
+ * Snapshot Batches
+ * ============================================================================
+ */
+
+static PyObject *hil_py_field_summary_batch(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *off_obj, *sum_obj, *cent_obj = Py_None;
+    if (!PyArg_ParseTuple(args, "OOO|O", &x_obj, &off_obj, &sum_obj, &cent_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t all;
+    hil_field_t *fields = NULL;
+    hil_field_summary_t *sums = NULL;
+    const uint64_t *off = NULL;
+    double *out = NULL, *cent = NULL;
+    size_t no = 0, ns = 0, nc = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &all, "vectors")) goto done;
+    off = hil_py_row_offsets(&v, off_obj, &all, &no);
+    if (!off) goto done;
+    const size_t count = no - 1;
+    out = HIL_PY_F64(&v, sum_obj, 1, &ns, "summary_out");
+    if (!out) goto done;
+    if (ns != 3 * count) {
+        PyErr_SetString(PyExc_ValueError, "summary_out must hold 3 entries per snapshot");
+        goto done;
+    }
+    if (cent_obj != Py_None) {
+        cent = HIL_PY_F64(&v, cent_obj, 1, &nc, "centroids_out");
+        if (!cent) goto done;
+        if (nc != count * all.coordinates.cols) {
+            PyErr_SetString(PyExc_ValueError, "centroids_out must hold one row per snapshot");
+            goto done;
+        }
+    }
+
+    fields = hil_py_row_ranges(&all, off, count);
+    if (!fields) goto done;
+    sums = (hil_field_summary_t*)PyMem_Malloc(sizeof(hil_field_summary_t) * count);
+    if (!sums) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_field_summary_batch(fields, count, sums, cent);
+    Py_END_ALLOW_THREADS
+
+    for (size_t t = 0; ok && t < count; t++) {
+        out[3 * t + 0] = sums[t].mean_norm;
+        out[3 * t + 1] = sums[t].centroid_norm;
+        out[3 * t + 2] = sums[t].coherence;
+    }
+
+done:
+    PyMem_Free(sums);
+    PyMem_Free(fields);
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_macrostate_dispersion_batch(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *stack_obj, *out_obj;
+    Py_ssize_t count, group, k;
+    int linf;
+    if (!PyArg_ParseTuple(args, "OnnnpO", &stack_obj, &count, &group, &k, &linf, &out_obj)) {
+        return NULL;
+    }
+
+    hil_py_views_t v = {0};
+    const double *stack = NULL;
+    double *out = NULL;
+    size_t ns = 0, no = 0;
+    int ok = 0;
+
+    if (count < 0 || group < 1 || k < 1) {
+        PyErr_SetString(PyExc_ValueError, "count must be >= 0, group and k >= 1");
+        return NULL;
+    }
+    stack = HIL_PY_F64(&v, stack_obj, 0, &ns, "stack");
+    if (!stack) goto done;
+    out = HIL_PY_F64(&v, out_obj, 1, &no, "dispersion_out");
+    if (!out) goto done;
+    if (ns != (size_t)count * (size_t)group * (size_t)k || no != (size_t)count) {
+        PyErr_SetString(PyExc_ValueError, "stack must be count x group x k and dispersion_out count");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_macrostate_dispersion_batch(stack, (size_t)count, (size_t)group, (size_t)k,
+                                         linf ? HIL_NORM_LINF : HIL_NORM_L2, out);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_fiber_entropy_batch(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *out_obj;
+    if (!PyArg_ParseTuple(args, "OO", &x_obj, &out_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t sigmas;
+    double *out = NULL;
+    size_t no = 0;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &sigmas, "sigmas")) goto done;
+    out = HIL_PY_F64(&v, out_obj, 1, &no, "entropy_out");
+    if (!out) goto done;
+    if (no != sigmas.coordinates.rows) {
+        PyErr_SetString(PyExc_ValueError, "entropy_out must have one entry per row");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_fiber_entropy_batch(&sigmas, out);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+/*
+ * field_spectrum(vectors, covariance, k, ncv, max_restarts, tol, start,
+ *                values_out, vectors_out) -> info dict, or None on failure.
+ * start and vectors_out may be None; N is rows (Gram) or cols (covariance).
+ */
+static PyObject *hil_py_field_spectrum(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *x_obj, *start_obj, *vals_obj, *vecs_obj;
+    int covariance;
+    Py_ssize_t k, ncv, max_restarts;
+    double tol;
+    if (!PyArg_ParseTuple(args, "OpnnndOOO", &x_obj, &covariance, &k, &ncv, &max_restarts,
+                          &tol, &start_obj, &vals_obj, &vecs_obj)) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    hil_spectrum_info_t info = {0, 0, 0};
+    const double *start = NULL;
+    double *vals = NULL, *vecs = NULL;
+    size_t ns = 0, nl = 0, nv = 0;
+    int ok = 0;
+
+    if (k < 1 || ncv < 0 || max_restarts < 1) {
+        PyErr_SetString(PyExc_ValueError, "k must be >= 1, ncv >= 0 and max_restarts >= 1");
+        return NULL;
+    }
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    const size_t N = covariance ? field.coordinates.cols : field.coordinates.rows;
+    if (start_obj != Py_None) {
+        start = HIL_PY_F64(&v, start_obj, 0, &ns, "start");
+        if (!start) goto done;
+        if (ns != N) {
+            PyErr_Format(PyExc_ValueError, "start must hold %zu entries", N);
+            goto done;
+        }
+    }
+    vals = HIL_PY_F64(&v, vals_obj, 1, &nl, "values_out");
+    if (!vals) goto done;
+    if (vecs_obj != Py_None) {
+        vecs = HIL_PY_F64(&v, vecs_obj, 1, &nv, "vectors_out");
+        if (!vecs) goto done;
+    }
+    if (nl != (size_t)k || (vecs && nv != (size_t)k * N)) {
+        PyErr_SetString(PyExc_ValueError, "outputs must hold k and k * N entries");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_field_spectrum(&field,
+                            covariance ? HIL_SPECTRUM_COVARIANCE : HIL_SPECTRUM_GRAM,
+                            (size_t)k, (size_t)ncv, (size_t)max_restarts, tol, start,
+                            vals, vecs, &info);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    if (!ok) Py_RETURN_NONE;
+    return Py_BuildValue(
+        "{s:n,s:n,s:n}",
+        "matvecs", (Py_ssize_t)info.matvecs,
+        "restarts", (Py_ssize_t)info.restarts,
+        "converged", (Py_ssize_t)info.converged
+    );
+}
+
+
+/* ============================================================================
+ * Lexicon
+ * ============================================================================
+ *
+ * A lexicon is held in a capsule across lexicon_add calls so documents can
+ * be streamed in batches. A capsule must not be shared between threads.
+ */
+
+#define HIL_PY_LEXICON "hil.core.native.lexicon"
+
+static void hil_py_lexicon_destroy(PyObject *capsule) {
+    hil_lexicon_free((hil_lexicon_t*)PyCapsule_GetPointer(capsule, HIL_PY_LEXICON));
+}
+
+static PyObject *hil_py_lexicon_new(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
+    hil_lexicon_t *lex = hil_lexicon_create();
+    if (!lex) return PyErr_NoMemory();
+    PyObject *capsule = PyCapsule_New(lex, HIL_PY_LEXICON, hil_py_lexicon_destroy);
+    if (!capsule) hil_lexicon_free(lex);
+    return capsule;
+}
+
+static PyObject *hil_py_lexicon_add(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj, *text_obj, *off_obj;
+    if (!PyArg_ParseTuple(args, "OOO", &cap_obj, &text_obj, &off_obj)) return NULL;
+
+    hil_lexicon_t *lex = (hil_lexicon_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_LEXICON);
+    if (!lex) return NULL;
+
+    hil_py_views_t v = {0};
+    uint8_t *text = NULL;
+    uint64_t *offsets = NULL;
+    size_t nt = 0, no = 0;
+    int ok = 0;
+
+    text = HIL_PY_BYTES(&v, text_obj, &nt, "text");
+    if (!text) goto done;
+    offsets = HIL_PY_U64(&v, off_obj, &no, "doc_offsets");
+    if (!offsets) goto done;
+    if (no < 1 || offsets[no - 1] > (uint64_t)nt || offsets[0] > offsets[no - 1]) {
+        PyErr_SetString(PyExc_ValueError, "doc_offsets must be non-empty and lie within text");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_lexicon_add(lex, text, offsets, no - 1);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_lexicon_finish(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj;
+    unsigned long long min_count;
+    Py_ssize_t max_terms;
+    if (!PyArg_ParseTuple(args, "OKn", &cap_obj, &min_count, &max_terms)) return NULL;
+    if (max_terms < 0) {
+        PyErr_SetString(PyExc_ValueError, "max_terms must be >= 0");
+        return NULL;
+    }
+
+    hil_lexicon_t *lex = (hil_lexicon_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_LEXICON);
+    if (!lex) return NULL;
+
+    hil_term_doc_t td;
+    int ok = 0;
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_lexicon_finish(lex, (uint64_t)min_count, (size_t)max_terms, &td);
+    Py_END_ALLOW_THREADS
+    if (!ok) {
+        PyErr_SetString(PyExc_RuntimeError, "native lexicon_finish failed");
+        return NULL;
+    }
+
+    const size_t nnz = (size_t)td.offsets[td.num_docs];
+    PyObject *off = NULL, *idx = NULL, *cnt = NULL, *tc = NULL, *toff = NULL;
+    PyObject *terms = NULL, *out = NULL;
+
+    terms = PyBytes_FromStringAndSize(td.term_bytes, (Py_ssize_t)td.term_offsets[td.num_terms]);
+    if (terms) off = hil_py_buffer_take((void**)&td.offsets, td.num_docs + 1, 8, 'Q');
+    if (off) idx = hil_py_buffer_take((void**)&td.indices, nnz, 4, 'I');
+    if (idx) cnt = hil_py_buffer_take((void**)&td.counts, nnz, 8, 'd');
+    if (cnt) tc = hil_py_buffer_take((void**)&td.term_counts, td.num_terms, 8, 'Q');
+    if (tc) toff = hil_py_buffer_take((void**)&td.term_offsets, td.num_terms + 1, 8, 'Q');
+    if (toff) out = PyTuple_Pack(6, off, idx, cnt, tc, toff, terms);
+
+    Py_XDECREF(off);
+    Py_XDECREF(idx);
+    Py_XDECREF(cnt);
+    Py_XDECREF(tc);
+    Py_XDECREF(toff);
+    Py_XDECREF(terms);
+    hil_term_doc_free(&td);
+    return out;
+}
+
+
+/* ============================================================================
+ * ANN Index
+ * ============================================================================
+ *
+ * An HNSW index is held in a capsule across ann_add calls so rows can be
+ * appended as a field grows. ann_add must not run concurrently with any
+ * other call on the same capsule; queries may overlap each other.
+ */
+
+#define HIL_PY_ANN "hil.core.native.ann"
+
+static void hil_py_ann_destroy(PyObject *capsule) {
+    hil_ann_free((hil_ann_t*)PyCapsule_GetPointer(capsule, HIL_PY_ANN));
+}
+
+static PyObject *hil_py_ann_capsule(hil_ann_t *ann) {
+    PyObject *capsule = PyCapsule_New(ann, HIL_PY_ANN, hil_py_ann_destroy);
+    if (!capsule) hil_ann_free(ann);
+    return capsule;
+}
+
+static PyObject *hil_py_ann_new(PyObject *self, PyObject *args) {
+    (void)self;
+    Py_ssize_t dim, m, ef_construction;
+    unsigned long long seed;
+    if (!PyArg_ParseTuple(args, "nnnK", &dim, &m, &ef_construction, &seed)) return NULL;
+    if (dim < 1 || m < 2 || ef_construction < 1) {
+        PyErr_SetString(PyExc_ValueError, "requires dim >= 1, m >= 2 and ef_construction >= 1");
+        return NULL;
+    }
+
+    const hil_ann_params_t params = { (size_t)m, (size_t)ef_construction, (uint64_t)seed };
+    hil_ann_t *ann = hil_ann_create((size_t)dim, &params);
+    if (!ann) return PyErr_NoMemory();
+    return hil_py_ann_capsule(ann);
+}
+
+static PyObject *hil_py_ann_add(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj, *x_obj;
+    if (!PyArg_ParseTuple(args, "OO", &cap_obj, &x_obj)) return NULL;
+
+    hil_ann_t *ann = (hil_ann_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_ANN);
+    if (!ann) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "vectors")) goto done;
+    if (field.coordinates.cols != hil_ann_dim(ann)) {
+        PyErr_SetString(PyExc_ValueError, "vectors: width must equal the index dim");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_ann_add(ann, &field);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+/* Borrow (out_ids, out_weight) for count * k results. */
+static int hil_py_ann_outputs(
+    hil_py_views_t *v,
+    PyObject *ids_obj,
+    PyObject *w_obj,
+    size_t count,
+    size_t k,
+    uint32_t **out_ids,
+    double **out_w
+) {
+    size_t ni = 0, nw = 0;
+    *out_ids = HIL_PY_U32_OUT(v, ids_obj, &ni, "out_ids");
+    if (!*out_ids) return 0;
+    *out_w = HIL_PY_F64(v, w_obj, 1, &nw, "out_weight");
+    if (!*out_w) return 0;
+    if (ni != count * k || nw != count * k) {
+        PyErr_SetString(PyExc_ValueError, "out_ids and out_weight must hold count * k entries");
+        return 0;
+    }
+    return 1;
+}
+
+static PyObject *hil_py_ann_query(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj, *x_obj, *ids_obj, *w_obj;
+    Py_ssize_t k, ef;
+    if (!PyArg_ParseTuple(args, "OOnnOO", &cap_obj, &x_obj, &k, &ef, &ids_obj, &w_obj)) {
+        return NULL;
+    }
+    if (k < 1 || ef < 0) {
+        PyErr_SetString(PyExc_ValueError, "requires k >= 1 and ef >= 0");
+        return NULL;
+    }
+
+    hil_ann_t *ann = (hil_ann_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_ANN);
+    if (!ann) return NULL;
+
+    hil_py_views_t v = {0};
+    hil_field_t field;
+    uint32_t *ids = NULL;
+    double *w = NULL;
+    int ok = 0;
+
+    if (!hil_py_field(&v, x_obj, &field, "queries")) goto done;
+    if (field.coordinates.cols != hil_ann_dim(ann)) {
+        PyErr_SetString(PyExc_ValueError, "queries: width must equal the index dim");
+        goto done;
+    }
+    if (!hil_py_ann_outputs(&v, ids_obj, w_obj, field.coordinates.rows, (size_t)k, &ids, &w)) {
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_ann_query(ann, &field, (size_t)k, (size_t)ef, ids, w);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_ann_query_nodes(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj, *nodes_obj, *ids_obj, *w_obj;
+    Py_ssize_t k, ef;
+    if (!PyArg_ParseTuple(args, "OOnnOO", &cap_obj, &nodes_obj, &k, &ef, &ids_obj, &w_obj)) {
+        return NULL;
+    }
+    if (k < 1 || ef < 0) {
+        PyErr_SetString(PyExc_ValueError, "requires k >= 1 and ef >= 0");
+        return NULL;
+    }
+
+    hil_ann_t *ann = (hil_ann_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_ANN);
+    if (!ann) return NULL;
+
+    hil_py_views_t v = {0};
+    uint32_t *nodes = NULL, *ids = NULL;
+    double *w = NULL;
+    size_t count = 0;
+    int ok = 0;
+
+    nodes = HIL_PY_U32(&v, nodes_obj, &count, "nodes");
+    if (!nodes) goto done;
+    for (size_t q = 0; q < count; q++) {
+        if (nodes[q] >= hil_ann_size(ann)) {
+            PyErr_SetString(PyExc_ValueError, "nodes: id out of range");
+            goto done;
+        }
+    }
+    if (!hil_py_ann_outputs(&v, ids_obj, w_obj, count, (size_t)k, &ids, &w)) goto done;
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_ann_query_nodes(ann, nodes, count, (size_t)k, (size_t)ef, ids, w);
+    Py_END_ALLOW_THREADS
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return PyBool_FromLong(ok);
+}
+
+static PyObject *hil_py_ann_info(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj;
+    if (!PyArg_ParseTuple(args, "O", &cap_obj)) return NULL;
+
+    const hil_ann_t *ann = (const hil_ann_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_ANN);
+    if (!ann) return NULL;
+
+    const hil_ann_params_t p = hil_ann_params(ann);
+    const uint32_t entry = hil_ann_entry(ann);
+    return Py_BuildValue(
+        "{s:n,s:n,s:n,s:n,s:K,s:I,s:L}",
+        "dim", (Py_ssize_t)hil_ann_dim(ann),
+        "size", (Py_ssize_t)hil_ann_size(ann),
+        "m", (Py_ssize_t)p.m,
+        "ef_construction", (Py_ssize_t)p.ef_construction,
+        "seed", (unsigned long long)p.seed,
+        "max_level", (unsigned int)hil_ann_max_level(ann),
+        "entry", entry == HIL_ANN_NONE ? -1LL : (long long)entry
+    );
+}
+
+static PyObject *hil_py_ann_export(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *cap_obj;
+    if (!PyArg_ParseTuple(args, "O", &cap_obj)) return NULL;
+
+    const hil_ann_t *ann = (const hil_ann_t*)PyCapsule_GetPointer(cap_obj, HIL_PY_ANN);
+    if (!ann) return NULL;
+
+    hil_ann_graph_t g;
+    int ok = 0;
+    Py_BEGIN_ALLOW_THREADS
+    ok = hil_ann_export(ann, &g);
+    Py_END_ALLOW_THREADS
+    if (!ok) return PyErr_NoMemory();
+
+    const size_t n = g.num_nodes;
+    const size_t num_links = (size_t)g.offsets[n];
+    PyObject *vec = NULL, *lv = NULL, *off = NULL, *links = NULL, *out = NULL;
+
+    vec = hil_py_buffer_take((void**)&g.vectors, n * g.dim, 8, 'd');
+    if (vec) lv = hil_py_buffer_take((void**)&g.levels, n, 4, 'I');
+    if (lv) off = hil_py_buffer_take((void**)&g.offsets, n + 1, 8, 'Q');
+    if (off) links = hil_py_buffer_take((void**)&g.links, num_links, 4, 'I');
+    if (links) out = PyTuple_Pack(4, vec, lv, off, links);
+
+    Py_XDECREF(vec);
+    Py_XDECREF(lv);
+    Py_XDECREF(off);
+    Py_XDECREF(links);
+    hil_ann_graph_free(&g);
+    return out;
+}
+
+static PyObject *hil_py_ann_import(PyObject *self, PyObject *args) {
+    (void)self;
+    Py_ssize_t dim, m, ef_construction;
+    unsigned long long seed;
+    long long entry;
+    unsigned int max_level;
+    PyObject *vec_obj, *lv_obj, *off_obj, *links_obj;
+    if (!PyArg_ParseTuple(args, "nnnKLIOOOO", &dim, &m, &ef_construction, &seed,
+                          &entry, &max_level, &vec_obj, &lv_obj, &off_obj, &links_obj)) {
+        return NULL;
+    }
+    if (dim < 1 || m < 2 || ef_construction < 1 || entry < -1 || entry >= (long long)HIL_ANN_NONE) {
+        PyErr_SetString(PyExc_ValueError, "invalid index parameters");
+        return NULL;
+    }
+
+    hil_py_views_t v = {0};
+    hil_ann_graph_t g;
+    size_t nv = 0, nl = 0, no = 0, nk = 0;
+    hil_ann_t *ann = NULL;
+
+    g.dim = (size_t)dim;
+    g.params.m = (size_t)m;
+    g.params.ef_construction = (size_t)ef_construction;
+    g.params.seed = (uint64_t)seed;
+    g.entry = entry < 0 ? HIL_ANN_NONE : (uint32_t)entry;
+    g.max_level = max_level;
+
+    g.vectors = HIL_PY_F64(&v, vec_obj, 0, &nv, "vectors");
+    if (!g.vectors) goto done;
+    g.levels = HIL_PY_U32(&v, lv_obj, &nl, "levels");
+    if (!g.levels) goto done;
+    g.offsets = HIL_PY_U64(&v, off_obj, &no, "offsets");
+    if (!g.offsets) goto done;
+    g.links = HIL_PY_U32(&v, links_obj, &nk, "links");
+    if (!g.links) goto done;
+    g.num_nodes = nl;
+    if (nv != nl * g.dim || no != nl + 1 || g.offsets[nl] != (uint64_t)nk) {
+        PyErr_SetString(PyExc_ValueError, "index arrays have inconsistent lengths");
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ann = hil_ann_import(&g);
+    Py_END_ALLOW_THREADS
+    if (!ann) PyErr_SetString(PyExc_ValueError, "index arrays do not describe a valid index");
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) {
+        hil_ann_free(ann);
+        return NULL;
+    }
+    return hil_py_ann_capsule(ann);
+}
+
+
+/* ============================================================================
+ * Instrumentation
+ * ============================================================================
+ */
+
+/*
+ * vec_dot(a, b, f32) -> (hil_vec_dot, hil_vec_dot_for(n)) of two arrays of
+ * one length, float32 (hil_vec_dot_f32) when f32 is true. Both come from the
+ * kernel selected at load time, for checks against the canonical order.
+ */
+static PyObject *hil_py_vec_dot(PyObject *self, PyObject *args) {
+    (void)self;
+    PyObject *a_obj, *b_obj;
+    int f32 = 0;
+    if (!PyArg_ParseTuple(args, "OOp", &a_obj, &b_obj, &f32)) return NULL;
+
+    hil_py_views_t v = {0};
+    size_t na = 0, nb = 0;
+    double dot = 0.0, dot_for = 0.0;
+
+    if (f32) {
+        const float *a = HIL_PY_F32(&v, a_obj, 0, &na, "a");
+        const float *b = a ? HIL_PY_F32(&v, b_obj, 0, &nb, "b") : NULL;
+        if (!b) goto done;
+        if (na != nb) {
+            PyErr_SetString(PyExc_ValueError, "a, b must have identical lengths");
+            goto done;
+        }
+        dot = hil_vec_dot_f32(a, b, na);
+        dot_for = hil_vec_dot_f32_for(na)(a, b, na);
+    } else {
+        const double *a = HIL_PY_F64(&v, a_obj, 0, &na, "a");
+        const double *b = a ? HIL_PY_F64(&v, b_obj, 0, &nb, "b") : NULL;
+        if (!b) goto done;
+        if (na != nb) {
+            PyErr_SetString(PyExc_ValueError, "a, b must have identical lengths");
+            goto done;
+        }
+        dot = hil_vec_dot(a, b, na);
+        dot_for = hil_vec_dot_for(na)(a, b, na);
+    }
+
+done:
+    hil_py_release(&v);
+    if (PyErr_Occurred()) return NULL;
+    return Py_BuildValue("(dd)", dot, dot_for);
+}
+
+static PyObject *hil_py_vec_backend(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
+    return PyUnicode_FromString(hil_vec_backend());
+}
+
+static PyObject *hil_py_native_stats(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
+    hil_stat_entry_t entries[HIL_STAT_COUNT];
+    const size_t n = hil_stats_snapshot(entries, HIL_STAT_COUNT);
+
+    PyObject *kernels = PyDict_New();
+    if (!kernels) return NULL;
+    for (size_t i = 0; i < n; i++) {
+        PyObject *entry = Py_BuildValue(
+            "{s:K,s:K,s:K,s:K}",
+            "calls", (unsigned long long)entries[i].calls,
+            "nanoseconds", (unsigned long long)entries[i].nanoseconds,
+            "bytes", (unsigned long long)entries[i].bytes,
+            "items", (unsigned long long)entries[i].items
+        );
+        if (!entry || PyDict_SetItemString(kernels, entries[i].name, entry) < 0) {
+            Py_XDECREF(entry);
+            Py_DECREF(kernels);
+            return NULL;
+        }
+        Py_DECREF(entry);
+    }
+
+    PyObject *out = Py_BuildValue("{s:O,s:O}",
+                                  "enabled", hil_stats_enabled() ? Py_True : Py_False,
+                                  "kernels", kernels);
+    Py_DECREF(kernels);
+    return out;
+}
+
+static PyObject *hil_py_native_stats_reset(PyObject *self, PyObject *args) {
+    (void)self;
+    (void)args;
+    hil_stats_reset();
+    Py_RETURN_NONE;
+}
+
+
+/* ============================================================================
+ * Module
+ * ============================================================================
+ */
+
+static PyMethodDef hil_py_methods[] = {
+    {"graph_build_cosine", hil_py_graph_build_cosine, METH_VARARGS,
+     "graph_build_cosine(vectors, src, dst, weight) -> bool"},
+    {"graph_build_knn_csr", hil_py_graph_build_knn_csr, METH_VARARGS,
+     "graph_build_knn_csr(vectors, k, min_weight) -> (offsets, indices, weight)"},
+    {"graph_entropy", hil_py_graph_entropy, METH_VARARGS,
+     "graph_entropy(src, dst, weight, num_nodes, workspace=None) -> float"},
+    {"graph_out_entropy", hil_py_graph_out_entropy, METH_VARARGS,
+     "graph_out_entropy(src, dst, weight, num_nodes) -> float"},
+    {"graph_metrics", hil_py_graph_metrics, METH_VARARGS,
+     "graph_metrics(src, dst, weight, num_nodes, workspace=None) -> dict"},
+    {"graph_build_csr", hil_py_graph_build_csr, METH_VARARGS,
+     "graph_build_csr(src, dst, weight, num_nodes) -> (offsets, indices, weight)"},
+    {"graph_entropy_csr", hil_py_graph_entropy_csr, METH_VARARGS,
+     "graph_entropy_csr(offsets, indices, weight, num_nodes) -> float"},
+    {"graph_components", hil_py_graph_components, METH_VARARGS,
+     "graph_components(src, dst, weight, num_nodes, labels_out=None, sizes_out=None,"
+     " workspace=None) -> int"},
+    {"graph_connected_components_csr", hil_py_graph_connected_components_csr, METH_VARARGS,
+     "graph_connected_components_csr(offsets, indices, weight, num_nodes) -> int"},
+    {"graph_pack_csr", hil_py_graph_pack_csr, METH_VARARGS,
+     "graph_pack_csr(offsets, indices, weight, num_nodes) -> (offsets, stream)"},
+    {"graph_degree_packed", hil_py_graph_degree_packed, METH_VARARGS,
+     "graph_degree_packed(offsets, stream, num_nodes, num_edges) -> degree"},
+    {"graph_entropy_packed", hil_py_graph_entropy_packed, METH_VARARGS,
+     "graph_entropy_packed(offsets, stream, num_nodes, num_edges) -> float"},
+    {"graph_entropy_packed_bound", hil_py_graph_entropy_packed_bound, METH_VARARGS,
+     "graph_entropy_packed_bound(offsets, stream, num_nodes, num_edges) -> float"},
+    {"graph_connected_components_packed", hil_py_graph_connected_components_packed, METH_VARARGS,
+     "graph_connected_components_packed(offsets, stream, num_nodes, num_edges) -> int"},
+    {"lexicon_new", hil_py_lexicon_new, METH_NOARGS,
+     "lexicon_new() -> capsule"},
+    {"lexicon_add", hil_py_lexicon_add, METH_VARARGS,
+     "lexicon_add(lexicon, text, doc_offsets) -> bool"},
+    {"lexicon_finish", hil_py_lexicon_finish, METH_VARARGS,
+     "lexicon_finish(lexicon, min_count, max_terms) -> (offsets, indices, counts, "
+     "term_counts, term_offsets, term_bytes)"},
+    {"ann_new", hil_py_ann_new, METH_VARARGS,
+     "ann_new(dim, m, ef_construction, seed) -> capsule"},
+    {"ann_add", hil_py_ann_add, METH_VARARGS,
+     "ann_add(index, vectors) -> bool"},
+    {"ann_query", hil_py_ann_query, METH_VARARGS,
+     "ann_query(index, queries, k, ef, out_ids, out_weight) -> bool"},
+    {"ann_query_nodes", hil_py_ann_query_nodes, METH_VARARGS,
+     "ann_query_nodes(index, nodes, k, ef, out_ids, out_weight) -> bool"},
+    {"ann_info", hil_py_ann_info, METH_VARARGS,
+     "ann_info(index) -> {'dim', 'size', 'm', 'ef_construction', 'seed', 'max_level', 'entry'}"},
+    {"ann_export", hil_py_ann_export, METH_VARARGS,
+     "ann_export(index) -> (vectors, levels, offsets, links)"},
+    {"ann_import", hil_py_ann_import, METH_VARARGS,
+     "ann_import(dim, m, ef_construction, seed, entry, max_level, vectors, levels, offsets, "
+     "links) -> capsule"},
+    {"field_summary", hil_py_field_summary, METH_VARARGS,
+     "field_summary(vectors, row_norms=None, workspace=None) -> dict"},
+    {"epistemic_stability_curve", hil_py_epistemic_stability_curve, METH_VARARGS,
+     "epistemic_stability_curve(vectors, epsilons, sensitivity_out) -> bool"},
+    {"leave_one_out_diagnostics", hil_py_leave_one_out_diagnostics, METH_VARARGS,
+     "leave_one_out_diagnostics(vectors, src, dst, weight, entropy_out, coherence_out) -> bool"},
+    {"pca_axes", hil_py_pca_axes, METH_VARARGS,
+     "pca_axes(vectors, k, warm_axes, max_iter, tol, axes_out, mean_out, variance_out) -> bool"},
+    {"pca_axes_batch", hil_py_pca_axes_batch, METH_VARARGS,
+     "pca_axes_batch(vectors, row_offsets, k, warm_axes, max_iter, tol, axes_out, means_out, "
+     "variances_out) -> bool"},
+    {"geometry_delta_loo", hil_py_geometry_delta_loo, METH_VARARGS,
+     "geometry_delta_loo(vectors, max_iter, tol, delta_out) -> bool"},
+    {"field_summary_batch", hil_py_field_summary_batch, METH_VARARGS,
+     "field_summary_batch(vectors, row_offsets, summary_out, centroids_out=None) -> bool"},
+    {"macrostate_dispersion_batch", hil_py_macrostate_dispersion_batch, METH_VARARGS,
+     "macrostate_dispersion_batch(stack, count, group, k, linf, dispersion_out) -> bool"},
+    {"fiber_entropy_batch", hil_py_fiber_entropy_batch, METH_VARARGS,
+     "fiber_entropy_batch(sigmas, entropy_out) -> bool"},
+    {"field_spectrum", hil_py_field_spectrum, METH_VARARGS,
+     "field_spectrum(vectors, covariance, k, ncv, max_restarts, tol, start, values_out, "
+     "vectors_out) -> {'matvecs', 'restarts', 'converged'} | None"},
+    {"graph_build_cosine_f32", hil_py_graph_build_cosine_f32, METH_VARARGS,
+     "graph_build_cosine_f32(vectors, src, dst, weight) -> bool"},
+    {"graph_build_knn_csr_f32", hil_py_graph_build_knn_csr_f32, METH_VARARGS,
+     "graph_build_knn_csr_f32(vectors, k, min_weight) -> (offsets, indices, weight)"},
+    {"graph_build_csr_f32", hil_py_graph_build_csr_f32, METH_VARARGS,
+     "graph_build_csr_f32(src, dst, weight, num_nodes) -> (offsets, indices, weight)"},
+    {"graph_entropy_f32", hil_py_graph_entropy_f32, METH_VARARGS,
+     "graph_entropy_f32(src, dst, weight, num_nodes, workspace=None) -> float"},
+    {"graph_out_entropy_f32", hil_py_graph_out_entropy_f32, METH_VARARGS,
+     "graph_out_entropy_f32(src, dst, weight, num_nodes) -> float"},
+    {"graph_metrics_f32", hil_py_graph_metrics_f32, METH_VARARGS,
+     "graph_metrics_f32(src, dst, weight, num_nodes, workspace=None) -> dict"},
+    {"graph_entropy_csr_f32", hil_py_graph_entropy_csr_f32, METH_VARARGS,
+     "graph_entropy_csr_f32(offsets, indices, weight, num_nodes) -> float"},
+    {"field_summary_f32", hil_py_field_summary_f32, METH_VARARGS,
+     "field_summary_f32(vectors, row_norms=None, workspace=None) -> dict"},
+    {"workspace_new", hil_py_workspace_new, METH_VARARGS,
+     "workspace_new(initial_bytes=0) -> capsule"},
+    {"workspace_info", hil_py_workspace_info, METH_VARARGS,
+     "workspace_info(workspace) -> {'capacity', 'peak', 'overflow'}"},
+    {"vec_dot", hil_py_vec_dot, METH_VARARGS,
+     "vec_dot(a, b, f32) -> (dot, dot_for)"},
+    {"vec_backend", hil_py_vec_backend, METH_NOARGS,
+     "vec_backend() -> str"},
+    {"native_stats", hil_py_native_stats, METH_NOARGS,
+     "native_stats() -> {'enabled': bool, 'kernels': {name: {calls, nanoseconds, bytes, items}}}"},
+    {"native_stats_reset", hil_py_native_stats_reset, METH_NOARGS,
+     "native_stats_reset() -> None"},
+    {NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef hil_py_module = {
+    PyModuleDef_HEAD_INIT,
+    "_native",
+    "HIL native numerical kernel (zero-copy buffer-protocol bindings).",
+    -1,
+    hil_py_methods,
+    NULL, NULL, NULL, NULL,
+};
+
+PyMODINIT_FUNC PyInit__native(void) {
+    if (PyType_Ready(&hil_py_buffer_type) < 0) return NULL;
+
+    PyObject *m = PyModule_Create(&hil_py_module);
+    if (!m) return NULL;
+
+    Py_INCREF(&hil_py_buffer_type);
+    if (PyModule_AddObject(m, "Buffer", (PyObject*)&hil_py_buffer_type) < 0) {
+        Py_DECREF(&hil_py_buffer_type);
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
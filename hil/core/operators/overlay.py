@@ -18,7 +18,7 @@ Invariants:
 
 from __future__ import annotations
 
-from typing import Dict, Tuple
+from typing import Dict, Optional, Tuple
 
 import numpy as np
 from sklearn.decomposition import PCA
@@ -139,6 +139,138 @@ def compute_shared_pca(
     return pca, projections
 
 
+# ---------------------------------------------------------------------------
+# Shared projection (native principal axes)
+# ---------------------------------------------------------------------------
+
+def _truncate_common(
+    fields: Dict[str, np.ndarray],
+    n_components: int,
+) -> Dict[str, np.ndarray]:
+    _op_invariant(len(fields) >= 2, "need at least two fields to overlay")
+    _op_invariant(n_components in (2, 3), "n_components must be 2 or 3")
+
+    for name, arr in fields.items():
+        _op_invariant(
+            isinstance(arr, np.ndarray) and arr.ndim == 2 and arr.shape[0] >= 1,
+            f"field '{name}' must be a non-empty 2D numpy array",
+        )
+        _op_invariant(
+            np.isfinite(arr).all(),
+            f"field '{name}' contains non-finite values",
+        )
+
+    common_dim = min(arr.shape[1] for arr in fields.values())
+    _op_invariant(
+        common_dim >= n_components,
+        "common dimensionality too small for requested projection",
+    )
+    return {name: arr[:, :common_dim] for name, arr in fields.items()}
+
+
+def _principal_axes(X: np.ndarray, k: int) -> Tuple[np.ndarray, np.ndarray]:
+    """
+    (axes (k, d), mean (d,)) of X; native subspace iteration when available,
+    dense SVD otherwise. Axes are signed so each row's largest-magnitude
+    entry is positive.
+    """
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import pca_axes  # noqa: WPS433
+    except ImportError:
+        pca_axes = None
+
+    if pca_axes is not None:
+        try:
+            axes, mean, _ = pca_axes(X, k, copy=True)
+            return axes, mean
+        except NativeError:
+            pass
+
+    mean = X.mean(axis=0)
+    _, _, Vt = np.linalg.svd(X - mean, full_matrices=False)
+    axes = Vt[:k].copy()
+    pivots = np.argmax(np.abs(axes), axis=1)
+    axes *= np.sign(axes[np.arange(k), pivots])[:, None]
+    return axes, mean
+
+
+def compute_shared_projection(
+    fields: Dict[str, np.ndarray],
+    *,
+    n_components: int = 3,
+) -> Tuple[np.ndarray, np.ndarray, Dict[str, np.ndarray]]:
+    """
+    compute_shared_pca without the sklearn model: the same Field Alignment
+    Contract (truncate to the common dimensionality, one shared projection),
+    returning the projection itself.
+
+    Returns
+    -------
+    axes : np.ndarray, shape (n_components, common_dim)
+    mean : np.ndarray, shape (common_dim,)
+    projections : dict[str, np.ndarray], each (n_i, n_components)
+
+    Projections match compute_shared_pca up to the per-axis sign convention.
+    """
+    truncated = _truncate_common(fields, n_components)
+
+    X_all = np.vstack(list(truncated.values()))
+    axes, mean = _principal_axes(X_all, n_components)
+
+    projections = {
+        name: (arr - mean) @ axes.T
+        for name, arr in truncated.items()
+    }
+    return axes, mean, projections
+
+
+def compute_field_axes(
+    fields: Dict[str, np.ndarray],
+    *,
+    n_components: int = 3,
+    warm_axes: Optional[np.ndarray] = None,
+) -> Dict[str, np.ndarray]:
+    """
+    Per-field principal axes in the common subspace, for comparing each
+    field's own geometry against the shared projection.
+
+    All fields are solved in one batched native call (hil_pca_axes_batch),
+    warm-started from warm_axes (e.g. the axes of compute_shared_projection)
+    when given; per-field dense SVD otherwise.
+
+    Returns
+    -------
+    axes : dict[str, np.ndarray], each (n_components, common_dim)
+    """
+    truncated = _truncate_common(fields, n_components)
+    names = list(truncated.keys())
+
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import pca_axes_batch  # noqa: WPS433
+    except ImportError:
+        pca_axes_batch = None
+
+    if pca_axes_batch is not None:
+        try:
+            axes, _, _ = pca_axes_batch(
+                [truncated[name] for name in names],
+                n_components,
+                warm_axes=warm_axes,
+            )
+            return {name: axes[i] for i, name in enumerate(names)}
+        except NativeError:
+            pass
+
+    return {
+        name: _principal_axes(np.asarray(truncated[name], dtype=np.float64), n_components)[0]
+        for name in names
+    }
+
+
 __all__ = [
     "compute_shared_pca",
+    "compute_shared_projection",
+    "compute_field_axes",
 ]
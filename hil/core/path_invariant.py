@@ -44,14 +44,22 @@ def build_path(
     *,
     stream: StreamProtocol,
     dt: float,
-    build_macrostate: Callable[[MicroSlice], np.ndarray],
+    build_macrostate: Callable[[MicroSlice], np.ndarray] | None = None,
     anchors: List[TimeIndex] | None = None,
     require_pair_valid: bool = True,
+    build_macrostates: Callable[[List[MicroSlice]], np.ndarray] | None = None,
 ) -> CovariantPath:
     """
     Build an irregular-time covariant path and its arc-length parameterization.
+
+    Pass exactly one builder: build_macrostate (one slice -> (k,)) or
+    build_macrostates (list of slices -> (m, k)), which builds every anchor's
+    macrostate in one call, e.g. hil.core.timebase.field_summary_macrostates.
     """
 
+    if (build_macrostate is None) == (build_macrostates is None):
+        raise ValueError("Pass exactly one of build_macrostate, build_macrostates")
+
     if anchors is None:
         anchors = list(stream.times(dt))
 
@@ -69,17 +77,21 @@ def build_path(
                 continue
         valid_anchors.append(t)
 
-    sigmas: List[np.ndarray] = []
-
-    for t in valid_anchors:
-        slc = stream.slice(t, dt)
-        sigma = build_macrostate(slc)
-        sigmas.append(np.asarray(sigma, dtype=float))
-
-    if len(sigmas) == 0:
+    if len(valid_anchors) == 0:
         return CovariantPath([], np.empty((0, 0)), np.empty((0,)), np.empty((0,)))
 
-    sigmas_arr = np.stack(sigmas, axis=0)
+    if build_macrostates is not None:
+        sigmas_arr = np.asarray(
+            build_macrostates([stream.slice(t, dt) for t in valid_anchors]),
+            dtype=float,
+        )
+        if sigmas_arr.ndim != 2 or sigmas_arr.shape[0] != len(valid_anchors):
+            raise ValueError("build_macrostates must return shape (len(anchors), k)")
+    else:
+        sigmas_arr = np.stack(
+            [np.asarray(build_macrostate(stream.slice(t, dt)), dtype=float) for t in valid_anchors],
+            axis=0,
+        )
 
     if len(sigmas_arr) == 1:
         return CovariantPath(
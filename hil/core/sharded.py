@@ -0,0 +1,542 @@
+# hil/core/sharded.py
+"""
+hil.core.sharded
+
+Row-sharded graph construction and diagnostics across cooperating processes.
+
+A field too large for one node is split into contiguous row ranges, one per
+shard. Each shard builds the CSR rows of the elements it owns by streaming
+every shard's normalized rows past its own (one column block at a time, so
+no node ever holds the whole field), then reduces small mergeable partials:
+
+- FieldPartial: row count, centroid sum, sum of norm-clamped unit rows
+- ForestPartial: a union-find forest over all nodes, stored as the smallest
+  node of each node's known component
+- strength totals, then per-shard entropy terms against the global total
+
+Merges are associative and performed in rank order, so every shard obtains
+the same numbers whatever the transport.
+
+Reference semantics (equal up to floating-point rounding; the rows are
+normalized and multiplied with NumPy, not the native canonical order):
+- CSR rows == build_structure_csr(field, k=k, min_weight=min_weight)
+- entropy == structural_entropy of that CSR graph; with k and min_weight
+  both None the rows hold both directions of every pair, so this is the
+  weighted-degree entropy of build_structure(field) (hil_graph_entropy),
+  not structural_entropy of that edge list (out-strength only)
+- coherence == field_coherence(field) (hil_field_coherence)
+- components == hil_graph_connected_components on the same graph
+
+Transport:
+- sharded_structure(comm, rows) is collective over any object with rank,
+  size, bcast(obj, root) and allgather(obj) — mpi4py's MPI.COMM_WORLD
+  qualifies as is; SerialComm runs a single shard in-process.
+- simulate_sharded_structure(vectors, shards) runs every shard of one
+  process serially through the same builder and merges.
+
+Invariants:
+- Structural / diagnostic only (returns numbers; never classifies)
+- Deterministic for a fixed field and shard count
+- No IO, no persistence
+"""
+
+from __future__ import annotations
+
+from dataclasses import dataclass
+from typing import Any, List, Optional, Protocol, Sequence, Tuple
+
+import numpy as np
+
+from hil.core.metrics.coherence import _HIL_EPS
+from hil.core.structure.graph import CSRGraph
+
+
+# Dense similarity scratch per block, in weights (as build_structure_csr).
+_BLOCK_WEIGHTS = 1 << 22
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _shard_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.core.sharded invariant] {message}")
+
+
+# ---------------------------------------------------------------------------
+# Transport
+# ---------------------------------------------------------------------------
+
+class Communicator(Protocol):
+    """The collective subset sharded_structure needs (mpi4py-compatible)."""
+
+    rank: int
+    size: int
+
+    def bcast(self, obj: Any, root: int = 0) -> Any: ...
+
+    def allgather(self, obj: Any) -> List[Any]: ...
+
+
+class SerialComm:
+    """A single-shard communicator for runs without a cluster."""
+
+    rank = 0
+    size = 1
+
+    def bcast(self, obj: Any, root: int = 0) -> Any:
+        return obj
+
+    def allgather(self, obj: Any) -> List[Any]:
+        return [obj]
+
+
+def shard_ranges(num_rows: int, shards: int) -> List[Tuple[int, int]]:
+    """
+    Contiguous, near-equal row ranges [start, stop) for each shard.
+
+    The first num_rows % shards shards take one extra row; shards beyond
+    num_rows own empty ranges.
+    """
+    _shard_invariant(num_rows >= 0, "num_rows must be >= 0")
+    _shard_invariant(shards >= 1, "shards must be >= 1")
+    base, extra = divmod(int(num_rows), int(shards))
+    out: List[Tuple[int, int]] = []
+    start = 0
+    for s in range(int(shards)):
+        stop = start + base + (1 if s < extra else 0)
+        out.append((start, stop))
+        start = stop
+    return out
+
+
+# ---------------------------------------------------------------------------
+# Mergeable partials
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class FieldPartial:
+    count: int
+    sum: np.ndarray
+    unit_sum: np.ndarray
+
+    @staticmethod
+    def from_rows(X: np.ndarray) -> "FieldPartial":
+        norms = np.maximum(np.linalg.norm(X, axis=1), _HIL_EPS)
+        return FieldPartial(
+            count=int(X.shape[0]),
+            sum=X.sum(axis=0),
+            unit_sum=(X / norms[:, None]).sum(axis=0),
+        )
+
+    def merge(self, other: "FieldPartial") -> "FieldPartial":
+        return FieldPartial(
+            count=self.count + other.count,
+            sum=self.sum + other.sum,
+            unit_sum=self.unit_sum + other.unit_sum,
+        )
+
+    def coherence(self) -> float:
+        """Mean cosine to centroid, norms clamped as in C."""
+        _shard_invariant(self.count >= 1, "coherence needs at least one row")
+        c = self.sum / float(self.count)
+        c_norm = max(float(np.linalg.norm(c)), _HIL_EPS)
+        return float(np.dot(self.unit_sum, c) / c_norm / float(self.count))
+
+
+def _min_roots(num_nodes: int, src: np.ndarray, dst: np.ndarray) -> np.ndarray:
+    """
+    root[x] = smallest node of x's weakly connected component over src/dst.
+    """
+    if src.size == 0:
+        return np.arange(num_nodes, dtype=np.int64)
+
+    # --- Stage C: optional native backend -----------------------------------
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import graph_components as _native_components  # noqa: WPS433
+    except ImportError:
+        _native_components = None
+
+    if _native_components is not None:
+        try:
+            _, labels, _ = _native_components(
+                src.astype(np.uint32),
+                dst.astype(np.uint32),
+                np.ones(src.size, dtype=np.float64),
+                num_nodes,
+            )
+            # Labels are numbered in order of each component's smallest node.
+            _, first = np.unique(labels, return_index=True)
+            return first.astype(np.int64)[labels.astype(np.int64)]
+        except NativeError:
+            pass
+
+    # --- Stage A/B: NumPy min-label propagation with pointer jumping --------
+    root = np.arange(num_nodes, dtype=np.int64)
+    src = src.astype(np.int64, copy=False)
+    dst = dst.astype(np.int64, copy=False)
+    while True:
+        nxt = root.copy()
+        np.minimum.at(nxt, src, root[dst])
+        np.minimum.at(nxt, dst, root[src])
+        np.minimum.at(nxt, root, nxt)
+        nxt = nxt[nxt]
+        if np.array_equal(nxt, root):
+            return root
+        root = nxt
+
+
+@dataclass(frozen=True)
+class ForestPartial:
+    root: np.ndarray      # smallest node of each node's known component
+
+    @staticmethod
+    def from_edges(num_nodes: int, src: np.ndarray, dst: np.ndarray) -> "ForestPartial":
+        return ForestPartial(root=_min_roots(num_nodes, src, dst))
+
+    def merge(self, other: "ForestPartial") -> "ForestPartial":
+        _shard_invariant(self.root.shape == other.root.shape, "forest size mismatch")
+        # Each forest contributes at most one edge per node: x -- root(x).
+        nodes = np.arange(self.root.size, dtype=np.int64)
+        a = self.root != nodes
+        b = other.root != nodes
+        src = np.concatenate([nodes[a], nodes[b]])
+        dst = np.concatenate([self.root[a], other.root[b]])
+        return ForestPartial.from_edges(self.root.size, src, dst)
+
+    def components(self) -> int:
+        return int(np.count_nonzero(self.root == np.arange(self.root.size)))
+
+
+@dataclass(frozen=True)
+class ShardPartials:
+    field: FieldPartial
+    forest: ForestPartial
+    strength_total: float
+
+    def merge(self, other: "ShardPartials") -> "ShardPartials":
+        return ShardPartials(
+            field=self.field.merge(other.field),
+            forest=self.forest.merge(other.forest),
+            strength_total=self.strength_total + other.strength_total,
+        )
+
+
+def _fold(parts: Sequence[Any]) -> Any:
+    """Merge in rank order, so every shard reduces to the same value."""
+    out = parts[0]
+    for p in parts[1:]:
+        out = out.merge(p)
+    return out
+
+
+def _entropy_term(strength: np.ndarray, total: float) -> float:
+    """This shard's share of -sum p log p (terms with p <= eps dropped, as in C)."""
+    if total <= _HIL_EPS or strength.size == 0:
+        return 0.0
+    p = strength / total
+    p = p[p > _HIL_EPS]
+    return float(-(p * np.log(p)).sum())
+
+
+# ---------------------------------------------------------------------------
+# Shard builder
+# ---------------------------------------------------------------------------
+
+def normalize_rows(X: np.ndarray) -> np.ndarray:
+    """build_structure normalization: zero rows stay zero (cos = 0)."""
+    X = np.asarray(X, dtype=np.float64)
+    norms = np.linalg.norm(X, axis=1, keepdims=True)
+    norms[norms == 0.0] = 1.0
+    return X / norms
+
+
+class ShardBuilder:
+    """
+    CSR rows [row_start, row_start + len(rows)) of the global cosine graph.
+
+    consume() takes each shard's normalized rows as one column block, in any
+    order; finish() emits the rows once every block has been seen. kNN rows
+    keep a running top-k per row across blocks (ties prefer the smaller
+    global index), so the result does not depend on the block order.
+    """
+
+    def __init__(
+        self,
+        rows: np.ndarray,
+        row_start: int,
+        num_nodes: int,
+        *,
+        k: Optional[int] = None,
+        min_weight: Optional[float] = None,
+    ) -> None:
+        rows = np.asarray(rows)
+        _shard_invariant(rows.ndim == 2, "shard rows must be 2D")
+        _shard_invariant(k is None or k >= 1, "k must be >= 1")
+        _shard_invariant(
+            min_weight is None or 0.0 <= min_weight <= 1.0,
+            "min_weight must lie in [0, 1]",
+        )
+        _shard_invariant(
+            0 <= row_start and row_start + rows.shape[0] <= num_nodes,
+            "shard rows out of range",
+        )
+
+        self.row_start = int(row_start)
+        self.num_nodes = int(num_nodes)
+        self._wtype = rows.dtype if np.issubdtype(rows.dtype, np.floating) else np.float64
+        self._X = rows.astype(np.float64, copy=False)
+        self._V = normalize_rows(self._X)
+        self._k = 0 if k is None else min(int(k), max(self.num_nodes - 1, 0))
+        self._mw = 0.0 if min_weight is None else float(min_weight)
+
+        m = self._V.shape[0]
+        if self._k > 0:
+            self._top_w = np.full((m, self._k), -np.inf)
+            self._top_j = np.full((m, self._k), self.num_nodes, dtype=np.int64)
+        else:
+            self._idx: List[List[np.ndarray]] = [[] for _ in range(m)]
+            self._w: List[List[np.ndarray]] = [[] for _ in range(m)]
+        self._seen = 0
+
+    @property
+    def normalized_rows(self) -> np.ndarray:
+        """The column block this shard contributes to every other shard."""
+        return self._V
+
+    def consume(self, col_start: int, block: np.ndarray) -> None:
+        block = np.asarray(block, dtype=np.float64)
+        b = int(block.shape[0])
+        m = int(self._V.shape[0])
+        _shard_invariant(
+            0 <= col_start and col_start + b <= self.num_nodes,
+            "column block out of range",
+        )
+        self._seen += b
+        if b == 0 or m == 0:
+            return
+        _shard_invariant(block.shape[1] == self._V.shape[1], "column block dimension mismatch")
+
+        cols = col_start + np.arange(b, dtype=np.int64)
+        step = max(1, _BLOCK_WEIGHTS // b)
+
+        for r0 in range(0, m, step):
+            r1 = min(r0 + step, m)
+            Wb = ((self._V[r0:r1] @ block.T) + 1.0) * 0.5
+
+            # Drop self-pairs that fall inside this column block.
+            own = np.arange(self.row_start + r0, self.row_start + r1)
+            hit = (own >= col_start) & (own < col_start + b)
+            Wb[np.flatnonzero(hit), own[hit] - col_start] = -np.inf
+            Wb[Wb < self._mw] = -np.inf
+
+            if self._k > 0:
+                W = np.hstack([self._top_w[r0:r1], Wb])
+                J = np.hstack([self._top_j[r0:r1], np.broadcast_to(cols, Wb.shape)])
+                order = np.lexsort((J, -W), axis=1)[:, :self._k]
+                self._top_w[r0:r1] = np.take_along_axis(W, order, axis=1)
+                self._top_j[r0:r1] = np.take_along_axis(J, order, axis=1)
+            else:
+                for r, row in enumerate(Wb):
+                    sel = np.flatnonzero(np.isfinite(row))
+                    self._idx[r0 + r].append(cols[sel])
+                    self._w[r0 + r].append(row[sel])
+
+    def finish(self) -> Tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """Local CSR (offsets over owned rows, global column indices, weights)."""
+        _shard_invariant(self._seen == self.num_nodes, "not every column block was consumed")
+        m = int(self._V.shape[0])
+        counts = np.zeros(m, dtype=np.int64)
+        idx_parts: List[np.ndarray] = []
+        w_parts: List[np.ndarray] = []
+
+        for r in range(m):
+            if self._k > 0:
+                keep = np.isfinite(self._top_w[r])
+                sel, wsel = self._top_j[r][keep], self._top_w[r][keep]
+            else:
+                sel = np.concatenate(self._idx[r]) if self._idx[r] else np.empty(0, dtype=np.int64)
+                wsel = np.concatenate(self._w[r]) if self._w[r] else np.empty(0)
+            perm = np.argsort(sel, kind="stable")
+            idx_parts.append(sel[perm].astype(np.uint32))
+            w_parts.append(wsel[perm])
+            counts[r] = sel.size
+
+        offsets = np.zeros(m + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum(counts)
+        indices = np.concatenate(idx_parts) if idx_parts else np.empty(0, dtype=np.uint32)
+        weight = (
+            np.concatenate(w_parts).astype(self._wtype, copy=False)
+            if w_parts
+            else np.empty(0, dtype=self._wtype)
+        )
+        return offsets, indices, weight
+
+    def partials(
+        self,
+        offsets: np.ndarray,
+        indices: np.ndarray,
+        weight: np.ndarray,
+    ) -> Tuple[ShardPartials, np.ndarray]:
+        """This shard's mergeable partials and its owned out-strengths."""
+        m = int(self._V.shape[0])
+        counts = np.diff(offsets.astype(np.int64))
+        src = np.repeat(self.row_start + np.arange(m, dtype=np.int64), counts)
+        strength = np.bincount(
+            src - self.row_start, weights=weight.astype(np.float64), minlength=m
+        ).astype(np.float64)
+
+        parts = ShardPartials(
+            field=FieldPartial.from_rows(self._X),
+            forest=ForestPartial.from_edges(self.num_nodes, src, indices.astype(np.int64)),
+            strength_total=float(strength.sum()),
+        )
+        return parts, strength
+
+
+# ---------------------------------------------------------------------------
+# Results
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class ShardedStructure:
+    """One shard's CSR rows plus the cluster-wide diagnostics."""
+
+    row_start: int
+    row_stop: int
+    offsets: np.ndarray       # length (row_stop - row_start) + 1
+    indices: np.ndarray       # global node indices
+    weight: np.ndarray
+    num_nodes: int
+    entropy: float
+    coherence: float
+    components: int
+
+
+def assemble_csr(parts: Sequence[ShardedStructure]) -> CSRGraph:
+    """Concatenate every shard's rows (in rank order) into one CSRGraph."""
+    _shard_invariant(len(parts) >= 1, "no shards to assemble")
+    n = parts[0].num_nodes
+    _shard_invariant(
+        parts[0].row_start == 0 and parts[-1].row_stop == n
+        and all(a.row_stop == b.row_start for a, b in zip(parts, parts[1:])),
+        "shards must cover [0, num_nodes) contiguously, in order",
+    )
+    counts = np.concatenate([np.diff(p.offsets.astype(np.int64)) for p in parts])
+    offsets = np.zeros(n + 1, dtype=np.uint64)
+    offsets[1:] = np.cumsum(counts)
+    return CSRGraph(
+        offsets=offsets,
+        indices=np.concatenate([p.indices for p in parts]),
+        weight=np.concatenate([p.weight for p in parts]),
+        num_nodes=n,
+    )
+
+
+def _result(
+    builder: ShardBuilder,
+    csr: Tuple[np.ndarray, np.ndarray, np.ndarray],
+    merged: ShardPartials,
+    entropy: float,
+) -> ShardedStructure:
+    offsets, indices, weight = csr
+    return ShardedStructure(
+        row_start=builder.row_start,
+        row_stop=builder.row_start + int(offsets.size) - 1,
+        offsets=offsets,
+        indices=indices,
+        weight=weight,
+        num_nodes=builder.num_nodes,
+        entropy=max(entropy, 0.0),
+        coherence=merged.field.coherence(),
+        components=merged.forest.components(),
+    )
+
+
+# ---------------------------------------------------------------------------
+# Drivers
+# ---------------------------------------------------------------------------
+
+def sharded_structure(
+    comm: Communicator,
+    rows: Any,
+    *,
+    k: Optional[int] = None,
+    min_weight: Optional[float] = None,
+) -> ShardedStructure:
+    """
+    Collective: build this rank's CSR rows and the cluster-wide diagnostics.
+
+    rows are this rank's contiguous slice of the field; ranks hold the
+    slices in rank order. Communication is one broadcast of each rank's
+    normalized rows plus two small allgathers; memory per rank is its own
+    rows, one peer block and O(num_nodes) for the forest.
+    """
+    X = np.asarray(rows)
+    _shard_invariant(X.ndim == 2, "rows must be 2D")
+
+    counts = comm.allgather((int(X.shape[0]), int(X.shape[1])))
+    _shard_invariant(len({d for c, d in counts if c > 0}) <= 1, "shards disagree on dimension")
+    starts = np.concatenate([[0], np.cumsum([c for c, _ in counts])]).astype(int)
+    n = int(starts[-1])
+    _shard_invariant(n >= 1, "field must have at least one vector")
+
+    builder = ShardBuilder(X, int(starts[comm.rank]), n, k=k, min_weight=min_weight)
+    for root in range(comm.size):
+        block = comm.bcast(builder.normalized_rows if comm.rank == root else None, root=root)
+        builder.consume(int(starts[root]), block)
+
+    csr = builder.finish()
+    parts, strength = builder.partials(*csr)
+    merged = _fold([p for p in comm.allgather(parts) if p.field.count > 0])
+    entropy = float(sum(comm.allgather(_entropy_term(strength, merged.strength_total))))
+    return _result(builder, csr, merged, entropy)
+
+
+def simulate_sharded_structure(
+    vectors: Any,
+    shards: int,
+    *,
+    k: Optional[int] = None,
+    min_weight: Optional[float] = None,
+) -> List[ShardedStructure]:
+    """
+    Run every shard of sharded_structure in this process, one after another.
+
+    Same builder, block exchange and rank-order merges as the collective
+    driver; useful for validating a shard count before deploying it.
+    """
+    X = np.asarray(vectors)
+    _shard_invariant(X.ndim == 2, "vectors must be 2D")
+    n = int(X.shape[0])
+    _shard_invariant(n >= 1, "field must have at least one vector")
+
+    ranges = shard_ranges(n, shards)
+    builders = [ShardBuilder(X[a:b], a, n, k=k, min_weight=min_weight) for a, b in ranges]
+    for src in builders:
+        for dst in builders:
+            dst.consume(src.row_start, src.normalized_rows)
+
+    csrs = [b.finish() for b in builders]
+    local = [b.partials(*c) for b, c in zip(builders, csrs)]
+    merged = _fold([p for p, _ in local if p.field.count > 0])
+    entropy = float(sum(_entropy_term(s, merged.strength_total) for _, s in local))
+    return [_result(b, c, merged, entropy) for b, c in zip(builders, csrs)]
+
+
+__all__ = [
+    "Communicator",
+    "SerialComm",
+    "shard_ranges",
+    "FieldPartial",
+    "ForestPartial",
+    "ShardPartials",
+    "ShardBuilder",
+    "ShardedStructure",
+    "normalize_rows",
+    "assemble_csr",
+    "sharded_structure",
+    "simulate_sharded_structure",
+]
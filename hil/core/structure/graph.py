@@ -127,7 +127,7 @@ class Graph:
 
         This is diagnostic only and intended for artifacts.
         """
-        total_weight = float(self.weight.sum()) if self.weight.size > 0 else 0.0
+        total_weight = float(self.weight.sum(dtype=np.float64)) if self.weight.size > 0 else 0.0
 
         return {
             "num_nodes": int(self.num_nodes),
@@ -136,6 +136,476 @@ class Graph:
         }
 
 
+# ---------------------------------------------------------------------------
+# Compressed sparse row graph
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class CSRGraph:
+    """
+    Directed weighted graph in compressed sparse row (CSR) form.
+
+    Representation:
+    - row i holds neighbours indices[offsets[i]:offsets[i+1]]
+      with weights weight[offsets[i]:offsets[i+1]]
+    - nodes are indexed [0, num_nodes)
+
+    Mirrors hil_graph_csr_t in the native kernel. Memory is O(n + m),
+    so sparse (kNN / thresholded) structure scales with stored edges only.
+
+    symmetric is True for adjacency views built by from_graph, where each
+    undirected edge is stored in both endpoint rows.
+    """
+
+    offsets: np.ndarray
+    indices: np.ndarray
+    weight: np.ndarray
+    num_nodes: int
+    symmetric: bool = False
+
+    def __post_init__(self) -> None:
+        _graph_invariant(isinstance(self.offsets, np.ndarray), "offsets must be np.ndarray")
+        _graph_invariant(isinstance(self.indices, np.ndarray), "indices must be np.ndarray")
+        _graph_invariant(isinstance(self.weight, np.ndarray), "weight must be np.ndarray")
+
+        _graph_invariant(
+            self.offsets.ndim == 1 and self.indices.ndim == 1 and self.weight.ndim == 1,
+            "offsets, indices, and weight must be 1D",
+        )
+        _graph_invariant(
+            isinstance(self.num_nodes, int) and self.num_nodes >= 0,
+            "num_nodes must be a non-negative integer",
+        )
+        _graph_invariant(
+            self.offsets.shape == (self.num_nodes + 1,),
+            "offsets must have length num_nodes + 1",
+        )
+        _graph_invariant(
+            self.indices.shape == self.weight.shape,
+            "indices and weight must have the same shape",
+        )
+
+        _graph_invariant(
+            np.issubdtype(self.offsets.dtype, np.integer),
+            "offsets must be integer dtype",
+        )
+        _graph_invariant(
+            np.issubdtype(self.indices.dtype, np.integer),
+            "indices must be integer dtype",
+        )
+        _graph_invariant(
+            np.issubdtype(self.weight.dtype, np.floating),
+            "weight must be floating dtype",
+        )
+
+        _graph_invariant(
+            int(self.offsets[0]) == 0 and int(self.offsets[-1]) == self.indices.size,
+            "offsets must start at 0 and end at the number of stored edges",
+        )
+        _graph_invariant(
+            bool(np.all(np.diff(self.offsets.astype(np.int64, copy=False)) >= 0)),
+            "offsets must be non-decreasing",
+        )
+
+        if self.indices.size > 0:
+            _graph_invariant(
+                self.indices.min() >= 0 and self.indices.max() < self.num_nodes,
+                "indices out of range",
+            )
+            _graph_invariant(
+                np.all(np.isfinite(self.weight)),
+                "weights must be finite",
+            )
+
+    @classmethod
+    def from_graph(cls, graph: Graph) -> "CSRGraph":
+        """
+        Build the symmetric adjacency view of an edge-list graph.
+
+        Each edge (s, d, w) is stored as s -> d and d -> s; rows preserve
+        edge-list order. Build once, then pass the view to every structural
+        diagnostic instead of re-walking the edge list per metric.
+        """
+        _graph_invariant(isinstance(graph, Graph), "graph must be a Graph")
+
+        try:
+            from hil.core.native._shim import NativeError  # noqa: WPS433
+            from hil.core.native._shim import graph_build_csr as _native_csr  # noqa: WPS433
+        except ImportError:
+            _native_csr = None
+
+        if _native_csr is not None:
+            try:
+                offsets, indices, weight = _native_csr(
+                    graph.src, graph.dst, graph.weight, graph.num_nodes
+                )
+                return cls(
+                    offsets=offsets,
+                    indices=indices,
+                    weight=weight,
+                    num_nodes=graph.num_nodes,
+                    symmetric=True,
+                )
+            except NativeError:
+                pass
+
+        m = graph.num_edges
+        rows = np.empty(2 * m, dtype=np.int64)
+        cols = np.empty(2 * m, dtype=np.uint32)
+        # float32 storage is kept as is; other dtypes widen to float64.
+        wtype = np.float32 if graph.weight.dtype == np.float32 else np.float64
+        w = np.empty(2 * m, dtype=wtype)
+
+        # Interleave (s -> d, d -> s) per edge so a stable sort by row keeps
+        # the native edge-list order within each row.
+        rows[0::2] = graph.src
+        rows[1::2] = graph.dst
+        cols[0::2] = graph.dst
+        cols[1::2] = graph.src
+        w[0::2] = graph.weight
+        w[1::2] = graph.weight
+
+        order = np.argsort(rows, kind="stable")
+        counts = np.bincount(rows, minlength=graph.num_nodes)
+
+        offsets = np.zeros(graph.num_nodes + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum(counts)
+
+        return cls(
+            offsets=offsets,
+            indices=cols[order],
+            weight=w[order],
+            num_nodes=graph.num_nodes,
+            symmetric=True,
+        )
+
+    @property
+    def num_edges(self) -> int:
+        """Return the number of stored edges."""
+        return int(self.indices.size)
+
+    def out_strength(self) -> np.ndarray:
+        """
+        Row weight sums (weighted degree of a symmetric view, out-strength
+        of a directed graph).
+        """
+        counts = np.diff(self.offsets.astype(np.int64, copy=False))
+        rows = np.repeat(np.arange(self.num_nodes, dtype=np.int64), counts)
+        return np.bincount(
+            rows,
+            weights=self.weight.astype(np.float64, copy=False),
+            minlength=self.num_nodes,
+        ).astype(np.float64, copy=False)
+
+    def to_graph(self) -> Graph:
+        """
+        Expand to the edge-list Graph (src[i] -> dst[i]) in row order.
+
+        Every stored entry becomes one directed edge, so a symmetric view
+        expands to both orientations of each undirected edge.
+
+        Arrays are shared where possible; only src is materialized.
+        """
+        counts = np.diff(self.offsets.astype(np.int64, copy=False))
+        src = np.repeat(np.arange(self.num_nodes, dtype=np.uint32), counts)
+        return Graph(
+            src=src,
+            dst=self.indices,
+            weight=self.weight,
+            num_nodes=self.num_nodes,
+        )
+
+    def summary(self) -> dict[str, Any]:
+        """
+        Return a minimal, JSON-safe summary of the graph.
+        """
+        total_weight = float(self.weight.sum(dtype=np.float64)) if self.weight.size > 0 else 0.0
+
+        return {
+            "num_nodes": int(self.num_nodes),
+            "num_edges": int(self.num_edges),
+            "total_weight": total_weight,
+            "symmetric": bool(self.symmetric),
+        }
+
+
+# ---------------------------------------------------------------------------
+# Packed graph (compressed CSR)
+# ---------------------------------------------------------------------------
+
+# Mirrors HIL_PACKED_WEIGHT_SCALE in hilbert_native.h.
+PACKED_WEIGHT_SCALE = 65535
+
+
+def _varint_lengths(gaps: np.ndarray) -> np.ndarray:
+    """LEB128 byte count of each (non-negative, < 2**32) gap."""
+    lengths = np.ones(gaps.shape, dtype=np.int64)
+    for shift in (7, 14, 21, 28):
+        lengths += gaps >= (1 << shift)
+    return lengths
+
+
+@dataclass(frozen=True)
+class PackedCSRGraph:
+    """
+    CSR graph with 16-bit fixed-point weights and delta-varint neighbours.
+
+    Representation (hil_graph_packed_t in the native kernel):
+    - rows are sorted by neighbour index; row i occupies
+      stream[offsets[i]:offsets[i+1]]
+    - each entry is the LEB128 varint gap from the previous index (the
+      first from 0), then the weight as round(w * 65535), 2 bytes
+      little-endian
+
+    An entry takes 3-4 bytes where a CSRGraph takes 12 (uint32 index and
+    float64 weight), whenever neighbour gaps stay below 16384. Weights must
+    lie in [0, 1], and come back within 1 / (2 * 65535) of the original.
+    Since rows are sorted, only order-free diagnostics (degree, entropy,
+    components) are preserved exactly, up to that rounding.
+    """
+
+    offsets: np.ndarray
+    stream: np.ndarray
+    num_nodes: int
+    num_edges: int
+    symmetric: bool = False
+
+    def __post_init__(self) -> None:
+        _graph_invariant(isinstance(self.offsets, np.ndarray), "offsets must be np.ndarray")
+        _graph_invariant(isinstance(self.stream, np.ndarray), "stream must be np.ndarray")
+        _graph_invariant(
+            self.offsets.ndim == 1 and self.stream.ndim == 1,
+            "offsets and stream must be 1D",
+        )
+        _graph_invariant(
+            isinstance(self.num_nodes, int) and self.num_nodes >= 0,
+            "num_nodes must be a non-negative integer",
+        )
+        _graph_invariant(
+            isinstance(self.num_edges, int) and self.num_edges >= 0,
+            "num_edges must be a non-negative integer",
+        )
+        _graph_invariant(
+            self.offsets.shape == (self.num_nodes + 1,),
+            "offsets must have length num_nodes + 1",
+        )
+        _graph_invariant(self.stream.dtype == np.uint8, "stream must be uint8")
+        _graph_invariant(
+            int(self.offsets[0]) == 0 and int(self.offsets[-1]) == self.stream.size,
+            "offsets must start at 0 and end at the stream length",
+        )
+        _graph_invariant(
+            bool(np.all(np.diff(self.offsets.astype(np.int64, copy=False)) >= 0)),
+            "offsets must be non-decreasing",
+        )
+
+    @classmethod
+    def from_csr(cls, graph: CSRGraph) -> "PackedCSRGraph":
+        """
+        Pack a CSR graph. Weights must lie in [0, 1].
+        """
+        _graph_invariant(isinstance(graph, CSRGraph), "graph must be a CSRGraph")
+        weight = graph.weight.astype(np.float64, copy=False)
+        _graph_invariant(
+            bool(np.all((weight >= 0.0) & (weight <= 1.0))),
+            "packed weights must lie in [0, 1]",
+        )
+
+        try:
+            from hil.core.native._shim import NativeError  # noqa: WPS433
+            from hil.core.native._shim import graph_pack_csr as _native_pack  # noqa: WPS433
+        except ImportError:
+            _native_pack = None
+
+        if _native_pack is not None:
+            try:
+                offsets, stream = _native_pack(
+                    graph.offsets, graph.indices, weight, graph.num_nodes
+                )
+                return cls(
+                    offsets=offsets,
+                    stream=stream,
+                    num_nodes=graph.num_nodes,
+                    num_edges=graph.num_edges,
+                    symmetric=graph.symmetric,
+                )
+            except NativeError:
+                pass
+
+        n = graph.num_nodes
+        counts = np.diff(graph.offsets.astype(np.int64, copy=False))
+        rows = np.repeat(np.arange(n, dtype=np.int64), counts)
+        q = np.floor(weight * PACKED_WEIGHT_SCALE + 0.5).astype(np.int64)
+        idx = graph.indices.astype(np.int64, copy=False)
+
+        # Same entry order as the native (index << 16 | q) row sort.
+        order = np.lexsort((q, idx, rows))
+        idx, q = idx[order], q[order]
+
+        gaps = idx.copy()
+        gaps[1:] -= idx[:-1]
+        starts = graph.offsets[:-1].astype(np.int64, copy=False)[counts > 0]
+        gaps[starts] = idx[starts]
+
+        lengths = _varint_lengths(gaps)
+        entry = lengths + 2
+        pos = np.cumsum(entry) - entry
+
+        offsets = np.zeros(n + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum(np.bincount(rows, weights=entry, minlength=n).astype(np.int64))
+
+        stream = np.empty(int(entry.sum()), dtype=np.uint8)
+        for b in range(5):
+            live = lengths > b
+            byte = (gaps[live] >> (7 * b)) & 0x7F
+            byte |= np.where(lengths[live] > b + 1, 0x80, 0)
+            stream[pos[live] + b] = byte
+        stream[pos + lengths] = q & 0xFF
+        stream[pos + lengths + 1] = q >> 8
+
+        return cls(
+            offsets=offsets,
+            stream=stream,
+            num_nodes=n,
+            num_edges=graph.num_edges,
+            symmetric=graph.symmetric,
+        )
+
+    @property
+    def nbytes(self) -> int:
+        """Bytes held by the offsets and stream."""
+        return int(self.offsets.nbytes + self.stream.nbytes)
+
+    def _decode(self) -> tuple[np.ndarray, np.ndarray, np.ndarray]:
+        """
+        (rows, indices, q) of every entry in stream order.
+
+        Advances one cursor per row, so the loop runs once per entry of the
+        longest row rather than once per entry.
+        """
+        stream = self.stream.astype(np.int64)
+        cursor = self.offsets[:-1].astype(np.int64)
+        end = self.offsets[1:].astype(np.int64)
+        index = np.zeros(self.num_nodes, dtype=np.int64)
+        rows, cols, qs, order = [], [], [], []
+
+        live = np.flatnonzero(cursor < end)
+        step = 0
+        while live.size:
+            c = cursor[live]
+            gap = np.zeros(live.size, dtype=np.int64)
+            more = np.ones(live.size, dtype=bool)
+            for b in range(5):
+                byte = stream[c]
+                gap |= np.where(more, (byte & 0x7F) << (7 * b), 0)
+                c = c + more
+                more &= (byte & 0x80) != 0
+            index[live] += gap
+            rows.append(live)
+            cols.append(index[live].copy())
+            qs.append(stream[c] | (stream[c + 1] << 8))
+            order.append(np.full(live.size, step, dtype=np.int64))
+            cursor[live] = c + 2
+            live = live[cursor[live] < end[live]]
+            step += 1
+
+        if not rows:
+            empty = np.empty(0, dtype=np.int64)
+            return empty, empty, empty
+
+        rows_a = np.concatenate(rows)
+        perm = np.lexsort((np.concatenate(order), rows_a))
+        return rows_a[perm], np.concatenate(cols)[perm], np.concatenate(qs)[perm]
+
+    def out_strength(self) -> np.ndarray:
+        """
+        Dequantized row weight sums, summed exactly in integers.
+        """
+        try:
+            from hil.core.native._shim import NativeError  # noqa: WPS433
+            from hil.core.native._shim import graph_degree_packed as _native_degree  # noqa: WPS433
+        except ImportError:
+            _native_degree = None
+
+        if _native_degree is not None:
+            try:
+                return _native_degree(self.offsets, self.stream, self.num_nodes, self.num_edges)
+            except NativeError:
+                pass
+
+        rows, _, q = self._decode()
+        sums = np.zeros(self.num_nodes, dtype=np.int64)
+        np.add.at(sums, rows, q)
+        return sums.astype(np.float64) / PACKED_WEIGHT_SCALE
+
+    def entropy_error_bound(self) -> float:
+        """
+        Bound on |structural_entropy(original) - structural_entropy(self)|.
+
+        The m stored weights are each rounded by at most d = 1 / (2 * 65535),
+        so the degree distributions differ by total variation at most
+        T = m d / (S - m d), S the packed weight total; by the
+        Fannes-Audenaert inequality |dH| <= T ln(n - 1) + h(T), with h the
+        binary entropy. Falls back to the trivial ln(n) when T >= 1 - 1/n.
+        """
+        if self.num_nodes < 2 or self.num_edges == 0:
+            return 0.0
+
+        try:
+            from hil.core.native._shim import NativeError  # noqa: WPS433
+            from hil.core.native._shim import graph_entropy_packed_bound as _native_bound  # noqa: WPS433
+        except ImportError:
+            _native_bound = None
+
+        if _native_bound is not None:
+            try:
+                return _native_bound(self.offsets, self.stream, self.num_nodes, self.num_edges)
+            except NativeError:
+                pass
+
+        n = self.num_nodes
+        S = float(self.out_strength().sum())
+        D = self.num_edges * 0.5 / PACKED_WEIGHT_SCALE
+        if S <= D:
+            return float(np.log(n))
+        T = D / (S - D)
+        if T >= 1.0 - 1.0 / n:
+            return float(np.log(n))
+        h = -T * np.log(T) - (1.0 - T) * np.log1p(-T)
+        return float(T * np.log(n - 1) + h)
+
+    def to_csr(self) -> CSRGraph:
+        """
+        Expand to a CSRGraph with rows sorted by index and dequantized weights.
+        """
+        rows, cols, q = self._decode()
+        counts = np.bincount(rows, minlength=self.num_nodes)
+        offsets = np.zeros(self.num_nodes + 1, dtype=np.uint64)
+        offsets[1:] = np.cumsum(counts)
+        return CSRGraph(
+            offsets=offsets,
+            indices=cols.astype(np.uint32),
+            weight=q.astype(np.float64) / PACKED_WEIGHT_SCALE,
+            num_nodes=self.num_nodes,
+            symmetric=self.symmetric,
+        )
+
+    def summary(self) -> dict[str, Any]:
+        """
+        Return a minimal, JSON-safe summary of the graph.
+        """
+        return {
+            "num_nodes": int(self.num_nodes),
+            "num_edges": int(self.num_edges),
+            "total_weight": float(self.out_strength().sum()) if self.num_edges else 0.0,
+            "symmetric": bool(self.symmetric),
+            "nbytes": self.nbytes,
+        }
+
+
 __all__ = [
     "Graph",
+    "CSRGraph",
+    "PackedCSRGraph",
+    "PACKED_WEIGHT_SCALE",
 ]
@@ -7,6 +7,8 @@ from typing import Callable, Iterable, Any
 
 import numpy as np
 
+from hil.core.metrics.coherence import field_coherence
+
 
 # ---------------------------------------------------------------------
 # Type aliases (keep symbolic, do not over-constrain)
@@ -43,6 +45,159 @@ def macrostate_dispersion(
         raise ValueError(f"Unknown norm: {norm}")
 
 
+def macrostate_dispersion_batch(
+    stack: np.ndarray,
+    norm: str = "l2",
+) -> np.ndarray:
+    """
+    macrostate_dispersion for T snapshots in one call.
+
+    stack has shape (T, G, k): snapshot t built under G moduli settings.
+    Returns shape (T,). Native (hil_macrostate_dispersion_batch, parallel
+    across snapshots) when available; agrees with the per-snapshot form to
+    rounding of the group mean.
+    """
+    S = np.asarray(stack, dtype=np.float64)
+    if S.ndim != 3:
+        raise ValueError("stack must have shape (T, G, k)")
+    if norm not in ("l2", "linf"):
+        raise ValueError(f"Unknown norm: {norm}")
+    if S.shape[1] <= 1 or S.shape[2] == 0:
+        return np.zeros(S.shape[0], dtype=np.float64)
+
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import macrostate_dispersion_batch as _native_batch  # noqa: WPS433
+    except ImportError:
+        _native_batch = None
+
+    if _native_batch is not None:
+        try:
+            return _native_batch(S, norm, copy=True)
+        except NativeError:
+            pass
+
+    diffs = S - S.mean(axis=1, keepdims=True)
+    if norm == "l2":
+        return np.sqrt((diffs ** 2).sum(axis=2)).max(axis=1)
+    return np.abs(diffs).max(axis=(1, 2))
+
+
+# ---------------------------------------------------------------------
+# Utility: batched snapshot macrostates
+# ---------------------------------------------------------------------
+#
+# A batch builder maps a list of slices to one (T, k) array in a single
+# call. The sweeps below accept one (build_macrostates) in place of the
+# per-slice build_macrostate, so a time series of T ticks costs one call
+# per moduli setting instead of T.
+
+
+def field_snapshot_summaries(
+    vectors: np.ndarray,
+    row_offsets: Any = None,
+) -> np.ndarray:
+    """
+    Field-summary macrostates [mean_norm, centroid_norm, coherence] of T
+    field snapshots, shape (T, 3).
+
+    vectors is either a stacked (T, n, d) tensor of snapshots or one (N, d)
+    field buffer with row_offsets (T + 1,) delimiting snapshot t as rows
+    [row_offsets[t], row_offsets[t + 1]). Snapshots are summarized in one
+    native call (hil_field_summary_batch) when available, matching
+    hil_field_summary per snapshot.
+    """
+    X = np.asarray(vectors)
+    if X.ndim == 3:
+        if row_offsets is not None:
+            raise ValueError("row_offsets applies to a 2D field buffer only")
+        T, n = int(X.shape[0]), int(X.shape[1])
+        X = X.reshape(T * n, X.shape[2])
+        off = np.arange(T + 1, dtype=np.uint64) * np.uint64(n)
+    elif X.ndim == 2:
+        if row_offsets is None:
+            raise ValueError("row_offsets is required for a 2D field buffer")
+        off = np.asarray(row_offsets, dtype=np.uint64).reshape(-1)
+    else:
+        raise ValueError("vectors must have shape (T, n, d) or (N, d)")
+
+    if off.size < 2 or X.shape[1] == 0:
+        raise ValueError("vectors must hold at least one non-empty snapshot")
+    if off[0] != 0 or off[-1] != X.shape[0] or np.any(off[1:] <= off[:-1]):
+        raise ValueError("row_offsets must increase strictly from 0 to the number of rows")
+
+    try:
+        from hil.core.native._shim import NativeError  # noqa: WPS433
+        from hil.core.native._shim import field_summary_batch  # noqa: WPS433
+    except ImportError:
+        field_summary_batch = None
+
+    if field_summary_batch is not None:
+        try:
+            summaries, _ = field_summary_batch(X, off, copy=True)
+            return summaries
+        except NativeError:
+            pass
+
+    out = np.empty((off.size - 1, 3), dtype=np.float64)
+    for t in range(off.size - 1):
+        rows = X[int(off[t]):int(off[t + 1])].astype(np.float64, copy=False)
+        centroid = rows.sum(axis=0) / float(rows.shape[0])
+        out[t] = (
+            float(np.linalg.norm(rows, axis=1).mean()),
+            float(np.linalg.norm(centroid)),
+            field_coherence(rows),
+        )
+    return out
+
+
+def field_summary_macrostates(slices: list[np.ndarray]) -> np.ndarray:
+    """
+    Batch builder over slices that are (n_t, d) field row blocks: stacks
+    them once and returns field_snapshot_summaries, shape (T, 3).
+    """
+    blocks = [np.asarray(b) for b in slices]
+    if not blocks:
+        return np.empty((0, 3), dtype=np.float64)
+    offsets = np.zeros(len(blocks) + 1, dtype=np.uint64)
+    offsets[1:] = np.cumsum([b.shape[0] for b in blocks], dtype=np.uint64)
+    return field_snapshot_summaries(np.vstack(blocks), offsets)
+
+
+def _one_builder(single: Any, batch: Any) -> None:
+    if (single is None) == (batch is None):
+        raise ValueError("Pass exactly one of build_macrostate, build_macrostates")
+
+
+def _batch_macrostates(
+    build_macrostates: Callable[..., np.ndarray],
+    slices: list[MicroSlice],
+    *params: Any,
+) -> np.ndarray:
+    """Call a batch builder once and check it returns (len(slices), k)."""
+    out = np.asarray(build_macrostates(slices, *params), dtype=np.float64)
+    if out.ndim != 2 or out.shape[0] != len(slices):
+        raise ValueError("build_macrostates must return shape (len(slices), k)")
+    return out
+
+
+def _moduli_dispersion(
+    slices: list[MicroSlice],
+    build_macrostates: Callable[[list[MicroSlice], dict[str, Any]], np.ndarray],
+    moduli_grid: ModuliGrid,
+    norm: str,
+) -> np.ndarray:
+    """Per-slice dispersion across the moduli grid, one batch call per setting."""
+    grid = list(moduli_grid)
+    if len(grid) <= 1 or not slices:
+        return np.zeros(len(slices), dtype=np.float64)
+    stack = np.stack(
+        [_batch_macrostates(build_macrostates, slices, params) for params in grid],
+        axis=1,
+    )
+    return macrostate_dispersion_batch(stack, norm)
+
+
 # ---------------------------------------------------------------------
 # 1. Data floor estimation
 # ---------------------------------------------------------------------
@@ -50,15 +205,36 @@ def macrostate_dispersion(
 def estimate_data_floor(
     *,
     slices: list[MicroSlice],
-    build_macrostate: Callable[[MicroSlice, dict[str, Any]], MacroState],
+    build_macrostate: Callable[[MicroSlice, dict[str, Any]], MacroState] | None = None,
     moduli_grid: ModuliGrid,
     tolerance: float,
     dispersion_norm: str = "l2",
+    build_macrostates: Callable[[list[MicroSlice], dict[str, Any]], np.ndarray] | None = None,
 ) -> dict:
     """
     Estimate the minimum slice size that yields stable macrostates
     under admissible moduli variation.
+
+    With build_macrostates (a batch builder) every slice is built in one
+    call per moduli setting and dispersions are computed in one batch; the
+    result is the same, though slices past the floor are also built.
     """
+    _one_builder(build_macrostate, build_macrostates)
+
+    if build_macrostates is not None:
+        curve = _moduli_dispersion(slices, build_macrostates, moduli_grid, dispersion_norm)
+        for idx, disp in enumerate(curve):
+            if disp <= tolerance:
+                return {
+                    "min_slice_index": idx,
+                    "min_slice_size": getattr(slices[idx], "size", idx),
+                    "dispersion_curve": [float(d) for d in curve[:idx + 1]],
+                }
+        return {
+            "min_slice_index": None,
+            "min_slice_size": None,
+            "dispersion_curve": [float(d) for d in curve],
+        }
 
     dispersion_curve: list[float] = []
 
@@ -179,14 +355,25 @@ def recommend_tick_band(
 def estimate_noise_floor(
     *,
     reference_slices: list[MicroSlice],
-    build_macrostate: Callable[[MicroSlice, dict[str, Any]], MacroState],
+    build_macrostate: Callable[[MicroSlice, dict[str, Any]], MacroState] | None = None,
     moduli_grid: ModuliGrid,
     dispersion_norm: str = "l2",
+    build_macrostates: Callable[[list[MicroSlice], dict[str, Any]], np.ndarray] | None = None,
 ) -> float:
     """
     Estimate instrument noise floor ε as the maximum macrostate
     dispersion induced by admissible moduli variation within a slice.
+
+    build_macrostates (a batch builder) replaces the per-slice calls with
+    one call per moduli setting.
     """
+    _one_builder(build_macrostate, build_macrostates)
+
+    if build_macrostates is not None:
+        eps = _moduli_dispersion(
+            list(reference_slices), build_macrostates, moduli_grid, dispersion_norm
+        )
+        return float(eps.max()) if eps.size else 0.0
 
     epsilons: list[float] = []
 
@@ -205,18 +392,47 @@ def compute_resolution_ratios(
     *,
     stream,
     candidate_ticks: list[float],
-    build_macrostate: Callable[[MicroSlice], MacroState],
+    build_macrostate: Callable[[MicroSlice], MacroState] | None = None,
     noise_floor: float,
+    build_macrostates: Callable[[list[MicroSlice]], np.ndarray] | None = None,
 ) -> dict:
     """
     Compute resolution ratios R(Δt) for candidate ticks.
+
+    With build_macrostates (a batch builder) the slices of every valid
+    (t, t + Δt) pair across all candidate ticks are built in one call.
     """
+    _one_builder(build_macrostate, build_macrostates)
 
     if noise_floor <= 0:
         raise ValueError("Noise floor must be positive")
 
     resolution: dict[float, float] = {}
 
+    if build_macrostates is not None:
+        pairs: list[tuple[float, MicroSlice, MicroSlice]] = []
+        for dt in candidate_ticks:
+            for t in stream.times(dt):
+                t0 = int(t)
+                t1 = int(t + dt)
+                if not stream.is_valid_index(t0) or not stream.is_valid_index(t1):
+                    continue
+                pairs.append((dt, stream.slice(t0, dt), stream.slice(t1, dt)))
+
+        P = len(pairs)
+        deltas = np.empty(0, dtype=np.float64)
+        if P:
+            states = _batch_macrostates(
+                build_macrostates, [p[1] for p in pairs] + [p[2] for p in pairs]
+            )
+            deltas = np.linalg.norm(states[P:] - states[:P], axis=1)
+
+        for dt in candidate_ticks:
+            mask = np.fromiter((p[0] == dt for p in pairs), dtype=bool, count=P)
+            mean_delta = float(deltas[mask].mean()) if mask.any() else 0.0
+            resolution[dt] = mean_delta / noise_floor
+        return resolution
+
     for dt in candidate_ticks:
         deltas: list[float] = []
 
@@ -2,9 +2,11 @@
 
 from __future__ import annotations
 
-from typing import Protocol, Any
+from dataclasses import dataclass
+from typing import Protocol, Any, Iterable
 import numpy as np
 
+from hil.core.metrics.coherence import _HIL_EPS
 from hil.core.path_invariant import CovariantPath
 
 
@@ -31,16 +33,80 @@ class FiberEntropyBackend(Protocol):
     - declare their reference measure externally,
     - be deterministic for fixed inputs,
     - not depend on time parameterization.
+
+    Implementations MAY also provide entropy_batch(sigmas) -> (m,) over an
+    (m, k) stack of macrostates; path_entropy and InfoMassAccumulator use
+    it in place of one entropy() call per anchor.
     """
 
     def entropy(self, sigma: np.ndarray) -> float:
         ...
 
 
+class ShannonFiberEntropy:
+    """
+    Shannon entropy (natural log) of the coordinate-magnitude distribution
+    p_j = |σ_j| / Σ_j |σ_j|; 0 for σ = 0.
+
+    Reference measure: counting measure on the k coordinates of σ.
+
+    entropy_batch runs natively (hil_fiber_entropy_batch) when the
+    extension is available, NumPy otherwise; both follow the
+    hil_graph_entropy conventions (terms with p_j <= 1e-12 dropped).
+    """
+
+    reference_measure = "counting"
+
+    def entropy(self, sigma: np.ndarray) -> float:
+        return float(self.entropy_batch(np.asarray(sigma, dtype=float).reshape(1, -1))[0])
+
+    def entropy_batch(self, sigmas: np.ndarray) -> np.ndarray:
+        X = np.asarray(sigmas, dtype=float)
+        if X.ndim != 2:
+            raise ValueError("sigmas must have shape (m, k)")
+        try:
+            from hil.core.native._shim import NativeError  # noqa: WPS433
+            from hil.core.native._shim import fiber_entropy_batch  # noqa: WPS433
+        except ImportError:
+            fiber_entropy_batch = None
+
+        if fiber_entropy_batch is not None:
+            try:
+                return fiber_entropy_batch(X, copy=True)
+            except NativeError:
+                pass
+
+        mag = np.abs(X)
+        total = mag.sum(axis=1)
+        safe = np.where(total > _HIL_EPS, total, 1.0)
+        p = mag / safe[:, None]
+        terms = np.where(p > _HIL_EPS, p * np.log(np.where(p > _HIL_EPS, p, 1.0)), 0.0)
+        return np.where(total > _HIL_EPS, -terms.sum(axis=1), 0.0)
+
+
 # ---------------------------------------------------------------------
 # Utilities
 # ---------------------------------------------------------------------
 
+def _anchor_entropies(
+    entropy_backend: FiberEntropyBackend,
+    sigmas: np.ndarray,
+) -> np.ndarray:
+    """
+    Per-anchor fiber entropies, batched when the backend supports it.
+    """
+    batch = getattr(entropy_backend, "entropy_batch", None)
+    if batch is not None:
+        H = np.asarray(batch(sigmas), dtype=float)
+        if H.shape != (sigmas.shape[0],):
+            raise ValueError("entropy_batch must return one entropy per anchor")
+        return H
+    return np.array(
+        [float(entropy_backend.entropy(s)) for s in sigmas],
+        dtype=float,
+    )
+
+
 def _broadcast_noise(
     noise: NoiseBand,
     length: int,
@@ -186,10 +252,7 @@ def path_entropy(
         return 0.0
 
     # Compute per-anchor entropies
-    H = np.array(
-        [float(entropy_backend.entropy(s)) for s in path.sigmas],
-        dtype=float,
-    )
+    H = _anchor_entropies(entropy_backend, path.sigmas)
 
     # Covariant weights via arc-length
     weights = np.zeros_like(H)
@@ -201,8 +264,7 @@ def path_entropy(
         # Interior points
         weights[0] = path.ds[0] / 2.0
         weights[-1] = path.ds[-1] / 2.0
-        for i in range(1, m - 1):
-            weights[i] = (path.ds[i - 1] + path.ds[i]) / 2.0
+        weights[1:m - 1] = (path.ds[:-1] + path.ds[1:]) / 2.0
 
     total_length = float(path.ds.sum())
     return float(np.dot(weights, H) / (total_length + delta))
@@ -280,11 +342,33 @@ def info_mass_report(
     """
     Deterministic, serializable diagnostic artifact.
     """
+    return _report(
+        arc_length=float(path.ds.sum()),
+        alpha=alpha,
+        mass=mass,
+        energy=energy,
+        entropy=entropy,
+        temperature=temperature,
+        free_energy=free_energy,
+        version=version,
+    )
+
 
+def _report(
+    *,
+    arc_length: float,
+    alpha: float,
+    mass: Mass,
+    energy: Energy | None,
+    entropy: Entropy | None,
+    temperature: float | None,
+    free_energy: float | None,
+    version: str,
+) -> dict[str, Any]:
     report: dict[str, Any] = {
         "version": version,
         "alpha": alpha,
-        "arc_length": float(path.ds.sum()),
+        "arc_length": float(arc_length),
         "informational_mass": float(mass),
     }
 
@@ -301,3 +385,223 @@ def info_mass_report(
         report["free_energy"] = float(free_energy)
 
     return report
+
+
+# ---------------------------------------------------------------------
+# 9. Streaming engine (chunked, single pass)
+# ---------------------------------------------------------------------
+#
+# For trajectories too long to hold as one CovariantPath. Macrostates
+# arrive in chunks; each chunk's increments (including the one across
+# the chunk boundary) are computed once and folded into running sums, so
+# memory is bounded by the chunk size. Results equal the whole-path
+# functions above up to floating-point summation order.
+
+@dataclass(frozen=True)
+class InfoMassSummary:
+    anchors: int
+    segments: int
+    arc_length: float                 # S = Σ ||Δσ||
+    thresholded_arc_length: float     # Σ thresholded_increments
+    informational_mass: Mass
+    mass_density: float
+    entropy: Entropy | None           # path_entropy (None without backend)
+    noise_mean: float
+    noise_max: float
+
+
+class InfoMassAccumulator:
+    """
+    Single-pass accumulator of the info_mass quantities.
+
+    noise: scalar ε (absolute threshold, as in informational_mass), or
+    None to pass per-segment ε_i with every update (one value per new
+    segment: len(chunk) for later chunks, len(chunk) - 1 for the first).
+
+    entropy_backend (optional) is evaluated once per anchor, batched per
+    chunk when it provides entropy_batch.
+    """
+
+    def __init__(
+        self,
+        *,
+        noise: float | None = None,
+        alpha: float = 1.0,
+        entropy_backend: FiberEntropyBackend | None = None,
+        delta: float = 1e-12,
+    ) -> None:
+        if noise is not None and not np.isscalar(noise):
+            raise ValueError("noise must be a scalar or None (per-segment noise via update)")
+        self.noise = None if noise is None else float(noise)
+        self.alpha = float(alpha)
+        self.entropy_backend = entropy_backend
+        self.delta = float(delta)
+
+        self._last: np.ndarray | None = None
+        self._last_H = 0.0
+        self._first_H = 0.0
+        self._anchors = 0
+        self._segments = 0
+        self._S = 0.0
+        self._thresholded = 0.0
+        self._weighted_H = 0.0
+        self._eps_sum = 0.0
+        self._eps_max = -np.inf
+
+    def update(
+        self,
+        sigmas: np.ndarray,
+        noise: NoiseBand | None = None,
+    ) -> "InfoMassAccumulator":
+        """
+        Fold the next chunk of anchors (shape (c, k)) into the sums.
+        """
+        X = np.asarray(sigmas, dtype=float)
+        if X.ndim != 2:
+            raise ValueError("sigmas chunk must have shape (c, k)")
+        if X.shape[0] == 0:
+            return self
+        if self._last is not None and X.shape[1] != self._last.shape[0]:
+            raise ValueError("sigmas chunks must share one dimensionality")
+
+        # Increments: boundary segment from the previous chunk, then interior.
+        ds = np.linalg.norm(np.diff(X, axis=0), axis=1)
+        if self._last is not None:
+            ds = np.concatenate(([float(np.linalg.norm(X[0] - self._last))], ds))
+
+        if self.noise is None:
+            if noise is None:
+                raise ValueError("per-segment noise is required when no scalar noise is set")
+            eps = _broadcast_noise(noise, len(ds))
+            if eps.size:
+                self._eps_sum += float(eps.sum())
+                self._eps_max = max(self._eps_max, float(eps.max()))
+        elif noise is not None:
+            raise ValueError("scalar noise was set at construction")
+        else:
+            eps = self.noise
+
+        self._S += float(ds.sum())
+        self._thresholded += float(np.maximum(0.0, ds - self.alpha * eps).sum())
+
+        if self.entropy_backend is not None:
+            H = _anchor_entropies(self.entropy_backend, X)
+            if self._last is None:
+                self._first_H = float(H[0])
+            else:
+                H = np.concatenate(([self._last_H], H))
+            # Each segment carries half its length to both endpoints.
+            self._weighted_H += float(np.dot(ds, H[:-1] + H[1:])) / 2.0
+            self._last_H = float(H[-1])
+
+        self._anchors += int(X.shape[0])
+        self._segments += int(ds.size)
+        self._last = X[-1].copy()
+        return self
+
+    def summary(self) -> InfoMassSummary:
+        S = self._S
+        if self.noise is None:
+            budget = self._eps_sum
+            noise_mean = self._eps_sum / self._segments if self._segments else 0.0
+            noise_max = self._eps_max if self._segments else 0.0
+        else:
+            budget = self.noise
+            noise_mean = noise_max = self.noise
+
+        mass = 0.0 if S == 0.0 else float(max(0.0, S - self.alpha * budget))
+
+        entropy: Entropy | None = None
+        if self.entropy_backend is not None:
+            if self._anchors == 0:
+                entropy = 0.0
+            elif self._segments == 0:
+                entropy = float(self._first_H / (S + self.delta))
+            else:
+                entropy = float(self._weighted_H / (S + self.delta))
+
+        return InfoMassSummary(
+            anchors=self._anchors,
+            segments=self._segments,
+            arc_length=S,
+            thresholded_arc_length=self._thresholded,
+            informational_mass=mass,
+            mass_density=float(mass / (S + self.delta)),
+            entropy=entropy,
+            noise_mean=float(noise_mean),
+            noise_max=float(noise_max),
+        )
+
+    def report(
+        self,
+        *,
+        energy_scale: float | None = None,
+        temperature_scale: float | None = None,
+        temperature_mode: str = "mean",
+        version: str = "v1",
+    ) -> dict[str, Any]:
+        """
+        info_mass_report from the accumulated sums: energy with
+        energy_scale, temperature with temperature_scale, and free energy
+        when energy, entropy and temperature are all available.
+        """
+        if temperature_mode not in ("mean", "max"):
+            raise ValueError(f"Unknown mode: {temperature_mode}")
+        summ = self.summary()
+
+        energy = None
+        if energy_scale is not None:
+            energy = informational_energy(mass=summ.informational_mass, scale=energy_scale)
+
+        temperature = None
+        if temperature_scale is not None:
+            eps = summ.noise_mean if temperature_mode == "mean" else summ.noise_max
+            temperature = informational_temperature(noise=eps, scale=temperature_scale)
+
+        free_energy = None
+        if energy is not None and summ.entropy is not None and temperature is not None:
+            free_energy = informational_free_energy(
+                mass=summ.informational_mass,
+                entropy=summ.entropy,
+                temperature=temperature,
+                energy_scale=energy_scale,
+            )
+
+        return _report(
+            arc_length=summ.arc_length,
+            alpha=self.alpha,
+            mass=summ.informational_mass,
+            energy=energy,
+            entropy=summ.entropy,
+            temperature=temperature,
+            free_energy=free_energy,
+            version=version,
+        )
+
+
+def stream_info_mass(
+    chunks: Iterable[np.ndarray],
+    *,
+    noise: float | None = None,
+    noise_chunks: Iterable[NoiseBand] | None = None,
+    alpha: float = 1.0,
+    entropy_backend: FiberEntropyBackend | None = None,
+    delta: float = 1e-12,
+) -> InfoMassAccumulator:
+    """
+    Run an InfoMassAccumulator over (c, k) macrostate chunks, with either a
+    scalar noise or one per-segment noise chunk per macrostate chunk.
+    """
+    acc = InfoMassAccumulator(
+        noise=noise,
+        alpha=alpha,
+        entropy_backend=entropy_backend,
+        delta=delta,
+    )
+    if noise_chunks is None:
+        for chunk in chunks:
+            acc.update(chunk)
+    else:
+        for chunk, eps in zip(chunks, noise_chunks):
+            acc.update(chunk, eps)
+    return acc
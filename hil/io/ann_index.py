@@ -0,0 +1,221 @@
+# hil/io/ann_index.py
+"""
+hil.io.ann_index
+
+Versioned binary format for approximate nearest-neighbour indexes.
+
+This module defines:
+- how an ANNIndex (hil.core.ann) is written next to a run's artifacts
+- how it is mapped back and handed to the native layer, which copies and
+  validates the arrays before answering queries
+
+This module does NOT:
+- build or query indexes
+- interpret contents
+
+Layout (little-endian, version 1), following hil.io.artifact:
+
+    [0, HEADER_SIZE)   header: fixed fields, block table, header checksum
+    block "vectors"     float64, num_nodes * dim, normalized rows
+    block "levels"      uint32,  num_nodes
+    block "offsets"     uint64,  num_nodes + 1
+    block "links"       uint32,  num_links
+
+Blocks are BLOCK_ALIGN-aligned and carry their own sha256. Node i's links
+are links[offsets[i]:offsets[i+1]]: per layer 0..levels[i], a count and
+that many neighbour ids (hil_ann_graph_t in hilbert_ann.h).
+"""
+
+from __future__ import annotations
+
+import hashlib
+import struct
+from pathlib import Path
+from typing import Any, Dict, Tuple, Union
+
+import numpy as np
+
+from hil.core.ann import ANNIndex
+from hil.io.artifact import BLOCK_ALIGN, HEADER_SIZE, _align, _block_digest, _chunks
+
+
+# ---------------------------------------------------------------------------
+# Format constants
+# ---------------------------------------------------------------------------
+
+MAGIC = b"HILANN\x00\x00"
+VERSION = 1
+
+# Conventional file name inside a run directory.
+ANN_INDEX_NAME = "FIELD_ANN.hilx"
+
+# magic, version, header_size, dim, num_nodes, num_links, m, ef_construction,
+# seed, entry (-1 when empty), max_level, block_count
+_FIXED = struct.Struct("<8sIIQQQQQQqII")
+# name, offset, nbytes, sha256
+_BLOCK = struct.Struct("<16sQQ32s")
+
+_BLOCK_DTYPES: Dict[str, np.dtype] = {
+    "vectors": np.dtype("<f8"),
+    "levels": np.dtype("<u4"),
+    "offsets": np.dtype("<u8"),
+    "links": np.dtype("<u4"),
+}
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _ann_index_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.io.ann_index invariant] {message}")
+
+
+# ---------------------------------------------------------------------------
+# Writer
+# ---------------------------------------------------------------------------
+
+def write_ann_index(path: Union[str, Path], index: ANNIndex) -> Path:
+    """Write an index (parameters, normalized rows and links)."""
+    _ann_index_invariant(isinstance(index, ANNIndex), "index must be an ANNIndex")
+    path = Path(path)
+    state = index.to_state()
+
+    blocks = {
+        name: np.ascontiguousarray(state[name], dtype=dtype)
+        for name, dtype in _BLOCK_DTYPES.items()
+    }
+
+    entries = []
+    with path.open("wb") as f:
+        f.write(b"\x00" * HEADER_SIZE)
+        position = HEADER_SIZE
+        for name, arr in blocks.items():
+            h = hashlib.sha256()
+            for chunk in _chunks(arr):
+                f.write(chunk)
+                h.update(chunk)
+            nbytes = arr.nbytes
+            end = _align(position + nbytes)
+            f.write(b"\x00" * (end - position - nbytes))
+            entries.append((name, position, nbytes, h.digest()))
+            position = end
+
+        header = bytearray(HEADER_SIZE)
+        _FIXED.pack_into(
+            header, 0, MAGIC, VERSION, HEADER_SIZE,
+            state["dim"], state["size"], blocks["links"].size,
+            state["m"], state["ef_construction"], state["seed"],
+            state["entry"], state["max_level"], len(entries),
+        )
+        for i, (name, offset, nbytes, digest) in enumerate(entries):
+            _BLOCK.pack_into(
+                header, _FIXED.size + i * _BLOCK.size,
+                name.encode("ascii"), offset, nbytes, digest,
+            )
+        header[HEADER_SIZE - 32:] = hashlib.sha256(header[:HEADER_SIZE - 32]).digest()
+
+        f.seek(0)
+        f.write(header)
+
+    return path
+
+
+# ---------------------------------------------------------------------------
+# Reader
+# ---------------------------------------------------------------------------
+
+def read_ann_header(path: Union[str, Path]) -> Dict[str, Any]:
+    """Parse and check the index header only (one HEADER_SIZE read)."""
+    path = Path(path)
+    _ann_index_invariant(path.exists(), f"index not found: {path}")
+
+    with path.open("rb") as f:
+        header = f.read(HEADER_SIZE)
+    _ann_index_invariant(len(header) == HEADER_SIZE, f"truncated index header: {path}")
+
+    (magic, version, header_size, dim, num_nodes, num_links, m, ef_construction,
+     seed, entry, max_level, count) = _FIXED.unpack_from(header, 0)
+    _ann_index_invariant(magic == MAGIC, f"not a HIL ANN index: {path}")
+    _ann_index_invariant(version == VERSION, f"unsupported index version {version}: {path}")
+    _ann_index_invariant(header_size == HEADER_SIZE, f"unexpected header size: {path}")
+    _ann_index_invariant(
+        hashlib.sha256(header[:HEADER_SIZE - 32]).digest() == header[HEADER_SIZE - 32:],
+        f"header checksum mismatch: {path}",
+    )
+
+    blocks: Dict[str, Tuple[int, int, str]] = {}
+    for i in range(count):
+        raw_name, offset, nbytes, digest = _BLOCK.unpack_from(header, _FIXED.size + i * _BLOCK.size)
+        name = raw_name.rstrip(b"\x00").decode("ascii")
+        _ann_index_invariant(name in _BLOCK_DTYPES, f"unknown block {name!r}: {path}")
+        _ann_index_invariant(offset % BLOCK_ALIGN == 0, f"misaligned block {name!r}: {path}")
+        blocks[name] = (int(offset), int(nbytes), digest.hex())
+    _ann_index_invariant(set(blocks) == set(_BLOCK_DTYPES), f"missing index blocks: {path}")
+
+    return {
+        "version": int(version),
+        "dim": int(dim),
+        "size": int(num_nodes),
+        "num_links": int(num_links),
+        "m": int(m),
+        "ef_construction": int(ef_construction),
+        "seed": int(seed),
+        "entry": int(entry),
+        "max_level": int(max_level),
+        "blocks": blocks,
+    }
+
+
+def open_ann_index(path: Union[str, Path], *, verify: bool = False) -> ANNIndex:
+    """
+    Load an index written by write_ann_index.
+
+    Blocks are mapped read-only and copied once into the native index,
+    which checks every count, level and link. Pass verify=True to also
+    recompute block checksums (reads every block twice).
+    """
+    path = Path(path)
+    meta = read_ann_header(path)
+    size = path.stat().st_size
+
+    expected = {
+        "vectors": meta["size"] * meta["dim"],
+        "levels": meta["size"],
+        "offsets": meta["size"] + 1,
+        "links": meta["num_links"],
+    }
+
+    state: Dict[str, Any] = {k: meta[k] for k in
+                             ("dim", "size", "m", "ef_construction", "seed", "entry", "max_level")}
+    for name, (offset, nbytes, digest) in meta["blocks"].items():
+        dtype = _BLOCK_DTYPES[name]
+        _ann_index_invariant(
+            nbytes == expected[name] * dtype.itemsize,
+            f"block {name!r} size does not match header counts: {path}",
+        )
+        _ann_index_invariant(offset + nbytes <= size, f"block {name!r} past end of file: {path}")
+        if nbytes == 0:
+            arr = np.empty(expected[name], dtype=dtype)
+        else:
+            arr = np.memmap(path, dtype=dtype, mode="r", offset=offset, shape=(expected[name],))
+        if verify:
+            _ann_index_invariant(
+                _block_digest(arr).hex() == digest,
+                f"checksum mismatch in block {name!r}: {path}",
+            )
+        state[name] = arr
+    state["vectors"] = state["vectors"].reshape(meta["size"], meta["dim"])
+
+    return ANNIndex.from_state(state)
+
+
+__all__ = [
+    "MAGIC",
+    "VERSION",
+    "ANN_INDEX_NAME",
+    "write_ann_index",
+    "read_ann_header",
+    "open_ann_index",
+]
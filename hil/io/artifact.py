@@ -0,0 +1,390 @@
+# hil/io/artifact.py
+"""
+hil.io.artifact
+
+Versioned binary artifact format for fields and structural graphs.
+
+This module defines:
+- how a field (coordinate matrix) and a CSR graph are written to disk
+- how they are mapped back as zero-copy, read-only array views
+
+This module does NOT:
+- compute diagnostics
+- interpret contents
+- manage run registries or provenance beyond per-block checksums
+
+Layout (little-endian, version 1):
+
+    [0, HEADER_SIZE)   header: fixed fields, block table, header checksum
+    block "coordinates" float64, rows * cols, row-major
+    block "offsets"     uint64,  num_nodes + 1
+    block "indices"     uint32,  num_edges
+    block "weight"      float64, num_edges
+
+Every block starts on a BLOCK_ALIGN boundary and carries its own sha256, so
+opening a file only parses the header; data pages are touched on demand.
+Block dtypes match hil_matrix_t / hil_graph_csr_t, so mapped arrays pass
+through the native bindings without conversion.
+
+File mapping happens here, not in the native layer (which never manages
+files); the native kernel only ever sees the mapped buffers.
+"""
+
+from __future__ import annotations
+
+import hashlib
+import struct
+from dataclasses import dataclass
+from pathlib import Path
+from typing import Any, Dict, Optional, Tuple, Union
+
+import numpy as np
+
+from hil.core.api import CoreField
+from hil.core.structure.graph import CSRGraph, Graph
+
+
+# ---------------------------------------------------------------------------
+# Format constants
+# ---------------------------------------------------------------------------
+
+MAGIC = b"HILART\x00\x00"
+VERSION = 1
+HEADER_SIZE = 4096
+BLOCK_ALIGN = 4096
+
+# Conventional file name inside a run directory.
+ARTIFACT_NAME = "FIELD_GRAPH.hila"
+
+# magic, version, header_size, rows, cols, num_nodes, num_edges, symmetric, block_count
+_FIXED = struct.Struct("<8sIIQQQQII")
+# name, offset, nbytes, sha256
+_BLOCK = struct.Struct("<16sQQ32s")
+
+_BLOCK_DTYPES: Dict[str, np.dtype] = {
+    "coordinates": np.dtype("<f8"),
+    "offsets": np.dtype("<u8"),
+    "indices": np.dtype("<u4"),
+    "weight": np.dtype("<f8"),
+}
+
+_CHUNK_BYTES = 1 << 26
+
+
+# ---------------------------------------------------------------------------
+# Invariants
+# ---------------------------------------------------------------------------
+
+def _artifact_invariant(condition: bool, message: str) -> None:
+    if not condition:
+        raise ValueError(f"[hil.io.artifact invariant] {message}")
+
+
+# ---------------------------------------------------------------------------
+# Helpers
+# ---------------------------------------------------------------------------
+
+def _align(n: int) -> int:
+    return (n + BLOCK_ALIGN - 1) // BLOCK_ALIGN * BLOCK_ALIGN
+
+
+def _chunks(a: np.ndarray):
+    """Yield byte views of a contiguous array in bounded chunks."""
+    flat = a.reshape(-1)
+    step = max(1, _CHUNK_BYTES // max(1, flat.itemsize))
+    for i in range(0, flat.size, step):
+        yield memoryview(flat[i:i + step]).cast("B")
+
+
+def _block_digest(a: np.ndarray) -> bytes:
+    h = hashlib.sha256()
+    for chunk in _chunks(a):
+        h.update(chunk)
+    return h.digest()
+
+
+def _edge_list_csr(graph: Graph) -> CSRGraph:
+    """
+    Directed CSR form of an edge list (row = src), preserving edge order
+    within each row. Edge lists emitted by build_structure are already
+    grouped by src, in which case no reordering happens.
+    """
+    src = graph.src.astype(np.int64, copy=False)
+    counts = np.bincount(src, minlength=graph.num_nodes)
+    offsets = np.zeros(graph.num_nodes + 1, dtype=np.uint64)
+    offsets[1:] = np.cumsum(counts)
+
+    if src.size > 1 and np.any(src[1:] < src[:-1]):
+        order = np.argsort(src, kind="stable")
+        indices, weight = graph.dst[order], graph.weight[order]
+    else:
+        indices, weight = graph.dst, graph.weight
+
+    return CSRGraph(
+        offsets=offsets,
+        indices=np.asarray(indices, dtype=np.uint32),
+        weight=np.asarray(weight, dtype=np.float64),
+        num_nodes=graph.num_nodes,
+    )
+
+
+# ---------------------------------------------------------------------------
+# Mapped artifact
+# ---------------------------------------------------------------------------
+
+@dataclass(frozen=True)
+class Artifact:
+    """
+    Read-only view of an on-disk artifact.
+
+    Arrays are np.memmap views (or empty arrays for empty blocks); nothing is
+    read until accessed. `checksums` holds the hex sha256 of each block as
+    recorded at write time.
+    """
+
+    path: Path
+    version: int
+    num_elements: int
+    dimensions: int
+    num_nodes: int
+    num_edges: int
+    symmetric: bool
+    checksums: Dict[str, str]
+    coordinates: Optional[np.ndarray] = None
+    offsets: Optional[np.ndarray] = None
+    indices: Optional[np.ndarray] = None
+    weight: Optional[np.ndarray] = None
+
+    @property
+    def has_field(self) -> bool:
+        return self.coordinates is not None
+
+    @property
+    def has_graph(self) -> bool:
+        return self.offsets is not None
+
+    def field(self) -> CoreField:
+        _artifact_invariant(self.has_field, "artifact has no coordinates block")
+        return CoreField(vectors=self.coordinates, metadata={"artifact": str(self.path)})
+
+    def graph(self) -> CSRGraph:
+        """
+        CSR graph over the mapped blocks.
+
+        CSRGraph validates its arrays on construction, which reads the
+        offsets and indices blocks once.
+        """
+        _artifact_invariant(self.has_graph, "artifact has no graph blocks")
+        return CSRGraph(
+            offsets=self.offsets,
+            indices=self.indices,
+            weight=self.weight,
+            num_nodes=self.num_nodes,
+            symmetric=self.symmetric,
+        )
+
+    def verify(self) -> None:
+        """Recompute every block checksum; raises ValueError on mismatch."""
+        for name, arr in (
+            ("coordinates", self.coordinates),
+            ("offsets", self.offsets),
+            ("indices", self.indices),
+            ("weight", self.weight),
+        ):
+            if arr is None:
+                continue
+            _artifact_invariant(
+                _block_digest(arr).hex() == self.checksums[name],
+                f"checksum mismatch in block {name!r}: {self.path}",
+            )
+
+
+# ---------------------------------------------------------------------------
+# Writer
+# ---------------------------------------------------------------------------
+
+def write_artifact(
+    path: Union[str, Path],
+    *,
+    vectors: Optional[np.ndarray] = None,
+    graph: Optional[Union[Graph, CSRGraph]] = None,
+) -> Path:
+    """
+    Write a field and/or graph as a binary artifact.
+
+    Edge-list graphs are stored in directed CSR form (row = src);
+    CSRGraph inputs are stored as given, including the symmetric flag.
+    """
+    _artifact_invariant(vectors is not None or graph is not None, "nothing to write")
+    path = Path(path)
+
+    blocks: Dict[str, np.ndarray] = {}
+    rows = cols = 0
+    num_nodes = num_edges = 0
+    symmetric = False
+
+    if vectors is not None:
+        X = np.asarray(vectors)
+        _artifact_invariant(X.ndim == 2, "vectors must be 2D (n, d)")
+        rows, cols = int(X.shape[0]), int(X.shape[1])
+        blocks["coordinates"] = np.ascontiguousarray(X, dtype=_BLOCK_DTYPES["coordinates"])
+
+    if graph is not None:
+        csr = _edge_list_csr(graph) if isinstance(graph, Graph) else graph
+        _artifact_invariant(isinstance(csr, CSRGraph), "graph must be Graph or CSRGraph")
+        num_nodes, num_edges = int(csr.num_nodes), int(csr.num_edges)
+        symmetric = bool(csr.symmetric)
+        for name, arr in (("offsets", csr.offsets), ("indices", csr.indices), ("weight", csr.weight)):
+            blocks[name] = np.ascontiguousarray(arr, dtype=_BLOCK_DTYPES[name])
+
+    names = [n for n in _BLOCK_DTYPES if n in blocks]
+    table_end = _FIXED.size + _BLOCK.size * len(names) + 32
+    _artifact_invariant(table_end <= HEADER_SIZE, "block table exceeds header size")
+
+    entries = []
+    with path.open("wb") as f:
+        f.write(b"\x00" * HEADER_SIZE)
+        position = HEADER_SIZE
+        for name in names:
+            arr = blocks[name]
+            h = hashlib.sha256()
+            for chunk in _chunks(arr):
+                f.write(chunk)
+                h.update(chunk)
+            nbytes = arr.nbytes
+            end = _align(position + nbytes)
+            f.write(b"\x00" * (end - position - nbytes))
+            entries.append((name, position, nbytes, h.digest()))
+            position = end
+
+        header = bytearray(HEADER_SIZE)
+        _FIXED.pack_into(
+            header, 0, MAGIC, VERSION, HEADER_SIZE,
+            rows, cols, num_nodes, num_edges, int(symmetric), len(entries),
+        )
+        for i, (name, offset, nbytes, digest) in enumerate(entries):
+            _BLOCK.pack_into(
+                header, _FIXED.size + i * _BLOCK.size,
+                name.encode("ascii"), offset, nbytes, digest,
+            )
+        header[HEADER_SIZE - 32:] = hashlib.sha256(header[:HEADER_SIZE - 32]).digest()
+
+        f.seek(0)
+        f.write(header)
+
+    return path
+
+
+# ---------------------------------------------------------------------------
+# Reader
+# ---------------------------------------------------------------------------
+
+def read_header(path: Union[str, Path]) -> Dict[str, Any]:
+    """
+    Parse and check the artifact header only (one HEADER_SIZE read).
+    """
+    path = Path(path)
+    _artifact_invariant(path.exists(), f"artifact not found: {path}")
+
+    with path.open("rb") as f:
+        header = f.read(HEADER_SIZE)
+    _artifact_invariant(len(header) == HEADER_SIZE, f"truncated artifact header: {path}")
+
+    magic, version, header_size, rows, cols, num_nodes, num_edges, symmetric, count = (
+        _FIXED.unpack_from(header, 0)
+    )
+    _artifact_invariant(magic == MAGIC, f"not a HIL artifact: {path}")
+    _artifact_invariant(version == VERSION, f"unsupported artifact version {version}: {path}")
+    _artifact_invariant(header_size == HEADER_SIZE, f"unexpected header size: {path}")
+    _artifact_invariant(
+        hashlib.sha256(header[:HEADER_SIZE - 32]).digest() == header[HEADER_SIZE - 32:],
+        f"header checksum mismatch: {path}",
+    )
+
+    blocks: Dict[str, Tuple[int, int, str]] = {}
+    for i in range(count):
+        raw_name, offset, nbytes, digest = _BLOCK.unpack_from(header, _FIXED.size + i * _BLOCK.size)
+        name = raw_name.rstrip(b"\x00").decode("ascii")
+        _artifact_invariant(name in _BLOCK_DTYPES, f"unknown block {name!r}: {path}")
+        _artifact_invariant(offset % BLOCK_ALIGN == 0, f"misaligned block {name!r}: {path}")
+        blocks[name] = (int(offset), int(nbytes), digest.hex())
+
+    return {
+        "version": int(version),
+        "num_elements": int(rows),
+        "dimensions": int(cols),
+        "num_nodes": int(num_nodes),
+        "num_edges": int(num_edges),
+        "symmetric": bool(symmetric),
+        "blocks": blocks,
+    }
+
+
+def open_artifact(path: Union[str, Path], *, verify: bool = False) -> Artifact:
+    """
+    Map an artifact read-only.
+
+    Only the header is read; blocks are mapped lazily by the OS. Pass
+    verify=True to recompute block checksums up front (reads every block).
+    """
+    path = Path(path)
+    meta = read_header(path)
+    size = path.stat().st_size
+
+    expected = {
+        "coordinates": meta["num_elements"] * meta["dimensions"],
+        "offsets": meta["num_nodes"] + 1,
+        "indices": meta["num_edges"],
+        "weight": meta["num_edges"],
+    }
+
+    arrays: Dict[str, np.ndarray] = {}
+    for name, (offset, nbytes, _) in meta["blocks"].items():
+        dtype = _BLOCK_DTYPES[name]
+        _artifact_invariant(
+            nbytes == expected[name] * dtype.itemsize,
+            f"block {name!r} size does not match header counts: {path}",
+        )
+        _artifact_invariant(offset + nbytes <= size, f"block {name!r} past end of file: {path}")
+        if nbytes == 0:
+            arr = np.empty(0, dtype=dtype)
+        else:
+            arr = np.memmap(path, dtype=dtype, mode="r", offset=offset, shape=(expected[name],))
+        if name == "coordinates":
+            arr = arr.reshape(meta["num_elements"], meta["dimensions"])
+        arrays[name] = arr
+
+    has_graph = {"offsets", "indices", "weight"} <= set(arrays)
+    _artifact_invariant(
+        has_graph or not ({"offsets", "indices", "weight"} & set(arrays)),
+        f"incomplete graph blocks: {path}",
+    )
+
+    artifact = Artifact(
+        path=path,
+        version=meta["version"],
+        num_elements=meta["num_elements"],
+        dimensions=meta["dimensions"],
+        num_nodes=meta["num_nodes"],
+        num_edges=meta["num_edges"],
+        symmetric=meta["symmetric"],
+        checksums={name: b[2] for name, b in meta["blocks"].items()},
+        coordinates=arrays.get("coordinates"),
+        offsets=arrays.get("offsets"),
+        indices=arrays.get("indices"),
+        weight=arrays.get("weight"),
+    )
+    if verify:
+        artifact.verify()
+    return artifact
+
+
+__all__ = [
+    "MAGIC",
+    "VERSION",
+    "ARTIFACT_NAME",
+    "Artifact",
+    "write_artifact",
+    "read_header",
+    "open_artifact",
+]
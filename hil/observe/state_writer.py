@@ -1 +1,104 @@
-# State recording stub
+# hil/observe/state_writer.py
+"""
+hil.observe.state_writer
+
+Run-state recording for native kernel instrumentation.
+
+This module defines:
+- how native kernel counters (hil_stats_snapshot) are read through the shim
+- how they are written next to the diagnostics as NATIVE_STATS.json
+
+This module does NOT:
+- compute diagnostics
+- interpret timings or decide anything from them
+- enable instrumentation (that is the -DHIL_STATS compile flag)
+
+Record layout (NATIVE_STATS.json):
+
+    available          native extension importable
+    enabled            extension built with -DHIL_STATS
+    kernels            {name: {calls, nanoseconds, bytes, items}}
+    wall_nanoseconds   caller-measured wall time of the recorded span
+    native_nanoseconds sum of kernel nanoseconds
+    python_nanoseconds wall minus native, floored at zero
+
+Kernel time is measured on the calling thread, so native_nanoseconds is
+comparable to wall time when kernels are not called concurrently.
+"""
+
+from __future__ import annotations
+
+import json
+from pathlib import Path
+from typing import Any, Dict, Optional
+
+STATS_NAME = "NATIVE_STATS.json"
+
+
+# ---- Counters ---------------------------------------------------------------
+
+def native_stats_snapshot(*, reset: bool = False) -> Optional[Dict[str, Any]]:
+    """
+    Native counters, or None when the extension (or NumPy) is unavailable.
+    """
+    try:
+        from hil.core.native._shim import NativeUnavailable, native_stats
+    except ImportError:
+        return None
+    try:
+        return native_stats(reset=reset)
+    except NativeUnavailable:
+        return None
+
+
+def reset_native_stats() -> None:
+    """
+    Zero the native counters, so a later snapshot covers one run only.
+    """
+    native_stats_snapshot(reset=True)
+
+
+# ---- Writer -----------------------------------------------------------------
+
+def native_stats_record(
+    stats: Optional[Dict[str, Any]],
+    *,
+    wall_seconds: float,
+) -> Dict[str, Any]:
+    """
+    Assemble the NATIVE_STATS.json record from a snapshot and a wall time.
+    """
+    kernels = dict(stats["kernels"]) if stats else {}
+    wall_ns = max(0, int(round(float(wall_seconds) * 1e9)))
+    native_ns = sum(int(entry.get("nanoseconds", 0)) for entry in kernels.values())
+
+    return {
+        "available": stats is not None,
+        "enabled": bool(stats["enabled"]) if stats else False,
+        "kernels": kernels,
+        "wall_nanoseconds": wall_ns,
+        "native_nanoseconds": native_ns,
+        "python_nanoseconds": max(0, wall_ns - native_ns),
+    }
+
+
+def write_native_stats(
+    run_root: Path,
+    *,
+    wall_seconds: float,
+    stats: Optional[Dict[str, Any]] = None,
+) -> Dict[str, Any]:
+    """
+    Write NATIVE_STATS.json into run_root and return the record.
+
+    stats defaults to a fresh snapshot; pass one explicitly to record a
+    snapshot taken earlier.
+    """
+    if stats is None:
+        stats = native_stats_snapshot()
+    record = native_stats_record(stats, wall_seconds=wall_seconds)
+
+    path = Path(run_root) / STATS_NAME
+    with path.open("w", encoding="utf-8") as f:
+        json.dump(record, f, indent=2, sort_keys=True)
+    return record
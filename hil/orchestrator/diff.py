@@ -24,6 +24,8 @@ import json
 from pathlib import Path
 from typing import Dict, Any
 
+from hil.io.artifact import ARTIFACT_NAME, read_header
+
 
 # ---------------------------------------------------------------------------
 # Invariants
@@ -149,6 +151,50 @@ def diff_graph_summary(
     return diff
 
 
+# ---------------------------------------------------------------------------
+# Binary artifact diffs
+# ---------------------------------------------------------------------------
+
+def diff_binary_artifact(
+    run_a: Path,
+    run_b: Path,
+) -> Dict[str, Any]:
+    """
+    Diff the binary field/graph artifacts between two runs.
+
+    Header-only: counts are compared numerically and blocks by their
+    recorded checksums, so no coordinate or edge data is read.
+    """
+    header_a = read_header(run_a / ARTIFACT_NAME)
+    header_b = read_header(run_b / ARTIFACT_NAME)
+
+    diff: Dict[str, Any] = {}
+
+    for k in ("num_elements", "dimensions", "num_nodes", "num_edges"):
+        va = header_a[k]
+        vb = header_b[k]
+
+        diff[k] = {
+            "run_a": va,
+            "run_b": vb,
+            "delta": _numeric_delta(va, vb),
+        }
+
+    blocks: Dict[str, Any] = {}
+    for name in sorted(set(header_a["blocks"]) | set(header_b["blocks"])):
+        sum_a = header_a["blocks"].get(name, (None, None, None))[2]
+        sum_b = header_b["blocks"].get(name, (None, None, None))[2]
+
+        blocks[name] = {
+            "run_a": sum_a,
+            "run_b": sum_b,
+            "identical": sum_a is not None and sum_a == sum_b,
+        }
+    diff["blocks"] = blocks
+
+    return diff
+
+
 # ---------------------------------------------------------------------------
 # Composite diff
 # ---------------------------------------------------------------------------
@@ -172,6 +218,11 @@ def diff_runs(
         "metrics": diff_metrics(run_a, run_b),
         "field": diff_field_summary(run_a, run_b),
         "graph": diff_graph_summary(run_a, run_b),
+        "binary": (
+            diff_binary_artifact(run_a, run_b)
+            if (run_a / ARTIFACT_NAME).exists() and (run_b / ARTIFACT_NAME).exists()
+            else None
+        ),
     }
 
 
@@ -179,5 +230,6 @@ __all__ = [
     "diff_metrics",
     "diff_field_summary",
     "diff_graph_summary",
+    "diff_binary_artifact",
     "diff_runs",
 ]
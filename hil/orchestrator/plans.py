@@ -43,6 +43,11 @@ class PlanStep:
 
     A step describes ONE build invocation with explicit, declared parameters.
     It does not contain logic, conditions, or branching.
+
+    step_id names the step for depends_on references (default: its position,
+    see Plan.step_keys). depends_on lists the steps that must complete
+    successfully before this one starts; it orders execution only and
+    carries no results between steps.
     """
 
     build: str
@@ -50,6 +55,8 @@ class PlanStep:
 
     perturbation: Optional[str] = None
     parameters: Dict[str, Any] = field(default_factory=dict)
+    step_id: Optional[str] = None
+    depends_on: List[str] = field(default_factory=list)
 
     def __post_init__(self) -> None:
         _plan_invariant(
@@ -68,6 +75,15 @@ class PlanStep:
             isinstance(self.parameters, dict),
             "parameters must be a dictionary",
         )
+        _plan_invariant(
+            self.step_id is None or (isinstance(self.step_id, str) and bool(self.step_id)),
+            "step_id must be a non-empty string or None",
+        )
+        _plan_invariant(
+            isinstance(self.depends_on, list)
+            and all(isinstance(d, str) and d for d in self.depends_on),
+            "depends_on must be a list of step ids",
+        )
 
 
 # ---------------------------------------------------------------------------
@@ -79,7 +95,10 @@ class Plan:
     """
     Declarative orchestration plan.
 
-    A plan is an ordered list of steps that a runner may execute.
+    A plan is a list of steps that a runner may execute. Steps form a DAG
+    through depends_on; steps with no path between them are independent
+    and may run concurrently. List order is the tie-break, never a
+    dependency.
     """
 
     name: str
@@ -106,6 +125,55 @@ class Plan:
             "metadata must be a dictionary",
         )
 
+        keys = self.step_keys()
+        _plan_invariant(len(set(keys)) == len(keys), "step ids must be unique")
+        known = set(keys)
+        for key, step in zip(keys, self.steps):
+            _plan_invariant(
+                all(d in known for d in step.depends_on),
+                f"step {key} depends on an unknown step",
+            )
+            _plan_invariant(key not in step.depends_on, f"step {key} depends on itself")
+        _plan_invariant(len(self.topological_order()) == len(keys), "step dependencies form a cycle")
+
+    def step_keys(self) -> List[str]:
+        """
+        Identifier of each step: its step_id, or "step_<index>" (zero-padded).
+        """
+        return [
+            s.step_id if s.step_id is not None else f"step_{i:03d}"
+            for i, s in enumerate(self.steps)
+        ]
+
+    def topological_order(self) -> List[int]:
+        """
+        Step indices in dependency order, ties broken by list position.
+
+        Steps on a cycle are omitted, so a short result means the plan is
+        not a DAG.
+        """
+        index = {k: i for i, k in enumerate(self.step_keys())}
+        pending = [len(s.depends_on) for s in self.steps]
+        dependents: List[List[int]] = [[] for _ in self.steps]
+        for i, s in enumerate(self.steps):
+            for d in s.depends_on:
+                if d in index:
+                    dependents[index[d]].append(i)
+                else:
+                    pending[i] -= 1
+
+        order: List[int] = []
+        ready = [i for i, p in enumerate(pending) if p == 0]
+        while ready:
+            ready.sort()
+            i = ready.pop(0)
+            order.append(i)
+            for j in dependents[i]:
+                pending[j] -= 1
+                if pending[j] == 0:
+                    ready.append(j)
+        return order
+
 
 # ---------------------------------------------------------------------------
 # Example plans (for reference only)
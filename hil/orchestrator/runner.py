@@ -5,9 +5,10 @@ hil.orchestrator.runner
 Plan execution engine for the HIL orchestrator.
 
 This module:
-- executes declarative plans step-by-step
-- invokes sanctioned build entrypoints
-- records procedural execution metadata
+- executes declarative plans in dependency (depends_on) order
+- runs independent steps concurrently on a bounded worker pool
+- invokes sanctioned build entrypoints, one explicit run directory per step
+- records procedural execution metadata (including timing)
 
 This module does NOT:
 - interpret epistemic results
@@ -15,16 +16,22 @@ This module does NOT:
 - apply thresholds or criteria
 - modify plans at runtime
 - persist hidden state between runs
+
+Scheduling is procedural only: a step starts once every step it depends on
+has completed successfully. After any failure no further steps are started;
+steps already running finish and are recorded.
 """
 
 from __future__ import annotations
 
+import os
 import subprocess
 import sys
 import time
+from concurrent.futures import FIRST_COMPLETED, Future, ThreadPoolExecutor, wait
 from dataclasses import dataclass, field
 from pathlib import Path
-from typing import List, Dict, Any
+from typing import List, Dict, Any, Optional
 
 from hil.orchestrator.plans import Plan, PlanStep
 
@@ -46,6 +53,8 @@ def _runner_invariant(condition: bool, message: str) -> None:
 class StepExecutionRecord:
     """
     Record of a single plan step execution.
+
+    duration_seconds is monotonic wall time of the build invocation.
     """
     step_index: int
     build: str
@@ -56,12 +65,19 @@ class StepExecutionRecord:
     success: bool
     run_directory: str | None
     error: str | None = None
+    step_id: str | None = None
+    depends_on: List[str] = field(default_factory=list)
+    duration_seconds: float = 0.0
 
 
 @dataclass(frozen=True)
 class PlanExecutionRecord:
     """
     Record of an entire plan execution.
+
+    steps are ordered by step_index and hold only steps that were started.
+    wall_seconds covers the whole plan; with concurrent steps it is less
+    than the sum of step durations.
     """
     plan_name: str
     started_utc: str
@@ -69,6 +85,7 @@ class PlanExecutionRecord:
     steps: List[StepExecutionRecord]
     success: bool
     metadata: Dict[str, Any] = field(default_factory=dict)
+    wall_seconds: float = 0.0
 
 
 # ---------------------------------------------------------------------------
@@ -79,9 +96,23 @@ def _utc_timestamp() -> str:
     return time.strftime("%Y-%m-%dT%H:%M:%SZ", time.gmtime())
 
 
-def _invoke_build(build: str) -> None:
+def _step_threads(workers: int) -> Optional[int]:
+    """
+    OpenMP threads per build process, so that `workers` concurrent builds
+    share the machine instead of each starting one thread per core. None
+    when OMP_NUM_THREADS is already set (an explicit choice is kept).
+    """
+    if os.environ.get("OMP_NUM_THREADS"):
+        return None
+    return max(1, (os.cpu_count() or 1) // max(workers, 1))
+
+
+def _invoke_build(build: str, run_dir: Path, threads: Optional[int] = None) -> None:
     """
-    Invoke a build entrypoint.
+    Invoke a build entrypoint, writing its artifacts to run_dir.
+
+    threads, when given, caps the build's native OpenMP threads
+    (OMP_NUM_THREADS in the child environment).
 
     Currently supports:
     - hil_build
@@ -92,17 +123,57 @@ def _invoke_build(build: str) -> None:
         raise RuntimeError(f"Unsupported build entrypoint: {build}")
 
     # Use the current interpreter to respect active environment (e.g. Conda)
-    cmd = [sys.executable, "-m", "hil.build.hil_build"]
-    subprocess.check_call(cmd)
+    cmd = [sys.executable, "-m", "hil.build.hil_build", "--run-dir", str(run_dir)]
+    env = None
+    if threads is not None:
+        env = dict(os.environ, OMP_NUM_THREADS=str(threads))
+    subprocess.check_call(cmd, env=env)
+
+
+def _step_run_dir(artifacts_root: Path, plan_stamp: str, plan: Plan, key: str) -> Path:
+    """
+    Explicit, unique run directory of one step: run_<stamp>_<plan>_<step>.
+    """
+    safe = "".join(c if c.isalnum() or c in "-_" else "-" for c in f"{plan.name}_{key}")
+    return artifacts_root / f"run_{plan_stamp}_{safe}"
+
 
+def _execute_step(
+    index: int,
+    key: str,
+    step: PlanStep,
+    run_dir: Path,
+    threads: Optional[int] = None,
+) -> StepExecutionRecord:
+    """
+    Run one step and record it; never raises for build failures.
+    """
+    step_start = _utc_timestamp()
+    t0 = time.perf_counter()
+    run_directory: str | None = None
+    error: str | None = None
 
-def _latest_run_dir(artifacts_root: Path) -> Path:
-    runs = sorted(
-        (p for p in artifacts_root.iterdir() if p.is_dir()),
-        key=lambda p: p.name,
+    try:
+        _invoke_build(step.build, run_dir, threads)
+        _runner_invariant(run_dir.is_dir(), f"build did not create {run_dir}")
+        run_directory = str(run_dir)
+    except Exception as e:
+        error = str(e)
+
+    return StepExecutionRecord(
+        step_index=index,
+        build=step.build,
+        input=step.input,
+        perturbation=step.perturbation,
+        start_time_utc=step_start,
+        end_time_utc=_utc_timestamp(),
+        success=error is None,
+        run_directory=run_directory,
+        error=error,
+        step_id=key,
+        depends_on=list(step.depends_on),
+        duration_seconds=time.perf_counter() - t0,
     )
-    _runner_invariant(len(runs) > 0, "no run directories found after build")
-    return runs[-1]
 
 
 # ---------------------------------------------------------------------------
@@ -113,13 +184,19 @@ def run_plan(
     plan: Plan,
     *,
     repo_root: Path | None = None,
+    max_workers: Optional[int] = None,
 ) -> PlanExecutionRecord:
     """
     Execute a declarative orchestration plan.
 
     This function:
-    - executes each step in order
-    - records execution metadata
+    - starts each step once all of its depends_on steps have succeeded,
+      up to max_workers at a time (default: CPU count, at most one worker
+      per step; 1 gives strictly sequential execution in dependency order)
+    - splits the cores between concurrent builds: each build process gets
+      cpu_count // workers OpenMP threads unless OMP_NUM_THREADS is set
+    - gives every step its own run directory under artifacts/runs
+    - records execution metadata and timing
     - returns a procedural record
 
     It does NOT:
@@ -134,46 +211,57 @@ def run_plan(
         artifacts_root.exists(),
         "artifacts/runs directory does not exist",
     )
+    workers = max_workers if max_workers is not None else (os.cpu_count() or 1)
+    _runner_invariant(workers >= 1, "max_workers must be >= 1")
+    workers = min(workers, len(plan.steps))
+    threads = _step_threads(workers)
+
+    keys = plan.step_keys()
+    index = {k: i for i, k in enumerate(keys)}
+    order = plan.topological_order()
+    plan_stamp = time.strftime("%Y%m%d_%H%M%S", time.gmtime())
 
     started = _utc_timestamp()
-    step_records: List[StepExecutionRecord] = []
-
-    for idx, step in enumerate(plan.steps):
-        step_start = _utc_timestamp()
-        run_dir: str | None = None
-        success = False
-        error: str | None = None
-
-        try:
-            _invoke_build(step.build)
-            latest = _latest_run_dir(artifacts_root)
-            run_dir = str(latest)
-            success = True
-        except Exception as e:
-            error = str(e)
-            success = False
-
-        step_end = _utc_timestamp()
-
-        step_records.append(
-            StepExecutionRecord(
-                step_index=idx,
-                build=step.build,
-                input=step.input,
-                perturbation=step.perturbation,
-                start_time_utc=step_start,
-                end_time_utc=step_end,
-                success=success,
-                run_directory=run_dir,
-                error=error,
-            )
+    t0 = time.perf_counter()
+
+    records: Dict[int, StepExecutionRecord] = {}
+    running: Dict[Future, int] = {}
+    waiting = list(order)
+    failed = False
+
+    def _ready(i: int) -> bool:
+        return all(
+            index[d] in records and records[index[d]].success
+            for d in plan.steps[i].depends_on
         )
 
-        if not success:
-            break  # stop execution on failure
+    with ThreadPoolExecutor(max_workers=workers, thread_name_prefix="hil-plan") as pool:
+        while waiting or running:
+            # Launch every ready step (topological order) while workers are free.
+            if not failed:
+                for i in [j for j in waiting if _ready(j)]:
+                    if len(running) >= workers:
+                        break
+                    waiting.remove(i)
+                    run_dir = _step_run_dir(artifacts_root, plan_stamp, plan, keys[i])
+                    fut = pool.submit(_execute_step, i, keys[i], plan.steps[i], run_dir, threads)
+                    running[fut] = i
+
+            if not running:
+                break  # nothing in flight and nothing launchable
+
+            done, _ = wait(running, return_when=FIRST_COMPLETED)
+            for fut in done:
+                rec = fut.result()
+                records[running.pop(fut)] = rec
+                if not rec.success:
+                    failed = True  # stop execution on failure
 
     finished = _utc_timestamp()
-    overall_success = all(s.success for s in step_records)
+    step_records = [records[i] for i in sorted(records)]
+    overall_success = len(step_records) == len(plan.steps) and all(
+        s.success for s in step_records
+    )
 
     return PlanExecutionRecord(
         plan_name=plan.name,
@@ -183,7 +271,12 @@ def run_plan(
         success=overall_success,
         metadata={
             "epistemic_status": "procedural-only",
+            "max_workers": workers,
+            "threads_per_step": threads,
+            "steps_not_run": [keys[i] for i in waiting],
+            "step_seconds_total": sum(s.duration_seconds for s in step_records),
         },
+        wall_seconds=time.perf_counter() - t0,
     )
 
 
@@ -29,7 +29,7 @@ import numpy as np
 from hil.core.structure.graph import Graph
 from hil.core.metrics.entropy import structural_entropy
 from hil.core.metrics.coherence import field_coherence
-from hil.core.native._shim import graph_entropy
+from hil.core.native._shim import field_summary, graph_entropy, graph_out_entropy
 
 
 def _assert_close(a: float, b: float, name: str, tol: float = 1e-9) -> None:
@@ -40,6 +40,13 @@ def _assert_close(a: float, b: float, name: str, tol: float = 1e-9) -> None:
     print(f"[OK] {name}: python={a:.12f}, native={b:.12f}")
 
 
+def _reference_entropy(strength: np.ndarray) -> float:
+    """Explicit NumPy Shannon entropy of strength / sum(strength)."""
+    p = strength / strength.sum()
+    p = p[p > 0.0]
+    return float(-(p * np.log(p)).sum())
+
+
 def main() -> None:
     # ------------------------------------------------------------------
     # Step 1: Construct a tiny, explicit field (no semantics)
@@ -72,33 +79,49 @@ def main() -> None:
 
     # ------------------------------------------------------------------
     # Step 3: Python diagnostics
+    #
+    # The references are computed here with NumPy, independently of
+    # structural_entropy, which itself dispatches to native when built.
     # ------------------------------------------------------------------
-    py_entropy = structural_entropy(graph)
+    src64 = graph.src.astype(np.int64)
+    out_strength = np.bincount(src64, weights=graph.weight, minlength=graph.num_nodes)
+    degree = out_strength + np.bincount(
+        graph.dst.astype(np.int64), weights=graph.weight, minlength=graph.num_nodes
+    )
+
+    py_out_entropy = _reference_entropy(out_strength)
+    py_degree_entropy = _reference_entropy(degree)
     py_coherence = field_coherence(vectors)
 
     # ------------------------------------------------------------------
     # Step 4: Native diagnostics
     # ------------------------------------------------------------------
-    native_entropy = graph_entropy(
+    native_out_entropy = graph_out_entropy(
+        src=graph.src,
+        dst=graph.dst,
+        weight=graph.weight,
+        num_nodes=graph.num_nodes,
+    )
+    native_degree_entropy = graph_entropy(
         src=graph.src,
         dst=graph.dst,
         weight=graph.weight,
         num_nodes=graph.num_nodes,
     )
 
-    # Native coherence binding will be added later; for now, we check
-    # only entropy via native and coherence via Python parity-by-definition.
+    native_coherence = field_summary(vectors)["coherence"]
 
     # ------------------------------------------------------------------
     # Step 5: Parity assertions
     # ------------------------------------------------------------------
     print("\n--- Native ↔ Python Parity Check ---\n")
 
-    _assert_close(py_entropy, native_entropy, "structural_entropy")
+    # structural_entropy is the out-strength entropy whichever backend ran.
+    _assert_close(py_out_entropy, structural_entropy(graph), "structural_entropy")
+    _assert_close(py_out_entropy, native_out_entropy, "graph_out_entropy")
+    _assert_close(py_degree_entropy, native_degree_entropy, "graph_entropy (degree)")
 
-    # Coherence parity check is structural-by-definition at this stage
-    # (native binding will be added later).
-    print(f"[INFO] field_coherence (python): {py_coherence:.12f}")
+    _assert_close(py_coherence, native_coherence, "field_coherence")
 
     print("\n[PASS] Native ↔ Python parity verified for current diagnostics.")
 
@@ -0,0 +1,115 @@
+# hil/tests/test_ann_index.py
+"""
+ANN index test: HNSW index, incremental kNN rows and the index file.
+
+Purpose:
+- Verify incremental kNN rows, built batch by batch with exhaustive
+  candidates, equal build_structure_csr on the same rows, and that their
+  running entropy equals structural_entropy of those rows
+- Verify the index depends on its rows only, not on how they were batched
+- Verify a written index answers queries exactly as the original and that
+  a corrupted file is rejected
+
+This test does NOT:
+- measure recall or latency (hilbert_test.c reports both)
+- test large fields
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.ann import ANNIndex, IncrementalKNN  # noqa: E402
+from hil.core.api import CoreField, build_structure_csr  # noqa: E402
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.io.ann_index import open_ann_index, write_ann_index  # noqa: E402
+from hil.io.artifact import HEADER_SIZE  # noqa: E402
+
+
+@pytest.fixture(autouse=True)
+def _require_native():
+    # Importing the shim fails outright when _native is not built.
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+
+
+@pytest.fixture
+def vectors():
+    rng = np.random.default_rng(0)
+    a = rng.standard_normal((36, 8)) * 0.3 + 2.0
+    b = rng.standard_normal((24, 8)) * 0.3 - 2.0
+    return np.vstack([a, b])
+
+
+def _batches(X, sizes):
+    edges = np.cumsum([0] + list(sizes))
+    return [X[s:e] for s, e in zip(edges[:-1], edges[1:])]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_incremental_rows_match_exact_knn(vectors):
+    n, k = vectors.shape[0], 5
+    knn = IncrementalKNN(ANNIndex(vectors.shape[1], seed=3), k, ef=2 * n, candidates=n)
+    for batch in _batches(vectors, (1, 9, 20, 30)):
+        knn.add(batch)
+
+    got = knn.to_csr()
+    ref = build_structure_csr(CoreField(vectors=vectors), k=k, min_weight=0.0)
+    assert np.array_equal(got.offsets.astype(np.int64), ref.offsets.astype(np.int64))
+    assert np.array_equal(got.indices.astype(np.int64), ref.indices.astype(np.int64))
+    assert np.array_equal(got.weight, ref.weight)
+
+    assert knn.entropy() == pytest.approx(structural_entropy(got), rel=1e-12)
+    assert np.array_equal(knn.in_degree(), np.bincount(got.indices, minlength=n))
+
+
+def test_index_is_batch_invariant(vectors):
+    whole = ANNIndex.build(vectors, m=4, seed=7)
+    parts = ANNIndex(vectors.shape[1], m=4, seed=7)
+    for batch in _batches(vectors, (7, 13, 40)):
+        parts.add(batch)
+
+    a, b = whole.to_state(), parts.to_state()
+    assert a.keys() == b.keys()
+    for key in a:
+        assert np.array_equal(np.asarray(a[key]), np.asarray(b[key])), key
+
+
+def test_index_file_round_trip(vectors, tmp_path):
+    index = ANNIndex.build(vectors, m=4, ef_construction=32, seed=1)
+    path = write_ann_index(tmp_path / "FIELD_ANN.hilx", index)
+
+    loaded = open_ann_index(path, verify=True)
+    assert loaded.info() == index.info()
+    queries = vectors[::7] + 0.05
+    for got, ref in zip(loaded.query(queries, 4), index.query(queries, 4)):
+        assert np.array_equal(got, ref)
+
+    empty = ANNIndex(8)
+    assert open_ann_index(write_ann_index(tmp_path / "empty.hilx", empty)).size == 0
+
+
+def test_corrupted_index_file_is_rejected(vectors, tmp_path):
+    path = write_ann_index(tmp_path / "FIELD_ANN.hilx", ANNIndex.build(vectors, m=4))
+    raw = bytearray(path.read_bytes())
+    raw[HEADER_SIZE + 8] ^= 0xFF  # inside the vectors block
+    path.write_bytes(bytes(raw))
+
+    with pytest.raises(ValueError):
+        open_ann_index(path, verify=True)
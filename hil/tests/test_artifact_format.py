@@ -0,0 +1,80 @@
+# hil/tests/test_artifact_format.py
+"""
+Binary artifact format test: write, map, verify.
+
+Purpose:
+- Verify field and graph blocks round-trip bit-exactly through the format
+- Verify mapped arrays are read-only memory maps, not parsed copies
+- Verify header and block checksums detect corruption
+
+This test does NOT:
+- compute or interpret diagnostics
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure  # noqa: E402
+from hil.io.artifact import open_artifact, read_header, write_artifact  # noqa: E402
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_artifact_roundtrip(tmp_path):
+    """
+    Coordinates and the CSR form of an edge list map back bit-exactly.
+    """
+    rng = np.random.default_rng(0)
+    X = rng.standard_normal((12, 5))
+    graph = build_structure(CoreField(vectors=X))
+
+    path = write_artifact(tmp_path / "run.hila", vectors=X, graph=graph)
+    art = open_artifact(path, verify=True)
+
+    assert isinstance(art.coordinates, np.memmap)
+    assert not art.coordinates.flags.writeable
+    assert np.array_equal(art.coordinates, X)
+
+    csr = art.graph()
+    assert csr.num_nodes == graph.num_nodes
+    assert csr.num_edges == graph.num_edges
+    back = csr.to_graph()
+    assert np.array_equal(back.src, graph.src)
+    assert np.array_equal(back.dst, graph.dst)
+    assert np.array_equal(back.weight, graph.weight)
+
+
+def test_artifact_detects_corruption(tmp_path):
+    """
+    Flipping a data byte fails block verification; flipping a header byte
+    fails on open.
+    """
+    X = np.arange(24, dtype=np.float64).reshape(6, 4)
+    path = write_artifact(tmp_path / "run.hila", vectors=X)
+
+    block_offset = read_header(path)["blocks"]["coordinates"][0]
+    raw = bytearray(path.read_bytes())
+    raw[block_offset] ^= 0xFF
+    path.write_bytes(bytes(raw))
+
+    open_artifact(path)  # header intact: opening stays lazy
+    with pytest.raises(ValueError):
+        open_artifact(path, verify=True)
+
+    raw[block_offset] ^= 0xFF
+    raw[40] ^= 0xFF
+    path.write_bytes(bytes(raw))
+    with pytest.raises(ValueError):
+        open_artifact(path)
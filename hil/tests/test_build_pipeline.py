@@ -0,0 +1,142 @@
+# hil/tests/test_build_pipeline.py
+"""
+Pipelined batch build test.
+
+Purpose:
+- Verify run_pipeline returns outputs in input order and matches the
+  sequential schedule, with stages overlapping in time
+- Verify a failing stage is recorded for its item only
+- Verify a pipelined hil_build batch writes the same per-run artifacts as
+  the sequential batch, and reports stage occupancy and queue depth
+
+This test does NOT:
+- measure speedups or assert timing beyond overlap
+"""
+
+from __future__ import annotations
+
+import json
+import sys
+import threading
+import time
+from pathlib import Path
+
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.build import hil_build  # noqa: E402
+from hil.build.pipeline import Stage, run_pipeline  # noqa: E402
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+class _Spans:
+    """Records (start, end) per (stage, item) around a sleeping stage fn."""
+
+    def __init__(self) -> None:
+        self.spans: dict = {}
+        self.lock = threading.Lock()
+
+    def stage(self, name: str, delay: float, fail_on: int = -1) -> Stage:
+        def fn(payload):
+            i, value = payload
+            start = time.perf_counter()
+            time.sleep(delay)
+            if i == fail_on:
+                raise RuntimeError(f"{name} failed")
+            with self.lock:
+                self.spans[(name, i)] = (start, time.perf_counter())
+            return i, value * 2 + 1
+        return Stage(name, fn)
+
+
+def _corpora(root: Path) -> list:
+    texts = {
+        "alpha": ["field geometry and structure", "structure of the field graph"],
+        "beta": ["entropy of a diagnostic run", "runs are diagnostic only"],
+        "gamma": ["coherence across corpora", "corpora load while others embed"],
+    }
+    dirs = []
+    for name, docs in texts.items():
+        d = root / name
+        d.mkdir()
+        for j, text in enumerate(docs):
+            (d / f"doc_{j}.md").write_text(text * 20, encoding="utf-8")
+        dirs.append(hil_build.directory_corpus(d))
+    return dirs
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_pipeline_matches_sequential_and_overlaps():
+    spans = _Spans()
+    stages = [spans.stage("a", 0.05), spans.stage("b", 0.05), spans.stage("c", 0.05)]
+    items = [(i, i) for i in range(4)]
+
+    piped = run_pipeline(items, stages, queue_depth=1)
+    reference = run_pipeline(items, [_Spans().stage(s.name, 0.0) for s in stages], sequential=True)
+    assert piped.outputs == reference.outputs
+    assert [o[0] for o in piped.outputs] == list(range(4))
+    assert not piped.errors
+
+    # Item 1 entered stage a before item 0 left stage c.
+    assert spans.spans[("a", 1)][0] < spans.spans[("c", 0)][1]
+
+    stats = piped.stats.to_dict()
+    assert stats["mode"] == "pipelined"
+    assert [s["items"] for s in stats["stages"]] == [4, 4, 4]
+    assert all(0.0 < s["occupancy"] <= 1.0 for s in stats["stages"])
+    assert all(s["queue_depth_max"] <= 1 for s in stats["stages"])
+    json.dumps(stats)
+
+
+def test_failure_is_per_item():
+    spans = _Spans()
+    stages = [spans.stage("a", 0.0), spans.stage("b", 0.0, fail_on=2), spans.stage("c", 0.0)]
+    result = run_pipeline([(i, i) for i in range(4)], stages)
+
+    assert result.outputs[2] is None
+    assert result.errors == {2: ("b", "RuntimeError: b failed")}
+    assert all(result.outputs[i] is not None for i in (0, 1, 3))
+    assert ("c", 2) not in spans.spans
+
+
+def test_invalid_pipeline_is_rejected():
+    with pytest.raises(ValueError):
+        run_pipeline([1], [])
+    with pytest.raises(ValueError):
+        run_pipeline([1], [Stage("a", abs), Stage("a", abs)])
+    with pytest.raises(ValueError):
+        run_pipeline([1], [Stage("a", abs)], queue_depth=0)
+
+
+def test_batch_build_matches_sequential(tmp_path):
+    corpora = _corpora(tmp_path / "corpora")
+
+    piped = hil_build.run_batch(corpora, tmp_path / "piped", cache_root=None)
+    reference = hil_build.run_batch(corpora, tmp_path / "seq", cache_root=None, sequential=True)
+
+    assert all(r["success"] for r in piped["runs"])
+    assert [r["run_directory"] for r in piped["runs"]] == [
+        r["run_directory"] for r in reference["runs"]
+    ]
+    for r in piped["runs"]:
+        a, b = tmp_path / "piped" / r["run_directory"], tmp_path / "seq" / r["run_directory"]
+        for name in ("METRICS.json", "FIELD_SUMMARY.json", "GRAPH_SUMMARY.json",
+                     "INPUT_MANIFEST.json", "CONFIG_SNAPSHOT.json", hil_build.ARTIFACT_NAME):
+            assert (a / name).read_bytes() == (b / name).read_bytes(), name
+
+    stats = piped["pipeline"]
+    assert stats["mode"] == "pipelined"
+    assert [s["name"] for s in stats["stages"]] == [
+        "open", "embed", "structure", "diagnostics", "write"
+    ]
+    assert all(s["items"] == len(corpora) for s in stats["stages"])
+    on_disk = json.loads((tmp_path / "piped" / hil_build.BATCH_MANIFEST_NAME).read_text())
+    assert on_disk["pipeline"]["stages"] == stats["stages"]
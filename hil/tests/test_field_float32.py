@@ -0,0 +1,84 @@
+# hil/tests/test_field_float32.py
+"""
+float32 field storage test.
+
+Purpose:
+- Verify float32 fields build float32-weighted graphs
+- Verify diagnostics of a float32 field match the float64 field holding the
+  same (widened) values within tolerance, dense and sparse
+
+This test does NOT:
+- interpret entropy or coherence values
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import (  # noqa: E402
+    CoreEmbedding,
+    build_field,
+    build_structure,
+    build_structure_csr,
+    compute_diagnostics,
+)
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.core.structure.graph import CSRGraph  # noqa: E402
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+def _fields():
+    rng = np.random.default_rng(0)
+    X = rng.standard_normal((48, 12)).astype(np.float32).astype(np.float64) + 0.3
+    emb = CoreEmbedding(vectors=X, vocabulary={})
+    return build_field(emb), build_field(emb, dtype="float32")
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_float32_field_matches_float64_dense():
+    """
+    Complete graph: float32 weights, diagnostics within float32 rounding.
+    """
+    f64, f32 = _fields()
+    assert f32.vectors.dtype == np.float32
+
+    g64 = build_structure(f64)
+    g32 = build_structure(f32)
+    assert g32.weight.dtype == np.float32
+    assert np.array_equal(g32.src, g64.src) and np.array_equal(g32.dst, g64.dst)
+    assert np.allclose(g32.weight, g64.weight, rtol=0.0, atol=1e-6)
+
+    d64 = compute_diagnostics(f64, g64)
+    d32 = compute_diagnostics(f32, g32)
+    assert abs(d32["entropy"] - d64["entropy"]) < 1e-6
+    assert abs(d32["coherence"] - d64["coherence"]) < 1e-12
+
+
+def test_float32_field_matches_float64_sparse():
+    """
+    kNN CSR graph: same neighbours, float32 weights, entropy within rounding.
+    """
+    f64, f32 = _fields()
+
+    c64 = build_structure_csr(f64, k=5)
+    c32 = build_structure_csr(f32, k=5)
+    assert c32.weight.dtype == np.float32
+    assert np.array_equal(c32.offsets, c64.offsets)
+    assert np.array_equal(c32.indices, c64.indices)
+    assert np.allclose(c32.weight, c64.weight, rtol=0.0, atol=1e-6)
+    assert abs(structural_entropy(c32) - structural_entropy(c64)) < 1e-6
+
+    adj = CSRGraph.from_graph(build_structure(f32))
+    assert adj.weight.dtype == np.float32
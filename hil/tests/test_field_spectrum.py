@@ -0,0 +1,129 @@
+# hil/tests/test_field_spectrum.py
+"""
+Top-k field spectrum test: matrix-free Lanczos against dense eigh.
+
+Purpose:
+- Verify field_spectrum's leading Gram / covariance eigenpairs match
+  spectrum() of the dense matrix, with the documented sign convention
+- Verify the native solver is deterministic and honours a start vector
+- Verify field_spectral_energy (trace and leading k) and spectral_potential
+  agree with their dense definitions
+
+This test does NOT:
+- assert timings or memory use
+- test fields large enough to need the matrix-free path
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.field.field import build_field_from_elements  # noqa: E402
+from hil.core.field.operators import (  # noqa: E402
+    covariance_matrix,
+    field_spectral_energy,
+    field_spectrum,
+    gram_matrix,
+    spectrum,
+)
+from hil.core.field.potential import field_potential, spectral_potential  # noqa: E402
+from hil.core.structure.element import Element  # noqa: E402
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+@pytest.fixture
+def field():
+    # Three dominant directions over isotropic noise: a clear spectral gap.
+    rng = np.random.default_rng(0)
+    basis = np.linalg.qr(rng.standard_normal((24, 3)))[0].T
+    coeffs = rng.standard_normal((150, 3)) * np.array([6.0, 4.0, 2.5])
+    return coeffs @ basis + 0.1 * rng.standard_normal((150, 24)) + 0.5
+
+
+def _dense(mat, operator, k):
+    op = covariance_matrix(mat) if operator == "covariance" else gram_matrix(mat)
+    vals, vecs = spectrum(op)
+    return vals[:k], vecs[:, :k]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+@pytest.mark.parametrize("operator", ["gram", "covariance"])
+def test_leading_pairs_match_dense(field, operator):
+    k = 5
+    vals, vecs = field_spectrum(field, k, operator=operator)
+    ref_vals, ref_vecs = _dense(field, operator, k)
+
+    assert vals.shape == (k,) and vecs.shape == (ref_vecs.shape[0], k)
+    assert np.allclose(vals, ref_vals, rtol=1e-9, atol=1e-9 * ref_vals[0])
+    # Eigenvectors agree up to sign; the returned sign is canonical.
+    assert np.allclose(np.abs(np.sum(vecs * ref_vecs, axis=0)), 1.0, atol=1e-6)
+    arg = np.argmax(np.abs(vecs), axis=0)
+    assert np.all(vecs[arg, np.arange(k)] > 0.0)
+
+
+def test_native_solver_is_deterministic(field):
+    _shim = _require_native()
+    a = _shim.field_spectrum(field, 4)
+    b = _shim.field_spectrum(field, 4)
+    assert np.array_equal(a[0], b[0]) and np.array_equal(a[1], b[1])
+    assert a[2]["converged"] == 4
+    assert a[2]["matvecs"] < field.shape[0]
+
+    start = np.random.default_rng(1).standard_normal(field.shape[0])
+    c = _shim.field_spectrum(field, 4, start=start)
+    assert np.allclose(c[0], a[0], rtol=1e-9)
+    assert np.array_equal(c[0], _shim.field_spectrum(field, 4, start=start)[0])
+
+    with pytest.raises(ValueError):
+        _shim.field_spectrum(field, 4, start=np.ones(3))
+    with pytest.raises(RuntimeError):
+        _shim.field_spectrum(field, 4, start=np.zeros(field.shape[0]))
+
+
+def test_rank_deficient_gram(field):
+    # n > d: the Gram has at most d non-zero eigenvalues.
+    k = field.shape[1] + 2
+    vals, vecs = field_spectrum(field, k)
+    ref_vals, _ = _dense(field, "gram", k)
+    assert np.allclose(vals, ref_vals, atol=1e-8 * ref_vals[0])
+    assert np.allclose(vecs.T @ vecs, np.eye(k), atol=1e-8)
+
+
+def test_spectral_energy_and_potential(field):
+    for operator in ("gram", "covariance"):
+        op = covariance_matrix(field) if operator == "covariance" else gram_matrix(field)
+        total = float(np.trace(op))
+        assert field_spectral_energy(field, operator=operator) == pytest.approx(total, rel=1e-12)
+        lead = float(np.sum(_dense(field, operator, 3)[0]))
+        assert field_spectral_energy(field, operator=operator, k=3) == pytest.approx(lead, rel=1e-9)
+
+    f = build_field_from_elements(
+        Element(element_id=f"e{i}", vector=row) for i, row in enumerate(field)
+    )
+    V = field_potential(f)
+    V3 = spectral_potential(f, 3)
+    assert V3 == pytest.approx(float(np.sum(_dense(field, "covariance", 3)[0])), rel=1e-9)
+    assert 0.0 <= V3 <= V
+    assert spectral_potential(f, field.shape[1]) == pytest.approx(V, rel=1e-9)
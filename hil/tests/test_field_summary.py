@@ -0,0 +1,66 @@
+# hil/tests/test_field_summary.py
+"""
+Fused field summary test: one native pass against the separate metrics.
+
+Purpose:
+- Verify field_summary's coherence equals field_coherence, and its row
+  norms, mean norm and centroid norm equal NumPy's, for float64 and
+  float32 fields, row-strided views and fields with zero rows
+
+This test does NOT:
+- interpret coherence values
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.metrics.coherence import field_coherence  # noqa: E402
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _fields(dtype) -> list[np.ndarray]:
+    rng = np.random.default_rng(9)
+    base = (rng.standard_normal((41, 12)) + 0.4).astype(dtype)
+    zeros = base[:10].copy()
+    zeros[[2, 7]] = 0.0
+    return [base, base[::3], base[:, 2:9], zeros, base[:1]]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+def test_summary_matches_separate_metrics(dtype):
+    _shim = _require_native()
+    for X in _fields(dtype):
+        summary = _shim.field_summary(X, return_row_norms=True)
+        X64 = X.astype(np.float64)
+        norms = np.linalg.norm(X64, axis=1)
+
+        assert summary["coherence"] == pytest.approx(field_coherence(X), abs=1e-12)
+        assert np.allclose(summary["row_norms"], norms, rtol=1e-14, atol=0.0)
+        assert summary["mean_norm"] == pytest.approx(float(norms.mean()), rel=1e-13)
+        assert summary["centroid_norm"] == pytest.approx(
+            float(np.linalg.norm(X64.mean(axis=0))), rel=1e-12
+        )
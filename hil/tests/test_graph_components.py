@@ -0,0 +1,117 @@
+# hil/tests/test_graph_components.py
+"""
+Connected components test: native union-find labels and sizes.
+
+Purpose:
+- Verify graph_components labels are min-root canonical: dense, numbered in
+  order of each component's smallest node, equal to a reference union-find
+- Verify sizes sum to num_nodes and count each label
+- Verify labels and sizes do not depend on the native thread count
+
+This test does NOT:
+- interpret component structure
+"""
+
+from __future__ import annotations
+
+import os
+import subprocess
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _edges(n: int = 5000, m: int = 3500, seed: int = 7):
+    """Sparse random edges: many components of varied size, some isolated nodes."""
+    rng = np.random.default_rng(seed)
+    src = rng.integers(0, n, size=m).astype(np.uint32)
+    dst = rng.integers(0, n, size=m).astype(np.uint32)
+    return n, src, dst, np.ones(m, dtype=np.float64)
+
+
+def _reference_labels(n: int, src: np.ndarray, dst: np.ndarray) -> np.ndarray:
+    parent = list(range(n))
+
+    def find(a: int) -> int:
+        while parent[a] != a:
+            parent[a] = parent[parent[a]]
+            a = parent[a]
+        return a
+
+    for s, d in zip(src.tolist(), dst.tolist()):
+        a, b = find(s), find(d)
+        if a != b:
+            parent[max(a, b)] = min(a, b)
+
+    labels = np.empty(n, dtype=np.int64)
+    first: dict[int, int] = {}
+    for i in range(n):
+        labels[i] = first.setdefault(find(i), len(first))
+    return labels
+
+
+_CHILD = """
+import sys
+import numpy as np
+from hil.core.native._shim import graph_components
+n, path = int(sys.argv[1]), sys.argv[2]
+e = np.load(path)
+_, labels, sizes = graph_components(e[0], e[1], np.ones(e.shape[1]), n)
+np.save(path.replace("edges", "labels"), labels)
+np.save(path.replace("edges", "sizes"), sizes)
+"""
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_labels_are_min_root_canonical():
+    _shim = _require_native()
+    n, src, dst, w = _edges()
+    count, labels, sizes = _shim.graph_components(src, dst, w, n)
+
+    ref = _reference_labels(n, src, dst)
+    assert count == int(ref.max()) + 1
+    assert np.array_equal(labels.astype(np.int64), ref)
+
+    # The smallest node of each component carries the next label in order.
+    _, first = np.unique(labels, return_index=True)
+    assert np.all(np.diff(first) > 0)
+
+    assert sizes.size == count
+    assert int(sizes.sum()) == n
+    assert np.array_equal(sizes, np.bincount(labels, minlength=count).astype(np.uint64))
+
+
+@pytest.mark.parametrize("threads", ["1", "4"])
+def test_labels_thread_count_independent(threads, tmp_path):
+    _shim = _require_native()
+    n, src, dst, w = _edges()
+    _, labels, sizes = _shim.graph_components(src, dst, w, n)
+
+    path = tmp_path / "edges.npy"
+    np.save(path, np.stack([src, dst]))
+    env = dict(os.environ, OMP_NUM_THREADS=threads, PYTHONPATH=str(REPO_ROOT))
+    subprocess.run([sys.executable, "-c", _CHILD, str(n), str(path)], env=env, check=True)
+
+    assert np.array_equal(np.load(tmp_path / "labels.npy"), labels)
+    assert np.array_equal(np.load(tmp_path / "sizes.npy"), sizes)
@@ -0,0 +1,94 @@
+# hil/tests/test_graph_metrics.py
+"""
+Fused graph metrics test: one native pass against the individual metrics.
+
+Purpose:
+- Verify graph_metrics' "out_entropy" is structural_entropy and its
+  "degree_entropy" is graph_entropy (both endpoints of every edge)
+- Verify density, total weight, mean degree and component count against
+  direct NumPy / union-find computations, for float64 and float32 weights
+
+This test does NOT:
+- interpret metric values
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure  # noqa: E402
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.core.structure.graph import Graph  # noqa: E402
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _component_count(graph: Graph) -> int:
+    parent = list(range(graph.num_nodes))
+
+    def find(a: int) -> int:
+        while parent[a] != a:
+            a = parent[a]
+        return a
+
+    for s, d in zip(graph.src.tolist(), graph.dst.tolist()):
+        parent[find(s)] = find(d)
+    return len({find(i) for i in range(graph.num_nodes)})
+
+
+def _graphs() -> list[Graph]:
+    rng = np.random.default_rng(4)
+    X = rng.standard_normal((20, 5))
+    forest = Graph(
+        src=np.array([0, 1, 2, 0, 4, 6], dtype=np.uint32),
+        dst=np.array([1, 2, 0, 0, 3, 5], dtype=np.uint32),
+        weight=np.array([0.5, 0.3, 0.9, 0.2, 0.4, 0.7]),
+        num_nodes=8,
+    )
+    return [
+        build_structure(CoreField(vectors=X)),
+        build_structure(CoreField(vectors=X), method="knn", k=3),
+        forest,
+    ]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+def test_metrics_match_individual_functions(dtype):
+    _shim = _require_native()
+    tol = 1e-12 if dtype is np.float64 else 1e-6
+
+    for graph in _graphs():
+        w = graph.weight.astype(dtype)
+        n, m = graph.num_nodes, graph.src.size
+        metrics = _shim.graph_metrics(graph.src, graph.dst, w, n)
+
+        assert metrics["out_entropy"] == pytest.approx(structural_entropy(graph), abs=tol)
+        assert metrics["degree_entropy"] == pytest.approx(
+            _shim.graph_entropy(graph.src, graph.dst, w, n), abs=tol
+        )
+        assert metrics["density"] == pytest.approx(min(m / (n * (n - 1) / 2), 1.0))
+        assert metrics["total_weight"] == pytest.approx(float(graph.weight.sum()), abs=tol)
+        assert metrics["mean_degree"] == pytest.approx(2.0 * float(graph.weight.sum()) / n, abs=tol)
+        assert metrics["components"] == _component_count(graph)
@@ -0,0 +1,129 @@
+# hil/tests/test_incremental_window.py
+"""
+Incremental sliding-window diagnostics test.
+
+Purpose:
+- Verify per-tick entropy and coherence match a from-scratch rebuild of
+  each window (complete and threshold structure)
+- Verify the engine only touches elements that entered or left the window
+
+This test does NOT:
+- compute or interpret regimes
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure, build_structure_csr  # noqa: E402
+from hil.core.incremental import IncrementalDiagnostics, sliding_diagnostics  # noqa: E402
+from hil.core.metrics.coherence import field_coherence  # noqa: E402
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+class _RowStream:
+    """Integer-anchored stream: slice(t, dt) is rows [t, t + dt)."""
+
+    def __init__(self, X: np.ndarray) -> None:
+        self.X = X
+
+    def times(self, dt):
+        return range(0, self.X.shape[0] - int(dt) + 1)
+
+    def slice(self, t, dt):
+        return [(i, self.X[i]) for i in range(t, t + int(dt))]
+
+    def is_valid_time(self, t):
+        return 0 <= t <= self.X.shape[0]
+
+
+def _reference_entropy_complete(X: np.ndarray) -> float:
+    # NumPy out-strength definition over the i < j edge list.
+    g = build_structure(CoreField(vectors=X))
+    out = np.bincount(g.src.astype(np.int64), weights=g.weight, minlength=g.num_nodes)
+    p = out[out > 0.0] / out.sum() if out.sum() > 0.0 else np.empty(0)
+    return float(-(p * np.log(p)).sum())
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_sliding_window_matches_rebuild():
+    """
+    Every tick of a 95%-overlap window equals diagnostics rebuilt from scratch.
+    """
+    rng = np.random.default_rng(0)
+    X = rng.standard_normal((60, 6))
+    dt = 20
+
+    ticks = list(sliding_diagnostics(stream=_RowStream(X), dt=dt, elements=lambda s: s))
+    assert len(ticks) == X.shape[0] - dt + 1
+
+    for tick in ticks:
+        W = X[tick.t:tick.t + dt]
+        assert tick.num_elements == dt
+        assert tick.coherence == pytest.approx(field_coherence(W), rel=1e-9, abs=1e-12)
+        assert tick.entropy == pytest.approx(_reference_entropy_complete(W), rel=1e-9)
+
+    assert (ticks[0].added, ticks[0].removed) == (dt, 0)
+    assert all((t.added, t.removed) == (1, 1) for t in ticks[1:])
+
+
+def test_threshold_window_entropy_and_components():
+    """
+    Threshold structure entropy and components track the sparse rebuild,
+    including after out-of-order removals and resync.
+    """
+    rng = np.random.default_rng(1)
+    X = rng.standard_normal((30, 4))
+    mw = 0.8
+
+    eng = IncrementalDiagnostics(method="threshold", min_weight=mw, capacity=4)
+    for i in range(20):
+        eng.add(i, X[i])
+    for i in (3, 11, 0):
+        eng.remove(i)
+    for i in range(20, 30):
+        eng.add(i, X[i])
+
+    keep = [i for i in range(30) if i not in (3, 11, 0)]
+    csr = build_structure_csr(CoreField(vectors=X[keep]), min_weight=mw)
+
+    assert eng.entropy() == pytest.approx(structural_entropy(csr), rel=1e-9)
+    assert eng.coherence() == pytest.approx(field_coherence(X[keep]), rel=1e-9, abs=1e-12)
+
+    labels_ref = _components_reference(csr)
+    assert eng.components() == labels_ref
+
+    eng.resync()
+    assert eng.entropy() == pytest.approx(structural_entropy(csr), rel=1e-12)
+    assert eng.components() == labels_ref
+
+
+def _components_reference(csr) -> int:
+    n = csr.num_nodes
+    parent = list(range(n))
+
+    def find(x):
+        while parent[x] != x:
+            x = parent[x]
+        return x
+
+    for i in range(n):
+        for k in range(int(csr.offsets[i]), int(csr.offsets[i + 1])):
+            a, b = find(i), find(int(csr.indices[k]))
+            if a != b:
+                parent[max(a, b)] = min(a, b)
+    return sum(1 for i in range(n) if find(i) == i)
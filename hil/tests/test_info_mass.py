@@ -12,6 +12,9 @@ from hil.extensions.thermo.info_mass import (
     informational_temperature,
     informational_free_energy,
     path_entropy,
+    InfoMassAccumulator,
+    ShannonFiberEntropy,
+    stream_info_mass,
 )
 
 
@@ -213,3 +216,54 @@ def test_free_energy_decreases_with_entropy():
     )
 
     assert F_low_H > F_high_H
+
+
+def test_streaming_matches_whole_path():
+    """
+    Chunked single-pass accumulation must reproduce the whole-path
+    quantities, for scalar and per-segment noise.
+    """
+    rng = np.random.default_rng(0)
+    points = np.cumsum(rng.standard_normal((101, 3)), axis=0)
+    path = make_path(points.tolist())
+    backend = ShannonFiberEntropy()
+    chunks = [points[i:i + 17] for i in range(0, 101, 17)]
+
+    acc = stream_info_mass(chunks, noise=2.0, alpha=0.5, entropy_backend=backend)
+    summ = acc.summary()
+    assert summ.anchors == 101 and summ.segments == 100
+    assert summ.arc_length == pytest.approx(float(path.ds.sum()), rel=1e-12)
+    assert summ.informational_mass == pytest.approx(
+        informational_mass(path=path, noise=2.0, alpha=0.5), rel=1e-12
+    )
+    assert summ.thresholded_arc_length == pytest.approx(
+        float(thresholded_increments(path=path, noise=2.0, alpha=0.5).sum()), rel=1e-12
+    )
+    assert summ.entropy == pytest.approx(
+        path_entropy(path=path, entropy_backend=backend), rel=1e-12
+    )
+
+    eps = rng.uniform(0.0, 0.5, size=100)
+    sizes = [len(c) - (i == 0) for i, c in enumerate(chunks)]
+    noise_chunks = np.split(eps, np.cumsum(sizes)[:-1])
+    acc = stream_info_mass(chunks, noise_chunks=noise_chunks)
+    assert acc.summary().informational_mass == pytest.approx(
+        informational_mass(path=path, noise=eps), rel=1e-12
+    )
+    report = acc.report(temperature_scale=2.0)
+    assert report["temperature"] == pytest.approx(
+        informational_temperature(noise=eps, scale=2.0), rel=1e-12
+    )
+
+
+def test_shannon_fiber_entropy_batch_matches_single():
+    backend = ShannonFiberEntropy()
+    sigmas = np.array([[1.0, 2.0, 3.0], [0.0, 0.0, 0.0], [-1.0, 1.0, -1.0]])
+    batch = backend.entropy_batch(sigmas)
+    assert batch[1] == 0.0
+    assert batch[2] == pytest.approx(np.log(3.0), rel=1e-12)
+    for i in range(3):
+        assert backend.entropy(sigmas[i]) == batch[i]
+
+    with pytest.raises(ValueError):
+        InfoMassAccumulator(noise=None).update(sigmas)
@@ -0,0 +1,131 @@
+# hil/tests/test_native_shim.py
+"""
+Native shim coercion test: zero-copy wrapping and the fallback contract.
+
+Purpose:
+- Verify _as_vector / _as_matrix wrap matching arrays in place (aliasing),
+  reinterpret non-negative int32 indices as uint32 views, and copy only
+  with copy=True
+- Verify inputs that would need a copy raise NativeCopyRequired (a
+  ValueError), including strided vectors and column-strided matrices
+- Verify inputs outside a kernel's domain raise NativeUnsupported, and
+  Stage C callers fall back to NumPy on NativeError only; other errors
+  propagate
+
+This test does NOT:
+- exercise the native kernels beyond one entropy call
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.core.structure.graph import Graph  # noqa: E402
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_vector_wrapped_in_place():
+    _shim = _require_native()
+    idx = np.arange(6, dtype=np.uint32)
+    assert _shim._as_vector(idx, np.uint32, "idx", False) is idx
+
+    signed = np.arange(6, dtype=np.int32)
+    view = _shim._as_vector(signed, np.uint32, "idx", False)
+    assert view.dtype == np.uint32
+    assert np.shares_memory(view, signed)
+    assert np.array_equal(view, signed)
+
+
+def test_vector_copy_required():
+    _shim = _require_native()
+    w = np.linspace(0.0, 1.0, 8)
+
+    with pytest.raises(_shim.NativeCopyRequired):
+        _shim._as_vector(w[::2], np.float64, "w", False)
+    with pytest.raises(_shim.NativeCopyRequired):
+        _shim._as_vector(w.astype(np.float32), np.float64, "w", False)
+    with pytest.raises(ValueError):
+        _shim._as_vector(w[::2], np.float64, "w", False)
+
+    copied = _shim._as_vector(w[::2], np.float64, "w", True)
+    assert copied.flags["C_CONTIGUOUS"]
+    assert not np.shares_memory(copied, w)
+    assert np.array_equal(copied, w[::2])
+
+
+def test_negative_indices_rejected():
+    _shim = _require_native()
+    with pytest.raises(ValueError, match="non-negative"):
+        _shim._as_vector(np.array([0, -1], dtype=np.int32), np.uint32, "idx", False)
+
+
+def test_matrix_strided_rows_in_place():
+    _shim = _require_native()
+    X = np.arange(24, dtype=np.float64).reshape(6, 4)
+
+    rows = X[::2]
+    assert _shim._as_matrix(rows, "X", False) is rows
+    assert np.shares_memory(_shim._as_matrix(X[:, 1:3], "X", False), X)
+
+    with pytest.raises(_shim.NativeCopyRequired):
+        _shim._as_matrix(X[:, ::2], "X", False)
+    assert np.array_equal(_shim._as_matrix(X[:, ::2], "X", True), X[:, ::2])
+
+
+def test_unsupported_input_falls_back():
+    _shim = _require_native()
+    with pytest.raises(_shim.NativeUnsupported):
+        _shim.graph_out_entropy(
+            np.zeros(0, dtype=np.uint32),
+            np.zeros(0, dtype=np.uint32),
+            np.zeros(0),
+            0,
+        )
+    assert issubclass(_shim.NativeUnsupported, ValueError)
+    assert issubclass(_shim.NativeUnsupported, _shim.NativeError)
+
+
+def test_callers_fall_back_only_on_native_errors(monkeypatch):
+    _shim = _require_native()
+    graph = Graph(
+        src=np.array([0, 1, 2], dtype=np.int64),
+        dst=np.array([1, 2, 0], dtype=np.int64),
+        weight=np.array([0.2, 0.3, 0.5]),
+        num_nodes=3,
+    )
+    p = np.array([0.2, 0.3, 0.5])
+    expected = float(-(p * np.log(p)).sum())
+
+    # int64 indices cannot be wrapped as uint32: NumPy answers.
+    assert structural_entropy(graph) == pytest.approx(expected, abs=1e-12)
+
+    def _broken(*args, **kwargs):
+        raise TypeError("not a native failure")
+
+    monkeypatch.setattr(_shim, "graph_out_entropy", _broken)
+    with pytest.raises(TypeError):
+        structural_entropy(graph)
@@ -0,0 +1,149 @@
+# hil/tests/test_native_stats.py
+"""
+Native instrumentation test: kernel counters and NATIVE_STATS.json.
+
+Purpose:
+- Verify native_stats reports enabled=False and no kernels when the
+  extension was built without -DHIL_STATS
+- Verify that with -DHIL_STATS a kernel call raises its calls and items
+  counters, and reset=True zeroes them
+- Verify write_native_stats writes the record it returns, for a live
+  snapshot, an explicit one, and an unavailable extension
+
+The with/without HIL_STATS tests each skip on the other build.
+
+This test does NOT:
+- check timing values beyond their sign
+"""
+
+from __future__ import annotations
+
+import json
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.observe.state_writer import (  # noqa: E402
+    STATS_NAME,
+    native_stats_record,
+    native_stats_snapshot,
+    write_native_stats,
+)
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _entropy_call(_shim) -> int:
+    """One graph_entropy call; returns its edge count."""
+    src = np.array([0, 1, 2, 3], dtype=np.uint32)
+    dst = np.array([1, 2, 3, 0], dtype=np.uint32)
+    _shim.graph_entropy(src, dst, np.array([0.1, 0.2, 0.3, 0.4]), 4)
+    return src.size
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_stats_disabled_build():
+    _shim = _require_native()
+    if _shim.native_stats()["enabled"]:
+        pytest.skip("extension built with HIL_STATS")
+
+    _entropy_call(_shim)
+    assert _shim.native_stats() == {"enabled": False, "kernels": {}}
+
+    record = native_stats_record(_shim.native_stats(), wall_seconds=0.5)
+    assert record["available"] is True
+    assert record["enabled"] is False
+    assert record["kernels"] == {}
+    assert record["native_nanoseconds"] == 0
+    assert record["python_nanoseconds"] == record["wall_nanoseconds"] == 500_000_000
+
+
+def test_stats_enabled_build_counts_calls():
+    _shim = _require_native()
+    if not _shim.native_stats(reset=True)["enabled"]:
+        pytest.skip("extension built without HIL_STATS")
+
+    zeroed = _shim.native_stats()["kernels"]["graph_entropy"]
+    assert zeroed == {"calls": 0, "nanoseconds": 0, "bytes": 0, "items": 0}
+
+    edges = _entropy_call(_shim)
+    _entropy_call(_shim)
+    entry = _shim.native_stats(reset=True)["kernels"]["graph_entropy"]
+    assert entry["calls"] == 2
+    assert entry["items"] == 2 * edges
+    assert entry["nanoseconds"] >= 0
+
+    assert _shim.native_stats()["kernels"]["graph_entropy"]["calls"] == 0
+
+
+def test_write_native_stats_live_snapshot(tmp_path):
+    _shim = _require_native()
+    _shim.native_stats(reset=True)
+    _entropy_call(_shim)
+
+    record = write_native_stats(tmp_path, wall_seconds=10.0)
+    assert json.loads((tmp_path / STATS_NAME).read_text(encoding="utf-8")) == record
+    assert record["available"] is True
+    assert record["enabled"] is _shim.native_stats()["enabled"]
+    if record["enabled"]:
+        assert record["kernels"]["graph_entropy"]["calls"] == 1
+        assert record["native_nanoseconds"] == sum(
+            k["nanoseconds"] for k in record["kernels"].values()
+        )
+    else:
+        assert record["kernels"] == {}
+    assert record["python_nanoseconds"] == max(
+        0, record["wall_nanoseconds"] - record["native_nanoseconds"]
+    )
+
+
+def test_write_native_stats_explicit_snapshot(tmp_path):
+    stats = {
+        "enabled": True,
+        "kernels": {
+            "graph_entropy": {"calls": 3, "nanoseconds": 700, "bytes": 64, "items": 12},
+            "graph_metrics": {"calls": 1, "nanoseconds": 400, "bytes": 0, "items": 4},
+        },
+    }
+    record = write_native_stats(tmp_path, wall_seconds=1e-6, stats=stats)
+    assert json.loads((tmp_path / STATS_NAME).read_text(encoding="utf-8")) == record
+    assert record["kernels"] == stats["kernels"]
+    assert record["wall_nanoseconds"] == 1000
+    assert record["native_nanoseconds"] == 1100
+    assert record["python_nanoseconds"] == 0
+
+
+def test_write_native_stats_unavailable(tmp_path, monkeypatch):
+    _shim = _require_native()
+
+    def _unavailable(*args, **kwargs):
+        raise _shim.NativeUnavailable("forced unavailable")
+
+    monkeypatch.setattr(_shim, "native_stats", _unavailable)
+    assert native_stats_snapshot() is None
+
+    record = write_native_stats(tmp_path, wall_seconds=2.0)
+    assert json.loads((tmp_path / STATS_NAME).read_text(encoding="utf-8")) == record
+    assert record["available"] is False
+    assert record["enabled"] is False
+    assert record["kernels"] == {}
+    assert record["python_nanoseconds"] == 2_000_000_000
@@ -0,0 +1,124 @@
+# hil/tests/test_orchestrator_runner.py
+"""
+Orchestrator DAG runner test.
+
+Purpose:
+- Verify independent steps run concurrently on the worker pool
+- Verify depends_on orders execution and each step gets its own run directory
+- Verify a failure stops further steps and is recorded
+- Verify concurrent builds split the cores between their OpenMP threads
+- Verify invalid (cyclic / unknown) dependencies are rejected
+
+The build entrypoint is replaced by a stub so no pipeline runs.
+
+This test does NOT:
+- run hil_build or inspect artifacts
+"""
+
+from __future__ import annotations
+
+import sys
+import threading
+import time
+from pathlib import Path
+
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.orchestrator import runner  # noqa: E402
+from hil.orchestrator.plans import Plan, PlanStep  # noqa: E402
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+class _StubBuild:
+    """Records (start, end) per run directory; fails for names in fail."""
+
+    def __init__(self, delay: float, fail: tuple = ()) -> None:
+        self.delay = delay
+        self.fail = fail
+        self.spans: dict = {}
+        self.threads: dict = {}
+        self.lock = threading.Lock()
+
+    def __call__(self, build: str, run_dir: Path, threads=None) -> None:
+        start = time.perf_counter()
+        time.sleep(self.delay)
+        if any(run_dir.name.endswith(name) for name in self.fail):
+            raise RuntimeError("stub failure")
+        run_dir.mkdir(parents=True)
+        with self.lock:
+            self.spans[run_dir.name] = (start, time.perf_counter())
+            self.threads[run_dir.name] = threads
+
+
+def _step(step_id: str, *deps: str) -> PlanStep:
+    return PlanStep(build="hil_build", input="self", step_id=step_id, depends_on=list(deps))
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_independent_steps_overlap_and_dependencies_order(tmp_path, monkeypatch):
+    (tmp_path / "artifacts" / "runs").mkdir(parents=True)
+    stub = _StubBuild(delay=0.2)
+    monkeypatch.setattr(runner, "_invoke_build", stub)
+
+    plan = Plan(name="dag", steps=[_step("a"), _step("b"), _step("c"), _step("d", "a", "b")])
+    record = runner.run_plan(plan, repo_root=tmp_path, max_workers=3)
+
+    assert record.success
+    assert [s.step_id for s in record.steps] == ["a", "b", "c", "d"]
+    dirs = {s.step_id: Path(s.run_directory).name for s in record.steps}
+    assert len(set(dirs.values())) == 4
+
+    spans = {k: stub.spans[v] for k, v in dirs.items()}
+    # a, b, c start together; d starts after both a and b end.
+    assert max(spans[k][0] for k in "abc") < min(spans[k][1] for k in "abc")
+    assert spans["d"][0] >= max(spans["a"][1], spans["b"][1])
+    assert record.wall_seconds < sum(s.duration_seconds for s in record.steps)
+
+
+def test_failure_stops_dependents(tmp_path, monkeypatch):
+    (tmp_path / "artifacts" / "runs").mkdir(parents=True)
+    monkeypatch.setattr(runner, "_invoke_build", _StubBuild(delay=0.0, fail=("_a",)))
+
+    plan = Plan(name="dag", steps=[_step("a"), _step("b", "a")])
+    record = runner.run_plan(plan, repo_root=tmp_path, max_workers=2)
+
+    assert not record.success
+    assert [s.step_id for s in record.steps] == ["a"]
+    assert record.steps[0].error == "stub failure"
+    assert record.metadata["steps_not_run"] == ["b"]
+
+
+def test_builds_split_openmp_threads(tmp_path, monkeypatch):
+    (tmp_path / "artifacts" / "runs").mkdir(parents=True)
+    monkeypatch.setattr(runner.os, "cpu_count", lambda: 8)
+    monkeypatch.delenv("OMP_NUM_THREADS", raising=False)
+    plan = Plan(name="dag", steps=[_step("a"), _step("b"), _step("c")])
+
+    stub = _StubBuild(delay=0.0)
+    monkeypatch.setattr(runner, "_invoke_build", stub)
+    record = runner.run_plan(plan, repo_root=tmp_path, max_workers=3)
+    assert set(stub.threads.values()) == {2}
+    assert record.metadata["threads_per_step"] == 2
+
+    # An explicit OMP_NUM_THREADS is passed through untouched.
+    monkeypatch.setenv("OMP_NUM_THREADS", "5")
+    stub = _StubBuild(delay=0.0)
+    monkeypatch.setattr(runner, "_invoke_build", stub)
+    runner.run_plan(Plan(name="env", steps=plan.steps), repo_root=tmp_path, max_workers=1)
+    assert set(stub.threads.values()) == {None}
+
+
+def test_invalid_dependencies_rejected():
+    with pytest.raises(ValueError):
+        Plan(name="cycle", steps=[_step("a", "b"), _step("b", "a")])
+    with pytest.raises(ValueError):
+        Plan(name="unknown", steps=[_step("a", "missing")])
@@ -0,0 +1,153 @@
+# hil/tests/test_packed_graph.py
+"""
+Packed graph test: 16-bit weights and delta-varint neighbour lists.
+
+Purpose:
+- Verify packing round-trips indices exactly and weights to within half a
+  quantization step, with rows sorted by index
+- Verify the NumPy and native packers produce the same stream
+- Verify packed entropy stays within the documented error bound and packed
+  degree / component counts match the CSR diagnostics
+- Verify the packed form is several times smaller than the CSR arrays
+
+This test does NOT:
+- assert timings
+- test weights outside [0, 1] beyond rejection
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure_csr  # noqa: E402
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.core.structure.graph import (  # noqa: E402
+    PACKED_WEIGHT_SCALE,
+    CSRGraph,
+    PackedCSRGraph,
+)
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _sorted_rows(graph):
+    rows = np.repeat(np.arange(graph.num_nodes), np.diff(graph.offsets.astype(np.int64)))
+    # Duplicate neighbours sort by weight, as the packer sorts them by q.
+    order = np.lexsort((graph.weight, graph.indices, rows))
+    return graph.indices[order], graph.weight[order]
+
+
+@pytest.fixture
+def knn():
+    rng = np.random.default_rng(0)
+    a = rng.standard_normal((60, 8)) * 0.3 + 2.0
+    b = rng.standard_normal((40, 8)) * 0.3 - 2.0
+    return build_structure_csr(CoreField(vectors=np.vstack([a, b])), k=6, min_weight=0.0)
+
+
+@pytest.fixture
+def wide():
+    # Row gaps spanning one- to three-byte varints.
+    rng = np.random.default_rng(1)
+    n = 40000
+    rows = np.sort(rng.integers(0, n, size=3000))
+    counts = np.bincount(rows, minlength=n)
+    offsets = np.zeros(n + 1, dtype=np.uint64)
+    offsets[1:] = np.cumsum(counts)
+    indices = rng.integers(0, n, size=rows.size).astype(np.uint32)
+    weight = rng.random(rows.size)
+    return CSRGraph(offsets=offsets, indices=indices, weight=weight, num_nodes=n)
+
+
+# ---- Tests -----------------------------------------------------------------
+
+@pytest.mark.parametrize("name", ["knn", "wide"])
+def test_round_trip(request, name):
+    graph = request.getfixturevalue(name)
+    packed = PackedCSRGraph.from_csr(graph)
+    back = packed.to_csr()
+
+    assert back.num_edges == graph.num_edges == packed.num_edges
+    assert np.array_equal(back.offsets, graph.offsets)
+
+    indices, weight = _sorted_rows(graph)
+    assert np.array_equal(back.indices, indices)
+    assert np.max(np.abs(back.weight - weight)) <= 0.5 / PACKED_WEIGHT_SCALE + 1e-15
+
+
+def test_native_stream_matches_numpy(knn, wide, monkeypatch):
+    _shim = _require_native()
+    native = [PackedCSRGraph.from_csr(g) for g in (knn, wide)]
+
+    def _unavailable(*args, **kwargs):
+        raise _shim.NativeUnavailable("forced NumPy path")
+
+    monkeypatch.setattr(_shim, "graph_pack_csr", _unavailable)
+    for graph, want in zip((knn, wide), native):
+        got = PackedCSRGraph.from_csr(graph)
+        assert np.array_equal(got.offsets, want.offsets)
+        assert np.array_equal(got.stream, want.stream)
+
+
+@pytest.mark.parametrize("name", ["knn", "wide"])
+def test_entropy_within_bound(request, name):
+    graph = request.getfixturevalue(name)
+    packed = PackedCSRGraph.from_csr(graph)
+
+    bound = packed.entropy_error_bound()
+    assert 0.0 < bound < 1e-3
+    assert abs(structural_entropy(packed) - structural_entropy(graph)) <= bound
+
+    counts = np.diff(graph.offsets.astype(np.int64))
+    step = counts * (0.5 / PACKED_WEIGHT_SCALE) + 1e-12
+    assert np.all(np.abs(packed.out_strength() - graph.out_strength()) <= step)
+
+
+def test_native_components_match_csr(knn):
+    _shim = _require_native()
+    packed = PackedCSRGraph.from_csr(knn)
+    want = _shim.graph_connected_components_csr(
+        knn.offsets, knn.indices, knn.weight, knn.num_nodes
+    )
+    got = _shim.graph_connected_components_packed(
+        packed.offsets, packed.stream, packed.num_nodes, packed.num_edges
+    )
+    assert got == want >= 2
+
+
+def test_packed_is_smaller(knn):
+    packed = PackedCSRGraph.from_csr(knn)
+    csr_bytes = knn.offsets.nbytes + knn.num_edges * (4 + 8)
+    assert packed.nbytes * 3 <= csr_bytes
+
+
+def test_rejects_weights_outside_unit_interval(knn):
+    bad = CSRGraph(
+        offsets=knn.offsets,
+        indices=knn.indices,
+        weight=knn.weight * 2.0,
+        num_nodes=knn.num_nodes,
+        symmetric=knn.symmetric,
+    )
+    with pytest.raises(ValueError):
+        PackedCSRGraph.from_csr(bad)
@@ -0,0 +1,167 @@
+# hil/tests/test_sharded_structure.py
+"""
+Sharded structure test: row-sharded construction against a single node.
+
+Purpose:
+- Verify the assembled shard rows equal build_structure_csr (kNN, threshold
+  and unfiltered) for several shard counts, including empty shards
+- Verify the merged entropy, coherence and component count match the
+  single-node diagnostics
+- Verify the collective driver agrees with the serial simulation when the
+  shards run concurrently over an in-process communicator
+
+This test does NOT:
+- require MPI
+- assert timings
+"""
+
+from __future__ import annotations
+
+import sys
+import threading
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure_csr  # noqa: E402
+from hil.core.metrics.coherence import field_coherence  # noqa: E402
+from hil.core.metrics.entropy import structural_entropy  # noqa: E402
+from hil.core.sharded import (  # noqa: E402
+    SerialComm,
+    assemble_csr,
+    shard_ranges,
+    sharded_structure,
+    simulate_sharded_structure,
+)
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+class _ThreadComm:
+    """One rank of an in-process communicator; ranks run on threads."""
+
+    def __init__(self, rank, size, slots, barrier):
+        self.rank = rank
+        self.size = size
+        self._slots = slots
+        self._barrier = barrier
+
+    def bcast(self, obj, root=0):
+        if self.rank == root:
+            self._slots[root] = obj
+        self._barrier.wait()
+        out = self._slots[root]
+        self._barrier.wait()
+        return out
+
+    def allgather(self, obj):
+        self._slots[self.rank] = obj
+        self._barrier.wait()
+        out = list(self._slots)
+        self._barrier.wait()
+        return out
+
+
+def _components(graph):
+    parent = list(range(graph.num_nodes))
+
+    def find(x):
+        while parent[x] != x:
+            parent[x] = parent[parent[x]]
+            x = parent[x]
+        return x
+
+    for i in range(graph.num_nodes):
+        for j in graph.indices[graph.offsets[i]:graph.offsets[i + 1]]:
+            a, b = find(i), find(int(j))
+            if a != b:
+                parent[max(a, b)] = min(a, b)
+    return sum(1 for i in range(graph.num_nodes) if find(i) == i)
+
+
+@pytest.fixture
+def field():
+    rng = np.random.default_rng(0)
+    # Two separated clusters, so thresholded structure has several components.
+    a = rng.standard_normal((30, 6)) * 0.3 + 2.0
+    b = rng.standard_normal((25, 6)) * 0.3 - 2.0
+    return np.vstack([a, b])
+
+
+CASES = [
+    {"k": 4},
+    {"min_weight": 0.9},
+    {"k": 6, "min_weight": 0.8},
+    {},
+]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_shard_ranges_cover_rows():
+    assert shard_ranges(10, 3) == [(0, 4), (4, 7), (7, 10)]
+    assert shard_ranges(2, 4) == [(0, 1), (1, 2), (2, 2), (2, 2)]
+    with pytest.raises(ValueError):
+        shard_ranges(5, 0)
+
+
+@pytest.mark.parametrize("params", CASES)
+@pytest.mark.parametrize("shards", [1, 2, 3, 7, 60])
+def test_simulated_shards_match_single_node(field, params, shards):
+    ref = build_structure_csr(CoreField(vectors=field), **params)
+    parts = simulate_sharded_structure(field, shards, **params)
+    got = assemble_csr(parts)
+
+    assert np.array_equal(got.offsets, ref.offsets)
+    assert np.array_equal(got.indices, ref.indices)
+    assert np.allclose(got.weight, ref.weight, rtol=0, atol=1e-12)
+
+    for p in parts:
+        assert p.entropy == pytest.approx(structural_entropy(ref), abs=1e-10)
+        assert p.coherence == pytest.approx(field_coherence(field), abs=1e-12)
+        assert p.components == _components(ref)
+
+
+def test_serial_comm_is_one_shard(field):
+    single = sharded_structure(SerialComm(), field, k=5)
+    (sim,) = simulate_sharded_structure(field, 1, k=5)
+    assert np.array_equal(single.indices, sim.indices)
+    assert single.entropy == sim.entropy
+    assert single.coherence == sim.coherence
+    assert single.components == sim.components
+
+
+def test_collective_driver_matches_simulation(field):
+    size = 3
+    ranges = shard_ranges(field.shape[0], size)
+    slots = [None] * size
+    barrier = threading.Barrier(size)
+    out = [None] * size
+
+    def run(rank):
+        a, b = ranges[rank]
+        comm = _ThreadComm(rank, size, slots, barrier)
+        out[rank] = sharded_structure(comm, field[a:b], min_weight=0.9)
+
+    threads = [threading.Thread(target=run, args=(r,)) for r in range(size)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    sim = simulate_sharded_structure(field, size, min_weight=0.9)
+    for got, want in zip(out, sim):
+        assert (got.row_start, got.row_stop) == (want.row_start, want.row_stop)
+        assert np.array_equal(got.indices, want.indices)
+        assert np.array_equal(got.weight, want.weight)
+        assert got.entropy == want.entropy
+        assert got.coherence == want.coherence
+        assert got.components == want.components
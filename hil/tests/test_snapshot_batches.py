@@ -0,0 +1,145 @@
+# hil/tests/test_snapshot_batches.py
+"""
+Batched snapshot diagnostics test.
+
+Purpose:
+- Verify field_snapshot_summaries agrees for stacked and offset inputs and
+  matches per-snapshot coherence
+- Verify batch macrostate builders give the same path, data floor, noise
+  floor and resolution ratios as the per-slice builders
+- Verify macrostate_dispersion_batch matches macrostate_dispersion
+
+This test does NOT:
+- assert timings or native availability
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core import timebase  # noqa: E402
+from hil.core.metrics.coherence import field_coherence  # noqa: E402
+from hil.core.path_invariant import build_path  # noqa: E402
+
+
+# ---- Fixtures --------------------------------------------------------------
+
+class _FieldStream:
+    """Tick t is a block of rows of one field buffer."""
+
+    def __init__(self, X: np.ndarray, rows: int) -> None:
+        self.X = X
+        self.rows = rows
+        self.count = X.shape[0] // rows
+
+    def times(self, dt):
+        return list(range(self.count))
+
+    def slice(self, t, dt):
+        return self.X[int(t) * self.rows:(int(t) + 1) * self.rows]
+
+    def is_valid_time(self, t):
+        return isinstance(t, int) and 0 <= t < self.count
+
+    def is_valid_index(self, t):
+        return self.is_valid_time(int(t))
+
+
+def _single(slc):
+    return timebase.field_summary_macrostates([slc])[0]
+
+
+def _single_param(slc, params):
+    return _single(slc * params["scale"])
+
+
+def _batch_param(slices, params):
+    return timebase.field_summary_macrostates([s * params["scale"] for s in slices])
+
+
+GRID = [{"scale": 1.0}, {"scale": 1.1}, {"scale": 0.9}]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_field_snapshot_summaries_layouts_agree():
+    rng = np.random.default_rng(0)
+    stacked = rng.standard_normal((6, 8, 4)) + 0.5
+    flat = stacked.reshape(48, 4)
+    offsets = np.arange(7) * 8
+
+    a = timebase.field_snapshot_summaries(stacked)
+    b = timebase.field_snapshot_summaries(flat, offsets)
+    assert a.shape == (6, 3)
+    assert np.array_equal(a, b)
+    for t in range(6):
+        assert a[t, 2] == pytest.approx(field_coherence(stacked[t]), abs=1e-12)
+
+    with pytest.raises(ValueError):
+        timebase.field_snapshot_summaries(flat, [0, 8, 8, 48])
+
+
+def test_batch_builders_match_per_slice_builders():
+    rng = np.random.default_rng(1)
+    stream = _FieldStream(rng.standard_normal((80, 5)) + 0.3, rows=8)
+    slices = [stream.slice(t, 1) for t in range(stream.count)]
+
+    p1 = build_path(stream=stream, dt=1, build_macrostate=_single)
+    p2 = build_path(stream=stream, dt=1, build_macrostates=timebase.field_summary_macrostates)
+    assert p1.anchors == p2.anchors
+    assert np.allclose(p1.sigmas, p2.sigmas, rtol=0, atol=1e-12)
+    assert np.allclose(p1.s, p2.s, rtol=0, atol=1e-12)
+
+    f1 = timebase.estimate_data_floor(
+        slices=slices, build_macrostate=_single_param, moduli_grid=GRID, tolerance=0.05
+    )
+    f2 = timebase.estimate_data_floor(
+        slices=slices, build_macrostates=_batch_param, moduli_grid=GRID, tolerance=0.05
+    )
+    assert f1["min_slice_index"] == f2["min_slice_index"]
+    assert np.allclose(f1["dispersion_curve"], f2["dispersion_curve"], rtol=0, atol=1e-12)
+
+    e1 = timebase.estimate_noise_floor(
+        reference_slices=slices, build_macrostate=_single_param, moduli_grid=GRID
+    )
+    e2 = timebase.estimate_noise_floor(
+        reference_slices=slices, build_macrostates=_batch_param, moduli_grid=GRID
+    )
+    assert e1 == pytest.approx(e2, abs=1e-12)
+
+    r1 = timebase.compute_resolution_ratios(
+        stream=stream, candidate_ticks=[1, 2], build_macrostate=_single, noise_floor=e1
+    )
+    r2 = timebase.compute_resolution_ratios(
+        stream=stream,
+        candidate_ticks=[1, 2],
+        build_macrostates=timebase.field_summary_macrostates,
+        noise_floor=e1,
+    )
+    assert r1.keys() == r2.keys()
+    for dt in r1:
+        assert r1[dt] == pytest.approx(r2[dt], rel=1e-10)
+
+    with pytest.raises(ValueError):
+        build_path(stream=stream, dt=1)
+
+
+def test_dispersion_batch_matches_single():
+    rng = np.random.default_rng(2)
+    stack = rng.standard_normal((7, 4, 3))
+    for norm in ("l2", "linf"):
+        batch = timebase.macrostate_dispersion_batch(stack, norm)
+        single = [timebase.macrostate_dispersion(list(stack[t]), norm=norm) for t in range(7)]
+        assert np.allclose(batch, single, rtol=0, atol=1e-12)
+    assert np.array_equal(timebase.macrostate_dispersion_batch(stack[:, :1]), np.zeros(7))
@@ -0,0 +1,174 @@
+# hil/tests/test_sparse_structure.py
+"""
+Sparse structure test: kNN and threshold cosine graphs.
+
+Purpose:
+- Verify that sparse structure modes keep exactly the declared neighbours
+- Verify CSR layout (ascending rows, consistent offsets)
+- Verify weights agree with the complete cosine graph
+- Verify the native complete-graph builder matches the NumPy path in edge
+  order, index dtype and weights
+- Verify CSRGraph.from_graph stores every edge in both rows, in edge-list
+  order, keeping duplicates and self-loops, on both backends
+
+This test does NOT:
+- interpret graph structure
+- assert regimes, labels, or thresholds on diagnostics
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.api import CoreField, build_structure, build_structure_csr  # noqa: E402
+from hil.core.structure.graph import CSRGraph, Graph  # noqa: E402
+
+
+# ---- Utilities -------------------------------------------------------------
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _field(n: int = 40, d: int = 6, seed: int = 0) -> CoreField:
+    rng = np.random.default_rng(seed)
+    return CoreField(vectors=rng.standard_normal((n, d)))
+
+
+def _dense_weights(field: CoreField) -> np.ndarray:
+    X = field.vectors
+    norms = np.linalg.norm(X, axis=1, keepdims=True)
+    norms[norms == 0.0] = 1.0
+    V = X / norms
+    return ((V @ V.T) + 1.0) * 0.5
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_complete_structure_edge_ordering():
+    """
+    The complete graph lists every pair i < j in row-major order.
+    """
+    field = _field(n=7)
+    graph = build_structure(field)
+
+    iu, ju = np.triu_indices(7, k=1)
+    assert np.array_equal(graph.src, iu)
+    assert np.array_equal(graph.dst, ju)
+    assert np.allclose(graph.weight, _dense_weights(field)[iu, ju], atol=1e-12)
+
+
+def test_knn_structure_keeps_top_k():
+    """
+    Each row keeps exactly its k highest-weight neighbours, in ascending order.
+    """
+    field = _field()
+    k = 5
+    csr = build_structure_csr(field, k=k)
+    W = _dense_weights(field)
+    np.fill_diagonal(W, -np.inf)
+
+    assert csr.num_edges == field.vectors.shape[0] * k
+
+    for i in range(csr.num_nodes):
+        row = csr.indices[int(csr.offsets[i]):int(csr.offsets[i + 1])]
+        assert row.size == k
+        assert np.all(np.diff(row.astype(np.int64)) > 0)
+        assert i not in set(row.tolist())
+
+        expected = np.sort(np.argsort(-W[i], kind="stable")[:k])
+        assert np.array_equal(row, expected)
+
+
+def test_threshold_structure_respects_cutoff():
+    """
+    Threshold mode keeps every neighbour at or above the cutoff and no others.
+    """
+    field = _field()
+    cutoff = 0.6
+    graph = build_structure(field, method="threshold", min_weight=cutoff)
+    W = _dense_weights(field)
+    np.fill_diagonal(W, -np.inf)
+
+    assert graph.num_edges == int((W >= cutoff).sum())
+    assert np.all(graph.weight >= cutoff)
+    assert np.allclose(graph.weight, W[graph.src, graph.dst], atol=1e-12)
+
+
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+def test_native_complete_structure_matches_numpy(dtype, monkeypatch):
+    """
+    The tiled native builder (n spans several 64-row tiles) emits the same
+    edges, in the same order and dtypes, as the NumPy row-block fallback.
+    """
+    _shim = _require_native()
+    field = CoreField(vectors=_field(n=150, d=9, seed=3).vectors.astype(dtype))
+    native = build_structure(field)
+
+    def _unavailable(*args, **kwargs):
+        raise _shim.NativeUnavailable("forced NumPy path")
+
+    monkeypatch.setattr(_shim, "graph_build_cosine", _unavailable)
+    fallback = build_structure(field)
+
+    assert native.src.dtype == fallback.src.dtype == np.uint32
+    assert native.dst.dtype == fallback.dst.dtype == np.uint32
+    assert native.weight.dtype == fallback.weight.dtype == np.dtype(dtype)
+    assert np.array_equal(native.src, fallback.src)
+    assert np.array_equal(native.dst, fallback.dst)
+    # Both round the same float64 cosine; they differ only by BLAS summation
+    # order, which float32 storage can turn into one ulp.
+    atol = 1e-12 if dtype is np.float64 else float(np.finfo(np.float32).eps)
+    assert np.allclose(native.weight, fallback.weight, rtol=0.0, atol=atol)
+
+
+def test_symmetric_view_keeps_duplicates_and_order(monkeypatch):
+    """
+    Edge (s, d, w) lands in row s as (d, w) and in row d as (s, w), rows in
+    edge-list order. Duplicates, reversed pairs and self-loops (stored twice)
+    are kept; node 4 is isolated.
+    """
+    _shim = _require_native()
+    graph = Graph(
+        src=np.array([0, 1, 0, 2, 3, 1], dtype=np.uint32),
+        dst=np.array([1, 0, 1, 2, 1, 3], dtype=np.uint32),
+        weight=np.array([0.1, 0.2, 0.3, 0.4, 0.5, 0.6]),
+        num_nodes=5,
+    )
+    rows = [[] for _ in range(graph.num_nodes)]
+    for s, d, w in zip(graph.src.tolist(), graph.dst.tolist(), graph.weight.tolist()):
+        rows[s].append((d, w))
+        rows[d].append((s, w))
+
+    native = CSRGraph.from_graph(graph)
+
+    def _unavailable(*args, **kwargs):
+        raise _shim.NativeUnavailable("forced NumPy path")
+
+    monkeypatch.setattr(_shim, "graph_build_csr", _unavailable)
+    fallback = CSRGraph.from_graph(graph)
+
+    for csr in (native, fallback):
+        assert csr.symmetric and csr.num_edges == 2 * graph.num_edges
+        for i, want in enumerate(rows):
+            lo, hi = int(csr.offsets[i]), int(csr.offsets[i + 1])
+            got = list(zip(csr.indices[lo:hi].tolist(), csr.weight[lo:hi].tolist()))
+            assert got == want
@@ -0,0 +1,92 @@
+# hil/tests/test_stage_cache.py
+"""
+Stage cache test: keys, hits and round trips.
+
+Purpose:
+- Verify a stage key changes with config, inputs, upstream key, hil
+  sources and native fingerprint, and is stable otherwise
+- Verify field, graph and JSON stage outputs round-trip exactly and are
+  recorded as misses then hits
+- Verify an unreadable entry is treated as a miss
+
+This test does NOT:
+- run hil_build or compute diagnostics
+"""
+
+from __future__ import annotations
+
+import json
+import sys
+from pathlib import Path
+
+import numpy as np
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.build import stage_cache  # noqa: E402
+from hil.build.stage_cache import StageCache, stage_key  # noqa: E402
+from hil.core.api import CoreField, build_structure  # noqa: E402
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_stage_key_tracks_every_input(monkeypatch):
+    base = stage_key("field", config={"k": 8}, inputs={"a": "1"}, native="n0")
+    assert base == stage_key("field", config={"k": 8}, inputs={"a": "1"}, native="n0")
+    assert base != stage_key("field", config={"k": 9}, inputs={"a": "1"}, native="n0")
+    assert base != stage_key("field", config={"k": 8}, inputs={"a": "2"}, native="n0")
+    assert base != stage_key("field", config={"k": 8}, inputs={"a": "1"}, native="n1")
+    assert base != stage_key("field", config={"k": 8}, inputs={"a": "1"}, upstream="u", native="n0")
+    assert base != stage_key("graph", config={"k": 8}, inputs={"a": "1"}, native="n0")
+
+    monkeypatch.setattr(stage_cache, "code_fingerprint", lambda: "edited")
+    assert base != stage_key("field", config={"k": 8}, inputs={"a": "1"}, native="n0")
+
+
+def test_field_graph_json_roundtrip(tmp_path):
+    rng = np.random.default_rng(0)
+    field = CoreField(vectors=rng.standard_normal((20, 6)).astype(np.float32))
+    graph = build_structure(field, method="knn", k=4)
+    cache = StageCache(tmp_path / "cache")
+
+    assert cache.load_field("field", "f", dtype=np.float32) is None
+    assert cache.load_graph("structure", "g", dtype=np.float32) is None
+    assert cache.load_json("diagnostics", "d") is None
+    assert not any(r["hit"] for r in cache.record.values())
+
+    cache.store_field("field", "f", field.vectors)
+    cache.store_graph("structure", "g", graph)
+    cache.store_json("diagnostics", "d", {"x": [1.5, 2.0]})
+
+    vectors = cache.load_field("field", "f", dtype=np.float32)
+    assert vectors.dtype == np.float32
+    assert np.array_equal(vectors, field.vectors)
+
+    cached = cache.load_graph("structure", "g", dtype=np.float32)
+    assert cached.num_nodes == graph.num_nodes
+    assert np.array_equal(cached.src, graph.src)
+    assert np.array_equal(cached.dst, graph.dst)
+    assert cached.weight.dtype == graph.weight.dtype
+    assert np.array_equal(cached.weight, graph.weight)
+
+    assert cache.load_json("diagnostics", "d") == {"x": [1.5, 2.0]}
+    assert all(r["hit"] for r in cache.record.values())
+    assert not list((tmp_path / "cache").rglob("*.tmp"))
+
+
+def test_corrupt_entry_is_a_miss(tmp_path):
+    cache = StageCache(tmp_path)
+    path = cache.store_json("diagnostics", "d", {"x": 1})
+    path.write_text("{not json", encoding="utf-8")
+    assert cache.load_json("diagnostics", "d") is None
+
+    path = cache.store_field("field", "f", np.ones((3, 2)))
+    path.write_bytes(path.read_bytes()[:16])
+    assert cache.load_field("field", "f") is None
+    assert cache.record["field"] == {"key": "f", "hit": False}
+    json.dumps(cache.record)
@@ -0,0 +1,73 @@
+# hil/tests/test_term_document.py
+"""
+Term-document builder test.
+
+Purpose:
+- Verify build_term_document matches the Python tokenizer and counter
+  (vocabulary order and per-document counts), whichever backend runs
+- Verify build_vocabulary is the term-document vocabulary
+
+This test does NOT:
+- weight or interpret tokens
+"""
+
+from __future__ import annotations
+
+import sys
+from collections import Counter
+from pathlib import Path
+
+import numpy as np
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+from hil.core.embeddings.vocabulary import (  # noqa: E402
+    build_term_document,
+    build_vocabulary,
+    tokenize,
+)
+
+
+# ---- Tests -----------------------------------------------------------------
+
+DOCS = [
+    "The field, the FIELD and the graph_2.",
+    "",
+    "İstanbul Kelvin café -- x x x",
+    "graph_2 graph_2 field",
+]
+
+
+def test_term_document_matches_reference():
+    """
+    Vocabulary order is (-count, token); rows hold sorted (index, count).
+    """
+    td = build_term_document(DOCS, min_count=1)
+
+    per_doc = [Counter(tokenize(d)) for d in DOCS]
+    total = sum(per_doc, Counter())
+    expected_terms = sorted(total, key=lambda t: (-total[t], t))
+
+    assert list(td.vocabulary) == expected_terms
+    assert td.shape == (len(DOCS), len(expected_terms))
+    assert td.offsets.dtype == np.uint64 and td.indices.dtype == np.uint32
+
+    for i, c in enumerate(per_doc):
+        lo, hi = int(td.offsets[i]), int(td.offsets[i + 1])
+        row = sorted((td.vocabulary[t], float(n)) for t, n in c.items())
+        assert list(zip(td.indices[lo:hi].tolist(), td.counts[lo:hi].tolist())) == row
+
+
+def test_vocabulary_filters():
+    """
+    min_count and max_vocab_size prune the same prefix in both entrypoints.
+    """
+    td = build_term_document(DOCS, min_count=2, max_vocab_size=2)
+    assert td.vocabulary == build_vocabulary(DOCS, min_count=2, max_vocab_size=2)
+    assert len(td.vocabulary) == 2
+    assert int(td.indices.max()) < 2
@@ -0,0 +1,73 @@
+# hil/tests/test_vec_kernels.py
+"""
+Vector kernel test: dispatched dot products against the canonical order.
+
+Purpose:
+- Verify the dot kernel selected at load time (scalar, AVX2, AVX-512 or
+  NEON), and its fixed-length variants, equal the scalar canonical lane
+  order bit for bit, for float64 and float32 inputs
+- Cover lengths below one lane block, ragged tails and every fixed length
+
+This test does NOT:
+- exercise backends other than the one this host selects
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+LANES = 16
+LENGTHS = list(range(0, 41)) + [63, 64, 65, 128, 256, 300, 384, 768, 1000]
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _canonical_dot(a: np.ndarray, b: np.ndarray) -> float:
+    """Element i into lane i mod 16, then lanes k += k + w for w = 8, 4, 2, 1."""
+    lanes = [0.0] * LANES
+    for i, (x, y) in enumerate(zip(a.tolist(), b.tolist())):
+        lanes[i % LANES] += x * y
+    w = LANES // 2
+    while w:
+        for k in range(w):
+            lanes[k] += lanes[k + w]
+        w //= 2
+    return lanes[0]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+@pytest.mark.parametrize("dtype", [np.float64, np.float32])
+def test_dispatched_dot_matches_canonical_order(dtype):
+    _shim = _require_native()
+    if _shim.vec_backend() == "sequential":
+        pytest.skip("built with HIL_SEQUENTIAL_REDUCTION")
+
+    rng = np.random.default_rng(8)
+    for n in LENGTHS:
+        a = rng.standard_normal(n).astype(dtype)
+        b = rng.standard_normal(n).astype(dtype)
+        want = _canonical_dot(a, b)
+        dot, dot_for = _shim.vec_dot(a, b)
+        assert dot == want, (n, dtype)
+        assert dot_for == want, (n, dtype)
@@ -0,0 +1,122 @@
+# hil/tests/test_workspace_reuse.py
+"""
+Workspace reuse test: repeated _ws calls share one scratch arena.
+
+Purpose:
+- Verify graph_entropy, graph_metrics, graph_components and field_summary
+  give identical results with a reused workspace and without one
+- Verify the arena settles after the first call: no overflow blocks and a
+  fixed capacity across further repeats
+- Verify a larger input grows the arena and smaller inputs keep it
+
+This test does NOT:
+- measure allocation time
+"""
+
+from __future__ import annotations
+
+import sys
+from pathlib import Path
+
+import numpy as np
+import pytest
+
+
+# ---- Repository root resolution --------------------------------------------
+
+REPO_ROOT = Path(__file__).resolve().parents[2]
+if str(REPO_ROOT) not in sys.path:
+    sys.path.insert(0, str(REPO_ROOT))
+
+
+def _require_native():
+    """The native shim, or skip: importing it fails when _native is not built."""
+    try:
+        from hil.core.native import _shim  # noqa: WPS433
+
+        _shim._require_native()
+    except (ImportError, RuntimeError):
+        pytest.skip("native extension not built")
+    return _shim
+
+
+def _edges(n: int, m: int, seed: int):
+    rng = np.random.default_rng(seed)
+    src = rng.integers(0, n, size=m).astype(np.uint32)
+    dst = rng.integers(0, n, size=m).astype(np.uint32)
+    return src, dst, rng.random(m)
+
+
+def _calls(_shim, n: int, seed: int, workspace):
+    """One round of every workspace-aware kernel."""
+    src, dst, w = _edges(n, 2 * n, seed)
+    X = np.random.default_rng(seed).standard_normal((n, 6))
+    count, labels, sizes = _shim.graph_components(src, dst, w, n, workspace=workspace)
+    summary = _shim.field_summary(X, return_row_norms=True, workspace=workspace)
+    return [
+        _shim.graph_entropy(src, dst, w, n, workspace=workspace),
+        _shim.graph_entropy(src, dst, w.astype(np.float32), n, workspace=workspace),
+        _shim.graph_metrics(src, dst, w, n, workspace=workspace),
+        _shim.graph_metrics(src, dst, w.astype(np.float32), n, workspace=workspace),
+        (count, labels.tolist(), sizes.tolist()),
+        {k: (v.tolist() if isinstance(v, np.ndarray) else v) for k, v in summary.items()},
+        _shim.field_summary(X.astype(np.float32), workspace=workspace),
+    ]
+
+
+# ---- Tests -----------------------------------------------------------------
+
+def test_reused_workspace_matches_temporary():
+    _shim = _require_native()
+    ws = _shim.workspace_new()
+    expected = _calls(_shim, 300, 1, None)
+    for _ in range(3):
+        assert _calls(_shim, 300, 1, ws) == expected
+
+
+def test_arena_settles_after_first_call():
+    _shim = _require_native()
+    ws = _shim.workspace_new()
+    _calls(_shim, 300, 2, ws)
+    _calls(_shim, 300, 2, ws)
+    settled = _shim.workspace_info(ws)
+    assert settled["capacity"] >= settled["peak"] > 0
+    assert settled["overflow"] == 0
+
+    for _ in range(3):
+        _calls(_shim, 300, 2, ws)
+        assert _shim.workspace_info(ws) == settled
+
+
+def test_arena_grows_for_larger_input():
+    _shim = _require_native()
+    ws = _shim.workspace_new()
+    _calls(_shim, 100, 3, ws)
+    _calls(_shim, 100, 3, ws)
+    small = _shim.workspace_info(ws)["capacity"]
+
+    expected = _calls(_shim, 2000, 3, None)
+    assert _calls(_shim, 2000, 3, ws) == expected
+    assert _calls(_shim, 2000, 3, ws) == expected
+    large = _shim.workspace_info(ws)
+    assert large["capacity"] > small
+    assert large["overflow"] == 0
+
+    _calls(_shim, 100, 3, ws)
+    assert _shim.workspace_info(ws)["capacity"] == large["capacity"]
+
+
+def test_initial_bytes_avoid_overflow():
+    _shim = _require_native()
+    probe = _shim.workspace_new()
+    _calls(_shim, 300, 4, probe)
+    peak = _shim.workspace_info(probe)["peak"]
+
+    ws = _shim.workspace_new(peak)
+    _calls(_shim, 300, 4, ws)
+    info = _shim.workspace_info(ws)
+    assert info["capacity"] >= peak
+    assert info["overflow"] == 0
+
+    with pytest.raises(ValueError):
+        _shim.workspace_new(-1)
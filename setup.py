@@ -0,0 +1,100 @@
+# setup.py
+"""
+Build definition for the HIL reference implementation.
+
+The only compiled component is the optional native kernel extension
+`hil.core.native._native` (see hil/core/native/README.md). Everything else
+is pure Python.
+
+    pip install -e .                      # editable install, builds _native
+    python setup.py build_ext --inplace   # build _native next to the sources
+
+Environment switches (read at build time):
+- HIL_STATS=1      compile the per-kernel counters (-DHIL_STATS)
+- HIL_NO_OPENMP=1  build single-threaded even when OpenMP is available
+
+OpenMP is used when the compiler accepts -fopenmp; otherwise the kernels
+build serial, with identical results.
+"""
+
+from __future__ import annotations
+
+import os
+import sys
+import tempfile
+
+from setuptools import Extension, find_packages, setup
+from setuptools.command.build_ext import build_ext
+
+
+NATIVE_DIR = os.path.join("hil", "core", "native")
+
+NATIVE_SOURCES = [
+    os.path.join(NATIVE_DIR, "hilbert_native.c"),
+    os.path.join(NATIVE_DIR, "hilbert_math.c"),
+    os.path.join(NATIVE_DIR, "hilbert_lexicon.c"),
+    os.path.join(NATIVE_DIR, "hilbert_ann.c"),
+    os.path.join(NATIVE_DIR, "pybind", "hil_native_module.c"),
+]
+
+
+def _flag(name: str) -> bool:
+    return os.environ.get(name, "") == "1"
+
+
+class _BuildNative(build_ext):
+    """build_ext that adds OpenMP when the compiler supports it."""
+
+    def _accepts(self, compile_args, link_args) -> bool:
+        with tempfile.TemporaryDirectory() as tmp:
+            src = os.path.join(tmp, "omp_probe.c")
+            with open(src, "w", encoding="ascii") as f:
+                f.write("#include <omp.h>\nint main(void) { return omp_get_max_threads() < 1; }\n")
+            try:
+                objs = self.compiler.compile([src], output_dir=tmp, extra_postargs=compile_args)
+                self.compiler.link_executable(
+                    objs, "omp_probe", output_dir=tmp, extra_postargs=link_args
+                )
+            except Exception:
+                return False
+        return True
+
+    def build_extensions(self) -> None:
+        if self.compiler.compiler_type == "msvc":
+            compile_args, link_args = ["/O2"], []
+            omp = (["/openmp"], [])
+        else:
+            compile_args, link_args = ["-std=c11", "-O2"], []
+            omp = (["-fopenmp"], ["-fopenmp"])
+
+        if not _flag("HIL_NO_OPENMP") and self._accepts(*omp):
+            compile_args += omp[0]
+            link_args += omp[1]
+        else:
+            sys.stderr.write("hil: building _native without OpenMP (serial kernels)\n")
+
+        for ext in self.extensions:
+            ext.extra_compile_args = compile_args + list(ext.extra_compile_args or [])
+            ext.extra_link_args = link_args + list(ext.extra_link_args or [])
+        super().build_extensions()
+
+
+native = Extension(
+    "hil.core.native._native",
+    sources=NATIVE_SOURCES,
+    include_dirs=[NATIVE_DIR],
+    define_macros=[("HIL_STATS", "1")] if _flag("HIL_STATS") else [],
+    libraries=[] if os.name == "nt" else ["m"],
+)
+
+
+setup(
+    name="hil",
+    version="1.0.0",
+    description="Hilbert Information Lab reference implementation",
+    packages=find_packages(include=["hil", "hil.*"]),
+    python_requires=">=3.9",
+    install_requires=["numpy"],
+    ext_modules=[native],
+    cmdclass={"build_ext": _BuildNative},
+)